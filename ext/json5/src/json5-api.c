@@ -75,22 +75,19 @@ IDIO idio_json5_string_value_to_idio (json5_unicode_string_t *js)
 {
     IDIO_C_ASSERT (js);
 
-    IDIO so = idio_gc_get (IDIO_TYPE_STRING);
-    so->vtable = idio_vtable (IDIO_TYPE_STRING);
-    IDIO_STRING_LEN (so) = js->len;
-
+    IDIO_FLAGS_T flags;
     size_t reqd_bytes = js->len;
     switch (js->width) {
     case JSON5_UNICODE_STRING_WIDTH_1BYTE:
-	IDIO_STRING_FLAGS (so) = IDIO_STRING_FLAG_1BYTE;
+	flags = IDIO_STRING_FLAG_1BYTE;
 	reqd_bytes *= 1;
 	break;
     case JSON5_UNICODE_STRING_WIDTH_2BYTE:
-	IDIO_STRING_FLAGS (so) = IDIO_STRING_FLAG_2BYTE;
+	flags = IDIO_STRING_FLAG_2BYTE;
 	reqd_bytes *= 2;
 	break;
     case JSON5_UNICODE_STRING_WIDTH_4BYTE:
-	IDIO_STRING_FLAGS (so) = IDIO_STRING_FLAG_4BYTE;
+	flags = IDIO_STRING_FLAG_4BYTE;
 	reqd_bytes *= 4;
 	break;
     default:
@@ -102,8 +99,13 @@ IDIO idio_json5_string_value_to_idio (json5_unicode_string_t *js)
 	return idio_S_notreached;
     }
 
-    IDIO_GC_ALLOC (IDIO_STRING_S (so), reqd_bytes + 1);
-    IDIO_STRING_BLEN (so) = reqd_bytes;
+    idio_string_check_blen (reqd_bytes);
+
+    IDIO so = idio_gc_get (IDIO_TYPE_STRING);
+    IDIO_STRING_LEN (so) = js->len;
+    IDIO_STRING_FLAGS (so) = flags;
+
+    idio_string_alloc_s (so, reqd_bytes);
 
     memcpy (IDIO_STRING_S (so), js->s, reqd_bytes);
     IDIO_STRING_S (so)[reqd_bytes] = '\0';
@@ -237,13 +239,15 @@ void idio_print_hash_as_json (IDIO h, IDIO oh, int json5, int depth)
 
     IDIO_TYPE_ASSERT (hash, h);
 
+    idio_hash_migrate_all (h);
+
     int printed = 0;
     idio_display_C ("{", oh);
 
     idio_hi_t i;
     for (i = 0; i < IDIO_HASH_SIZE (h); i++) {
-	idio_hash_entry_t *he = IDIO_HASH_HA (h, i);
-	for ( ; NULL != he; he = IDIO_HASH_HE_NEXT (he)) {
+	idio_hash_entry_t *he = IDIO_HASH_HE (h, i);
+	if (IDIO_HASH_HE_LIVE_P (he)) {
 	    IDIO k = IDIO_HASH_HE_KEY (he);
 	    if (idio_isa_string (k) ||
 		idio_isa_symbol (k)) {
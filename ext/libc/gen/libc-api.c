@@ -0,0 +1,10121 @@
+
+/*
+ * libc-api.c
+ *
+ *
+ * This file was generated by idio-c-api-gen on a Linux 6.18.44-fc-v139 x86_64 system
+ */
+
+#define _GNU_SOURCE
+
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/statvfs.h>
+#include <sys/time.h>
+#include <sys/resource.h>
+#include <sys/times.h>
+#include <sys/utsname.h>
+#include <sys/wait.h>
+
+#include <assert.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <setjmp.h>
+#include <signal.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "idio-system.h"
+#include "idio-config.h"
+
+#include "gc.h"
+#include "idio.h"
+
+#include "c-type.h"
+#include "error.h"
+#include "evaluate.h"
+#include "fixnum.h"
+#include "handle.h"
+#include "hash.h"
+#include "idio-string.h"
+#include "job-control.h"
+#include "libc-wrap.h"
+#include "module.h"
+#include "pair.h"
+#include "path.h"
+#include "string-handle.h"
+#include "symbol.h"
+#include "util.h"
+#include "vm.h"
+#include "vtable.h"
+
+#include "libc-api.h"
+
+
+/*
+	/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h
+
+	struct	{
+	  long unsigned int[]  __val;
+	};
+*/
+
+
+/*
+	/usr/include/grp.h
+
+	struct group
+	{
+	  char*                gr_name;
+	  char*                gr_passwd;
+	  __gid_t              gr_gid;
+	  char**               gr_mem;
+	};
+*/
+
+IDIO_C_STRUCT_IDENT_DECL (libc_struct_group);
+IDIO_SYMBOL_DECL (gr_name);
+IDIO_SYMBOL_DECL (gr_passwd);
+IDIO_SYMBOL_DECL (gr_gid);
+IDIO_SYMBOL_DECL (gr_mem);
+
+IDIO_DEFINE_PRIMITIVE2_DS ("struct-group-ref", libc_struct_group_ref, (IDIO group, IDIO member), "group member", "\
+in C, :samp:`{group}->{member}`			\n\
+					\n\
+:param group: :ref:`struct-group <libc/struct-group>`	\n\
+:type group: C/pointer		\n\
+:param member: member name		\n\
+:type member: symbol			\n\
+:return: `group` -> `member`		\n\
+:rtype:	varies on `member`		\n\
+")
+{
+    IDIO_ASSERT (group);
+    IDIO_ASSERT (member);
+
+    /*
+     * Test Case: libc-errors/struct-group-ref-bad-pointer-type.idio
+     *
+     * struct-group-ref #t #t
+     */
+    IDIO_USER_C_TYPE_ASSERT (pointer, group);
+    if (idio_CSI_libc_struct_group != IDIO_C_TYPE_POINTER_PTYPE (group)) {
+	/*
+	 * Test Case: libc-errors/struct-group-ref-invalid-pointer-type.idio
+	 *
+	 * struct-group-ref libc/NULL #t
+	 */
+	idio_error_param_value_exp ("struct-group-ref", "group", group, "C struct group", IDIO_C_FUNC_LOCATION ());
+
+	return idio_S_notreached;
+    }
+
+    /*
+     * Test Case: libc-errors/struct-group-ref-bad-member-type.idio
+     *
+     * struct-group-ref v #t
+     */
+    IDIO_USER_TYPE_ASSERT (symbol, member);
+
+    struct group *groupp = IDIO_C_TYPE_POINTER_P (group);
+    if (idio_S_gr_name == member) {
+        /*
+         * WARNING:
+         * char* gr_name
+         *
+         * sizeof (groupp->gr_name) is dubious
+         *
+         * check the API
+         */
+        size_t slen = sizeof (groupp->gr_name);
+        char* rp = (char*) idio_alloc (slen);
+        memcpy ((void *) rp, (void *) &groupp->gr_name, slen);
+    } else if (idio_S_gr_passwd == member) {
+        /*
+         * WARNING:
+         * char* gr_passwd
+         *
+         * sizeof (groupp->gr_passwd) is dubious
+         *
+         * check the API
+         */
+        size_t slen = sizeof (groupp->gr_passwd);
+        char* rp = (char*) idio_alloc (slen);
+        memcpy ((void *) rp, (void *) &groupp->gr_passwd, slen);
+    } else if (idio_S_gr_gid == member) {
+        return idio_libc___gid_t (groupp->gr_gid);
+    } else if (idio_S_gr_mem == member) {
+        /*
+         * WARNING:
+         * char** gr_mem
+         *
+         * sizeof (groupp->gr_mem) is dubious
+         *
+         * check the API
+         */
+        size_t slen = sizeof (groupp->gr_mem);
+        char** rp = (char**) idio_alloc (slen);
+        memcpy ((void *) rp, (void *) &groupp->gr_mem, slen);
+    } else {
+	/*
+	 * Test Case: libc-errors/struct-group-ref-invalid-member.idio
+	 *
+	 * struct-group-ref v 'not-likely
+	 */
+        idio_error_param_value_exp ("struct-group-ref", "member", member, "C struct group member", IDIO_C_FUNC_LOCATION());
+
+        return idio_S_notreached;
+    }
+
+    return idio_S_notreached;
+}
+
+IDIO_DEFINE_PRIMITIVE3_DS ("struct-group-set!", libc_struct_group_set, (IDIO group, IDIO member, IDIO val), "group member val", "\
+in C, :samp:`{group}->{member} = {val}`		\n\
+					\n\
+:param group: :ref:`struct-group <libc/struct-group>`	\n\
+:type group: C/pointer		\n\
+:param member: member name		\n\
+:type member: symbol			\n\
+:param val: a C/ type			\n\
+:type val: varies on `member`		\n\
+:return: #<unspec>		\n\
+")
+{
+    IDIO_ASSERT (group);
+    IDIO_ASSERT (member);
+    IDIO_ASSERT (val);
+
+
+    /*
+     * Test Case: libc-errors/struct-group-set-bad-pointer-type.idio
+     *
+     * struct-group-set! #t #t #t
+     */
+    IDIO_USER_C_TYPE_ASSERT (pointer, group);
+    if (idio_CSI_libc_struct_group != IDIO_C_TYPE_POINTER_PTYPE (group)) {
+	/*
+	 * Test Case: libc-errors/struct-group-set-invalid-pointer-type.idio
+	 *
+	 * struct-group-set! libc/NULL #t #t
+	 */
+	idio_error_param_value_exp ("struct-group-set!", "group", group, "C struct group", IDIO_C_FUNC_LOCATION ());
+
+	return idio_S_notreached;
+    }
+
+    /*
+     * Test Case: libc-errors/struct-group-set-bad-member-type.idio
+     *
+     * struct-group-set! v #t #t
+     */
+    IDIO_USER_TYPE_ASSERT (symbol, member);
+
+    struct group *groupp = IDIO_C_TYPE_POINTER_P (group);
+    if (idio_S_gr_name == member) {
+       /*
+	* Test Case: libc-errors/struct-group-set-gr_name-bad-value-type.idio
+	*
+	* struct-group-set! v 'gr_name #t
+	*/
+	IDIO_USER_C_TYPE_ASSERT (pointer, val);
+
+        /*
+         * WARNING:
+         * char* gr_name
+         *
+         * sizeof (groupp->gr_name) is dubious
+         *
+         * check the API
+         */
+        char* valp = IDIO_C_TYPE_POINTER_P (val);
+        size_t slen = sizeof (groupp->gr_name);
+        memcpy ((void *) &groupp->gr_name, (void *) valp, slen);
+        return idio_S_unspec;
+    } else if (idio_S_gr_passwd == member) {
+       /*
+	* Test Case: libc-errors/struct-group-set-gr_passwd-bad-value-type.idio
+	*
+	* struct-group-set! v 'gr_passwd #t
+	*/
+	IDIO_USER_C_TYPE_ASSERT (pointer, val);
+
+        /*
+         * WARNING:
+         * char* gr_passwd
+         *
+         * sizeof (groupp->gr_passwd) is dubious
+         *
+         * check the API
+         */
+        char* valp = IDIO_C_TYPE_POINTER_P (val);
+        size_t slen = sizeof (groupp->gr_passwd);
+        memcpy ((void *) &groupp->gr_passwd, (void *) valp, slen);
+        return idio_S_unspec;
+    } else if (idio_S_gr_gid == member) {
+       /*
+	* Test Case: libc-errors/struct-group-set-gr_gid-bad-value-type.idio
+	*
+	* struct-group-set! v 'gr_gid #t
+	*/
+	IDIO_USER_libc_TYPE_ASSERT (__gid_t, val);
+
+        groupp->gr_gid = IDIO_C_TYPE_libc___gid_t (val);
+        return idio_S_unspec;
+    } else if (idio_S_gr_mem == member) {
+       /*
+	* Test Case: libc-errors/struct-group-set-gr_mem-bad-value-type.idio
+	*
+	* struct-group-set! v 'gr_mem #t
+	*/
+	IDIO_USER_C_TYPE_ASSERT (pointer, val);
+
+        /*
+         * WARNING:
+         * char** gr_mem
+         *
+         * sizeof (groupp->gr_mem) is dubious
+         *
+         * check the API
+         */
+        char** valp = IDIO_C_TYPE_POINTER_P (val);
+        size_t slen = sizeof (groupp->gr_mem);
+        memcpy ((void *) &groupp->gr_mem, (void *) valp, slen);
+        return idio_S_unspec;
+    } else {
+	/*
+	 * Test Case: libc-errors/struct-group-set-invalid-member.idio
+	 *
+	 * struct-group-set! v 'not-likely #t
+	 */
+        idio_error_param_value_exp ("struct-group-set!", "member", member, "C struct group member", IDIO_C_FUNC_LOCATION());
+
+        return idio_S_notreached;
+    }
+
+    return idio_S_notreached;
+}
+
+IDIO idio_libc_struct_group_as_string (struct group *groupp)
+{
+    IDIO_C_ASSERT (groupp);
+
+    IDIO CSI_sh = idio_open_output_string_handle_C ();
+    idio_display_C ("#<CSI libc/struct-group", CSI_sh);
+
+    char buf[BUFSIZ];
+    char *fmt;
+
+    idio_display_C (" gr_name:", CSI_sh);
+
+    idio_display_C (groupp->gr_name, CSI_sh);
+
+    idio_display_C (" gr_passwd:", CSI_sh);
+
+    idio_display_C (groupp->gr_passwd, CSI_sh);
+
+    idio_display_C (" gr_gid:", CSI_sh);
+
+    fmt = idio_C_type_format_string (IDIO_TYPE_C_libc___gid_t);
+    idio_snprintf (buf, BUFSIZ, fmt, groupp->gr_gid);
+    idio_display_C (buf, CSI_sh);
+    idio_free (fmt);
+
+    idio_display_C (" gr_mem:", CSI_sh);
+
+    idio_display_C ("<<2char**>>", CSI_sh);
+
+    idio_display_C (">", CSI_sh);
+
+    return idio_get_output_string (CSI_sh);
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("struct-group-as-string", libc_struct_group_as_string, (IDIO group), "group", "\
+:param group: :ref:`struct-group <libc/struct-group>`	\n\
+:type group: C/pointer			\n\
+:return: string				\n\
+:rtype:	string				\n\
+")
+{
+    IDIO_ASSERT (group);
+
+    /*
+     * Test Case: libc-errors/struct-group-as-string-bad-pointer-type.idio
+     *
+     * struct-group-as-string #t
+     */
+    IDIO_USER_C_TYPE_ASSERT (pointer, group);
+    if (idio_CSI_libc_struct_group != IDIO_C_TYPE_POINTER_PTYPE (group)) {
+	/*
+	 * Test Case: libc-errors/struct-group-as-string-invalid-pointer-type.idio
+	 *
+	 * struct-group-as-string libc/NULL
+	 */
+	idio_error_param_value_exp ("struct-group-as-string", "group", group, "C struct group", IDIO_C_FUNC_LOCATION ());
+
+	return idio_S_notreached;
+    }
+
+    return idio_libc_struct_group_as_string (IDIO_C_TYPE_POINTER_P (group));
+}
+
+/*
+	/usr/include/pwd.h
+
+	struct passwd
+	{
+	  char*                pw_name;
+	  char*                pw_passwd;
+	  __uid_t              pw_uid;
+	  __gid_t              pw_gid;
+	  char*                pw_gecos;
+	  char*                pw_dir;
+	  char*                pw_shell;
+	};
+*/
+
+IDIO_C_STRUCT_IDENT_DECL (libc_struct_passwd);
+IDIO_SYMBOL_DECL (pw_name);
+IDIO_SYMBOL_DECL (pw_passwd);
+IDIO_SYMBOL_DECL (pw_uid);
+IDIO_SYMBOL_DECL (pw_gid);
+IDIO_SYMBOL_DECL (pw_gecos);
+IDIO_SYMBOL_DECL (pw_dir);
+IDIO_SYMBOL_DECL (pw_shell);
+
+IDIO_DEFINE_PRIMITIVE2_DS ("struct-passwd-ref", libc_struct_passwd_ref, (IDIO passwd, IDIO member), "passwd member", "\
+in C, :samp:`{passwd}->{member}`			\n\
+					\n\
+:param passwd: :ref:`struct-passwd <libc/struct-passwd>`	\n\
+:type passwd: C/pointer		\n\
+:param member: member name		\n\
+:type member: symbol			\n\
+:return: `passwd` -> `member`		\n\
+:rtype:	varies on `member`		\n\
+")
+{
+    IDIO_ASSERT (passwd);
+    IDIO_ASSERT (member);
+
+    /*
+     * Test Case: libc-errors/struct-passwd-ref-bad-pointer-type.idio
+     *
+     * struct-passwd-ref #t #t
+     */
+    IDIO_USER_C_TYPE_ASSERT (pointer, passwd);
+    if (idio_CSI_libc_struct_passwd != IDIO_C_TYPE_POINTER_PTYPE (passwd)) {
+	/*
+	 * Test Case: libc-errors/struct-passwd-ref-invalid-pointer-type.idio
+	 *
+	 * struct-passwd-ref libc/NULL #t
+	 */
+	idio_error_param_value_exp ("struct-passwd-ref", "passwd", passwd, "C struct passwd", IDIO_C_FUNC_LOCATION ());
+
+	return idio_S_notreached;
+    }
+
+    /*
+     * Test Case: libc-errors/struct-passwd-ref-bad-member-type.idio
+     *
+     * struct-passwd-ref v #t
+     */
+    IDIO_USER_TYPE_ASSERT (symbol, member);
+
+    struct passwd *passwdp = IDIO_C_TYPE_POINTER_P (passwd);
+    if (idio_S_pw_name == member) {
+        /*
+         * WARNING:
+         * char* pw_name
+         *
+         * sizeof (passwdp->pw_name) is dubious
+         *
+         * check the API
+         */
+        size_t slen = sizeof (passwdp->pw_name);
+        char* rp = (char*) idio_alloc (slen);
+        memcpy ((void *) rp, (void *) &passwdp->pw_name, slen);
+    } else if (idio_S_pw_passwd == member) {
+        /*
+         * WARNING:
+         * char* pw_passwd
+         *
+         * sizeof (passwdp->pw_passwd) is dubious
+         *
+         * check the API
+         */
+        size_t slen = sizeof (passwdp->pw_passwd);
+        char* rp = (char*) idio_alloc (slen);
+        memcpy ((void *) rp, (void *) &passwdp->pw_passwd, slen);
+    } else if (idio_S_pw_uid == member) {
+        return idio_libc___uid_t (passwdp->pw_uid);
+    } else if (idio_S_pw_gid == member) {
+        return idio_libc___gid_t (passwdp->pw_gid);
+    } else if (idio_S_pw_gecos == member) {
+        /*
+         * WARNING:
+         * char* pw_gecos
+         *
+         * sizeof (passwdp->pw_gecos) is dubious
+         *
+         * check the API
+         */
+        size_t slen = sizeof (passwdp->pw_gecos);
+        char* rp = (char*) idio_alloc (slen);
+        memcpy ((void *) rp, (void *) &passwdp->pw_gecos, slen);
+    } else if (idio_S_pw_dir == member) {
+        /*
+         * WARNING:
+         * char* pw_dir
+         *
+         * sizeof (passwdp->pw_dir) is dubious
+         *
+         * check the API
+         */
+        size_t slen = sizeof (passwdp->pw_dir);
+        char* rp = (char*) idio_alloc (slen);
+        memcpy ((void *) rp, (void *) &passwdp->pw_dir, slen);
+    } else if (idio_S_pw_shell == member) {
+        /*
+         * WARNING:
+         * char* pw_shell
+         *
+         * sizeof (passwdp->pw_shell) is dubious
+         *
+         * check the API
+         */
+        size_t slen = sizeof (passwdp->pw_shell);
+        char* rp = (char*) idio_alloc (slen);
+        memcpy ((void *) rp, (void *) &passwdp->pw_shell, slen);
+    } else {
+	/*
+	 * Test Case: libc-errors/struct-passwd-ref-invalid-member.idio
+	 *
+	 * struct-passwd-ref v 'not-likely
+	 */
+        idio_error_param_value_exp ("struct-passwd-ref", "member", member, "C struct passwd member", IDIO_C_FUNC_LOCATION());
+
+        return idio_S_notreached;
+    }
+
+    return idio_S_notreached;
+}
+
+IDIO_DEFINE_PRIMITIVE3_DS ("struct-passwd-set!", libc_struct_passwd_set, (IDIO passwd, IDIO member, IDIO val), "passwd member val", "\
+in C, :samp:`{passwd}->{member} = {val}`		\n\
+					\n\
+:param passwd: :ref:`struct-passwd <libc/struct-passwd>`	\n\
+:type passwd: C/pointer		\n\
+:param member: member name		\n\
+:type member: symbol			\n\
+:param val: a C/ type			\n\
+:type val: varies on `member`		\n\
+:return: #<unspec>		\n\
+")
+{
+    IDIO_ASSERT (passwd);
+    IDIO_ASSERT (member);
+    IDIO_ASSERT (val);
+
+
+    /*
+     * Test Case: libc-errors/struct-passwd-set-bad-pointer-type.idio
+     *
+     * struct-passwd-set! #t #t #t
+     */
+    IDIO_USER_C_TYPE_ASSERT (pointer, passwd);
+    if (idio_CSI_libc_struct_passwd != IDIO_C_TYPE_POINTER_PTYPE (passwd)) {
+	/*
+	 * Test Case: libc-errors/struct-passwd-set-invalid-pointer-type.idio
+	 *
+	 * struct-passwd-set! libc/NULL #t #t
+	 */
+	idio_error_param_value_exp ("struct-passwd-set!", "passwd", passwd, "C struct passwd", IDIO_C_FUNC_LOCATION ());
+
+	return idio_S_notreached;
+    }
+
+    /*
+     * Test Case: libc-errors/struct-passwd-set-bad-member-type.idio
+     *
+     * struct-passwd-set! v #t #t
+     */
+    IDIO_USER_TYPE_ASSERT (symbol, member);
+
+    struct passwd *passwdp = IDIO_C_TYPE_POINTER_P (passwd);
+    if (idio_S_pw_name == member) {
+       /*
+	* Test Case: libc-errors/struct-passwd-set-pw_name-bad-value-type.idio
+	*
+	* struct-passwd-set! v 'pw_name #t
+	*/
+	IDIO_USER_C_TYPE_ASSERT (pointer, val);
+
+        /*
+         * WARNING:
+         * char* pw_name
+         *
+         * sizeof (passwdp->pw_name) is dubious
+         *
+         * check the API
+         */
+        char* valp = IDIO_C_TYPE_POINTER_P (val);
+        size_t slen = sizeof (passwdp->pw_name);
+        memcpy ((void *) &passwdp->pw_name, (void *) valp, slen);
+        return idio_S_unspec;
+    } else if (idio_S_pw_passwd == member) {
+       /*
+	* Test Case: libc-errors/struct-passwd-set-pw_passwd-bad-value-type.idio
+	*
+	* struct-passwd-set! v 'pw_passwd #t
+	*/
+	IDIO_USER_C_TYPE_ASSERT (pointer, val);
+
+        /*
+         * WARNING:
+         * char* pw_passwd
+         *
+         * sizeof (passwdp->pw_passwd) is dubious
+         *
+         * check the API
+         */
+        char* valp = IDIO_C_TYPE_POINTER_P (val);
+        size_t slen = sizeof (passwdp->pw_passwd);
+        memcpy ((void *) &passwdp->pw_passwd, (void *) valp, slen);
+        return idio_S_unspec;
+    } else if (idio_S_pw_uid == member) {
+       /*
+	* Test Case: libc-errors/struct-passwd-set-pw_uid-bad-value-type.idio
+	*
+	* struct-passwd-set! v 'pw_uid #t
+	*/
+	IDIO_USER_libc_TYPE_ASSERT (__uid_t, val);
+
+        passwdp->pw_uid = IDIO_C_TYPE_libc___uid_t (val);
+        return idio_S_unspec;
+    } else if (idio_S_pw_gid == member) {
+       /*
+	* Test Case: libc-errors/struct-passwd-set-pw_gid-bad-value-type.idio
+	*
+	* struct-passwd-set! v 'pw_gid #t
+	*/
+	IDIO_USER_libc_TYPE_ASSERT (__gid_t, val);
+
+        passwdp->pw_gid = IDIO_C_TYPE_libc___gid_t (val);
+        return idio_S_unspec;
+    } else if (idio_S_pw_gecos == member) {
+       /*
+	* Test Case: libc-errors/struct-passwd-set-pw_gecos-bad-value-type.idio
+	*
+	* struct-passwd-set! v 'pw_gecos #t
+	*/
+	IDIO_USER_C_TYPE_ASSERT (pointer, val);
+
+        /*
+         * WARNING:
+         * char* pw_gecos
+         *
+         * sizeof (passwdp->pw_gecos) is dubious
+         *
+         * check the API
+         */
+        char* valp = IDIO_C_TYPE_POINTER_P (val);
+        size_t slen = sizeof (passwdp->pw_gecos);
+        memcpy ((void *) &passwdp->pw_gecos, (void *) valp, slen);
+        return idio_S_unspec;
+    } else if (idio_S_pw_dir == member) {
+       /*
+	* Test Case: libc-errors/struct-passwd-set-pw_dir-bad-value-type.idio
+	*
+	* struct-passwd-set! v 'pw_dir #t
+	*/
+	IDIO_USER_C_TYPE_ASSERT (pointer, val);
+
+        /*
+         * WARNING:
+         * char* pw_dir
+         *
+         * sizeof (passwdp->pw_dir) is dubious
+         *
+         * check the API
+         */
+        char* valp = IDIO_C_TYPE_POINTER_P (val);
+        size_t slen = sizeof (passwdp->pw_dir);
+        memcpy ((void *) &passwdp->pw_dir, (void *) valp, slen);
+        return idio_S_unspec;
+    } else if (idio_S_pw_shell == member) {
+       /*
+	* Test Case: libc-errors/struct-passwd-set-pw_shell-bad-value-type.idio
+	*
+	* struct-passwd-set! v 'pw_shell #t
+	*/
+	IDIO_USER_C_TYPE_ASSERT (pointer, val);
+
+        /*
+         * WARNING:
+         * char* pw_shell
+         *
+         * sizeof (passwdp->pw_shell) is dubious
+         *
+         * check the API
+         */
+        char* valp = IDIO_C_TYPE_POINTER_P (val);
+        size_t slen = sizeof (passwdp->pw_shell);
+        memcpy ((void *) &passwdp->pw_shell, (void *) valp, slen);
+        return idio_S_unspec;
+    } else {
+	/*
+	 * Test Case: libc-errors/struct-passwd-set-invalid-member.idio
+	 *
+	 * struct-passwd-set! v 'not-likely #t
+	 */
+        idio_error_param_value_exp ("struct-passwd-set!", "member", member, "C struct passwd member", IDIO_C_FUNC_LOCATION());
+
+        return idio_S_notreached;
+    }
+
+    return idio_S_notreached;
+}
+
+IDIO idio_libc_struct_passwd_as_string (struct passwd *passwdp)
+{
+    IDIO_C_ASSERT (passwdp);
+
+    IDIO CSI_sh = idio_open_output_string_handle_C ();
+    idio_display_C ("#<CSI libc/struct-passwd", CSI_sh);
+
+    char buf[BUFSIZ];
+    char *fmt;
+
+    idio_display_C (" pw_name:", CSI_sh);
+
+    idio_display_C (passwdp->pw_name, CSI_sh);
+
+    idio_display_C (" pw_passwd:", CSI_sh);
+
+    idio_display_C (passwdp->pw_passwd, CSI_sh);
+
+    idio_display_C (" pw_uid:", CSI_sh);
+
+    fmt = idio_C_type_format_string (IDIO_TYPE_C_libc___uid_t);
+    idio_snprintf (buf, BUFSIZ, fmt, passwdp->pw_uid);
+    idio_display_C (buf, CSI_sh);
+    idio_free (fmt);
+
+    idio_display_C (" pw_gid:", CSI_sh);
+
+    fmt = idio_C_type_format_string (IDIO_TYPE_C_libc___gid_t);
+    idio_snprintf (buf, BUFSIZ, fmt, passwdp->pw_gid);
+    idio_display_C (buf, CSI_sh);
+    idio_free (fmt);
+
+    idio_display_C (" pw_gecos:", CSI_sh);
+
+    idio_display_C (passwdp->pw_gecos, CSI_sh);
+
+    idio_display_C (" pw_dir:", CSI_sh);
+
+    idio_display_C (passwdp->pw_dir, CSI_sh);
+
+    idio_display_C (" pw_shell:", CSI_sh);
+
+    idio_display_C (passwdp->pw_shell, CSI_sh);
+
+    idio_display_C (">", CSI_sh);
+
+    return idio_get_output_string (CSI_sh);
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("struct-passwd-as-string", libc_struct_passwd_as_string, (IDIO passwd), "passwd", "\
+:param passwd: :ref:`struct-passwd <libc/struct-passwd>`	\n\
+:type passwd: C/pointer			\n\
+:return: string				\n\
+:rtype:	string				\n\
+")
+{
+    IDIO_ASSERT (passwd);
+
+    /*
+     * Test Case: libc-errors/struct-passwd-as-string-bad-pointer-type.idio
+     *
+     * struct-passwd-as-string #t
+     */
+    IDIO_USER_C_TYPE_ASSERT (pointer, passwd);
+    if (idio_CSI_libc_struct_passwd != IDIO_C_TYPE_POINTER_PTYPE (passwd)) {
+	/*
+	 * Test Case: libc-errors/struct-passwd-as-string-invalid-pointer-type.idio
+	 *
+	 * struct-passwd-as-string libc/NULL
+	 */
+	idio_error_param_value_exp ("struct-passwd-as-string", "passwd", passwd, "C struct passwd", IDIO_C_FUNC_LOCATION ());
+
+	return idio_S_notreached;
+    }
+
+    return idio_libc_struct_passwd_as_string (IDIO_C_TYPE_POINTER_P (passwd));
+}
+
+/*
+	/usr/include/x86_64-linux-gnu/sys/poll.h
+
+	struct pollfd
+	{
+	  int                  fd;
+	  short int            events;
+	  short int            revents;
+	};
+*/
+
+IDIO_C_STRUCT_IDENT_DECL (libc_struct_pollfd);
+IDIO_SYMBOL_DECL (fd);
+IDIO_SYMBOL_DECL (events);
+IDIO_SYMBOL_DECL (revents);
+
+IDIO_DEFINE_PRIMITIVE2_DS ("struct-pollfd-ref", libc_struct_pollfd_ref, (IDIO pollfd, IDIO member), "pollfd member", "\
+in C, :samp:`{pollfd}->{member}`			\n\
+					\n\
+:param pollfd: :ref:`struct-pollfd <libc/struct-pollfd>`	\n\
+:type pollfd: C/pointer		\n\
+:param member: member name		\n\
+:type member: symbol			\n\
+:return: `pollfd` -> `member`		\n\
+:rtype:	varies on `member`		\n\
+")
+{
+    IDIO_ASSERT (pollfd);
+    IDIO_ASSERT (member);
+
+    /*
+     * Test Case: libc-errors/struct-pollfd-ref-bad-pointer-type.idio
+     *
+     * struct-pollfd-ref #t #t
+     */
+    IDIO_USER_C_TYPE_ASSERT (pointer, pollfd);
+    if (idio_CSI_libc_struct_pollfd != IDIO_C_TYPE_POINTER_PTYPE (pollfd)) {
+	/*
+	 * Test Case: libc-errors/struct-pollfd-ref-invalid-pointer-type.idio
+	 *
+	 * struct-pollfd-ref libc/NULL #t
+	 */
+	idio_error_param_value_exp ("struct-pollfd-ref", "pollfd", pollfd, "C struct pollfd", IDIO_C_FUNC_LOCATION ());
+
+	return idio_S_notreached;
+    }
+
+    /*
+     * Test Case: libc-errors/struct-pollfd-ref-bad-member-type.idio
+     *
+     * struct-pollfd-ref v #t
+     */
+    IDIO_USER_TYPE_ASSERT (symbol, member);
+
+    struct pollfd *pollfdp = IDIO_C_TYPE_POINTER_P (pollfd);
+    if (idio_S_fd == member) {
+        return idio_C_int (pollfdp->fd);
+    } else if (idio_S_events == member) {
+        return idio_C_short (pollfdp->events);
+    } else if (idio_S_revents == member) {
+        return idio_C_short (pollfdp->revents);
+    } else {
+	/*
+	 * Test Case: libc-errors/struct-pollfd-ref-invalid-member.idio
+	 *
+	 * struct-pollfd-ref v 'not-likely
+	 */
+        idio_error_param_value_exp ("struct-pollfd-ref", "member", member, "C struct pollfd member", IDIO_C_FUNC_LOCATION());
+
+        return idio_S_notreached;
+    }
+
+    return idio_S_notreached;
+}
+
+IDIO_DEFINE_PRIMITIVE3_DS ("struct-pollfd-set!", libc_struct_pollfd_set, (IDIO pollfd, IDIO member, IDIO val), "pollfd member val", "\
+in C, :samp:`{pollfd}->{member} = {val}`		\n\
+					\n\
+:param pollfd: :ref:`struct-pollfd <libc/struct-pollfd>`	\n\
+:type pollfd: C/pointer		\n\
+:param member: member name		\n\
+:type member: symbol			\n\
+:param val: a C/ type			\n\
+:type val: varies on `member`		\n\
+:return: #<unspec>		\n\
+")
+{
+    IDIO_ASSERT (pollfd);
+    IDIO_ASSERT (member);
+    IDIO_ASSERT (val);
+
+
+    /*
+     * Test Case: libc-errors/struct-pollfd-set-bad-pointer-type.idio
+     *
+     * struct-pollfd-set! #t #t #t
+     */
+    IDIO_USER_C_TYPE_ASSERT (pointer, pollfd);
+    if (idio_CSI_libc_struct_pollfd != IDIO_C_TYPE_POINTER_PTYPE (pollfd)) {
+	/*
+	 * Test Case: libc-errors/struct-pollfd-set-invalid-pointer-type.idio
+	 *
+	 * struct-pollfd-set! libc/NULL #t #t
+	 */
+	idio_error_param_value_exp ("struct-pollfd-set!", "pollfd", pollfd, "C struct pollfd", IDIO_C_FUNC_LOCATION ());
+
+	return idio_S_notreached;
+    }
+
+    /*
+     * Test Case: libc-errors/struct-pollfd-set-bad-member-type.idio
+     *
+     * struct-pollfd-set! v #t #t
+     */
+    IDIO_USER_TYPE_ASSERT (symbol, member);
+
+    struct pollfd *pollfdp = IDIO_C_TYPE_POINTER_P (pollfd);
+    if (idio_S_fd == member) {
+       /*
+	* Test Case: libc-errors/struct-pollfd-set-fd-bad-value-type.idio
+	*
+	* struct-pollfd-set! v 'fd #t
+	*/
+	IDIO_USER_C_TYPE_ASSERT (int, val);
+
+        pollfdp->fd = IDIO_C_TYPE_int (val);
+        return idio_S_unspec;
+    } else if (idio_S_events == member) {
+       /*
+	* Test Case: libc-errors/struct-pollfd-set-events-bad-value-type.idio
+	*
+	* struct-pollfd-set! v 'events #t
+	*/
+	IDIO_USER_C_TYPE_ASSERT (short, val);
+
+        pollfdp->events = IDIO_C_TYPE_short (val);
+        return idio_S_unspec;
+    } else if (idio_S_revents == member) {
+       /*
+	* Test Case: libc-errors/struct-pollfd-set-revents-bad-value-type.idio
+	*
+	* struct-pollfd-set! v 'revents #t
+	*/
+	IDIO_USER_C_TYPE_ASSERT (short, val);
+
+        pollfdp->revents = IDIO_C_TYPE_short (val);
+        return idio_S_unspec;
+    } else {
+	/*
+	 * Test Case: libc-errors/struct-pollfd-set-invalid-member.idio
+	 *
+	 * struct-pollfd-set! v 'not-likely #t
+	 */
+        idio_error_param_value_exp ("struct-pollfd-set!", "member", member, "C struct pollfd member", IDIO_C_FUNC_LOCATION());
+
+        return idio_S_notreached;
+    }
+
+    return idio_S_notreached;
+}
+
+IDIO idio_libc_struct_pollfd_as_string (struct pollfd *pollfdp)
+{
+    IDIO_C_ASSERT (pollfdp);
+
+    IDIO CSI_sh = idio_open_output_string_handle_C ();
+    idio_display_C ("#<CSI libc/struct-pollfd", CSI_sh);
+
+    char buf[BUFSIZ];
+    char *fmt;
+
+    idio_display_C (" fd:", CSI_sh);
+
+    fmt = idio_C_type_format_string (IDIO_TYPE_C_INT);
+    idio_snprintf (buf, BUFSIZ, fmt, pollfdp->fd);
+    idio_display_C (buf, CSI_sh);
+    idio_free (fmt);
+
+    idio_display_C (" events:", CSI_sh);
+
+    fmt = idio_C_type_format_string (IDIO_TYPE_C_SHORT);
+    idio_snprintf (buf, BUFSIZ, fmt, pollfdp->events);
+    idio_display_C (buf, CSI_sh);
+    idio_free (fmt);
+
+    idio_display_C (" revents:", CSI_sh);
+
+    fmt = idio_C_type_format_string (IDIO_TYPE_C_SHORT);
+    idio_snprintf (buf, BUFSIZ, fmt, pollfdp->revents);
+    idio_display_C (buf, CSI_sh);
+    idio_free (fmt);
+
+    idio_display_C (">", CSI_sh);
+
+    return idio_get_output_string (CSI_sh);
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("struct-pollfd-as-string", libc_struct_pollfd_as_string, (IDIO pollfd), "pollfd", "\
+:param pollfd: :ref:`struct-pollfd <libc/struct-pollfd>`	\n\
+:type pollfd: C/pointer			\n\
+:return: string				\n\
+:rtype:	string				\n\
+")
+{
+    IDIO_ASSERT (pollfd);
+
+    /*
+     * Test Case: libc-errors/struct-pollfd-as-string-bad-pointer-type.idio
+     *
+     * struct-pollfd-as-string #t
+     */
+    IDIO_USER_C_TYPE_ASSERT (pointer, pollfd);
+    if (idio_CSI_libc_struct_pollfd != IDIO_C_TYPE_POINTER_PTYPE (pollfd)) {
+	/*
+	 * Test Case: libc-errors/struct-pollfd-as-string-invalid-pointer-type.idio
+	 *
+	 * struct-pollfd-as-string libc/NULL
+	 */
+	idio_error_param_value_exp ("struct-pollfd-as-string", "pollfd", pollfd, "C struct pollfd", IDIO_C_FUNC_LOCATION ());
+
+	return idio_S_notreached;
+    }
+
+    return idio_libc_struct_pollfd_as_string (IDIO_C_TYPE_POINTER_P (pollfd));
+}
+
+/*
+	/usr/include/x86_64-linux-gnu/bits/resource.h
+
+	struct rlimit
+	{
+	  rlim_t               rlim_cur;
+	  rlim_t               rlim_max;
+	};
+*/
+
+IDIO_C_STRUCT_IDENT_DECL (libc_struct_rlimit);
+IDIO_SYMBOL_DECL (rlim_cur);
+IDIO_SYMBOL_DECL (rlim_max);
+
+IDIO_DEFINE_PRIMITIVE2_DS ("struct-rlimit-ref", libc_struct_rlimit_ref, (IDIO rlimit, IDIO member), "rlimit member", "\
+in C, :samp:`{rlimit}->{member}`			\n\
+					\n\
+:param rlimit: :ref:`struct-rlimit <libc/struct-rlimit>`	\n\
+:type rlimit: C/pointer		\n\
+:param member: member name		\n\
+:type member: symbol			\n\
+:return: `rlimit` -> `member`		\n\
+:rtype:	varies on `member`		\n\
+")
+{
+    IDIO_ASSERT (rlimit);
+    IDIO_ASSERT (member);
+
+    /*
+     * Test Case: libc-errors/struct-rlimit-ref-bad-pointer-type.idio
+     *
+     * struct-rlimit-ref #t #t
+     */
+    IDIO_USER_C_TYPE_ASSERT (pointer, rlimit);
+    if (idio_CSI_libc_struct_rlimit != IDIO_C_TYPE_POINTER_PTYPE (rlimit)) {
+	/*
+	 * Test Case: libc-errors/struct-rlimit-ref-invalid-pointer-type.idio
+	 *
+	 * struct-rlimit-ref libc/NULL #t
+	 */
+	idio_error_param_value_exp ("struct-rlimit-ref", "rlimit", rlimit, "C struct rlimit", IDIO_C_FUNC_LOCATION ());
+
+	return idio_S_notreached;
+    }
+
+    /*
+     * Test Case: libc-errors/struct-rlimit-ref-bad-member-type.idio
+     *
+     * struct-rlimit-ref v #t
+     */
+    IDIO_USER_TYPE_ASSERT (symbol, member);
+
+    struct rlimit *rlimitp = IDIO_C_TYPE_POINTER_P (rlimit);
+    if (idio_S_rlim_cur == member) {
+        return idio_libc_rlim_t (rlimitp->rlim_cur);
+    } else if (idio_S_rlim_max == member) {
+        return idio_libc_rlim_t (rlimitp->rlim_max);
+    } else {
+	/*
+	 * Test Case: libc-errors/struct-rlimit-ref-invalid-member.idio
+	 *
+	 * struct-rlimit-ref v 'not-likely
+	 */
+        idio_error_param_value_exp ("struct-rlimit-ref", "member", member, "C struct rlimit member", IDIO_C_FUNC_LOCATION());
+
+        return idio_S_notreached;
+    }
+
+    return idio_S_notreached;
+}
+
+IDIO_DEFINE_PRIMITIVE3_DS ("struct-rlimit-set!", libc_struct_rlimit_set, (IDIO rlimit, IDIO member, IDIO val), "rlimit member val", "\
+in C, :samp:`{rlimit}->{member} = {val}`		\n\
+					\n\
+:param rlimit: :ref:`struct-rlimit <libc/struct-rlimit>`	\n\
+:type rlimit: C/pointer		\n\
+:param member: member name		\n\
+:type member: symbol			\n\
+:param val: a C/ type			\n\
+:type val: varies on `member`		\n\
+:return: #<unspec>		\n\
+")
+{
+    IDIO_ASSERT (rlimit);
+    IDIO_ASSERT (member);
+    IDIO_ASSERT (val);
+
+
+    /*
+     * Test Case: libc-errors/struct-rlimit-set-bad-pointer-type.idio
+     *
+     * struct-rlimit-set! #t #t #t
+     */
+    IDIO_USER_C_TYPE_ASSERT (pointer, rlimit);
+    if (idio_CSI_libc_struct_rlimit != IDIO_C_TYPE_POINTER_PTYPE (rlimit)) {
+	/*
+	 * Test Case: libc-errors/struct-rlimit-set-invalid-pointer-type.idio
+	 *
+	 * struct-rlimit-set! libc/NULL #t #t
+	 */
+	idio_error_param_value_exp ("struct-rlimit-set!", "rlimit", rlimit, "C struct rlimit", IDIO_C_FUNC_LOCATION ());
+
+	return idio_S_notreached;
+    }
+
+    /*
+     * Test Case: libc-errors/struct-rlimit-set-bad-member-type.idio
+     *
+     * struct-rlimit-set! v #t #t
+     */
+    IDIO_USER_TYPE_ASSERT (symbol, member);
+
+    struct rlimit *rlimitp = IDIO_C_TYPE_POINTER_P (rlimit);
+    if (idio_S_rlim_cur == member) {
+       /*
+	* Test Case: libc-errors/struct-rlimit-set-rlim_cur-bad-value-type.idio
+	*
+	* struct-rlimit-set! v 'rlim_cur #t
+	*/
+	IDIO_USER_libc_TYPE_ASSERT (rlim_t, val);
+
+        rlimitp->rlim_cur = IDIO_C_TYPE_libc_rlim_t (val);
+        return idio_S_unspec;
+    } else if (idio_S_rlim_max == member) {
+       /*
+	* Test Case: libc-errors/struct-rlimit-set-rlim_max-bad-value-type.idio
+	*
+	* struct-rlimit-set! v 'rlim_max #t
+	*/
+	IDIO_USER_libc_TYPE_ASSERT (rlim_t, val);
+
+        rlimitp->rlim_max = IDIO_C_TYPE_libc_rlim_t (val);
+        return idio_S_unspec;
+    } else {
+	/*
+	 * Test Case: libc-errors/struct-rlimit-set-invalid-member.idio
+	 *
+	 * struct-rlimit-set! v 'not-likely #t
+	 */
+        idio_error_param_value_exp ("struct-rlimit-set!", "member", member, "C struct rlimit member", IDIO_C_FUNC_LOCATION());
+
+        return idio_S_notreached;
+    }
+
+    return idio_S_notreached;
+}
+
+IDIO idio_libc_struct_rlimit_as_string (struct rlimit *rlimitp)
+{
+    IDIO_C_ASSERT (rlimitp);
+
+    IDIO CSI_sh = idio_open_output_string_handle_C ();
+    idio_display_C ("#<CSI libc/struct-rlimit", CSI_sh);
+
+    char buf[BUFSIZ];
+    char *fmt;
+
+    idio_display_C (" rlim_cur:", CSI_sh);
+
+    fmt = idio_C_type_format_string (IDIO_TYPE_C_libc_rlim_t);
+    idio_snprintf (buf, BUFSIZ, fmt, rlimitp->rlim_cur);
+    idio_display_C (buf, CSI_sh);
+    idio_free (fmt);
+
+    idio_display_C (" rlim_max:", CSI_sh);
+
+    fmt = idio_C_type_format_string (IDIO_TYPE_C_libc_rlim_t);
+    idio_snprintf (buf, BUFSIZ, fmt, rlimitp->rlim_max);
+    idio_display_C (buf, CSI_sh);
+    idio_free (fmt);
+
+    idio_display_C (">", CSI_sh);
+
+    return idio_get_output_string (CSI_sh);
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("struct-rlimit-as-string", libc_struct_rlimit_as_string, (IDIO rlimit), "rlimit", "\
+:param rlimit: :ref:`struct-rlimit <libc/struct-rlimit>`	\n\
+:type rlimit: C/pointer			\n\
+:return: string				\n\
+:rtype:	string				\n\
+")
+{
+    IDIO_ASSERT (rlimit);
+
+    /*
+     * Test Case: libc-errors/struct-rlimit-as-string-bad-pointer-type.idio
+     *
+     * struct-rlimit-as-string #t
+     */
+    IDIO_USER_C_TYPE_ASSERT (pointer, rlimit);
+    if (idio_CSI_libc_struct_rlimit != IDIO_C_TYPE_POINTER_PTYPE (rlimit)) {
+	/*
+	 * Test Case: libc-errors/struct-rlimit-as-string-invalid-pointer-type.idio
+	 *
+	 * struct-rlimit-as-string libc/NULL
+	 */
+	idio_error_param_value_exp ("struct-rlimit-as-string", "rlimit", rlimit, "C struct rlimit", IDIO_C_FUNC_LOCATION ());
+
+	return idio_S_notreached;
+    }
+
+    return idio_libc_struct_rlimit_as_string (IDIO_C_TYPE_POINTER_P (rlimit));
+}
+
+/*
+	/usr/include/x86_64-linux-gnu/bits/types/struct_rusage.h
+
+	struct rusage
+	{
+	  struct timeval       ru_utime;
+	  struct timeval       ru_stime;
+	  union {}             -anon-;
+	  union {}             -anon-;
+	  union {}             -anon-;
+	  union {}             -anon-;
+	  union {}             -anon-;
+	  union {}             -anon-;
+	  union {}             -anon-;
+	  union {}             -anon-;
+	  union {}             -anon-;
+	  union {}             -anon-;
+	  union {}             -anon-;
+	  union {}             -anon-;
+	  union {}             -anon-;
+	  union {}             -anon-;
+	};
+*/
+
+IDIO_C_STRUCT_IDENT_DECL (libc_struct_rusage);
+IDIO_SYMBOL_DECL (ru_utime);
+IDIO_SYMBOL_DECL (ru_stime);
+
+IDIO_DEFINE_PRIMITIVE2_DS ("struct-rusage-ref", libc_struct_rusage_ref, (IDIO rusage, IDIO member), "rusage member", "\
+in C, :samp:`{rusage}->{member}`			\n\
+					\n\
+:param rusage: :ref:`struct-rusage <libc/struct-rusage>`	\n\
+:type rusage: C/pointer		\n\
+:param member: member name		\n\
+:type member: symbol			\n\
+:return: `rusage` -> `member`		\n\
+:rtype:	varies on `member`		\n\
+")
+{
+    IDIO_ASSERT (rusage);
+    IDIO_ASSERT (member);
+
+    /*
+     * Test Case: libc-errors/struct-rusage-ref-bad-pointer-type.idio
+     *
+     * struct-rusage-ref #t #t
+     */
+    IDIO_USER_C_TYPE_ASSERT (pointer, rusage);
+    if (idio_CSI_libc_struct_rusage != IDIO_C_TYPE_POINTER_PTYPE (rusage)) {
+	/*
+	 * Test Case: libc-errors/struct-rusage-ref-invalid-pointer-type.idio
+	 *
+	 * struct-rusage-ref libc/NULL #t
+	 */
+	idio_error_param_value_exp ("struct-rusage-ref", "rusage", rusage, "C struct rusage", IDIO_C_FUNC_LOCATION ());
+
+	return idio_S_notreached;
+    }
+
+    /*
+     * Test Case: libc-errors/struct-rusage-ref-bad-member-type.idio
+     *
+     * struct-rusage-ref v #t
+     */
+    IDIO_USER_TYPE_ASSERT (symbol, member);
+
+    struct rusage *rusagep = IDIO_C_TYPE_POINTER_P (rusage);
+    if (idio_S_ru_utime == member) {
+        struct timeval *rp = (struct timeval *) idio_alloc (sizeof (struct timeval));
+        memcpy ((void *) rp, (void *) &rusagep->ru_utime, sizeof (struct timeval));
+
+        return idio_C_pointer_type (idio_CSI_libc_struct_timeval, rp);
+
+    } else if (idio_S_ru_stime == member) {
+        struct timeval *rp = (struct timeval *) idio_alloc (sizeof (struct timeval));
+        memcpy ((void *) rp, (void *) &rusagep->ru_stime, sizeof (struct timeval));
+
+        return idio_C_pointer_type (idio_CSI_libc_struct_timeval, rp);
+
+    } else {
+	/*
+	 * Test Case: libc-errors/struct-rusage-ref-invalid-member.idio
+	 *
+	 * struct-rusage-ref v 'not-likely
+	 */
+        idio_error_param_value_exp ("struct-rusage-ref", "member", member, "C struct rusage member", IDIO_C_FUNC_LOCATION());
+
+        return idio_S_notreached;
+    }
+
+    return idio_S_notreached;
+}
+
+IDIO_DEFINE_PRIMITIVE3_DS ("struct-rusage-set!", libc_struct_rusage_set, (IDIO rusage, IDIO member, IDIO val), "rusage member val", "\
+in C, :samp:`{rusage}->{member} = {val}`		\n\
+					\n\
+:param rusage: :ref:`struct-rusage <libc/struct-rusage>`	\n\
+:type rusage: C/pointer		\n\
+:param member: member name		\n\
+:type member: symbol			\n\
+:param val: a C/ type			\n\
+:type val: varies on `member`		\n\
+:return: #<unspec>		\n\
+")
+{
+    IDIO_ASSERT (rusage);
+    IDIO_ASSERT (member);
+    IDIO_ASSERT (val);
+
+
+    /*
+     * Test Case: libc-errors/struct-rusage-set-bad-pointer-type.idio
+     *
+     * struct-rusage-set! #t #t #t
+     */
+    IDIO_USER_C_TYPE_ASSERT (pointer, rusage);
+    if (idio_CSI_libc_struct_rusage != IDIO_C_TYPE_POINTER_PTYPE (rusage)) {
+	/*
+	 * Test Case: libc-errors/struct-rusage-set-invalid-pointer-type.idio
+	 *
+	 * struct-rusage-set! libc/NULL #t #t
+	 */
+	idio_error_param_value_exp ("struct-rusage-set!", "rusage", rusage, "C struct rusage", IDIO_C_FUNC_LOCATION ());
+
+	return idio_S_notreached;
+    }
+
+    /*
+     * Test Case: libc-errors/struct-rusage-set-bad-member-type.idio
+     *
+     * struct-rusage-set! v #t #t
+     */
+    IDIO_USER_TYPE_ASSERT (symbol, member);
+
+    struct rusage *rusagep = IDIO_C_TYPE_POINTER_P (rusage);
+    if (idio_S_ru_utime == member) {
+       /*
+	* Test Case: libc-errors/struct-rusage-set-ru_utime-bad-value-type.idio
+	*
+	* struct-rusage-set! v 'ru_utime #t
+	*/
+	IDIO_USER_C_TYPE_ASSERT (pointer, val);
+
+        struct timeval *valp = IDIO_C_TYPE_POINTER_P (val);
+        memcpy ((void *) &rusagep->ru_utime, (void *) valp, sizeof (struct timeval));
+        return idio_S_unspec;
+    } else if (idio_S_ru_stime == member) {
+       /*
+	* Test Case: libc-errors/struct-rusage-set-ru_stime-bad-value-type.idio
+	*
+	* struct-rusage-set! v 'ru_stime #t
+	*/
+	IDIO_USER_C_TYPE_ASSERT (pointer, val);
+
+        struct timeval *valp = IDIO_C_TYPE_POINTER_P (val);
+        memcpy ((void *) &rusagep->ru_stime, (void *) valp, sizeof (struct timeval));
+        return idio_S_unspec;
+    } else {
+	/*
+	 * Test Case: libc-errors/struct-rusage-set-invalid-member.idio
+	 *
+	 * struct-rusage-set! v 'not-likely #t
+	 */
+        idio_error_param_value_exp ("struct-rusage-set!", "member", member, "C struct rusage member", IDIO_C_FUNC_LOCATION());
+
+        return idio_S_notreached;
+    }
+
+    return idio_S_notreached;
+}
+
+IDIO idio_libc_struct_rusage_as_string (struct rusage *rusagep)
+{
+    IDIO_C_ASSERT (rusagep);
+
+    IDIO CSI_sh = idio_open_output_string_handle_C ();
+    idio_display_C ("#<CSI libc/struct-rusage", CSI_sh);
+
+    char buf[BUFSIZ];
+    char *fmt;
+
+    idio_display_C (" ru_utime:", CSI_sh);
+
+    idio_display (idio_libc_struct_timeval_as_string (&(rusagep->ru_utime)), CSI_sh);
+
+    idio_display_C (" ru_stime:", CSI_sh);
+
+    idio_display (idio_libc_struct_timeval_as_string (&(rusagep->ru_stime)), CSI_sh);
+
+    idio_display_C (">", CSI_sh);
+
+    return idio_get_output_string (CSI_sh);
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("struct-rusage-as-string", libc_struct_rusage_as_string, (IDIO rusage), "rusage", "\
+:param rusage: :ref:`struct-rusage <libc/struct-rusage>`	\n\
+:type rusage: C/pointer			\n\
+:return: string				\n\
+:rtype:	string				\n\
+")
+{
+    IDIO_ASSERT (rusage);
+
+    /*
+     * Test Case: libc-errors/struct-rusage-as-string-bad-pointer-type.idio
+     *
+     * struct-rusage-as-string #t
+     */
+    IDIO_USER_C_TYPE_ASSERT (pointer, rusage);
+    if (idio_CSI_libc_struct_rusage != IDIO_C_TYPE_POINTER_PTYPE (rusage)) {
+	/*
+	 * Test Case: libc-errors/struct-rusage-as-string-invalid-pointer-type.idio
+	 *
+	 * struct-rusage-as-string libc/NULL
+	 */
+	idio_error_param_value_exp ("struct-rusage-as-string", "rusage", rusage, "C struct rusage", IDIO_C_FUNC_LOCATION ());
+
+	return idio_S_notreached;
+    }
+
+    return idio_libc_struct_rusage_as_string (IDIO_C_TYPE_POINTER_P (rusage));
+}
+
+/*
+	/usr/include/x86_64-linux-gnu/bits/sigaction.h
+
+	struct sigaction
+	{
+	  union {}             __sigaction_handler;
+	  __sigset_t           sa_mask;
+	  int                  sa_flags;
+	  (*)*                 sa_restorer;
+	};
+*/
+
+IDIO_C_STRUCT_IDENT_DECL (libc_struct_sigaction);
+IDIO_SYMBOL_DECL (__sigaction_handler);
+IDIO_SYMBOL_DECL (sa_mask);
+IDIO_SYMBOL_DECL (sa_flags);
+IDIO_SYMBOL_DECL (sa_restorer);
+
+IDIO_DEFINE_PRIMITIVE2_DS ("struct-sigaction-ref", libc_struct_sigaction_ref, (IDIO sigaction, IDIO member), "sigaction member", "\
+in C, :samp:`{sigaction}->{member}`			\n\
+					\n\
+:param sigaction: :ref:`struct-sigaction <libc/struct-sigaction>`	\n\
+:type sigaction: C/pointer		\n\
+:param member: member name		\n\
+:type member: symbol			\n\
+:return: `sigaction` -> `member`		\n\
+:rtype:	varies on `member`		\n\
+")
+{
+    IDIO_ASSERT (sigaction);
+    IDIO_ASSERT (member);
+
+    /*
+     * Test Case: libc-errors/struct-sigaction-ref-bad-pointer-type.idio
+     *
+     * struct-sigaction-ref #t #t
+     */
+    IDIO_USER_C_TYPE_ASSERT (pointer, sigaction);
+    if (idio_CSI_libc_struct_sigaction != IDIO_C_TYPE_POINTER_PTYPE (sigaction)) {
+	/*
+	 * Test Case: libc-errors/struct-sigaction-ref-invalid-pointer-type.idio
+	 *
+	 * struct-sigaction-ref libc/NULL #t
+	 */
+	idio_error_param_value_exp ("struct-sigaction-ref", "sigaction", sigaction, "C struct sigaction", IDIO_C_FUNC_LOCATION ());
+
+	return idio_S_notreached;
+    }
+
+    /*
+     * Test Case: libc-errors/struct-sigaction-ref-bad-member-type.idio
+     *
+     * struct-sigaction-ref v #t
+     */
+    IDIO_USER_TYPE_ASSERT (symbol, member);
+
+    struct sigaction *sigactionp = IDIO_C_TYPE_POINTER_P (sigaction);
+    if (idio_S___sigaction_handler == member) {
+        union {} *rp = (union {} *) idio_alloc (sizeof (union {}));
+        memcpy ((void *) rp, (void *) &sigactionp->__sigaction_handler, sizeof (union {}));
+
+        return idio_C_pointer_free_me (rp);
+
+    } else if (idio_S_sa_mask == member) {
+        return idio_libc___sigset_t (sigactionp->sa_mask);
+    } else if (idio_S_sa_flags == member) {
+        return idio_C_int (sigactionp->sa_flags);
+    } else if (idio_S_sa_restorer == member) {
+        (*)* *rp = ((*)* *) idio_alloc (sizeof ((*)*));
+        memcpy ((void *) rp, (void *) &sigactionp->sa_restorer, sizeof ((*)*));
+
+        return idio_C_pointer_free_me (rp);
+
+    } else {
+	/*
+	 * Test Case: libc-errors/struct-sigaction-ref-invalid-member.idio
+	 *
+	 * struct-sigaction-ref v 'not-likely
+	 */
+        idio_error_param_value_exp ("struct-sigaction-ref", "member", member, "C struct sigaction member", IDIO_C_FUNC_LOCATION());
+
+        return idio_S_notreached;
+    }
+
+    return idio_S_notreached;
+}
+
+IDIO_DEFINE_PRIMITIVE3_DS ("struct-sigaction-set!", libc_struct_sigaction_set, (IDIO sigaction, IDIO member, IDIO val), "sigaction member val", "\
+in C, :samp:`{sigaction}->{member} = {val}`		\n\
+					\n\
+:param sigaction: :ref:`struct-sigaction <libc/struct-sigaction>`	\n\
+:type sigaction: C/pointer		\n\
+:param member: member name		\n\
+:type member: symbol			\n\
+:param val: a C/ type			\n\
+:type val: varies on `member`		\n\
+:return: #<unspec>		\n\
+")
+{
+    IDIO_ASSERT (sigaction);
+    IDIO_ASSERT (member);
+    IDIO_ASSERT (val);
+
+
+    /*
+     * Test Case: libc-errors/struct-sigaction-set-bad-pointer-type.idio
+     *
+     * struct-sigaction-set! #t #t #t
+     */
+    IDIO_USER_C_TYPE_ASSERT (pointer, sigaction);
+    if (idio_CSI_libc_struct_sigaction != IDIO_C_TYPE_POINTER_PTYPE (sigaction)) {
+	/*
+	 * Test Case: libc-errors/struct-sigaction-set-invalid-pointer-type.idio
+	 *
+	 * struct-sigaction-set! libc/NULL #t #t
+	 */
+	idio_error_param_value_exp ("struct-sigaction-set!", "sigaction", sigaction, "C struct sigaction", IDIO_C_FUNC_LOCATION ());
+
+	return idio_S_notreached;
+    }
+
+    /*
+     * Test Case: libc-errors/struct-sigaction-set-bad-member-type.idio
+     *
+     * struct-sigaction-set! v #t #t
+     */
+    IDIO_USER_TYPE_ASSERT (symbol, member);
+
+    struct sigaction *sigactionp = IDIO_C_TYPE_POINTER_P (sigaction);
+    if (idio_S___sigaction_handler == member) {
+       /*
+	* Test Case: libc-errors/struct-sigaction-set-__sigaction_handler-bad-value-type.idio
+	*
+	* struct-sigaction-set! v '__sigaction_handler #t
+	*/
+	IDIO_USER_C_TYPE_ASSERT (pointer, val);
+
+        union {} *valp = IDIO_C_TYPE_POINTER_P (val);
+        memcpy ((void *) &sigactionp->__sigaction_handler, (void *) valp, sizeof (union {}));
+        return idio_S_unspec;
+    } else if (idio_S_sa_mask == member) {
+       /*
+	* Test Case: libc-errors/struct-sigaction-set-sa_mask-bad-value-type.idio
+	*
+	* struct-sigaction-set! v 'sa_mask #t
+	*/
+	IDIO_USER_libc_TYPE_ASSERT (__sigset_t, val);
+
+        sigactionp->sa_mask = IDIO_C_TYPE_libc___sigset_t (val);
+        return idio_S_unspec;
+    } else if (idio_S_sa_flags == member) {
+       /*
+	* Test Case: libc-errors/struct-sigaction-set-sa_flags-bad-value-type.idio
+	*
+	* struct-sigaction-set! v 'sa_flags #t
+	*/
+	IDIO_USER_C_TYPE_ASSERT (int, val);
+
+        sigactionp->sa_flags = IDIO_C_TYPE_int (val);
+        return idio_S_unspec;
+    } else if (idio_S_sa_restorer == member) {
+       /*
+	* Test Case: libc-errors/struct-sigaction-set-sa_restorer-bad-value-type.idio
+	*
+	* struct-sigaction-set! v 'sa_restorer #t
+	*/
+	IDIO_USER_C_TYPE_ASSERT (pointer, val);
+
+        (*)* *valp = IDIO_C_TYPE_POINTER_P (val);
+        memcpy ((void *) &sigactionp->sa_restorer, (void *) valp, sizeof ((*)*));
+        return idio_S_unspec;
+    } else {
+	/*
+	 * Test Case: libc-errors/struct-sigaction-set-invalid-member.idio
+	 *
+	 * struct-sigaction-set! v 'not-likely #t
+	 */
+        idio_error_param_value_exp ("struct-sigaction-set!", "member", member, "C struct sigaction member", IDIO_C_FUNC_LOCATION());
+
+        return idio_S_notreached;
+    }
+
+    return idio_S_notreached;
+}
+
+IDIO idio_libc_struct_sigaction_as_string (struct sigaction *sigactionp)
+{
+    IDIO_C_ASSERT (sigactionp);
+
+    IDIO CSI_sh = idio_open_output_string_handle_C ();
+    idio_display_C ("#<CSI libc/struct-sigaction", CSI_sh);
+
+    char buf[BUFSIZ];
+    char *fmt;
+
+    idio_display_C (" __sigaction_handler:", CSI_sh);
+
+    idio_display (idio_libc_union____as_string (sigactionp->__sigaction_handler), CSI_sh);
+
+    idio_display_C (" sa_mask:", CSI_sh);
+
+    fmt = idio_C_type_format_string (IDIO_TYPE_C_libc___sigset_t);
+    idio_snprintf (buf, BUFSIZ, fmt, sigactionp->sa_mask);
+    idio_display_C (buf, CSI_sh);
+    idio_free (fmt);
+
+    idio_display_C (" sa_flags:", CSI_sh);
+
+    fmt = idio_C_type_format_string (IDIO_TYPE_C_INT);
+    idio_snprintf (buf, BUFSIZ, fmt, sigactionp->sa_flags);
+    idio_display_C (buf, CSI_sh);
+    idio_free (fmt);
+
+    idio_display_C (" sa_restorer:", CSI_sh);
+
+    idio_display (idio_libc______as_string (sigactionp->sa_restorer), CSI_sh);
+
+    idio_display_C (">", CSI_sh);
+
+    return idio_get_output_string (CSI_sh);
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("struct-sigaction-as-string", libc_struct_sigaction_as_string, (IDIO sigaction), "sigaction", "\
+:param sigaction: :ref:`struct-sigaction <libc/struct-sigaction>`	\n\
+:type sigaction: C/pointer			\n\
+:return: string				\n\
+:rtype:	string				\n\
+")
+{
+    IDIO_ASSERT (sigaction);
+
+    /*
+     * Test Case: libc-errors/struct-sigaction-as-string-bad-pointer-type.idio
+     *
+     * struct-sigaction-as-string #t
+     */
+    IDIO_USER_C_TYPE_ASSERT (pointer, sigaction);
+    if (idio_CSI_libc_struct_sigaction != IDIO_C_TYPE_POINTER_PTYPE (sigaction)) {
+	/*
+	 * Test Case: libc-errors/struct-sigaction-as-string-invalid-pointer-type.idio
+	 *
+	 * struct-sigaction-as-string libc/NULL
+	 */
+	idio_error_param_value_exp ("struct-sigaction-as-string", "sigaction", sigaction, "C struct sigaction", IDIO_C_FUNC_LOCATION ());
+
+	return idio_S_notreached;
+    }
+
+    return idio_libc_struct_sigaction_as_string (IDIO_C_TYPE_POINTER_P (sigaction));
+}
+
+/*
+	/usr/include/x86_64-linux-gnu/bits/struct_stat.h
+
+	struct stat
+	{
+	  __dev_t              st_dev;
+	  __ino_t              st_ino;
+	  __nlink_t            st_nlink;
+	  __mode_t             st_mode;
+	  __uid_t              st_uid;
+	  __gid_t              st_gid;
+	  int                  __pad0;
+	  __dev_t              st_rdev;
+	  __off_t              st_size;
+	  __blksize_t          st_blksize;
+	  __blkcnt_t           st_blocks;
+	  struct timespec      st_atim;
+	  struct timespec      st_mtim;
+	  struct timespec      st_ctim;
+	  __syscall_slong_t[]  __glibc_reserved;
+	};
+*/
+
+IDIO_C_STRUCT_IDENT_DECL (libc_struct_stat);
+IDIO_SYMBOL_DECL (st_dev);
+IDIO_SYMBOL_DECL (st_ino);
+IDIO_SYMBOL_DECL (st_nlink);
+IDIO_SYMBOL_DECL (st_mode);
+IDIO_SYMBOL_DECL (st_uid);
+IDIO_SYMBOL_DECL (st_gid);
+IDIO_SYMBOL_DECL (__pad0);
+IDIO_SYMBOL_DECL (st_rdev);
+IDIO_SYMBOL_DECL (st_size);
+IDIO_SYMBOL_DECL (st_blksize);
+IDIO_SYMBOL_DECL (st_blocks);
+IDIO_SYMBOL_DECL (st_atim);
+IDIO_SYMBOL_DECL (st_mtim);
+IDIO_SYMBOL_DECL (st_ctim);
+IDIO_SYMBOL_DECL (__glibc_reserved);
+
+IDIO_DEFINE_PRIMITIVE2_DS ("struct-stat-ref", libc_struct_stat_ref, (IDIO stat, IDIO member), "stat member", "\
+in C, :samp:`{stat}->{member}`			\n\
+					\n\
+:param stat: :ref:`struct-stat <libc/struct-stat>`	\n\
+:type stat: C/pointer		\n\
+:param member: member name		\n\
+:type member: symbol			\n\
+:return: `stat` -> `member`		\n\
+:rtype:	varies on `member`		\n\
+")
+{
+    IDIO_ASSERT (stat);
+    IDIO_ASSERT (member);
+
+    /*
+     * Test Case: libc-errors/struct-stat-ref-bad-pointer-type.idio
+     *
+     * struct-stat-ref #t #t
+     */
+    IDIO_USER_C_TYPE_ASSERT (pointer, stat);
+    if (idio_CSI_libc_struct_stat != IDIO_C_TYPE_POINTER_PTYPE (stat)) {
+	/*
+	 * Test Case: libc-errors/struct-stat-ref-invalid-pointer-type.idio
+	 *
+	 * struct-stat-ref libc/NULL #t
+	 */
+	idio_error_param_value_exp ("struct-stat-ref", "stat", stat, "C struct stat", IDIO_C_FUNC_LOCATION ());
+
+	return idio_S_notreached;
+    }
+
+    /*
+     * Test Case: libc-errors/struct-stat-ref-bad-member-type.idio
+     *
+     * struct-stat-ref v #t
+     */
+    IDIO_USER_TYPE_ASSERT (symbol, member);
+
+    struct stat *statp = IDIO_C_TYPE_POINTER_P (stat);
+    if (idio_S_st_dev == member) {
+        return idio_libc___dev_t (statp->st_dev);
+    } else if (idio_S_st_ino == member) {
+        return idio_libc___ino_t (statp->st_ino);
+    } else if (idio_S_st_nlink == member) {
+        return idio_libc___nlink_t (statp->st_nlink);
+    } else if (idio_S_st_mode == member) {
+        return idio_libc___mode_t (statp->st_mode);
+    } else if (idio_S_st_uid == member) {
+        return idio_libc___uid_t (statp->st_uid);
+    } else if (idio_S_st_gid == member) {
+        return idio_libc___gid_t (statp->st_gid);
+    } else if (idio_S___pad0 == member) {
+        return idio_C_int (statp->__pad0);
+    } else if (idio_S_st_rdev == member) {
+        return idio_libc___dev_t (statp->st_rdev);
+    } else if (idio_S_st_size == member) {
+        return idio_libc___off_t (statp->st_size);
+    } else if (idio_S_st_blksize == member) {
+        return idio_libc___blksize_t (statp->st_blksize);
+    } else if (idio_S_st_blocks == member) {
+        return idio_libc___blkcnt_t (statp->st_blocks);
+    } else if (idio_S_st_atim == member) {
+        struct timespec *rp = (struct timespec *) idio_alloc (sizeof (struct timespec));
+        memcpy ((void *) rp, (void *) &statp->st_atim, sizeof (struct timespec));
+
+        return idio_C_pointer_type (idio_CSI_libc_struct_timespec, rp);
+
+    } else if (idio_S_st_mtim == member) {
+        struct timespec *rp = (struct timespec *) idio_alloc (sizeof (struct timespec));
+        memcpy ((void *) rp, (void *) &statp->st_mtim, sizeof (struct timespec));
+
+        return idio_C_pointer_type (idio_CSI_libc_struct_timespec, rp);
+
+    } else if (idio_S_st_ctim == member) {
+        struct timespec *rp = (struct timespec *) idio_alloc (sizeof (struct timespec));
+        memcpy ((void *) rp, (void *) &statp->st_ctim, sizeof (struct timespec));
+
+        return idio_C_pointer_type (idio_CSI_libc_struct_timespec, rp);
+
+    } else if (idio_S___glibc_reserved == member) {
+        /*
+         * WARNING:
+         * __syscall_slong_t[] __glibc_reserved
+         *
+         * sizeof (statp->__glibc_reserved) is probably incorrect
+         *
+         * check the API
+         */
+        size_t alen = sizeof (statp->__glibc_reserved);
+        __syscall_slong_t *rp = (__syscall_slong_t *) idio_alloc (alen);
+        memcpy ((void *) rp, (void *) &statp->__glibc_reserved, alen);
+    } else {
+	/*
+	 * Test Case: libc-errors/struct-stat-ref-invalid-member.idio
+	 *
+	 * struct-stat-ref v 'not-likely
+	 */
+        idio_error_param_value_exp ("struct-stat-ref", "member", member, "C struct stat member", IDIO_C_FUNC_LOCATION());
+
+        return idio_S_notreached;
+    }
+
+    return idio_S_notreached;
+}
+
+IDIO_DEFINE_PRIMITIVE3_DS ("struct-stat-set!", libc_struct_stat_set, (IDIO stat, IDIO member, IDIO val), "stat member val", "\
+in C, :samp:`{stat}->{member} = {val}`		\n\
+					\n\
+:param stat: :ref:`struct-stat <libc/struct-stat>`	\n\
+:type stat: C/pointer		\n\
+:param member: member name		\n\
+:type member: symbol			\n\
+:param val: a C/ type			\n\
+:type val: varies on `member`		\n\
+:return: #<unspec>		\n\
+")
+{
+    IDIO_ASSERT (stat);
+    IDIO_ASSERT (member);
+    IDIO_ASSERT (val);
+
+
+    /*
+     * Test Case: libc-errors/struct-stat-set-bad-pointer-type.idio
+     *
+     * struct-stat-set! #t #t #t
+     */
+    IDIO_USER_C_TYPE_ASSERT (pointer, stat);
+    if (idio_CSI_libc_struct_stat != IDIO_C_TYPE_POINTER_PTYPE (stat)) {
+	/*
+	 * Test Case: libc-errors/struct-stat-set-invalid-pointer-type.idio
+	 *
+	 * struct-stat-set! libc/NULL #t #t
+	 */
+	idio_error_param_value_exp ("struct-stat-set!", "stat", stat, "C struct stat", IDIO_C_FUNC_LOCATION ());
+
+	return idio_S_notreached;
+    }
+
+    /*
+     * Test Case: libc-errors/struct-stat-set-bad-member-type.idio
+     *
+     * struct-stat-set! v #t #t
+     */
+    IDIO_USER_TYPE_ASSERT (symbol, member);
+
+    struct stat *statp = IDIO_C_TYPE_POINTER_P (stat);
+    if (idio_S_st_dev == member) {
+       /*
+	* Test Case: libc-errors/struct-stat-set-st_dev-bad-value-type.idio
+	*
+	* struct-stat-set! v 'st_dev #t
+	*/
+	IDIO_USER_libc_TYPE_ASSERT (__dev_t, val);
+
+        statp->st_dev = IDIO_C_TYPE_libc___dev_t (val);
+        return idio_S_unspec;
+    } else if (idio_S_st_ino == member) {
+       /*
+	* Test Case: libc-errors/struct-stat-set-st_ino-bad-value-type.idio
+	*
+	* struct-stat-set! v 'st_ino #t
+	*/
+	IDIO_USER_libc_TYPE_ASSERT (__ino_t, val);
+
+        statp->st_ino = IDIO_C_TYPE_libc___ino_t (val);
+        return idio_S_unspec;
+    } else if (idio_S_st_nlink == member) {
+       /*
+	* Test Case: libc-errors/struct-stat-set-st_nlink-bad-value-type.idio
+	*
+	* struct-stat-set! v 'st_nlink #t
+	*/
+	IDIO_USER_libc_TYPE_ASSERT (__nlink_t, val);
+
+        statp->st_nlink = IDIO_C_TYPE_libc___nlink_t (val);
+        return idio_S_unspec;
+    } else if (idio_S_st_mode == member) {
+       /*
+	* Test Case: libc-errors/struct-stat-set-st_mode-bad-value-type.idio
+	*
+	* struct-stat-set! v 'st_mode #t
+	*/
+	IDIO_USER_libc_TYPE_ASSERT (__mode_t, val);
+
+        statp->st_mode = IDIO_C_TYPE_libc___mode_t (val);
+        return idio_S_unspec;
+    } else if (idio_S_st_uid == member) {
+       /*
+	* Test Case: libc-errors/struct-stat-set-st_uid-bad-value-type.idio
+	*
+	* struct-stat-set! v 'st_uid #t
+	*/
+	IDIO_USER_libc_TYPE_ASSERT (__uid_t, val);
+
+        statp->st_uid = IDIO_C_TYPE_libc___uid_t (val);
+        return idio_S_unspec;
+    } else if (idio_S_st_gid == member) {
+       /*
+	* Test Case: libc-errors/struct-stat-set-st_gid-bad-value-type.idio
+	*
+	* struct-stat-set! v 'st_gid #t
+	*/
+	IDIO_USER_libc_TYPE_ASSERT (__gid_t, val);
+
+        statp->st_gid = IDIO_C_TYPE_libc___gid_t (val);
+        return idio_S_unspec;
+    } else if (idio_S___pad0 == member) {
+       /*
+	* Test Case: libc-errors/struct-stat-set-__pad0-bad-value-type.idio
+	*
+	* struct-stat-set! v '__pad0 #t
+	*/
+	IDIO_USER_C_TYPE_ASSERT (int, val);
+
+        statp->__pad0 = IDIO_C_TYPE_int (val);
+        return idio_S_unspec;
+    } else if (idio_S_st_rdev == member) {
+       /*
+	* Test Case: libc-errors/struct-stat-set-st_rdev-bad-value-type.idio
+	*
+	* struct-stat-set! v 'st_rdev #t
+	*/
+	IDIO_USER_libc_TYPE_ASSERT (__dev_t, val);
+
+        statp->st_rdev = IDIO_C_TYPE_libc___dev_t (val);
+        return idio_S_unspec;
+    } else if (idio_S_st_size == member) {
+       /*
+	* Test Case: libc-errors/struct-stat-set-st_size-bad-value-type.idio
+	*
+	* struct-stat-set! v 'st_size #t
+	*/
+	IDIO_USER_libc_TYPE_ASSERT (__off_t, val);
+
+        statp->st_size = IDIO_C_TYPE_libc___off_t (val);
+        return idio_S_unspec;
+    } else if (idio_S_st_blksize == member) {
+       /*
+	* Test Case: libc-errors/struct-stat-set-st_blksize-bad-value-type.idio
+	*
+	* struct-stat-set! v 'st_blksize #t
+	*/
+	IDIO_USER_libc_TYPE_ASSERT (__blksize_t, val);
+
+        statp->st_blksize = IDIO_C_TYPE_libc___blksize_t (val);
+        return idio_S_unspec;
+    } else if (idio_S_st_blocks == member) {
+       /*
+	* Test Case: libc-errors/struct-stat-set-st_blocks-bad-value-type.idio
+	*
+	* struct-stat-set! v 'st_blocks #t
+	*/
+	IDIO_USER_libc_TYPE_ASSERT (__blkcnt_t, val);
+
+        statp->st_blocks = IDIO_C_TYPE_libc___blkcnt_t (val);
+        return idio_S_unspec;
+    } else if (idio_S_st_atim == member) {
+       /*
+	* Test Case: libc-errors/struct-stat-set-st_atim-bad-value-type.idio
+	*
+	* struct-stat-set! v 'st_atim #t
+	*/
+	IDIO_USER_C_TYPE_ASSERT (pointer, val);
+
+        struct timespec *valp = IDIO_C_TYPE_POINTER_P (val);
+        memcpy ((void *) &statp->st_atim, (void *) valp, sizeof (struct timespec));
+        return idio_S_unspec;
+    } else if (idio_S_st_mtim == member) {
+       /*
+	* Test Case: libc-errors/struct-stat-set-st_mtim-bad-value-type.idio
+	*
+	* struct-stat-set! v 'st_mtim #t
+	*/
+	IDIO_USER_C_TYPE_ASSERT (pointer, val);
+
+        struct timespec *valp = IDIO_C_TYPE_POINTER_P (val);
+        memcpy ((void *) &statp->st_mtim, (void *) valp, sizeof (struct timespec));
+        return idio_S_unspec;
+    } else if (idio_S_st_ctim == member) {
+       /*
+	* Test Case: libc-errors/struct-stat-set-st_ctim-bad-value-type.idio
+	*
+	* struct-stat-set! v 'st_ctim #t
+	*/
+	IDIO_USER_C_TYPE_ASSERT (pointer, val);
+
+        struct timespec *valp = IDIO_C_TYPE_POINTER_P (val);
+        memcpy ((void *) &statp->st_ctim, (void *) valp, sizeof (struct timespec));
+        return idio_S_unspec;
+    } else if (idio_S___glibc_reserved == member) {
+       /*
+	* Test Case: libc-errors/struct-stat-set-__glibc_reserved-bad-value-type.idio
+	*
+	* struct-stat-set! v '__glibc_reserved #t
+	*/
+	IDIO_USER_C_TYPE_ASSERT (pointer, val);
+
+        /*
+         * WARNING:
+         * __syscall_slong_t[] __glibc_reserved
+         *
+         * sizeof (statp->__glibc_reserved) is possibly incorrect
+         *
+         * check the API
+         */
+        __syscall_slong_t *valp = IDIO_C_TYPE_POINTER_P (val);
+        size_t alen = sizeof (statp->__glibc_reserved);
+        memcpy ((void *) &statp->__glibc_reserved, (void *) valp, alen);
+        return idio_S_unspec;
+    } else {
+	/*
+	 * Test Case: libc-errors/struct-stat-set-invalid-member.idio
+	 *
+	 * struct-stat-set! v 'not-likely #t
+	 */
+        idio_error_param_value_exp ("struct-stat-set!", "member", member, "C struct stat member", IDIO_C_FUNC_LOCATION());
+
+        return idio_S_notreached;
+    }
+
+    return idio_S_notreached;
+}
+
+IDIO idio_libc_struct_stat_as_string (struct stat *statp)
+{
+    IDIO_C_ASSERT (statp);
+
+    IDIO CSI_sh = idio_open_output_string_handle_C ();
+    idio_display_C ("#<CSI libc/struct-stat", CSI_sh);
+
+    char buf[BUFSIZ];
+    char *fmt;
+
+    idio_display_C (" st_dev:", CSI_sh);
+
+    fmt = idio_C_type_format_string (IDIO_TYPE_C_libc___dev_t);
+    idio_snprintf (buf, BUFSIZ, fmt, statp->st_dev);
+    idio_display_C (buf, CSI_sh);
+    idio_free (fmt);
+
+    idio_display_C (" st_ino:", CSI_sh);
+
+    fmt = idio_C_type_format_string (IDIO_TYPE_C_libc___ino_t);
+    idio_snprintf (buf, BUFSIZ, fmt, statp->st_ino);
+    idio_display_C (buf, CSI_sh);
+    idio_free (fmt);
+
+    idio_display_C (" st_nlink:", CSI_sh);
+
+    fmt = idio_C_type_format_string (IDIO_TYPE_C_libc___nlink_t);
+    idio_snprintf (buf, BUFSIZ, fmt, statp->st_nlink);
+    idio_display_C (buf, CSI_sh);
+    idio_free (fmt);
+
+    idio_display_C (" st_mode:", CSI_sh);
+
+    fmt = idio_C_type_format_string (IDIO_TYPE_C_libc___mode_t);
+    idio_snprintf (buf, BUFSIZ, fmt, statp->st_mode);
+    idio_display_C (buf, CSI_sh);
+    idio_free (fmt);
+
+    idio_display_C (" st_uid:", CSI_sh);
+
+    fmt = idio_C_type_format_string (IDIO_TYPE_C_libc___uid_t);
+    idio_snprintf (buf, BUFSIZ, fmt, statp->st_uid);
+    idio_display_C (buf, CSI_sh);
+    idio_free (fmt);
+
+    idio_display_C (" st_gid:", CSI_sh);
+
+    fmt = idio_C_type_format_string (IDIO_TYPE_C_libc___gid_t);
+    idio_snprintf (buf, BUFSIZ, fmt, statp->st_gid);
+    idio_display_C (buf, CSI_sh);
+    idio_free (fmt);
+
+    idio_display_C (" __pad0:", CSI_sh);
+
+    fmt = idio_C_type_format_string (IDIO_TYPE_C_INT);
+    idio_snprintf (buf, BUFSIZ, fmt, statp->__pad0);
+    idio_display_C (buf, CSI_sh);
+    idio_free (fmt);
+
+    idio_display_C (" st_rdev:", CSI_sh);
+
+    fmt = idio_C_type_format_string (IDIO_TYPE_C_libc___dev_t);
+    idio_snprintf (buf, BUFSIZ, fmt, statp->st_rdev);
+    idio_display_C (buf, CSI_sh);
+    idio_free (fmt);
+
+    idio_display_C (" st_size:", CSI_sh);
+
+    fmt = idio_C_type_format_string (IDIO_TYPE_C_libc___off_t);
+    idio_snprintf (buf, BUFSIZ, fmt, statp->st_size);
+    idio_display_C (buf, CSI_sh);
+    idio_free (fmt);
+
+    idio_display_C (" st_blksize:", CSI_sh);
+
+    fmt = idio_C_type_format_string (IDIO_TYPE_C_libc___blksize_t);
+    idio_snprintf (buf, BUFSIZ, fmt, statp->st_blksize);
+    idio_display_C (buf, CSI_sh);
+    idio_free (fmt);
+
+    idio_display_C (" st_blocks:", CSI_sh);
+
+    fmt = idio_C_type_format_string (IDIO_TYPE_C_libc___blkcnt_t);
+    idio_snprintf (buf, BUFSIZ, fmt, statp->st_blocks);
+    idio_display_C (buf, CSI_sh);
+    idio_free (fmt);
+
+    idio_display_C (" st_atim:", CSI_sh);
+
+    idio_display (idio_libc_struct_timespec_as_string (&(statp->st_atim)), CSI_sh);
+
+    idio_display_C (" st_mtim:", CSI_sh);
+
+    idio_display (idio_libc_struct_timespec_as_string (&(statp->st_mtim)), CSI_sh);
+
+    idio_display_C (" st_ctim:", CSI_sh);
+
+    idio_display (idio_libc_struct_timespec_as_string (&(statp->st_ctim)), CSI_sh);
+
+    idio_display_C (" __glibc_reserved:", CSI_sh);
+
+    idio_display_C ("<<1__syscall_slong_t[]>>", CSI_sh);
+
+    idio_display_C (">", CSI_sh);
+
+    return idio_get_output_string (CSI_sh);
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("struct-stat-as-string", libc_struct_stat_as_string, (IDIO stat), "stat", "\
+:param stat: :ref:`struct-stat <libc/struct-stat>`	\n\
+:type stat: C/pointer			\n\
+:return: string				\n\
+:rtype:	string				\n\
+")
+{
+    IDIO_ASSERT (stat);
+
+    /*
+     * Test Case: libc-errors/struct-stat-as-string-bad-pointer-type.idio
+     *
+     * struct-stat-as-string #t
+     */
+    IDIO_USER_C_TYPE_ASSERT (pointer, stat);
+    if (idio_CSI_libc_struct_stat != IDIO_C_TYPE_POINTER_PTYPE (stat)) {
+	/*
+	 * Test Case: libc-errors/struct-stat-as-string-invalid-pointer-type.idio
+	 *
+	 * struct-stat-as-string libc/NULL
+	 */
+	idio_error_param_value_exp ("struct-stat-as-string", "stat", stat, "C struct stat", IDIO_C_FUNC_LOCATION ());
+
+	return idio_S_notreached;
+    }
+
+    return idio_libc_struct_stat_as_string (IDIO_C_TYPE_POINTER_P (stat));
+}
+
+/*
+	/usr/include/x86_64-linux-gnu/bits/statvfs.h
+
+	struct statvfs
+	{
+	  long unsigned int    f_bsize;
+	  long unsigned int    f_frsize;
+	  __fsblkcnt_t         f_blocks;
+	  __fsblkcnt_t         f_bfree;
+	  __fsblkcnt_t         f_bavail;
+	  __fsfilcnt_t         f_files;
+	  __fsfilcnt_t         f_ffree;
+	  __fsfilcnt_t         f_favail;
+	  long unsigned int    f_fsid;
+	  long unsigned int    f_flag;
+	  long unsigned int    f_namemax;
+	  int[]                __f_spare;
+	};
+*/
+
+IDIO_C_STRUCT_IDENT_DECL (libc_struct_statvfs);
+IDIO_SYMBOL_DECL (f_bsize);
+IDIO_SYMBOL_DECL (f_frsize);
+IDIO_SYMBOL_DECL (f_blocks);
+IDIO_SYMBOL_DECL (f_bfree);
+IDIO_SYMBOL_DECL (f_bavail);
+IDIO_SYMBOL_DECL (f_files);
+IDIO_SYMBOL_DECL (f_ffree);
+IDIO_SYMBOL_DECL (f_favail);
+IDIO_SYMBOL_DECL (f_fsid);
+IDIO_SYMBOL_DECL (f_flag);
+IDIO_SYMBOL_DECL (f_namemax);
+IDIO_SYMBOL_DECL (__f_spare);
+
+IDIO_DEFINE_PRIMITIVE2_DS ("struct-statvfs-ref", libc_struct_statvfs_ref, (IDIO statvfs, IDIO member), "statvfs member", "\
+in C, :samp:`{statvfs}->{member}`			\n\
+					\n\
+:param statvfs: :ref:`struct-statvfs <libc/struct-statvfs>`	\n\
+:type statvfs: C/pointer		\n\
+:param member: member name		\n\
+:type member: symbol			\n\
+:return: `statvfs` -> `member`		\n\
+:rtype:	varies on `member`		\n\
+")
+{
+    IDIO_ASSERT (statvfs);
+    IDIO_ASSERT (member);
+
+    /*
+     * Test Case: libc-errors/struct-statvfs-ref-bad-pointer-type.idio
+     *
+     * struct-statvfs-ref #t #t
+     */
+    IDIO_USER_C_TYPE_ASSERT (pointer, statvfs);
+    if (idio_CSI_libc_struct_statvfs != IDIO_C_TYPE_POINTER_PTYPE (statvfs)) {
+	/*
+	 * Test Case: libc-errors/struct-statvfs-ref-invalid-pointer-type.idio
+	 *
+	 * struct-statvfs-ref libc/NULL #t
+	 */
+	idio_error_param_value_exp ("struct-statvfs-ref", "statvfs", statvfs, "C struct statvfs", IDIO_C_FUNC_LOCATION ());
+
+	return idio_S_notreached;
+    }
+
+    /*
+     * Test Case: libc-errors/struct-statvfs-ref-bad-member-type.idio
+     *
+     * struct-statvfs-ref v #t
+     */
+    IDIO_USER_TYPE_ASSERT (symbol, member);
+
+    struct statvfs *statvfsp = IDIO_C_TYPE_POINTER_P (statvfs);
+    if (idio_S_f_bsize == member) {
+        return idio_C_ulong (statvfsp->f_bsize);
+    } else if (idio_S_f_frsize == member) {
+        return idio_C_ulong (statvfsp->f_frsize);
+    } else if (idio_S_f_blocks == member) {
+        return idio_libc___fsblkcnt_t (statvfsp->f_blocks);
+    } else if (idio_S_f_bfree == member) {
+        return idio_libc___fsblkcnt_t (statvfsp->f_bfree);
+    } else if (idio_S_f_bavail == member) {
+        return idio_libc___fsblkcnt_t (statvfsp->f_bavail);
+    } else if (idio_S_f_files == member) {
+        return idio_libc___fsfilcnt_t (statvfsp->f_files);
+    } else if (idio_S_f_ffree == member) {
+        return idio_libc___fsfilcnt_t (statvfsp->f_ffree);
+    } else if (idio_S_f_favail == member) {
+        return idio_libc___fsfilcnt_t (statvfsp->f_favail);
+    } else if (idio_S_f_fsid == member) {
+        return idio_C_ulong (statvfsp->f_fsid);
+    } else if (idio_S_f_flag == member) {
+        return idio_C_ulong (statvfsp->f_flag);
+    } else if (idio_S_f_namemax == member) {
+        return idio_C_ulong (statvfsp->f_namemax);
+    } else if (idio_S___f_spare == member) {
+        /*
+         * WARNING:
+         * int[] __f_spare
+         *
+         * sizeof (statvfsp->__f_spare) is probably incorrect
+         *
+         * check the API
+         */
+        size_t alen = sizeof (statvfsp->__f_spare);
+        int *rp = (int *) idio_alloc (alen);
+        memcpy ((void *) rp, (void *) &statvfsp->__f_spare, alen);
+    } else {
+	/*
+	 * Test Case: libc-errors/struct-statvfs-ref-invalid-member.idio
+	 *
+	 * struct-statvfs-ref v 'not-likely
+	 */
+        idio_error_param_value_exp ("struct-statvfs-ref", "member", member, "C struct statvfs member", IDIO_C_FUNC_LOCATION());
+
+        return idio_S_notreached;
+    }
+
+    return idio_S_notreached;
+}
+
+IDIO_DEFINE_PRIMITIVE3_DS ("struct-statvfs-set!", libc_struct_statvfs_set, (IDIO statvfs, IDIO member, IDIO val), "statvfs member val", "\
+in C, :samp:`{statvfs}->{member} = {val}`		\n\
+					\n\
+:param statvfs: :ref:`struct-statvfs <libc/struct-statvfs>`	\n\
+:type statvfs: C/pointer		\n\
+:param member: member name		\n\
+:type member: symbol			\n\
+:param val: a C/ type			\n\
+:type val: varies on `member`		\n\
+:return: #<unspec>		\n\
+")
+{
+    IDIO_ASSERT (statvfs);
+    IDIO_ASSERT (member);
+    IDIO_ASSERT (val);
+
+
+    /*
+     * Test Case: libc-errors/struct-statvfs-set-bad-pointer-type.idio
+     *
+     * struct-statvfs-set! #t #t #t
+     */
+    IDIO_USER_C_TYPE_ASSERT (pointer, statvfs);
+    if (idio_CSI_libc_struct_statvfs != IDIO_C_TYPE_POINTER_PTYPE (statvfs)) {
+	/*
+	 * Test Case: libc-errors/struct-statvfs-set-invalid-pointer-type.idio
+	 *
+	 * struct-statvfs-set! libc/NULL #t #t
+	 */
+	idio_error_param_value_exp ("struct-statvfs-set!", "statvfs", statvfs, "C struct statvfs", IDIO_C_FUNC_LOCATION ());
+
+	return idio_S_notreached;
+    }
+
+    /*
+     * Test Case: libc-errors/struct-statvfs-set-bad-member-type.idio
+     *
+     * struct-statvfs-set! v #t #t
+     */
+    IDIO_USER_TYPE_ASSERT (symbol, member);
+
+    struct statvfs *statvfsp = IDIO_C_TYPE_POINTER_P (statvfs);
+    if (idio_S_f_bsize == member) {
+       /*
+	* Test Case: libc-errors/struct-statvfs-set-f_bsize-bad-value-type.idio
+	*
+	* struct-statvfs-set! v 'f_bsize #t
+	*/
+	IDIO_USER_C_TYPE_ASSERT (ulong, val);
+
+        statvfsp->f_bsize = IDIO_C_TYPE_ulong (val);
+        return idio_S_unspec;
+    } else if (idio_S_f_frsize == member) {
+       /*
+	* Test Case: libc-errors/struct-statvfs-set-f_frsize-bad-value-type.idio
+	*
+	* struct-statvfs-set! v 'f_frsize #t
+	*/
+	IDIO_USER_C_TYPE_ASSERT (ulong, val);
+
+        statvfsp->f_frsize = IDIO_C_TYPE_ulong (val);
+        return idio_S_unspec;
+    } else if (idio_S_f_blocks == member) {
+       /*
+	* Test Case: libc-errors/struct-statvfs-set-f_blocks-bad-value-type.idio
+	*
+	* struct-statvfs-set! v 'f_blocks #t
+	*/
+	IDIO_USER_libc_TYPE_ASSERT (__fsblkcnt_t, val);
+
+        statvfsp->f_blocks = IDIO_C_TYPE_libc___fsblkcnt_t (val);
+        return idio_S_unspec;
+    } else if (idio_S_f_bfree == member) {
+       /*
+	* Test Case: libc-errors/struct-statvfs-set-f_bfree-bad-value-type.idio
+	*
+	* struct-statvfs-set! v 'f_bfree #t
+	*/
+	IDIO_USER_libc_TYPE_ASSERT (__fsblkcnt_t, val);
+
+        statvfsp->f_bfree = IDIO_C_TYPE_libc___fsblkcnt_t (val);
+        return idio_S_unspec;
+    } else if (idio_S_f_bavail == member) {
+       /*
+	* Test Case: libc-errors/struct-statvfs-set-f_bavail-bad-value-type.idio
+	*
+	* struct-statvfs-set! v 'f_bavail #t
+	*/
+	IDIO_USER_libc_TYPE_ASSERT (__fsblkcnt_t, val);
+
+        statvfsp->f_bavail = IDIO_C_TYPE_libc___fsblkcnt_t (val);
+        return idio_S_unspec;
+    } else if (idio_S_f_files == member) {
+       /*
+	* Test Case: libc-errors/struct-statvfs-set-f_files-bad-value-type.idio
+	*
+	* struct-statvfs-set! v 'f_files #t
+	*/
+	IDIO_USER_libc_TYPE_ASSERT (__fsfilcnt_t, val);
+
+        statvfsp->f_files = IDIO_C_TYPE_libc___fsfilcnt_t (val);
+        return idio_S_unspec;
+    } else if (idio_S_f_ffree == member) {
+       /*
+	* Test Case: libc-errors/struct-statvfs-set-f_ffree-bad-value-type.idio
+	*
+	* struct-statvfs-set! v 'f_ffree #t
+	*/
+	IDIO_USER_libc_TYPE_ASSERT (__fsfilcnt_t, val);
+
+        statvfsp->f_ffree = IDIO_C_TYPE_libc___fsfilcnt_t (val);
+        return idio_S_unspec;
+    } else if (idio_S_f_favail == member) {
+       /*
+	* Test Case: libc-errors/struct-statvfs-set-f_favail-bad-value-type.idio
+	*
+	* struct-statvfs-set! v 'f_favail #t
+	*/
+	IDIO_USER_libc_TYPE_ASSERT (__fsfilcnt_t, val);
+
+        statvfsp->f_favail = IDIO_C_TYPE_libc___fsfilcnt_t (val);
+        return idio_S_unspec;
+    } else if (idio_S_f_fsid == member) {
+       /*
+	* Test Case: libc-errors/struct-statvfs-set-f_fsid-bad-value-type.idio
+	*
+	* struct-statvfs-set! v 'f_fsid #t
+	*/
+	IDIO_USER_C_TYPE_ASSERT (ulong, val);
+
+        statvfsp->f_fsid = IDIO_C_TYPE_ulong (val);
+        return idio_S_unspec;
+    } else if (idio_S_f_flag == member) {
+       /*
+	* Test Case: libc-errors/struct-statvfs-set-f_flag-bad-value-type.idio
+	*
+	* struct-statvfs-set! v 'f_flag #t
+	*/
+	IDIO_USER_C_TYPE_ASSERT (ulong, val);
+
+        statvfsp->f_flag = IDIO_C_TYPE_ulong (val);
+        return idio_S_unspec;
+    } else if (idio_S_f_namemax == member) {
+       /*
+	* Test Case: libc-errors/struct-statvfs-set-f_namemax-bad-value-type.idio
+	*
+	* struct-statvfs-set! v 'f_namemax #t
+	*/
+	IDIO_USER_C_TYPE_ASSERT (ulong, val);
+
+        statvfsp->f_namemax = IDIO_C_TYPE_ulong (val);
+        return idio_S_unspec;
+    } else if (idio_S___f_spare == member) {
+       /*
+	* Test Case: libc-errors/struct-statvfs-set-__f_spare-bad-value-type.idio
+	*
+	* struct-statvfs-set! v '__f_spare #t
+	*/
+	IDIO_USER_C_TYPE_ASSERT (pointer, val);
+
+        /*
+         * WARNING:
+         * int[] __f_spare
+         *
+         * sizeof (statvfsp->__f_spare) is possibly incorrect
+         *
+         * check the API
+         */
+        int *valp = IDIO_C_TYPE_POINTER_P (val);
+        size_t alen = sizeof (statvfsp->__f_spare);
+        memcpy ((void *) &statvfsp->__f_spare, (void *) valp, alen);
+        return idio_S_unspec;
+    } else {
+	/*
+	 * Test Case: libc-errors/struct-statvfs-set-invalid-member.idio
+	 *
+	 * struct-statvfs-set! v 'not-likely #t
+	 */
+        idio_error_param_value_exp ("struct-statvfs-set!", "member", member, "C struct statvfs member", IDIO_C_FUNC_LOCATION());
+
+        return idio_S_notreached;
+    }
+
+    return idio_S_notreached;
+}
+
+IDIO idio_libc_struct_statvfs_as_string (struct statvfs *statvfsp)
+{
+    IDIO_C_ASSERT (statvfsp);
+
+    IDIO CSI_sh = idio_open_output_string_handle_C ();
+    idio_display_C ("#<CSI libc/struct-statvfs", CSI_sh);
+
+    char buf[BUFSIZ];
+    char *fmt;
+
+    idio_display_C (" f_bsize:", CSI_sh);
+
+    fmt = idio_C_type_format_string (IDIO_TYPE_C_ULONG);
+    idio_snprintf (buf, BUFSIZ, fmt, statvfsp->f_bsize);
+    idio_display_C (buf, CSI_sh);
+    idio_free (fmt);
+
+    idio_display_C (" f_frsize:", CSI_sh);
+
+    fmt = idio_C_type_format_string (IDIO_TYPE_C_ULONG);
+    idio_snprintf (buf, BUFSIZ, fmt, statvfsp->f_frsize);
+    idio_display_C (buf, CSI_sh);
+    idio_free (fmt);
+
+    idio_display_C (" f_blocks:", CSI_sh);
+
+    fmt = idio_C_type_format_string (IDIO_TYPE_C_libc___fsblkcnt_t);
+    idio_snprintf (buf, BUFSIZ, fmt, statvfsp->f_blocks);
+    idio_display_C (buf, CSI_sh);
+    idio_free (fmt);
+
+    idio_display_C (" f_bfree:", CSI_sh);
+
+    fmt = idio_C_type_format_string (IDIO_TYPE_C_libc___fsblkcnt_t);
+    idio_snprintf (buf, BUFSIZ, fmt, statvfsp->f_bfree);
+    idio_display_C (buf, CSI_sh);
+    idio_free (fmt);
+
+    idio_display_C (" f_bavail:", CSI_sh);
+
+    fmt = idio_C_type_format_string (IDIO_TYPE_C_libc___fsblkcnt_t);
+    idio_snprintf (buf, BUFSIZ, fmt, statvfsp->f_bavail);
+    idio_display_C (buf, CSI_sh);
+    idio_free (fmt);
+
+    idio_display_C (" f_files:", CSI_sh);
+
+    fmt = idio_C_type_format_string (IDIO_TYPE_C_libc___fsfilcnt_t);
+    idio_snprintf (buf, BUFSIZ, fmt, statvfsp->f_files);
+    idio_display_C (buf, CSI_sh);
+    idio_free (fmt);
+
+    idio_display_C (" f_ffree:", CSI_sh);
+
+    fmt = idio_C_type_format_string (IDIO_TYPE_C_libc___fsfilcnt_t);
+    idio_snprintf (buf, BUFSIZ, fmt, statvfsp->f_ffree);
+    idio_display_C (buf, CSI_sh);
+    idio_free (fmt);
+
+    idio_display_C (" f_favail:", CSI_sh);
+
+    fmt = idio_C_type_format_string (IDIO_TYPE_C_libc___fsfilcnt_t);
+    idio_snprintf (buf, BUFSIZ, fmt, statvfsp->f_favail);
+    idio_display_C (buf, CSI_sh);
+    idio_free (fmt);
+
+    idio_display_C (" f_fsid:", CSI_sh);
+
+    fmt = idio_C_type_format_string (IDIO_TYPE_C_ULONG);
+    idio_snprintf (buf, BUFSIZ, fmt, statvfsp->f_fsid);
+    idio_display_C (buf, CSI_sh);
+    idio_free (fmt);
+
+    idio_display_C (" f_flag:", CSI_sh);
+
+    fmt = idio_C_type_format_string (IDIO_TYPE_C_ULONG);
+    idio_snprintf (buf, BUFSIZ, fmt, statvfsp->f_flag);
+    idio_display_C (buf, CSI_sh);
+    idio_free (fmt);
+
+    idio_display_C (" f_namemax:", CSI_sh);
+
+    fmt = idio_C_type_format_string (IDIO_TYPE_C_ULONG);
+    idio_snprintf (buf, BUFSIZ, fmt, statvfsp->f_namemax);
+    idio_display_C (buf, CSI_sh);
+    idio_free (fmt);
+
+    idio_display_C (" __f_spare:", CSI_sh);
+
+    idio_display_C ("<<1int[]>>", CSI_sh);
+
+    idio_display_C (">", CSI_sh);
+
+    return idio_get_output_string (CSI_sh);
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("struct-statvfs-as-string", libc_struct_statvfs_as_string, (IDIO statvfs), "statvfs", "\
+:param statvfs: :ref:`struct-statvfs <libc/struct-statvfs>`	\n\
+:type statvfs: C/pointer			\n\
+:return: string				\n\
+:rtype:	string				\n\
+")
+{
+    IDIO_ASSERT (statvfs);
+
+    /*
+     * Test Case: libc-errors/struct-statvfs-as-string-bad-pointer-type.idio
+     *
+     * struct-statvfs-as-string #t
+     */
+    IDIO_USER_C_TYPE_ASSERT (pointer, statvfs);
+    if (idio_CSI_libc_struct_statvfs != IDIO_C_TYPE_POINTER_PTYPE (statvfs)) {
+	/*
+	 * Test Case: libc-errors/struct-statvfs-as-string-invalid-pointer-type.idio
+	 *
+	 * struct-statvfs-as-string libc/NULL
+	 */
+	idio_error_param_value_exp ("struct-statvfs-as-string", "statvfs", statvfs, "C struct statvfs", IDIO_C_FUNC_LOCATION ());
+
+	return idio_S_notreached;
+    }
+
+    return idio_libc_struct_statvfs_as_string (IDIO_C_TYPE_POINTER_P (statvfs));
+}
+
+/*
+	/usr/include/x86_64-linux-gnu/bits/termios-struct.h
+
+	struct termios
+	{
+	  tcflag_t             c_iflag;
+	  tcflag_t             c_oflag;
+	  tcflag_t             c_cflag;
+	  tcflag_t             c_lflag;
+	  cc_t                 c_line;
+	  cc_t[]               c_cc;
+	  speed_t              c_ispeed;
+	  speed_t              c_ospeed;
+	};
+*/
+
+IDIO_C_STRUCT_IDENT_DECL (libc_struct_termios);
+IDIO_SYMBOL_DECL (c_iflag);
+IDIO_SYMBOL_DECL (c_oflag);
+IDIO_SYMBOL_DECL (c_cflag);
+IDIO_SYMBOL_DECL (c_lflag);
+IDIO_SYMBOL_DECL (c_line);
+IDIO_SYMBOL_DECL (c_cc);
+IDIO_SYMBOL_DECL (c_ispeed);
+IDIO_SYMBOL_DECL (c_ospeed);
+
+IDIO_DEFINE_PRIMITIVE2_DS ("struct-termios-ref", libc_struct_termios_ref, (IDIO termios, IDIO member), "termios member", "\
+in C, :samp:`{termios}->{member}`			\n\
+					\n\
+:param termios: :ref:`struct-termios <libc/struct-termios>`	\n\
+:type termios: C/pointer		\n\
+:param member: member name		\n\
+:type member: symbol			\n\
+:return: `termios` -> `member`		\n\
+:rtype:	varies on `member`		\n\
+")
+{
+    IDIO_ASSERT (termios);
+    IDIO_ASSERT (member);
+
+    /*
+     * Test Case: libc-errors/struct-termios-ref-bad-pointer-type.idio
+     *
+     * struct-termios-ref #t #t
+     */
+    IDIO_USER_C_TYPE_ASSERT (pointer, termios);
+    if (idio_CSI_libc_struct_termios != IDIO_C_TYPE_POINTER_PTYPE (termios)) {
+	/*
+	 * Test Case: libc-errors/struct-termios-ref-invalid-pointer-type.idio
+	 *
+	 * struct-termios-ref libc/NULL #t
+	 */
+	idio_error_param_value_exp ("struct-termios-ref", "termios", termios, "C struct termios", IDIO_C_FUNC_LOCATION ());
+
+	return idio_S_notreached;
+    }
+
+    /*
+     * Test Case: libc-errors/struct-termios-ref-bad-member-type.idio
+     *
+     * struct-termios-ref v #t
+     */
+    IDIO_USER_TYPE_ASSERT (symbol, member);
+
+    struct termios *termiosp = IDIO_C_TYPE_POINTER_P (termios);
+    if (idio_S_c_iflag == member) {
+        return idio_libc_tcflag_t (termiosp->c_iflag);
+    } else if (idio_S_c_oflag == member) {
+        return idio_libc_tcflag_t (termiosp->c_oflag);
+    } else if (idio_S_c_cflag == member) {
+        return idio_libc_tcflag_t (termiosp->c_cflag);
+    } else if (idio_S_c_lflag == member) {
+        return idio_libc_tcflag_t (termiosp->c_lflag);
+    } else if (idio_S_c_line == member) {
+        return idio_libc_cc_t (termiosp->c_line);
+    } else if (idio_S_c_cc == member) {
+        /*
+         * WARNING:
+         * cc_t[] c_cc
+         *
+         * sizeof (termiosp->c_cc) is probably incorrect
+         *
+         * check the API
+         */
+        size_t alen = sizeof (termiosp->c_cc);
+        cc_t *rp = (cc_t *) idio_alloc (alen);
+        memcpy ((void *) rp, (void *) &termiosp->c_cc, alen);
+    } else if (idio_S_c_ispeed == member) {
+        return idio_libc_speed_t (termiosp->c_ispeed);
+    } else if (idio_S_c_ospeed == member) {
+        return idio_libc_speed_t (termiosp->c_ospeed);
+    } else {
+	/*
+	 * Test Case: libc-errors/struct-termios-ref-invalid-member.idio
+	 *
+	 * struct-termios-ref v 'not-likely
+	 */
+        idio_error_param_value_exp ("struct-termios-ref", "member", member, "C struct termios member", IDIO_C_FUNC_LOCATION());
+
+        return idio_S_notreached;
+    }
+
+    return idio_S_notreached;
+}
+
+IDIO_DEFINE_PRIMITIVE3_DS ("struct-termios-set!", libc_struct_termios_set, (IDIO termios, IDIO member, IDIO val), "termios member val", "\
+in C, :samp:`{termios}->{member} = {val}`		\n\
+					\n\
+:param termios: :ref:`struct-termios <libc/struct-termios>`	\n\
+:type termios: C/pointer		\n\
+:param member: member name		\n\
+:type member: symbol			\n\
+:param val: a C/ type			\n\
+:type val: varies on `member`		\n\
+:return: #<unspec>		\n\
+")
+{
+    IDIO_ASSERT (termios);
+    IDIO_ASSERT (member);
+    IDIO_ASSERT (val);
+
+
+    /*
+     * Test Case: libc-errors/struct-termios-set-bad-pointer-type.idio
+     *
+     * struct-termios-set! #t #t #t
+     */
+    IDIO_USER_C_TYPE_ASSERT (pointer, termios);
+    if (idio_CSI_libc_struct_termios != IDIO_C_TYPE_POINTER_PTYPE (termios)) {
+	/*
+	 * Test Case: libc-errors/struct-termios-set-invalid-pointer-type.idio
+	 *
+	 * struct-termios-set! libc/NULL #t #t
+	 */
+	idio_error_param_value_exp ("struct-termios-set!", "termios", termios, "C struct termios", IDIO_C_FUNC_LOCATION ());
+
+	return idio_S_notreached;
+    }
+
+    /*
+     * Test Case: libc-errors/struct-termios-set-bad-member-type.idio
+     *
+     * struct-termios-set! v #t #t
+     */
+    IDIO_USER_TYPE_ASSERT (symbol, member);
+
+    struct termios *termiosp = IDIO_C_TYPE_POINTER_P (termios);
+    if (idio_S_c_iflag == member) {
+       /*
+	* Test Case: libc-errors/struct-termios-set-c_iflag-bad-value-type.idio
+	*
+	* struct-termios-set! v 'c_iflag #t
+	*/
+	IDIO_USER_libc_TYPE_ASSERT (tcflag_t, val);
+
+        termiosp->c_iflag = IDIO_C_TYPE_libc_tcflag_t (val);
+        return idio_S_unspec;
+    } else if (idio_S_c_oflag == member) {
+       /*
+	* Test Case: libc-errors/struct-termios-set-c_oflag-bad-value-type.idio
+	*
+	* struct-termios-set! v 'c_oflag #t
+	*/
+	IDIO_USER_libc_TYPE_ASSERT (tcflag_t, val);
+
+        termiosp->c_oflag = IDIO_C_TYPE_libc_tcflag_t (val);
+        return idio_S_unspec;
+    } else if (idio_S_c_cflag == member) {
+       /*
+	* Test Case: libc-errors/struct-termios-set-c_cflag-bad-value-type.idio
+	*
+	* struct-termios-set! v 'c_cflag #t
+	*/
+	IDIO_USER_libc_TYPE_ASSERT (tcflag_t, val);
+
+        termiosp->c_cflag = IDIO_C_TYPE_libc_tcflag_t (val);
+        return idio_S_unspec;
+    } else if (idio_S_c_lflag == member) {
+       /*
+	* Test Case: libc-errors/struct-termios-set-c_lflag-bad-value-type.idio
+	*
+	* struct-termios-set! v 'c_lflag #t
+	*/
+	IDIO_USER_libc_TYPE_ASSERT (tcflag_t, val);
+
+        termiosp->c_lflag = IDIO_C_TYPE_libc_tcflag_t (val);
+        return idio_S_unspec;
+    } else if (idio_S_c_line == member) {
+       /*
+	* Test Case: libc-errors/struct-termios-set-c_line-bad-value-type.idio
+	*
+	* struct-termios-set! v 'c_line #t
+	*/
+	IDIO_USER_libc_TYPE_ASSERT (cc_t, val);
+
+        termiosp->c_line = IDIO_C_TYPE_libc_cc_t (val);
+        return idio_S_unspec;
+    } else if (idio_S_c_cc == member) {
+       /*
+	* Test Case: libc-errors/struct-termios-set-c_cc-bad-value-type.idio
+	*
+	* struct-termios-set! v 'c_cc #t
+	*/
+	IDIO_USER_C_TYPE_ASSERT (pointer, val);
+
+        /*
+         * WARNING:
+         * cc_t[] c_cc
+         *
+         * sizeof (termiosp->c_cc) is possibly incorrect
+         *
+         * check the API
+         */
+        cc_t *valp = IDIO_C_TYPE_POINTER_P (val);
+        size_t alen = sizeof (termiosp->c_cc);
+        memcpy ((void *) &termiosp->c_cc, (void *) valp, alen);
+        return idio_S_unspec;
+    } else if (idio_S_c_ispeed == member) {
+       /*
+	* Test Case: libc-errors/struct-termios-set-c_ispeed-bad-value-type.idio
+	*
+	* struct-termios-set! v 'c_ispeed #t
+	*/
+	IDIO_USER_libc_TYPE_ASSERT (speed_t, val);
+
+        termiosp->c_ispeed = IDIO_C_TYPE_libc_speed_t (val);
+        return idio_S_unspec;
+    } else if (idio_S_c_ospeed == member) {
+       /*
+	* Test Case: libc-errors/struct-termios-set-c_ospeed-bad-value-type.idio
+	*
+	* struct-termios-set! v 'c_ospeed #t
+	*/
+	IDIO_USER_libc_TYPE_ASSERT (speed_t, val);
+
+        termiosp->c_ospeed = IDIO_C_TYPE_libc_speed_t (val);
+        return idio_S_unspec;
+    } else {
+	/*
+	 * Test Case: libc-errors/struct-termios-set-invalid-member.idio
+	 *
+	 * struct-termios-set! v 'not-likely #t
+	 */
+        idio_error_param_value_exp ("struct-termios-set!", "member", member, "C struct termios member", IDIO_C_FUNC_LOCATION());
+
+        return idio_S_notreached;
+    }
+
+    return idio_S_notreached;
+}
+
+IDIO idio_libc_struct_termios_as_string (struct termios *termiosp)
+{
+    IDIO_C_ASSERT (termiosp);
+
+    IDIO CSI_sh = idio_open_output_string_handle_C ();
+    idio_display_C ("#<CSI libc/struct-termios", CSI_sh);
+
+    char buf[BUFSIZ];
+    char *fmt;
+
+    idio_display_C (" c_iflag:", CSI_sh);
+
+    fmt = idio_C_type_format_string (IDIO_TYPE_C_libc_tcflag_t);
+    idio_snprintf (buf, BUFSIZ, fmt, termiosp->c_iflag);
+    idio_display_C (buf, CSI_sh);
+    idio_free (fmt);
+
+    idio_display_C (" c_oflag:", CSI_sh);
+
+    fmt = idio_C_type_format_string (IDIO_TYPE_C_libc_tcflag_t);
+    idio_snprintf (buf, BUFSIZ, fmt, termiosp->c_oflag);
+    idio_display_C (buf, CSI_sh);
+    idio_free (fmt);
+
+    idio_display_C (" c_cflag:", CSI_sh);
+
+    fmt = idio_C_type_format_string (IDIO_TYPE_C_libc_tcflag_t);
+    idio_snprintf (buf, BUFSIZ, fmt, termiosp->c_cflag);
+    idio_display_C (buf, CSI_sh);
+    idio_free (fmt);
+
+    idio_display_C (" c_lflag:", CSI_sh);
+
+    fmt = idio_C_type_format_string (IDIO_TYPE_C_libc_tcflag_t);
+    idio_snprintf (buf, BUFSIZ, fmt, termiosp->c_lflag);
+    idio_display_C (buf, CSI_sh);
+    idio_free (fmt);
+
+    idio_display_C (" c_line:", CSI_sh);
+
+    fmt = idio_C_type_format_string (IDIO_TYPE_C_libc_cc_t);
+    idio_snprintf (buf, BUFSIZ, fmt, termiosp->c_line);
+    idio_display_C (buf, CSI_sh);
+    idio_free (fmt);
+
+    idio_display_C (" c_cc:", CSI_sh);
+
+    idio_display_C ("<<1cc_t[]>>", CSI_sh);
+
+    idio_display_C (" c_ispeed:", CSI_sh);
+
+    fmt = idio_C_type_format_string (IDIO_TYPE_C_libc_speed_t);
+    idio_snprintf (buf, BUFSIZ, fmt, termiosp->c_ispeed);
+    idio_display_C (buf, CSI_sh);
+    idio_free (fmt);
+
+    idio_display_C (" c_ospeed:", CSI_sh);
+
+    fmt = idio_C_type_format_string (IDIO_TYPE_C_libc_speed_t);
+    idio_snprintf (buf, BUFSIZ, fmt, termiosp->c_ospeed);
+    idio_display_C (buf, CSI_sh);
+    idio_free (fmt);
+
+    idio_display_C (">", CSI_sh);
+
+    return idio_get_output_string (CSI_sh);
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("struct-termios-as-string", libc_struct_termios_as_string, (IDIO termios), "termios", "\
+:param termios: :ref:`struct-termios <libc/struct-termios>`	\n\
+:type termios: C/pointer			\n\
+:return: string				\n\
+:rtype:	string				\n\
+")
+{
+    IDIO_ASSERT (termios);
+
+    /*
+     * Test Case: libc-errors/struct-termios-as-string-bad-pointer-type.idio
+     *
+     * struct-termios-as-string #t
+     */
+    IDIO_USER_C_TYPE_ASSERT (pointer, termios);
+    if (idio_CSI_libc_struct_termios != IDIO_C_TYPE_POINTER_PTYPE (termios)) {
+	/*
+	 * Test Case: libc-errors/struct-termios-as-string-invalid-pointer-type.idio
+	 *
+	 * struct-termios-as-string libc/NULL
+	 */
+	idio_error_param_value_exp ("struct-termios-as-string", "termios", termios, "C struct termios", IDIO_C_FUNC_LOCATION ());
+
+	return idio_S_notreached;
+    }
+
+    return idio_libc_struct_termios_as_string (IDIO_C_TYPE_POINTER_P (termios));
+}
+
+/*
+	/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h
+
+	struct timespec
+	{
+	  __time_t             tv_sec;
+	  __syscall_slong_t    tv_nsec;
+	};
+*/
+
+IDIO_C_STRUCT_IDENT_DECL (libc_struct_timespec);
+IDIO_SYMBOL_DECL (tv_sec);
+IDIO_SYMBOL_DECL (tv_nsec);
+
+IDIO_DEFINE_PRIMITIVE2_DS ("struct-timespec-ref", libc_struct_timespec_ref, (IDIO timespec, IDIO member), "timespec member", "\
+in C, :samp:`{timespec}->{member}`			\n\
+					\n\
+:param timespec: :ref:`struct-timespec <libc/struct-timespec>`	\n\
+:type timespec: C/pointer		\n\
+:param member: member name		\n\
+:type member: symbol			\n\
+:return: `timespec` -> `member`		\n\
+:rtype:	varies on `member`		\n\
+")
+{
+    IDIO_ASSERT (timespec);
+    IDIO_ASSERT (member);
+
+    /*
+     * Test Case: libc-errors/struct-timespec-ref-bad-pointer-type.idio
+     *
+     * struct-timespec-ref #t #t
+     */
+    IDIO_USER_C_TYPE_ASSERT (pointer, timespec);
+    if (idio_CSI_libc_struct_timespec != IDIO_C_TYPE_POINTER_PTYPE (timespec)) {
+	/*
+	 * Test Case: libc-errors/struct-timespec-ref-invalid-pointer-type.idio
+	 *
+	 * struct-timespec-ref libc/NULL #t
+	 */
+	idio_error_param_value_exp ("struct-timespec-ref", "timespec", timespec, "C struct timespec", IDIO_C_FUNC_LOCATION ());
+
+	return idio_S_notreached;
+    }
+
+    /*
+     * Test Case: libc-errors/struct-timespec-ref-bad-member-type.idio
+     *
+     * struct-timespec-ref v #t
+     */
+    IDIO_USER_TYPE_ASSERT (symbol, member);
+
+    struct timespec *timespecp = IDIO_C_TYPE_POINTER_P (timespec);
+    if (idio_S_tv_sec == member) {
+        return idio_libc___time_t (timespecp->tv_sec);
+    } else if (idio_S_tv_nsec == member) {
+        return idio_libc___syscall_slong_t (timespecp->tv_nsec);
+    } else {
+	/*
+	 * Test Case: libc-errors/struct-timespec-ref-invalid-member.idio
+	 *
+	 * struct-timespec-ref v 'not-likely
+	 */
+        idio_error_param_value_exp ("struct-timespec-ref", "member", member, "C struct timespec member", IDIO_C_FUNC_LOCATION());
+
+        return idio_S_notreached;
+    }
+
+    return idio_S_notreached;
+}
+
+IDIO_DEFINE_PRIMITIVE3_DS ("struct-timespec-set!", libc_struct_timespec_set, (IDIO timespec, IDIO member, IDIO val), "timespec member val", "\
+in C, :samp:`{timespec}->{member} = {val}`		\n\
+					\n\
+:param timespec: :ref:`struct-timespec <libc/struct-timespec>`	\n\
+:type timespec: C/pointer		\n\
+:param member: member name		\n\
+:type member: symbol			\n\
+:param val: a C/ type			\n\
+:type val: varies on `member`		\n\
+:return: #<unspec>		\n\
+")
+{
+    IDIO_ASSERT (timespec);
+    IDIO_ASSERT (member);
+    IDIO_ASSERT (val);
+
+
+    /*
+     * Test Case: libc-errors/struct-timespec-set-bad-pointer-type.idio
+     *
+     * struct-timespec-set! #t #t #t
+     */
+    IDIO_USER_C_TYPE_ASSERT (pointer, timespec);
+    if (idio_CSI_libc_struct_timespec != IDIO_C_TYPE_POINTER_PTYPE (timespec)) {
+	/*
+	 * Test Case: libc-errors/struct-timespec-set-invalid-pointer-type.idio
+	 *
+	 * struct-timespec-set! libc/NULL #t #t
+	 */
+	idio_error_param_value_exp ("struct-timespec-set!", "timespec", timespec, "C struct timespec", IDIO_C_FUNC_LOCATION ());
+
+	return idio_S_notreached;
+    }
+
+    /*
+     * Test Case: libc-errors/struct-timespec-set-bad-member-type.idio
+     *
+     * struct-timespec-set! v #t #t
+     */
+    IDIO_USER_TYPE_ASSERT (symbol, member);
+
+    struct timespec *timespecp = IDIO_C_TYPE_POINTER_P (timespec);
+    if (idio_S_tv_sec == member) {
+       /*
+	* Test Case: libc-errors/struct-timespec-set-tv_sec-bad-value-type.idio
+	*
+	* struct-timespec-set! v 'tv_sec #t
+	*/
+	IDIO_USER_libc_TYPE_ASSERT (__time_t, val);
+
+        timespecp->tv_sec = IDIO_C_TYPE_libc___time_t (val);
+        return idio_S_unspec;
+    } else if (idio_S_tv_nsec == member) {
+       /*
+	* Test Case: libc-errors/struct-timespec-set-tv_nsec-bad-value-type.idio
+	*
+	* struct-timespec-set! v 'tv_nsec #t
+	*/
+	IDIO_USER_libc_TYPE_ASSERT (__syscall_slong_t, val);
+
+        timespecp->tv_nsec = IDIO_C_TYPE_libc___syscall_slong_t (val);
+        return idio_S_unspec;
+    } else {
+	/*
+	 * Test Case: libc-errors/struct-timespec-set-invalid-member.idio
+	 *
+	 * struct-timespec-set! v 'not-likely #t
+	 */
+        idio_error_param_value_exp ("struct-timespec-set!", "member", member, "C struct timespec member", IDIO_C_FUNC_LOCATION());
+
+        return idio_S_notreached;
+    }
+
+    return idio_S_notreached;
+}
+
+IDIO idio_libc_struct_timespec_as_string (struct timespec *timespecp)
+{
+    IDIO_C_ASSERT (timespecp);
+
+    IDIO CSI_sh = idio_open_output_string_handle_C ();
+    idio_display_C ("#<CSI libc/struct-timespec", CSI_sh);
+
+    char buf[BUFSIZ];
+    char *fmt;
+
+    idio_display_C (" tv_sec:", CSI_sh);
+
+    fmt = idio_C_type_format_string (IDIO_TYPE_C_libc___time_t);
+    idio_snprintf (buf, BUFSIZ, fmt, timespecp->tv_sec);
+    idio_display_C (buf, CSI_sh);
+    idio_free (fmt);
+
+    idio_display_C (" tv_nsec:", CSI_sh);
+
+    fmt = idio_C_type_format_string (IDIO_TYPE_C_libc___syscall_slong_t);
+    idio_snprintf (buf, BUFSIZ, fmt, timespecp->tv_nsec);
+    idio_display_C (buf, CSI_sh);
+    idio_free (fmt);
+
+    idio_display_C (">", CSI_sh);
+
+    return idio_get_output_string (CSI_sh);
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("struct-timespec-as-string", libc_struct_timespec_as_string, (IDIO timespec), "timespec", "\
+:param timespec: :ref:`struct-timespec <libc/struct-timespec>`	\n\
+:type timespec: C/pointer			\n\
+:return: string				\n\
+:rtype:	string				\n\
+")
+{
+    IDIO_ASSERT (timespec);
+
+    /*
+     * Test Case: libc-errors/struct-timespec-as-string-bad-pointer-type.idio
+     *
+     * struct-timespec-as-string #t
+     */
+    IDIO_USER_C_TYPE_ASSERT (pointer, timespec);
+    if (idio_CSI_libc_struct_timespec != IDIO_C_TYPE_POINTER_PTYPE (timespec)) {
+	/*
+	 * Test Case: libc-errors/struct-timespec-as-string-invalid-pointer-type.idio
+	 *
+	 * struct-timespec-as-string libc/NULL
+	 */
+	idio_error_param_value_exp ("struct-timespec-as-string", "timespec", timespec, "C struct timespec", IDIO_C_FUNC_LOCATION ());
+
+	return idio_S_notreached;
+    }
+
+    return idio_libc_struct_timespec_as_string (IDIO_C_TYPE_POINTER_P (timespec));
+}
+
+/*
+	/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h
+
+	struct timeval
+	{
+	  __time_t             tv_sec;
+	  __suseconds_t        tv_usec;
+	};
+*/
+
+IDIO_C_STRUCT_IDENT_DECL (libc_struct_timeval);
+/* tv_sec previously declared */
+IDIO_SYMBOL_DECL (tv_usec);
+
+IDIO_DEFINE_PRIMITIVE2_DS ("struct-timeval-ref", libc_struct_timeval_ref, (IDIO timeval, IDIO member), "timeval member", "\
+in C, :samp:`{timeval}->{member}`			\n\
+					\n\
+:param timeval: :ref:`struct-timeval <libc/struct-timeval>`	\n\
+:type timeval: C/pointer		\n\
+:param member: member name		\n\
+:type member: symbol			\n\
+:return: `timeval` -> `member`		\n\
+:rtype:	varies on `member`		\n\
+")
+{
+    IDIO_ASSERT (timeval);
+    IDIO_ASSERT (member);
+
+    /*
+     * Test Case: libc-errors/struct-timeval-ref-bad-pointer-type.idio
+     *
+     * struct-timeval-ref #t #t
+     */
+    IDIO_USER_C_TYPE_ASSERT (pointer, timeval);
+    if (idio_CSI_libc_struct_timeval != IDIO_C_TYPE_POINTER_PTYPE (timeval)) {
+	/*
+	 * Test Case: libc-errors/struct-timeval-ref-invalid-pointer-type.idio
+	 *
+	 * struct-timeval-ref libc/NULL #t
+	 */
+	idio_error_param_value_exp ("struct-timeval-ref", "timeval", timeval, "C struct timeval", IDIO_C_FUNC_LOCATION ());
+
+	return idio_S_notreached;
+    }
+
+    /*
+     * Test Case: libc-errors/struct-timeval-ref-bad-member-type.idio
+     *
+     * struct-timeval-ref v #t
+     */
+    IDIO_USER_TYPE_ASSERT (symbol, member);
+
+    struct timeval *timevalp = IDIO_C_TYPE_POINTER_P (timeval);
+    if (idio_S_tv_sec == member) {
+        return idio_libc___time_t (timevalp->tv_sec);
+    } else if (idio_S_tv_usec == member) {
+        return idio_libc___suseconds_t (timevalp->tv_usec);
+    } else {
+	/*
+	 * Test Case: libc-errors/struct-timeval-ref-invalid-member.idio
+	 *
+	 * struct-timeval-ref v 'not-likely
+	 */
+        idio_error_param_value_exp ("struct-timeval-ref", "member", member, "C struct timeval member", IDIO_C_FUNC_LOCATION());
+
+        return idio_S_notreached;
+    }
+
+    return idio_S_notreached;
+}
+
+IDIO_DEFINE_PRIMITIVE3_DS ("struct-timeval-set!", libc_struct_timeval_set, (IDIO timeval, IDIO member, IDIO val), "timeval member val", "\
+in C, :samp:`{timeval}->{member} = {val}`		\n\
+					\n\
+:param timeval: :ref:`struct-timeval <libc/struct-timeval>`	\n\
+:type timeval: C/pointer		\n\
+:param member: member name		\n\
+:type member: symbol			\n\
+:param val: a C/ type			\n\
+:type val: varies on `member`		\n\
+:return: #<unspec>		\n\
+")
+{
+    IDIO_ASSERT (timeval);
+    IDIO_ASSERT (member);
+    IDIO_ASSERT (val);
+
+
+    /*
+     * Test Case: libc-errors/struct-timeval-set-bad-pointer-type.idio
+     *
+     * struct-timeval-set! #t #t #t
+     */
+    IDIO_USER_C_TYPE_ASSERT (pointer, timeval);
+    if (idio_CSI_libc_struct_timeval != IDIO_C_TYPE_POINTER_PTYPE (timeval)) {
+	/*
+	 * Test Case: libc-errors/struct-timeval-set-invalid-pointer-type.idio
+	 *
+	 * struct-timeval-set! libc/NULL #t #t
+	 */
+	idio_error_param_value_exp ("struct-timeval-set!", "timeval", timeval, "C struct timeval", IDIO_C_FUNC_LOCATION ());
+
+	return idio_S_notreached;
+    }
+
+    /*
+     * Test Case: libc-errors/struct-timeval-set-bad-member-type.idio
+     *
+     * struct-timeval-set! v #t #t
+     */
+    IDIO_USER_TYPE_ASSERT (symbol, member);
+
+    struct timeval *timevalp = IDIO_C_TYPE_POINTER_P (timeval);
+    if (idio_S_tv_sec == member) {
+       /*
+	* Test Case: libc-errors/struct-timeval-set-tv_sec-bad-value-type.idio
+	*
+	* struct-timeval-set! v 'tv_sec #t
+	*/
+	IDIO_USER_libc_TYPE_ASSERT (__time_t, val);
+
+        timevalp->tv_sec = IDIO_C_TYPE_libc___time_t (val);
+        return idio_S_unspec;
+    } else if (idio_S_tv_usec == member) {
+       /*
+	* Test Case: libc-errors/struct-timeval-set-tv_usec-bad-value-type.idio
+	*
+	* struct-timeval-set! v 'tv_usec #t
+	*/
+	IDIO_USER_libc_TYPE_ASSERT (__suseconds_t, val);
+
+        timevalp->tv_usec = IDIO_C_TYPE_libc___suseconds_t (val);
+        return idio_S_unspec;
+    } else {
+	/*
+	 * Test Case: libc-errors/struct-timeval-set-invalid-member.idio
+	 *
+	 * struct-timeval-set! v 'not-likely #t
+	 */
+        idio_error_param_value_exp ("struct-timeval-set!", "member", member, "C struct timeval member", IDIO_C_FUNC_LOCATION());
+
+        return idio_S_notreached;
+    }
+
+    return idio_S_notreached;
+}
+
+IDIO idio_libc_struct_timeval_as_string (struct timeval *timevalp)
+{
+    IDIO_C_ASSERT (timevalp);
+
+    IDIO CSI_sh = idio_open_output_string_handle_C ();
+    idio_display_C ("#<CSI libc/struct-timeval", CSI_sh);
+
+    char buf[BUFSIZ];
+    char *fmt;
+
+    idio_display_C (" tv_sec:", CSI_sh);
+
+    fmt = idio_C_type_format_string (IDIO_TYPE_C_libc___time_t);
+    idio_snprintf (buf, BUFSIZ, fmt, timevalp->tv_sec);
+    idio_display_C (buf, CSI_sh);
+    idio_free (fmt);
+
+    idio_display_C (" tv_usec:", CSI_sh);
+
+    fmt = idio_C_type_format_string (IDIO_TYPE_C_libc___suseconds_t);
+    idio_snprintf (buf, BUFSIZ, fmt, timevalp->tv_usec);
+    idio_display_C (buf, CSI_sh);
+    idio_free (fmt);
+
+    idio_display_C (">", CSI_sh);
+
+    return idio_get_output_string (CSI_sh);
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("struct-timeval-as-string", libc_struct_timeval_as_string, (IDIO timeval), "timeval", "\
+:param timeval: :ref:`struct-timeval <libc/struct-timeval>`	\n\
+:type timeval: C/pointer			\n\
+:return: string				\n\
+:rtype:	string				\n\
+")
+{
+    IDIO_ASSERT (timeval);
+
+    /*
+     * Test Case: libc-errors/struct-timeval-as-string-bad-pointer-type.idio
+     *
+     * struct-timeval-as-string #t
+     */
+    IDIO_USER_C_TYPE_ASSERT (pointer, timeval);
+    if (idio_CSI_libc_struct_timeval != IDIO_C_TYPE_POINTER_PTYPE (timeval)) {
+	/*
+	 * Test Case: libc-errors/struct-timeval-as-string-invalid-pointer-type.idio
+	 *
+	 * struct-timeval-as-string libc/NULL
+	 */
+	idio_error_param_value_exp ("struct-timeval-as-string", "timeval", timeval, "C struct timeval", IDIO_C_FUNC_LOCATION ());
+
+	return idio_S_notreached;
+    }
+
+    return idio_libc_struct_timeval_as_string (IDIO_C_TYPE_POINTER_P (timeval));
+}
+
+/*
+	/usr/include/x86_64-linux-gnu/bits/types/struct_tm.h
+
+	struct tm
+	{
+	  int                  tm_sec;
+	  int                  tm_min;
+	  int                  tm_hour;
+	  int                  tm_mday;
+	  int                  tm_mon;
+	  int                  tm_year;
+	  int                  tm_wday;
+	  int                  tm_yday;
+	  int                  tm_isdst;
+	  long int             tm_gmtoff;
+	  char*                tm_zone;
+	};
+*/
+
+IDIO_C_STRUCT_IDENT_DECL (libc_struct_tm);
+IDIO_SYMBOL_DECL (tm_sec);
+IDIO_SYMBOL_DECL (tm_min);
+IDIO_SYMBOL_DECL (tm_hour);
+IDIO_SYMBOL_DECL (tm_mday);
+IDIO_SYMBOL_DECL (tm_mon);
+IDIO_SYMBOL_DECL (tm_year);
+IDIO_SYMBOL_DECL (tm_wday);
+IDIO_SYMBOL_DECL (tm_yday);
+IDIO_SYMBOL_DECL (tm_isdst);
+IDIO_SYMBOL_DECL (tm_gmtoff);
+IDIO_SYMBOL_DECL (tm_zone);
+
+IDIO_DEFINE_PRIMITIVE2_DS ("struct-tm-ref", libc_struct_tm_ref, (IDIO tm, IDIO member), "tm member", "\
+in C, :samp:`{tm}->{member}`			\n\
+					\n\
+:param tm: :ref:`struct-tm <libc/struct-tm>`	\n\
+:type tm: C/pointer		\n\
+:param member: member name		\n\
+:type member: symbol			\n\
+:return: `tm` -> `member`		\n\
+:rtype:	varies on `member`		\n\
+")
+{
+    IDIO_ASSERT (tm);
+    IDIO_ASSERT (member);
+
+    /*
+     * Test Case: libc-errors/struct-tm-ref-bad-pointer-type.idio
+     *
+     * struct-tm-ref #t #t
+     */
+    IDIO_USER_C_TYPE_ASSERT (pointer, tm);
+    if (idio_CSI_libc_struct_tm != IDIO_C_TYPE_POINTER_PTYPE (tm)) {
+	/*
+	 * Test Case: libc-errors/struct-tm-ref-invalid-pointer-type.idio
+	 *
+	 * struct-tm-ref libc/NULL #t
+	 */
+	idio_error_param_value_exp ("struct-tm-ref", "tm", tm, "C struct tm", IDIO_C_FUNC_LOCATION ());
+
+	return idio_S_notreached;
+    }
+
+    /*
+     * Test Case: libc-errors/struct-tm-ref-bad-member-type.idio
+     *
+     * struct-tm-ref v #t
+     */
+    IDIO_USER_TYPE_ASSERT (symbol, member);
+
+    struct tm *tmp = IDIO_C_TYPE_POINTER_P (tm);
+    if (idio_S_tm_sec == member) {
+        return idio_C_int (tmp->tm_sec);
+    } else if (idio_S_tm_min == member) {
+        return idio_C_int (tmp->tm_min);
+    } else if (idio_S_tm_hour == member) {
+        return idio_C_int (tmp->tm_hour);
+    } else if (idio_S_tm_mday == member) {
+        return idio_C_int (tmp->tm_mday);
+    } else if (idio_S_tm_mon == member) {
+        return idio_C_int (tmp->tm_mon);
+    } else if (idio_S_tm_year == member) {
+        return idio_C_int (tmp->tm_year);
+    } else if (idio_S_tm_wday == member) {
+        return idio_C_int (tmp->tm_wday);
+    } else if (idio_S_tm_yday == member) {
+        return idio_C_int (tmp->tm_yday);
+    } else if (idio_S_tm_isdst == member) {
+        return idio_C_int (tmp->tm_isdst);
+    } else if (idio_S_tm_gmtoff == member) {
+        return idio_C_long (tmp->tm_gmtoff);
+    } else if (idio_S_tm_zone == member) {
+        /*
+         * WARNING:
+         * char* tm_zone
+         *
+         * sizeof (tmp->tm_zone) is dubious
+         *
+         * check the API
+         */
+        size_t slen = sizeof (tmp->tm_zone);
+        char* rp = (char*) idio_alloc (slen);
+        memcpy ((void *) rp, (void *) &tmp->tm_zone, slen);
+    } else {
+	/*
+	 * Test Case: libc-errors/struct-tm-ref-invalid-member.idio
+	 *
+	 * struct-tm-ref v 'not-likely
+	 */
+        idio_error_param_value_exp ("struct-tm-ref", "member", member, "C struct tm member", IDIO_C_FUNC_LOCATION());
+
+        return idio_S_notreached;
+    }
+
+    return idio_S_notreached;
+}
+
+IDIO_DEFINE_PRIMITIVE3_DS ("struct-tm-set!", libc_struct_tm_set, (IDIO tm, IDIO member, IDIO val), "tm member val", "\
+in C, :samp:`{tm}->{member} = {val}`		\n\
+					\n\
+:param tm: :ref:`struct-tm <libc/struct-tm>`	\n\
+:type tm: C/pointer		\n\
+:param member: member name		\n\
+:type member: symbol			\n\
+:param val: a C/ type			\n\
+:type val: varies on `member`		\n\
+:return: #<unspec>		\n\
+")
+{
+    IDIO_ASSERT (tm);
+    IDIO_ASSERT (member);
+    IDIO_ASSERT (val);
+
+
+    /*
+     * Test Case: libc-errors/struct-tm-set-bad-pointer-type.idio
+     *
+     * struct-tm-set! #t #t #t
+     */
+    IDIO_USER_C_TYPE_ASSERT (pointer, tm);
+    if (idio_CSI_libc_struct_tm != IDIO_C_TYPE_POINTER_PTYPE (tm)) {
+	/*
+	 * Test Case: libc-errors/struct-tm-set-invalid-pointer-type.idio
+	 *
+	 * struct-tm-set! libc/NULL #t #t
+	 */
+	idio_error_param_value_exp ("struct-tm-set!", "tm", tm, "C struct tm", IDIO_C_FUNC_LOCATION ());
+
+	return idio_S_notreached;
+    }
+
+    /*
+     * Test Case: libc-errors/struct-tm-set-bad-member-type.idio
+     *
+     * struct-tm-set! v #t #t
+     */
+    IDIO_USER_TYPE_ASSERT (symbol, member);
+
+    struct tm *tmp = IDIO_C_TYPE_POINTER_P (tm);
+    if (idio_S_tm_sec == member) {
+       /*
+	* Test Case: libc-errors/struct-tm-set-tm_sec-bad-value-type.idio
+	*
+	* struct-tm-set! v 'tm_sec #t
+	*/
+	IDIO_USER_C_TYPE_ASSERT (int, val);
+
+        tmp->tm_sec = IDIO_C_TYPE_int (val);
+        return idio_S_unspec;
+    } else if (idio_S_tm_min == member) {
+       /*
+	* Test Case: libc-errors/struct-tm-set-tm_min-bad-value-type.idio
+	*
+	* struct-tm-set! v 'tm_min #t
+	*/
+	IDIO_USER_C_TYPE_ASSERT (int, val);
+
+        tmp->tm_min = IDIO_C_TYPE_int (val);
+        return idio_S_unspec;
+    } else if (idio_S_tm_hour == member) {
+       /*
+	* Test Case: libc-errors/struct-tm-set-tm_hour-bad-value-type.idio
+	*
+	* struct-tm-set! v 'tm_hour #t
+	*/
+	IDIO_USER_C_TYPE_ASSERT (int, val);
+
+        tmp->tm_hour = IDIO_C_TYPE_int (val);
+        return idio_S_unspec;
+    } else if (idio_S_tm_mday == member) {
+       /*
+	* Test Case: libc-errors/struct-tm-set-tm_mday-bad-value-type.idio
+	*
+	* struct-tm-set! v 'tm_mday #t
+	*/
+	IDIO_USER_C_TYPE_ASSERT (int, val);
+
+        tmp->tm_mday = IDIO_C_TYPE_int (val);
+        return idio_S_unspec;
+    } else if (idio_S_tm_mon == member) {
+       /*
+	* Test Case: libc-errors/struct-tm-set-tm_mon-bad-value-type.idio
+	*
+	* struct-tm-set! v 'tm_mon #t
+	*/
+	IDIO_USER_C_TYPE_ASSERT (int, val);
+
+        tmp->tm_mon = IDIO_C_TYPE_int (val);
+        return idio_S_unspec;
+    } else if (idio_S_tm_year == member) {
+       /*
+	* Test Case: libc-errors/struct-tm-set-tm_year-bad-value-type.idio
+	*
+	* struct-tm-set! v 'tm_year #t
+	*/
+	IDIO_USER_C_TYPE_ASSERT (int, val);
+
+        tmp->tm_year = IDIO_C_TYPE_int (val);
+        return idio_S_unspec;
+    } else if (idio_S_tm_wday == member) {
+       /*
+	* Test Case: libc-errors/struct-tm-set-tm_wday-bad-value-type.idio
+	*
+	* struct-tm-set! v 'tm_wday #t
+	*/
+	IDIO_USER_C_TYPE_ASSERT (int, val);
+
+        tmp->tm_wday = IDIO_C_TYPE_int (val);
+        return idio_S_unspec;
+    } else if (idio_S_tm_yday == member) {
+       /*
+	* Test Case: libc-errors/struct-tm-set-tm_yday-bad-value-type.idio
+	*
+	* struct-tm-set! v 'tm_yday #t
+	*/
+	IDIO_USER_C_TYPE_ASSERT (int, val);
+
+        tmp->tm_yday = IDIO_C_TYPE_int (val);
+        return idio_S_unspec;
+    } else if (idio_S_tm_isdst == member) {
+       /*
+	* Test Case: libc-errors/struct-tm-set-tm_isdst-bad-value-type.idio
+	*
+	* struct-tm-set! v 'tm_isdst #t
+	*/
+	IDIO_USER_C_TYPE_ASSERT (int, val);
+
+        tmp->tm_isdst = IDIO_C_TYPE_int (val);
+        return idio_S_unspec;
+    } else if (idio_S_tm_gmtoff == member) {
+       /*
+	* Test Case: libc-errors/struct-tm-set-tm_gmtoff-bad-value-type.idio
+	*
+	* struct-tm-set! v 'tm_gmtoff #t
+	*/
+	IDIO_USER_C_TYPE_ASSERT (long, val);
+
+        tmp->tm_gmtoff = IDIO_C_TYPE_long (val);
+        return idio_S_unspec;
+    } else if (idio_S_tm_zone == member) {
+       /*
+	* Test Case: libc-errors/struct-tm-set-tm_zone-bad-value-type.idio
+	*
+	* struct-tm-set! v 'tm_zone #t
+	*/
+	IDIO_USER_C_TYPE_ASSERT (pointer, val);
+
+        /*
+         * WARNING:
+         * char* tm_zone
+         *
+         * sizeof (tmp->tm_zone) is dubious
+         *
+         * check the API
+         */
+        char* valp = IDIO_C_TYPE_POINTER_P (val);
+        size_t slen = sizeof (tmp->tm_zone);
+        memcpy ((void *) &tmp->tm_zone, (void *) valp, slen);
+        return idio_S_unspec;
+    } else {
+	/*
+	 * Test Case: libc-errors/struct-tm-set-invalid-member.idio
+	 *
+	 * struct-tm-set! v 'not-likely #t
+	 */
+        idio_error_param_value_exp ("struct-tm-set!", "member", member, "C struct tm member", IDIO_C_FUNC_LOCATION());
+
+        return idio_S_notreached;
+    }
+
+    return idio_S_notreached;
+}
+
+IDIO idio_libc_struct_tm_as_string (struct tm *tmp)
+{
+    IDIO_C_ASSERT (tmp);
+
+    IDIO CSI_sh = idio_open_output_string_handle_C ();
+    idio_display_C ("#<CSI libc/struct-tm", CSI_sh);
+
+    char buf[BUFSIZ];
+    char *fmt;
+
+    idio_display_C (" tm_sec:", CSI_sh);
+
+    fmt = idio_C_type_format_string (IDIO_TYPE_C_INT);
+    idio_snprintf (buf, BUFSIZ, fmt, tmp->tm_sec);
+    idio_display_C (buf, CSI_sh);
+    idio_free (fmt);
+
+    idio_display_C (" tm_min:", CSI_sh);
+
+    fmt = idio_C_type_format_string (IDIO_TYPE_C_INT);
+    idio_snprintf (buf, BUFSIZ, fmt, tmp->tm_min);
+    idio_display_C (buf, CSI_sh);
+    idio_free (fmt);
+
+    idio_display_C (" tm_hour:", CSI_sh);
+
+    fmt = idio_C_type_format_string (IDIO_TYPE_C_INT);
+    idio_snprintf (buf, BUFSIZ, fmt, tmp->tm_hour);
+    idio_display_C (buf, CSI_sh);
+    idio_free (fmt);
+
+    idio_display_C (" tm_mday:", CSI_sh);
+
+    fmt = idio_C_type_format_string (IDIO_TYPE_C_INT);
+    idio_snprintf (buf, BUFSIZ, fmt, tmp->tm_mday);
+    idio_display_C (buf, CSI_sh);
+    idio_free (fmt);
+
+    idio_display_C (" tm_mon:", CSI_sh);
+
+    fmt = idio_C_type_format_string (IDIO_TYPE_C_INT);
+    idio_snprintf (buf, BUFSIZ, fmt, tmp->tm_mon);
+    idio_display_C (buf, CSI_sh);
+    idio_free (fmt);
+
+    idio_display_C (" tm_year:", CSI_sh);
+
+    fmt = idio_C_type_format_string (IDIO_TYPE_C_INT);
+    idio_snprintf (buf, BUFSIZ, fmt, tmp->tm_year);
+    idio_display_C (buf, CSI_sh);
+    idio_free (fmt);
+
+    idio_display_C (" tm_wday:", CSI_sh);
+
+    fmt = idio_C_type_format_string (IDIO_TYPE_C_INT);
+    idio_snprintf (buf, BUFSIZ, fmt, tmp->tm_wday);
+    idio_display_C (buf, CSI_sh);
+    idio_free (fmt);
+
+    idio_display_C (" tm_yday:", CSI_sh);
+
+    fmt = idio_C_type_format_string (IDIO_TYPE_C_INT);
+    idio_snprintf (buf, BUFSIZ, fmt, tmp->tm_yday);
+    idio_display_C (buf, CSI_sh);
+    idio_free (fmt);
+
+    idio_display_C (" tm_isdst:", CSI_sh);
+
+    fmt = idio_C_type_format_string (IDIO_TYPE_C_INT);
+    idio_snprintf (buf, BUFSIZ, fmt, tmp->tm_isdst);
+    idio_display_C (buf, CSI_sh);
+    idio_free (fmt);
+
+    idio_display_C (" tm_gmtoff:", CSI_sh);
+
+    fmt = idio_C_type_format_string (IDIO_TYPE_C_LONG);
+    idio_snprintf (buf, BUFSIZ, fmt, tmp->tm_gmtoff);
+    idio_display_C (buf, CSI_sh);
+    idio_free (fmt);
+
+    idio_display_C (" tm_zone:", CSI_sh);
+
+    idio_display_C (tmp->tm_zone, CSI_sh);
+
+    idio_display_C (">", CSI_sh);
+
+    return idio_get_output_string (CSI_sh);
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("struct-tm-as-string", libc_struct_tm_as_string, (IDIO tm), "tm", "\
+:param tm: :ref:`struct-tm <libc/struct-tm>`	\n\
+:type tm: C/pointer			\n\
+:return: string				\n\
+:rtype:	string				\n\
+")
+{
+    IDIO_ASSERT (tm);
+
+    /*
+     * Test Case: libc-errors/struct-tm-as-string-bad-pointer-type.idio
+     *
+     * struct-tm-as-string #t
+     */
+    IDIO_USER_C_TYPE_ASSERT (pointer, tm);
+    if (idio_CSI_libc_struct_tm != IDIO_C_TYPE_POINTER_PTYPE (tm)) {
+	/*
+	 * Test Case: libc-errors/struct-tm-as-string-invalid-pointer-type.idio
+	 *
+	 * struct-tm-as-string libc/NULL
+	 */
+	idio_error_param_value_exp ("struct-tm-as-string", "tm", tm, "C struct tm", IDIO_C_FUNC_LOCATION ());
+
+	return idio_S_notreached;
+    }
+
+    return idio_libc_struct_tm_as_string (IDIO_C_TYPE_POINTER_P (tm));
+}
+
+/*
+	/usr/include/x86_64-linux-gnu/sys/times.h
+
+	struct tms
+	{
+	  clock_t              tms_utime;
+	  clock_t              tms_stime;
+	  clock_t              tms_cutime;
+	  clock_t              tms_cstime;
+	};
+*/
+
+IDIO_C_STRUCT_IDENT_DECL (libc_struct_tms);
+IDIO_SYMBOL_DECL (tms_utime);
+IDIO_SYMBOL_DECL (tms_stime);
+IDIO_SYMBOL_DECL (tms_cutime);
+IDIO_SYMBOL_DECL (tms_cstime);
+
+IDIO_DEFINE_PRIMITIVE2_DS ("struct-tms-ref", libc_struct_tms_ref, (IDIO tms, IDIO member), "tms member", "\
+in C, :samp:`{tms}->{member}`			\n\
+					\n\
+:param tms: :ref:`struct-tms <libc/struct-tms>`	\n\
+:type tms: C/pointer		\n\
+:param member: member name		\n\
+:type member: symbol			\n\
+:return: `tms` -> `member`		\n\
+:rtype:	varies on `member`		\n\
+")
+{
+    IDIO_ASSERT (tms);
+    IDIO_ASSERT (member);
+
+    /*
+     * Test Case: libc-errors/struct-tms-ref-bad-pointer-type.idio
+     *
+     * struct-tms-ref #t #t
+     */
+    IDIO_USER_C_TYPE_ASSERT (pointer, tms);
+    if (idio_CSI_libc_struct_tms != IDIO_C_TYPE_POINTER_PTYPE (tms)) {
+	/*
+	 * Test Case: libc-errors/struct-tms-ref-invalid-pointer-type.idio
+	 *
+	 * struct-tms-ref libc/NULL #t
+	 */
+	idio_error_param_value_exp ("struct-tms-ref", "tms", tms, "C struct tms", IDIO_C_FUNC_LOCATION ());
+
+	return idio_S_notreached;
+    }
+
+    /*
+     * Test Case: libc-errors/struct-tms-ref-bad-member-type.idio
+     *
+     * struct-tms-ref v #t
+     */
+    IDIO_USER_TYPE_ASSERT (symbol, member);
+
+    struct tms *tmsp = IDIO_C_TYPE_POINTER_P (tms);
+    if (idio_S_tms_utime == member) {
+        return idio_libc_clock_t (tmsp->tms_utime);
+    } else if (idio_S_tms_stime == member) {
+        return idio_libc_clock_t (tmsp->tms_stime);
+    } else if (idio_S_tms_cutime == member) {
+        return idio_libc_clock_t (tmsp->tms_cutime);
+    } else if (idio_S_tms_cstime == member) {
+        return idio_libc_clock_t (tmsp->tms_cstime);
+    } else {
+	/*
+	 * Test Case: libc-errors/struct-tms-ref-invalid-member.idio
+	 *
+	 * struct-tms-ref v 'not-likely
+	 */
+        idio_error_param_value_exp ("struct-tms-ref", "member", member, "C struct tms member", IDIO_C_FUNC_LOCATION());
+
+        return idio_S_notreached;
+    }
+
+    return idio_S_notreached;
+}
+
+IDIO_DEFINE_PRIMITIVE3_DS ("struct-tms-set!", libc_struct_tms_set, (IDIO tms, IDIO member, IDIO val), "tms member val", "\
+in C, :samp:`{tms}->{member} = {val}`		\n\
+					\n\
+:param tms: :ref:`struct-tms <libc/struct-tms>`	\n\
+:type tms: C/pointer		\n\
+:param member: member name		\n\
+:type member: symbol			\n\
+:param val: a C/ type			\n\
+:type val: varies on `member`		\n\
+:return: #<unspec>		\n\
+")
+{
+    IDIO_ASSERT (tms);
+    IDIO_ASSERT (member);
+    IDIO_ASSERT (val);
+
+
+    /*
+     * Test Case: libc-errors/struct-tms-set-bad-pointer-type.idio
+     *
+     * struct-tms-set! #t #t #t
+     */
+    IDIO_USER_C_TYPE_ASSERT (pointer, tms);
+    if (idio_CSI_libc_struct_tms != IDIO_C_TYPE_POINTER_PTYPE (tms)) {
+	/*
+	 * Test Case: libc-errors/struct-tms-set-invalid-pointer-type.idio
+	 *
+	 * struct-tms-set! libc/NULL #t #t
+	 */
+	idio_error_param_value_exp ("struct-tms-set!", "tms", tms, "C struct tms", IDIO_C_FUNC_LOCATION ());
+
+	return idio_S_notreached;
+    }
+
+    /*
+     * Test Case: libc-errors/struct-tms-set-bad-member-type.idio
+     *
+     * struct-tms-set! v #t #t
+     */
+    IDIO_USER_TYPE_ASSERT (symbol, member);
+
+    struct tms *tmsp = IDIO_C_TYPE_POINTER_P (tms);
+    if (idio_S_tms_utime == member) {
+       /*
+	* Test Case: libc-errors/struct-tms-set-tms_utime-bad-value-type.idio
+	*
+	* struct-tms-set! v 'tms_utime #t
+	*/
+	IDIO_USER_libc_TYPE_ASSERT (clock_t, val);
+
+        tmsp->tms_utime = IDIO_C_TYPE_libc_clock_t (val);
+        return idio_S_unspec;
+    } else if (idio_S_tms_stime == member) {
+       /*
+	* Test Case: libc-errors/struct-tms-set-tms_stime-bad-value-type.idio
+	*
+	* struct-tms-set! v 'tms_stime #t
+	*/
+	IDIO_USER_libc_TYPE_ASSERT (clock_t, val);
+
+        tmsp->tms_stime = IDIO_C_TYPE_libc_clock_t (val);
+        return idio_S_unspec;
+    } else if (idio_S_tms_cutime == member) {
+       /*
+	* Test Case: libc-errors/struct-tms-set-tms_cutime-bad-value-type.idio
+	*
+	* struct-tms-set! v 'tms_cutime #t
+	*/
+	IDIO_USER_libc_TYPE_ASSERT (clock_t, val);
+
+        tmsp->tms_cutime = IDIO_C_TYPE_libc_clock_t (val);
+        return idio_S_unspec;
+    } else if (idio_S_tms_cstime == member) {
+       /*
+	* Test Case: libc-errors/struct-tms-set-tms_cstime-bad-value-type.idio
+	*
+	* struct-tms-set! v 'tms_cstime #t
+	*/
+	IDIO_USER_libc_TYPE_ASSERT (clock_t, val);
+
+        tmsp->tms_cstime = IDIO_C_TYPE_libc_clock_t (val);
+        return idio_S_unspec;
+    } else {
+	/*
+	 * Test Case: libc-errors/struct-tms-set-invalid-member.idio
+	 *
+	 * struct-tms-set! v 'not-likely #t
+	 */
+        idio_error_param_value_exp ("struct-tms-set!", "member", member, "C struct tms member", IDIO_C_FUNC_LOCATION());
+
+        return idio_S_notreached;
+    }
+
+    return idio_S_notreached;
+}
+
+IDIO idio_libc_struct_tms_as_string (struct tms *tmsp)
+{
+    IDIO_C_ASSERT (tmsp);
+
+    IDIO CSI_sh = idio_open_output_string_handle_C ();
+    idio_display_C ("#<CSI libc/struct-tms", CSI_sh);
+
+    char buf[BUFSIZ];
+    char *fmt;
+
+    idio_display_C (" tms_utime:", CSI_sh);
+
+    fmt = idio_C_type_format_string (IDIO_TYPE_C_libc_clock_t);
+    idio_snprintf (buf, BUFSIZ, fmt, tmsp->tms_utime);
+    idio_display_C (buf, CSI_sh);
+    idio_free (fmt);
+
+    idio_display_C (" tms_stime:", CSI_sh);
+
+    fmt = idio_C_type_format_string (IDIO_TYPE_C_libc_clock_t);
+    idio_snprintf (buf, BUFSIZ, fmt, tmsp->tms_stime);
+    idio_display_C (buf, CSI_sh);
+    idio_free (fmt);
+
+    idio_display_C (" tms_cutime:", CSI_sh);
+
+    fmt = idio_C_type_format_string (IDIO_TYPE_C_libc_clock_t);
+    idio_snprintf (buf, BUFSIZ, fmt, tmsp->tms_cutime);
+    idio_display_C (buf, CSI_sh);
+    idio_free (fmt);
+
+    idio_display_C (" tms_cstime:", CSI_sh);
+
+    fmt = idio_C_type_format_string (IDIO_TYPE_C_libc_clock_t);
+    idio_snprintf (buf, BUFSIZ, fmt, tmsp->tms_cstime);
+    idio_display_C (buf, CSI_sh);
+    idio_free (fmt);
+
+    idio_display_C (">", CSI_sh);
+
+    return idio_get_output_string (CSI_sh);
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("struct-tms-as-string", libc_struct_tms_as_string, (IDIO tms), "tms", "\
+:param tms: :ref:`struct-tms <libc/struct-tms>`	\n\
+:type tms: C/pointer			\n\
+:return: string				\n\
+:rtype:	string				\n\
+")
+{
+    IDIO_ASSERT (tms);
+
+    /*
+     * Test Case: libc-errors/struct-tms-as-string-bad-pointer-type.idio
+     *
+     * struct-tms-as-string #t
+     */
+    IDIO_USER_C_TYPE_ASSERT (pointer, tms);
+    if (idio_CSI_libc_struct_tms != IDIO_C_TYPE_POINTER_PTYPE (tms)) {
+	/*
+	 * Test Case: libc-errors/struct-tms-as-string-invalid-pointer-type.idio
+	 *
+	 * struct-tms-as-string libc/NULL
+	 */
+	idio_error_param_value_exp ("struct-tms-as-string", "tms", tms, "C struct tms", IDIO_C_FUNC_LOCATION ());
+
+	return idio_S_notreached;
+    }
+
+    return idio_libc_struct_tms_as_string (IDIO_C_TYPE_POINTER_P (tms));
+}
+
+/*
+	/usr/include/x86_64-linux-gnu/sys/utsname.h
+
+	struct utsname
+	{
+	  char[]               sysname;
+	  char[]               nodename;
+	  char[]               release;
+	  char[]               version;
+	  char[]               machine;
+	  char[]               domainname;
+	};
+*/
+
+IDIO_C_STRUCT_IDENT_DECL (libc_struct_utsname);
+IDIO_SYMBOL_DECL (sysname);
+IDIO_SYMBOL_DECL (nodename);
+IDIO_SYMBOL_DECL (release);
+/* version is defined by Idio */
+IDIO_SYMBOL_DECL (machine);
+IDIO_SYMBOL_DECL (domainname);
+
+IDIO_DEFINE_PRIMITIVE2_DS ("struct-utsname-ref", libc_struct_utsname_ref, (IDIO utsname, IDIO member), "utsname member", "\
+in C, :samp:`{utsname}->{member}`			\n\
+					\n\
+:param utsname: :ref:`struct-utsname <libc/struct-utsname>`	\n\
+:type utsname: C/pointer		\n\
+:param member: member name		\n\
+:type member: symbol			\n\
+:return: `utsname` -> `member`		\n\
+:rtype:	varies on `member`		\n\
+")
+{
+    IDIO_ASSERT (utsname);
+    IDIO_ASSERT (member);
+
+    /*
+     * Test Case: libc-errors/struct-utsname-ref-bad-pointer-type.idio
+     *
+     * struct-utsname-ref #t #t
+     */
+    IDIO_USER_C_TYPE_ASSERT (pointer, utsname);
+    if (idio_CSI_libc_struct_utsname != IDIO_C_TYPE_POINTER_PTYPE (utsname)) {
+	/*
+	 * Test Case: libc-errors/struct-utsname-ref-invalid-pointer-type.idio
+	 *
+	 * struct-utsname-ref libc/NULL #t
+	 */
+	idio_error_param_value_exp ("struct-utsname-ref", "utsname", utsname, "C struct utsname", IDIO_C_FUNC_LOCATION ());
+
+	return idio_S_notreached;
+    }
+
+    /*
+     * Test Case: libc-errors/struct-utsname-ref-bad-member-type.idio
+     *
+     * struct-utsname-ref v #t
+     */
+    IDIO_USER_TYPE_ASSERT (symbol, member);
+
+    struct utsname *utsnamep = IDIO_C_TYPE_POINTER_P (utsname);
+    if (idio_S_sysname == member) {
+        /*
+         * WARNING:
+         * char[] sysname
+         *
+         * sizeof (utsnamep->sysname) is probably incorrect
+         *
+         * check the API
+         */
+        size_t alen = sizeof (utsnamep->sysname);
+        char *rp = (char *) idio_alloc (alen);
+        memcpy ((void *) rp, (void *) &utsnamep->sysname, alen);
+    } else if (idio_S_nodename == member) {
+        /*
+         * WARNING:
+         * char[] nodename
+         *
+         * sizeof (utsnamep->nodename) is probably incorrect
+         *
+         * check the API
+         */
+        size_t alen = sizeof (utsnamep->nodename);
+        char *rp = (char *) idio_alloc (alen);
+        memcpy ((void *) rp, (void *) &utsnamep->nodename, alen);
+    } else if (idio_S_release == member) {
+        /*
+         * WARNING:
+         * char[] release
+         *
+         * sizeof (utsnamep->release) is probably incorrect
+         *
+         * check the API
+         */
+        size_t alen = sizeof (utsnamep->release);
+        char *rp = (char *) idio_alloc (alen);
+        memcpy ((void *) rp, (void *) &utsnamep->release, alen);
+    } else if (idio_S_version == member) {
+        /*
+         * WARNING:
+         * char[] version
+         *
+         * sizeof (utsnamep->version) is probably incorrect
+         *
+         * check the API
+         */
+        size_t alen = sizeof (utsnamep->version);
+        char *rp = (char *) idio_alloc (alen);
+        memcpy ((void *) rp, (void *) &utsnamep->version, alen);
+    } else if (idio_S_machine == member) {
+        /*
+         * WARNING:
+         * char[] machine
+         *
+         * sizeof (utsnamep->machine) is probably incorrect
+         *
+         * check the API
+         */
+        size_t alen = sizeof (utsnamep->machine);
+        char *rp = (char *) idio_alloc (alen);
+        memcpy ((void *) rp, (void *) &utsnamep->machine, alen);
+    } else if (idio_S_domainname == member) {
+        /*
+         * WARNING:
+         * char[] domainname
+         *
+         * sizeof (utsnamep->domainname) is probably incorrect
+         *
+         * check the API
+         */
+        size_t alen = sizeof (utsnamep->domainname);
+        char *rp = (char *) idio_alloc (alen);
+        memcpy ((void *) rp, (void *) &utsnamep->domainname, alen);
+    } else {
+	/*
+	 * Test Case: libc-errors/struct-utsname-ref-invalid-member.idio
+	 *
+	 * struct-utsname-ref v 'not-likely
+	 */
+        idio_error_param_value_exp ("struct-utsname-ref", "member", member, "C struct utsname member", IDIO_C_FUNC_LOCATION());
+
+        return idio_S_notreached;
+    }
+
+    return idio_S_notreached;
+}
+
+IDIO_DEFINE_PRIMITIVE3_DS ("struct-utsname-set!", libc_struct_utsname_set, (IDIO utsname, IDIO member, IDIO val), "utsname member val", "\
+in C, :samp:`{utsname}->{member} = {val}`		\n\
+					\n\
+:param utsname: :ref:`struct-utsname <libc/struct-utsname>`	\n\
+:type utsname: C/pointer		\n\
+:param member: member name		\n\
+:type member: symbol			\n\
+:param val: a C/ type			\n\
+:type val: varies on `member`		\n\
+:return: #<unspec>		\n\
+")
+{
+    IDIO_ASSERT (utsname);
+    IDIO_ASSERT (member);
+    IDIO_ASSERT (val);
+
+
+    /*
+     * Test Case: libc-errors/struct-utsname-set-bad-pointer-type.idio
+     *
+     * struct-utsname-set! #t #t #t
+     */
+    IDIO_USER_C_TYPE_ASSERT (pointer, utsname);
+    if (idio_CSI_libc_struct_utsname != IDIO_C_TYPE_POINTER_PTYPE (utsname)) {
+	/*
+	 * Test Case: libc-errors/struct-utsname-set-invalid-pointer-type.idio
+	 *
+	 * struct-utsname-set! libc/NULL #t #t
+	 */
+	idio_error_param_value_exp ("struct-utsname-set!", "utsname", utsname, "C struct utsname", IDIO_C_FUNC_LOCATION ());
+
+	return idio_S_notreached;
+    }
+
+    /*
+     * Test Case: libc-errors/struct-utsname-set-bad-member-type.idio
+     *
+     * struct-utsname-set! v #t #t
+     */
+    IDIO_USER_TYPE_ASSERT (symbol, member);
+
+    struct utsname *utsnamep = IDIO_C_TYPE_POINTER_P (utsname);
+    if (idio_S_sysname == member) {
+       /*
+	* Test Case: libc-errors/struct-utsname-set-sysname-bad-value-type.idio
+	*
+	* struct-utsname-set! v 'sysname #t
+	*/
+	IDIO_USER_C_TYPE_ASSERT (pointer, val);
+
+        /*
+         * WARNING:
+         * char[] sysname
+         *
+         * sizeof (utsnamep->sysname) is possibly incorrect
+         *
+         * check the API
+         */
+        char *valp = IDIO_C_TYPE_POINTER_P (val);
+        size_t alen = sizeof (utsnamep->sysname);
+        memcpy ((void *) &utsnamep->sysname, (void *) valp, alen);
+        return idio_S_unspec;
+    } else if (idio_S_nodename == member) {
+       /*
+	* Test Case: libc-errors/struct-utsname-set-nodename-bad-value-type.idio
+	*
+	* struct-utsname-set! v 'nodename #t
+	*/
+	IDIO_USER_C_TYPE_ASSERT (pointer, val);
+
+        /*
+         * WARNING:
+         * char[] nodename
+         *
+         * sizeof (utsnamep->nodename) is possibly incorrect
+         *
+         * check the API
+         */
+        char *valp = IDIO_C_TYPE_POINTER_P (val);
+        size_t alen = sizeof (utsnamep->nodename);
+        memcpy ((void *) &utsnamep->nodename, (void *) valp, alen);
+        return idio_S_unspec;
+    } else if (idio_S_release == member) {
+       /*
+	* Test Case: libc-errors/struct-utsname-set-release-bad-value-type.idio
+	*
+	* struct-utsname-set! v 'release #t
+	*/
+	IDIO_USER_C_TYPE_ASSERT (pointer, val);
+
+        /*
+         * WARNING:
+         * char[] release
+         *
+         * sizeof (utsnamep->release) is possibly incorrect
+         *
+         * check the API
+         */
+        char *valp = IDIO_C_TYPE_POINTER_P (val);
+        size_t alen = sizeof (utsnamep->release);
+        memcpy ((void *) &utsnamep->release, (void *) valp, alen);
+        return idio_S_unspec;
+    } else if (idio_S_version == member) {
+       /*
+	* Test Case: libc-errors/struct-utsname-set-version-bad-value-type.idio
+	*
+	* struct-utsname-set! v 'version #t
+	*/
+	IDIO_USER_C_TYPE_ASSERT (pointer, val);
+
+        /*
+         * WARNING:
+         * char[] version
+         *
+         * sizeof (utsnamep->version) is possibly incorrect
+         *
+         * check the API
+         */
+        char *valp = IDIO_C_TYPE_POINTER_P (val);
+        size_t alen = sizeof (utsnamep->version);
+        memcpy ((void *) &utsnamep->version, (void *) valp, alen);
+        return idio_S_unspec;
+    } else if (idio_S_machine == member) {
+       /*
+	* Test Case: libc-errors/struct-utsname-set-machine-bad-value-type.idio
+	*
+	* struct-utsname-set! v 'machine #t
+	*/
+	IDIO_USER_C_TYPE_ASSERT (pointer, val);
+
+        /*
+         * WARNING:
+         * char[] machine
+         *
+         * sizeof (utsnamep->machine) is possibly incorrect
+         *
+         * check the API
+         */
+        char *valp = IDIO_C_TYPE_POINTER_P (val);
+        size_t alen = sizeof (utsnamep->machine);
+        memcpy ((void *) &utsnamep->machine, (void *) valp, alen);
+        return idio_S_unspec;
+    } else if (idio_S_domainname == member) {
+       /*
+	* Test Case: libc-errors/struct-utsname-set-domainname-bad-value-type.idio
+	*
+	* struct-utsname-set! v 'domainname #t
+	*/
+	IDIO_USER_C_TYPE_ASSERT (pointer, val);
+
+        /*
+         * WARNING:
+         * char[] domainname
+         *
+         * sizeof (utsnamep->domainname) is possibly incorrect
+         *
+         * check the API
+         */
+        char *valp = IDIO_C_TYPE_POINTER_P (val);
+        size_t alen = sizeof (utsnamep->domainname);
+        memcpy ((void *) &utsnamep->domainname, (void *) valp, alen);
+        return idio_S_unspec;
+    } else {
+	/*
+	 * Test Case: libc-errors/struct-utsname-set-invalid-member.idio
+	 *
+	 * struct-utsname-set! v 'not-likely #t
+	 */
+        idio_error_param_value_exp ("struct-utsname-set!", "member", member, "C struct utsname member", IDIO_C_FUNC_LOCATION());
+
+        return idio_S_notreached;
+    }
+
+    return idio_S_notreached;
+}
+
+IDIO idio_libc_struct_utsname_as_string (struct utsname *utsnamep)
+{
+    IDIO_C_ASSERT (utsnamep);
+
+    IDIO CSI_sh = idio_open_output_string_handle_C ();
+    idio_display_C ("#<CSI libc/struct-utsname", CSI_sh);
+
+    char buf[BUFSIZ];
+    char *fmt;
+
+    idio_display_C (" sysname:", CSI_sh);
+
+    idio_display_C (utsnamep->sysname, CSI_sh);
+
+    idio_display_C (" nodename:", CSI_sh);
+
+    idio_display_C (utsnamep->nodename, CSI_sh);
+
+    idio_display_C (" release:", CSI_sh);
+
+    idio_display_C (utsnamep->release, CSI_sh);
+
+    idio_display_C (" version:", CSI_sh);
+
+    idio_display_C (utsnamep->version, CSI_sh);
+
+    idio_display_C (" machine:", CSI_sh);
+
+    idio_display_C (utsnamep->machine, CSI_sh);
+
+    idio_display_C (" domainname:", CSI_sh);
+
+    idio_display_C (utsnamep->domainname, CSI_sh);
+
+    idio_display_C (">", CSI_sh);
+
+    return idio_get_output_string (CSI_sh);
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("struct-utsname-as-string", libc_struct_utsname_as_string, (IDIO utsname), "utsname", "\
+:param utsname: :ref:`struct-utsname <libc/struct-utsname>`	\n\
+:type utsname: C/pointer			\n\
+:return: string				\n\
+:rtype:	string				\n\
+")
+{
+    IDIO_ASSERT (utsname);
+
+    /*
+     * Test Case: libc-errors/struct-utsname-as-string-bad-pointer-type.idio
+     *
+     * struct-utsname-as-string #t
+     */
+    IDIO_USER_C_TYPE_ASSERT (pointer, utsname);
+    if (idio_CSI_libc_struct_utsname != IDIO_C_TYPE_POINTER_PTYPE (utsname)) {
+	/*
+	 * Test Case: libc-errors/struct-utsname-as-string-invalid-pointer-type.idio
+	 *
+	 * struct-utsname-as-string libc/NULL
+	 */
+	idio_error_param_value_exp ("struct-utsname-as-string", "utsname", utsname, "C struct utsname", IDIO_C_FUNC_LOCATION ());
+
+	return idio_S_notreached;
+    }
+
+    return idio_libc_struct_utsname_as_string (IDIO_C_TYPE_POINTER_P (utsname));
+}
+
+IDIO_DEFINE_PRIMITIVE2_DS ("access", libc_access, (IDIO arg1, IDIO arg2), "arg1 arg2", "\
+in C: :samp:`access ({arg1}, {arg2})`		\n\
+a wrapper to libc :manpage:`access()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/pointer			\n\
+:param arg2: 				\n\
+:type arg2: C/int			\n\
+:return:				\n\
+:rtype: C/int	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+    IDIO_ASSERT (arg2);
+
+   /*
+    * Test Case: libc-errors/access-bad-arg1-type.idio
+    *
+    * access #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg1);
+    char* C_arg1 = IDIO_C_TYPE_POINTER_P (arg1);
+
+   /*
+    * Test Case: libc-errors/access-bad-arg2-type.idio
+    *
+    * access #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (int, arg2);
+    int C_arg2 = IDIO_C_TYPE_int (arg2);
+
+    int access_r = access (C_arg1, C_arg2);
+
+    /* check for errors */
+    if (-1 == access_r) {
+        idio_error_system_errno ("access", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_int (access_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("asctime", libc_asctime, (IDIO arg1), "arg1", "\
+in C: :samp:`asctime ({arg1})`		\n\
+a wrapper to libc :manpage:`asctime()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/pointer			\n\
+:return:				\n\
+:rtype: C/pointer	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+
+   /*
+    * Test Case: libc-errors/asctime-bad-arg1-type.idio
+    *
+    * asctime #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg1);
+    struct tm* C_arg1 = IDIO_C_TYPE_POINTER_P (arg1);
+
+    char* asctime_r = asctime (C_arg1);
+
+    /* check for errors */
+    if (-1 == asctime_r) {
+        idio_error_system_errno ("asctime", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_pointer_free_me (asctime_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("chdir", libc_chdir, (IDIO arg1), "arg1", "\
+in C: :samp:`chdir ({arg1})`		\n\
+a wrapper to libc :manpage:`chdir()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/pointer			\n\
+:return:				\n\
+:rtype: C/int	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+
+   /*
+    * Test Case: libc-errors/chdir-bad-arg1-type.idio
+    *
+    * chdir #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg1);
+    char* C_arg1 = IDIO_C_TYPE_POINTER_P (arg1);
+
+    int chdir_r = chdir (C_arg1);
+
+    /* check for errors */
+    if (-1 == chdir_r) {
+        idio_error_system_errno ("chdir", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_int (chdir_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE2_DS ("chmod", libc_chmod, (IDIO arg1, IDIO arg2), "arg1 arg2", "\
+in C: :samp:`chmod ({arg1}, {arg2})`		\n\
+a wrapper to libc :manpage:`chmod()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/pointer			\n\
+:param arg2: 				\n\
+:type arg2: libc/__mode_t			\n\
+:return:				\n\
+:rtype: C/int	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+    IDIO_ASSERT (arg2);
+
+   /*
+    * Test Case: libc-errors/chmod-bad-arg1-type.idio
+    *
+    * chmod #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg1);
+    char* C_arg1 = IDIO_C_TYPE_POINTER_P (arg1);
+
+   /*
+    * Test Case: libc-errors/chmod-bad-arg2-type.idio
+    *
+    * chmod #t #t
+    */
+    IDIO_USER_libc_TYPE_ASSERT (__mode_t, arg2);
+    __mode_t C_arg2 = IDIO_C_TYPE_libc___mode_t (arg2);
+
+    int chmod_r = chmod (C_arg1, C_arg2);
+
+    /* check for errors */
+    if (-1 == chmod_r) {
+        idio_error_system_errno ("chmod", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_int (chmod_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE3_DS ("chown", libc_chown, (IDIO arg1, IDIO arg2, IDIO arg3), "arg1 arg2 arg3", "\
+in C: :samp:`chown ({arg1}, {arg2}, {arg3})`		\n\
+a wrapper to libc :manpage:`chown()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/pointer			\n\
+:param arg2: 				\n\
+:type arg2: libc/__uid_t			\n\
+:param arg3: 				\n\
+:type arg3: libc/__gid_t			\n\
+:return:				\n\
+:rtype: C/int	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+    IDIO_ASSERT (arg2);
+    IDIO_ASSERT (arg3);
+
+   /*
+    * Test Case: libc-errors/chown-bad-arg1-type.idio
+    *
+    * chown #t #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg1);
+    char* C_arg1 = IDIO_C_TYPE_POINTER_P (arg1);
+
+   /*
+    * Test Case: libc-errors/chown-bad-arg2-type.idio
+    *
+    * chown #t #t #t
+    */
+    IDIO_USER_libc_TYPE_ASSERT (__uid_t, arg2);
+    __uid_t C_arg2 = IDIO_C_TYPE_libc___uid_t (arg2);
+
+   /*
+    * Test Case: libc-errors/chown-bad-arg3-type.idio
+    *
+    * chown #t #t #t
+    */
+    IDIO_USER_libc_TYPE_ASSERT (__gid_t, arg3);
+    __gid_t C_arg3 = IDIO_C_TYPE_libc___gid_t (arg3);
+
+    int chown_r = chown (C_arg1, C_arg2, C_arg3);
+
+    /* check for errors */
+    if (-1 == chown_r) {
+        idio_error_system_errno ("chown", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_int (chown_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("chroot", libc_chroot, (IDIO arg1), "arg1", "\
+in C: :samp:`chroot ({arg1})`		\n\
+a wrapper to libc :manpage:`chroot()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/pointer			\n\
+:return:				\n\
+:rtype: C/int	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+
+   /*
+    * Test Case: libc-errors/chroot-bad-arg1-type.idio
+    *
+    * chroot #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg1);
+    char* C_arg1 = IDIO_C_TYPE_POINTER_P (arg1);
+
+    int chroot_r = chroot (C_arg1);
+
+    /* check for errors */
+    if (-1 == chroot_r) {
+        idio_error_system_errno ("chroot", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_int (chroot_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("close", libc_close, (IDIO arg1), "arg1", "\
+in C: :samp:`close ({arg1})`		\n\
+a wrapper to libc :manpage:`close()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/int			\n\
+:return:				\n\
+:rtype: C/int	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+
+   /*
+    * Test Case: libc-errors/close-bad-arg1-type.idio
+    *
+    * close #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (int, arg1);
+    int C_arg1 = IDIO_C_TYPE_int (arg1);
+
+    int close_r = close (C_arg1);
+
+    /* check for errors */
+    if (-1 == close_r) {
+        idio_error_system_errno ("close", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_int (close_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("ctermid", libc_ctermid, (IDIO arg1), "arg1", "\
+in C: :samp:`ctermid ({arg1})`		\n\
+a wrapper to libc :manpage:`ctermid()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/pointer			\n\
+:return:				\n\
+:rtype: C/pointer	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+
+   /*
+    * Test Case: libc-errors/ctermid-bad-arg1-type.idio
+    *
+    * ctermid #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg1);
+    char* C_arg1 = IDIO_C_TYPE_POINTER_P (arg1);
+
+    char* ctermid_r = ctermid (C_arg1);
+
+    /* check for errors */
+    if (-1 == ctermid_r) {
+        idio_error_system_errno ("ctermid", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_pointer_free_me (ctermid_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("ctime", libc_ctime, (IDIO arg1), "arg1", "\
+in C: :samp:`ctime ({arg1})`		\n\
+a wrapper to libc :manpage:`ctime()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/pointer			\n\
+:return:				\n\
+:rtype: C/pointer	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+
+   /*
+    * Test Case: libc-errors/ctime-bad-arg1-type.idio
+    *
+    * ctime #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg1);
+    time_t* C_arg1 = IDIO_C_TYPE_POINTER_P (arg1);
+
+    char* ctime_r = ctime (C_arg1);
+
+    /* check for errors */
+    if (-1 == ctime_r) {
+        idio_error_system_errno ("ctime", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_pointer_free_me (ctime_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("dup", libc_dup, (IDIO arg1), "arg1", "\
+in C: :samp:`dup ({arg1})`		\n\
+a wrapper to libc :manpage:`dup()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/int			\n\
+:return:				\n\
+:rtype: C/int	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+
+   /*
+    * Test Case: libc-errors/dup-bad-arg1-type.idio
+    *
+    * dup #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (int, arg1);
+    int C_arg1 = IDIO_C_TYPE_int (arg1);
+
+    int dup_r = dup (C_arg1);
+
+    /* check for errors */
+    if (-1 == dup_r) {
+        idio_error_system_errno ("dup", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_int (dup_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE2_DS ("dup2", libc_dup2, (IDIO arg1, IDIO arg2), "arg1 arg2", "\
+in C: :samp:`dup2 ({arg1}, {arg2})`		\n\
+a wrapper to libc :manpage:`dup2()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/int			\n\
+:param arg2: 				\n\
+:type arg2: C/int			\n\
+:return:				\n\
+:rtype: C/int	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+    IDIO_ASSERT (arg2);
+
+   /*
+    * Test Case: libc-errors/dup2-bad-arg1-type.idio
+    *
+    * dup2 #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (int, arg1);
+    int C_arg1 = IDIO_C_TYPE_int (arg1);
+
+   /*
+    * Test Case: libc-errors/dup2-bad-arg2-type.idio
+    *
+    * dup2 #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (int, arg2);
+    int C_arg2 = IDIO_C_TYPE_int (arg2);
+
+    int dup2_r = dup2 (C_arg1, C_arg2);
+
+    /* check for errors */
+    if (-1 == dup2_r) {
+        idio_error_system_errno ("dup2", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_int (dup2_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE4_DS ("faccessat", libc_faccessat, (IDIO arg1, IDIO arg2, IDIO arg3, IDIO arg4), "arg1 arg2 arg3 arg4", "\
+in C: :samp:`faccessat ({arg1}, {arg2}, {arg3}, {arg4})`		\n\
+a wrapper to libc :manpage:`faccessat()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/int			\n\
+:param arg2: 				\n\
+:type arg2: C/pointer			\n\
+:param arg3: 				\n\
+:type arg3: C/int			\n\
+:param arg4: 				\n\
+:type arg4: C/int			\n\
+:return:				\n\
+:rtype: C/int	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+    IDIO_ASSERT (arg2);
+    IDIO_ASSERT (arg3);
+    IDIO_ASSERT (arg4);
+
+   /*
+    * Test Case: libc-errors/faccessat-bad-arg1-type.idio
+    *
+    * faccessat #t #t #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (int, arg1);
+    int C_arg1 = IDIO_C_TYPE_int (arg1);
+
+   /*
+    * Test Case: libc-errors/faccessat-bad-arg2-type.idio
+    *
+    * faccessat #t #t #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg2);
+    char* C_arg2 = IDIO_C_TYPE_POINTER_P (arg2);
+
+   /*
+    * Test Case: libc-errors/faccessat-bad-arg3-type.idio
+    *
+    * faccessat #t #t #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (int, arg3);
+    int C_arg3 = IDIO_C_TYPE_int (arg3);
+
+   /*
+    * Test Case: libc-errors/faccessat-bad-arg4-type.idio
+    *
+    * faccessat #t #t #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (int, arg4);
+    int C_arg4 = IDIO_C_TYPE_int (arg4);
+
+    int faccessat_r = faccessat (C_arg1, C_arg2, C_arg3, C_arg4);
+
+    /* check for errors */
+    if (-1 == faccessat_r) {
+        idio_error_system_errno ("faccessat", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_int (faccessat_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("fchdir", libc_fchdir, (IDIO arg1), "arg1", "\
+in C: :samp:`fchdir ({arg1})`		\n\
+a wrapper to libc :manpage:`fchdir()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/int			\n\
+:return:				\n\
+:rtype: C/int	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+
+   /*
+    * Test Case: libc-errors/fchdir-bad-arg1-type.idio
+    *
+    * fchdir #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (int, arg1);
+    int C_arg1 = IDIO_C_TYPE_int (arg1);
+
+    int fchdir_r = fchdir (C_arg1);
+
+    /* check for errors */
+    if (-1 == fchdir_r) {
+        idio_error_system_errno ("fchdir", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_int (fchdir_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE2_DS ("fchmod", libc_fchmod, (IDIO arg1, IDIO arg2), "arg1 arg2", "\
+in C: :samp:`fchmod ({arg1}, {arg2})`		\n\
+a wrapper to libc :manpage:`fchmod()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/int			\n\
+:param arg2: 				\n\
+:type arg2: libc/__mode_t			\n\
+:return:				\n\
+:rtype: C/int	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+    IDIO_ASSERT (arg2);
+
+   /*
+    * Test Case: libc-errors/fchmod-bad-arg1-type.idio
+    *
+    * fchmod #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (int, arg1);
+    int C_arg1 = IDIO_C_TYPE_int (arg1);
+
+   /*
+    * Test Case: libc-errors/fchmod-bad-arg2-type.idio
+    *
+    * fchmod #t #t
+    */
+    IDIO_USER_libc_TYPE_ASSERT (__mode_t, arg2);
+    __mode_t C_arg2 = IDIO_C_TYPE_libc___mode_t (arg2);
+
+    int fchmod_r = fchmod (C_arg1, C_arg2);
+
+    /* check for errors */
+    if (-1 == fchmod_r) {
+        idio_error_system_errno ("fchmod", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_int (fchmod_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE4_DS ("fchmodat", libc_fchmodat, (IDIO arg1, IDIO arg2, IDIO arg3, IDIO arg4), "arg1 arg2 arg3 arg4", "\
+in C: :samp:`fchmodat ({arg1}, {arg2}, {arg3}, {arg4})`		\n\
+a wrapper to libc :manpage:`fchmodat()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/int			\n\
+:param arg2: 				\n\
+:type arg2: C/pointer			\n\
+:param arg3: 				\n\
+:type arg3: libc/__mode_t			\n\
+:param arg4: 				\n\
+:type arg4: C/int			\n\
+:return:				\n\
+:rtype: C/int	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+    IDIO_ASSERT (arg2);
+    IDIO_ASSERT (arg3);
+    IDIO_ASSERT (arg4);
+
+   /*
+    * Test Case: libc-errors/fchmodat-bad-arg1-type.idio
+    *
+    * fchmodat #t #t #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (int, arg1);
+    int C_arg1 = IDIO_C_TYPE_int (arg1);
+
+   /*
+    * Test Case: libc-errors/fchmodat-bad-arg2-type.idio
+    *
+    * fchmodat #t #t #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg2);
+    char* C_arg2 = IDIO_C_TYPE_POINTER_P (arg2);
+
+   /*
+    * Test Case: libc-errors/fchmodat-bad-arg3-type.idio
+    *
+    * fchmodat #t #t #t #t
+    */
+    IDIO_USER_libc_TYPE_ASSERT (__mode_t, arg3);
+    __mode_t C_arg3 = IDIO_C_TYPE_libc___mode_t (arg3);
+
+   /*
+    * Test Case: libc-errors/fchmodat-bad-arg4-type.idio
+    *
+    * fchmodat #t #t #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (int, arg4);
+    int C_arg4 = IDIO_C_TYPE_int (arg4);
+
+    int fchmodat_r = fchmodat (C_arg1, C_arg2, C_arg3, C_arg4);
+
+    /* check for errors */
+    if (-1 == fchmodat_r) {
+        idio_error_system_errno ("fchmodat", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_int (fchmodat_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE3_DS ("fchown", libc_fchown, (IDIO arg1, IDIO arg2, IDIO arg3), "arg1 arg2 arg3", "\
+in C: :samp:`fchown ({arg1}, {arg2}, {arg3})`		\n\
+a wrapper to libc :manpage:`fchown()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/int			\n\
+:param arg2: 				\n\
+:type arg2: libc/__uid_t			\n\
+:param arg3: 				\n\
+:type arg3: libc/__gid_t			\n\
+:return:				\n\
+:rtype: C/int	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+    IDIO_ASSERT (arg2);
+    IDIO_ASSERT (arg3);
+
+   /*
+    * Test Case: libc-errors/fchown-bad-arg1-type.idio
+    *
+    * fchown #t #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (int, arg1);
+    int C_arg1 = IDIO_C_TYPE_int (arg1);
+
+   /*
+    * Test Case: libc-errors/fchown-bad-arg2-type.idio
+    *
+    * fchown #t #t #t
+    */
+    IDIO_USER_libc_TYPE_ASSERT (__uid_t, arg2);
+    __uid_t C_arg2 = IDIO_C_TYPE_libc___uid_t (arg2);
+
+   /*
+    * Test Case: libc-errors/fchown-bad-arg3-type.idio
+    *
+    * fchown #t #t #t
+    */
+    IDIO_USER_libc_TYPE_ASSERT (__gid_t, arg3);
+    __gid_t C_arg3 = IDIO_C_TYPE_libc___gid_t (arg3);
+
+    int fchown_r = fchown (C_arg1, C_arg2, C_arg3);
+
+    /* check for errors */
+    if (-1 == fchown_r) {
+        idio_error_system_errno ("fchown", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_int (fchown_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE5_DS ("fchownat", libc_fchownat, (IDIO arg1, IDIO arg2, IDIO arg3, IDIO arg4, IDIO arg5), "arg1 arg2 arg3 arg4 arg5", "\
+in C: :samp:`fchownat ({arg1}, {arg2}, {arg3}, {arg4}, {arg5})`		\n\
+a wrapper to libc :manpage:`fchownat()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/int			\n\
+:param arg2: 				\n\
+:type arg2: C/pointer			\n\
+:param arg3: 				\n\
+:type arg3: libc/__uid_t			\n\
+:param arg4: 				\n\
+:type arg4: libc/__gid_t			\n\
+:param arg5: 				\n\
+:type arg5: C/int			\n\
+:return:				\n\
+:rtype: C/int	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+    IDIO_ASSERT (arg2);
+    IDIO_ASSERT (arg3);
+    IDIO_ASSERT (arg4);
+    IDIO_ASSERT (arg5);
+
+   /*
+    * Test Case: libc-errors/fchownat-bad-arg1-type.idio
+    *
+    * fchownat #t #t #t #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (int, arg1);
+    int C_arg1 = IDIO_C_TYPE_int (arg1);
+
+   /*
+    * Test Case: libc-errors/fchownat-bad-arg2-type.idio
+    *
+    * fchownat #t #t #t #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg2);
+    char* C_arg2 = IDIO_C_TYPE_POINTER_P (arg2);
+
+   /*
+    * Test Case: libc-errors/fchownat-bad-arg3-type.idio
+    *
+    * fchownat #t #t #t #t #t
+    */
+    IDIO_USER_libc_TYPE_ASSERT (__uid_t, arg3);
+    __uid_t C_arg3 = IDIO_C_TYPE_libc___uid_t (arg3);
+
+   /*
+    * Test Case: libc-errors/fchownat-bad-arg4-type.idio
+    *
+    * fchownat #t #t #t #t #t
+    */
+    IDIO_USER_libc_TYPE_ASSERT (__gid_t, arg4);
+    __gid_t C_arg4 = IDIO_C_TYPE_libc___gid_t (arg4);
+
+   /*
+    * Test Case: libc-errors/fchownat-bad-arg5-type.idio
+    *
+    * fchownat #t #t #t #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (int, arg5);
+    int C_arg5 = IDIO_C_TYPE_int (arg5);
+
+    int fchownat_r = fchownat (C_arg1, C_arg2, C_arg3, C_arg4, C_arg5);
+
+    /* check for errors */
+    if (-1 == fchownat_r) {
+        idio_error_system_errno ("fchownat", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_int (fchownat_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE2_DS ("fcntl", libc_fcntl, (IDIO arg1, IDIO arg2), "arg1 arg2", "\
+in C: :samp:`fcntl ({arg1}, {arg2})`		\n\
+a wrapper to libc :manpage:`fcntl()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/int			\n\
+:param arg2: 				\n\
+:type arg2: C/int			\n\
+:return:				\n\
+:rtype: C/int	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+    IDIO_ASSERT (arg2);
+
+   /*
+    * Test Case: libc-errors/fcntl-bad-arg1-type.idio
+    *
+    * fcntl #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (int, arg1);
+    int C_arg1 = IDIO_C_TYPE_int (arg1);
+
+   /*
+    * Test Case: libc-errors/fcntl-bad-arg2-type.idio
+    *
+    * fcntl #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (int, arg2);
+    int C_arg2 = IDIO_C_TYPE_int (arg2);
+
+    int fcntl_r = fcntl (C_arg1, C_arg2);
+
+    /* check for errors */
+    if (-1 == fcntl_r) {
+        idio_error_system_errno ("fcntl", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_int (fcntl_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE0_DS ("fork", libc_fork, (), "", "\
+in C: :samp:`fork ()`		\n\
+a wrapper to libc :manpage:`fork()`	\n\
+					\n\
+:return:				\n\
+:rtype: libc/__pid_t	\n\
+")
+{
+
+    __pid_t fork_r = fork ();
+
+    /* check for errors */
+    if (-1 == fork_r) {
+        idio_error_system_errno ("fork", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_libc___pid_t (fork_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE2_DS ("fstat", libc_fstat, (IDIO arg1, IDIO arg2), "arg1 arg2", "\
+in C: :samp:`fstat ({arg1}, {arg2})`		\n\
+a wrapper to libc :manpage:`fstat()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/int			\n\
+:param arg2: 				\n\
+:type arg2: C/pointer			\n\
+:return:				\n\
+:rtype: C/int	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+    IDIO_ASSERT (arg2);
+
+   /*
+    * Test Case: libc-errors/fstat-bad-arg1-type.idio
+    *
+    * fstat #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (int, arg1);
+    int C_arg1 = IDIO_C_TYPE_int (arg1);
+
+   /*
+    * Test Case: libc-errors/fstat-bad-arg2-type.idio
+    *
+    * fstat #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg2);
+    struct stat* C_arg2 = IDIO_C_TYPE_POINTER_P (arg2);
+
+    int fstat_r = fstat (C_arg1, C_arg2);
+
+    /* check for errors */
+    if (-1 == fstat_r) {
+        idio_error_system_errno ("fstat", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_int (fstat_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE4_DS ("fstatat", libc_fstatat, (IDIO arg1, IDIO arg2, IDIO arg3, IDIO arg4), "arg1 arg2 arg3 arg4", "\
+in C: :samp:`fstatat ({arg1}, {arg2}, {arg3}, {arg4})`		\n\
+a wrapper to libc :manpage:`fstatat()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/int			\n\
+:param arg2: 				\n\
+:type arg2: C/pointer			\n\
+:param arg3: 				\n\
+:type arg3: C/pointer			\n\
+:param arg4: 				\n\
+:type arg4: C/int			\n\
+:return:				\n\
+:rtype: C/int	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+    IDIO_ASSERT (arg2);
+    IDIO_ASSERT (arg3);
+    IDIO_ASSERT (arg4);
+
+   /*
+    * Test Case: libc-errors/fstatat-bad-arg1-type.idio
+    *
+    * fstatat #t #t #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (int, arg1);
+    int C_arg1 = IDIO_C_TYPE_int (arg1);
+
+   /*
+    * Test Case: libc-errors/fstatat-bad-arg2-type.idio
+    *
+    * fstatat #t #t #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg2);
+    char* C_arg2 = IDIO_C_TYPE_POINTER_P (arg2);
+
+   /*
+    * Test Case: libc-errors/fstatat-bad-arg3-type.idio
+    *
+    * fstatat #t #t #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg3);
+    struct stat* C_arg3 = IDIO_C_TYPE_POINTER_P (arg3);
+
+   /*
+    * Test Case: libc-errors/fstatat-bad-arg4-type.idio
+    *
+    * fstatat #t #t #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (int, arg4);
+    int C_arg4 = IDIO_C_TYPE_int (arg4);
+
+    int fstatat_r = fstatat (C_arg1, C_arg2, C_arg3, C_arg4);
+
+    /* check for errors */
+    if (-1 == fstatat_r) {
+        idio_error_system_errno ("fstatat", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_int (fstatat_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE2_DS ("fstatvfs", libc_fstatvfs, (IDIO arg1, IDIO arg2), "arg1 arg2", "\
+in C: :samp:`fstatvfs ({arg1}, {arg2})`		\n\
+a wrapper to libc :manpage:`fstatvfs()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/int			\n\
+:param arg2: 				\n\
+:type arg2: C/pointer			\n\
+:return:				\n\
+:rtype: C/int	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+    IDIO_ASSERT (arg2);
+
+   /*
+    * Test Case: libc-errors/fstatvfs-bad-arg1-type.idio
+    *
+    * fstatvfs #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (int, arg1);
+    int C_arg1 = IDIO_C_TYPE_int (arg1);
+
+   /*
+    * Test Case: libc-errors/fstatvfs-bad-arg2-type.idio
+    *
+    * fstatvfs #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg2);
+    struct statvfs* C_arg2 = IDIO_C_TYPE_POINTER_P (arg2);
+
+    int fstatvfs_r = fstatvfs (C_arg1, C_arg2);
+
+    /* check for errors */
+    if (-1 == fstatvfs_r) {
+        idio_error_system_errno ("fstatvfs", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_int (fstatvfs_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("fsync", libc_fsync, (IDIO arg1), "arg1", "\
+in C: :samp:`fsync ({arg1})`		\n\
+a wrapper to libc :manpage:`fsync()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/int			\n\
+:return:				\n\
+:rtype: C/int	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+
+   /*
+    * Test Case: libc-errors/fsync-bad-arg1-type.idio
+    *
+    * fsync #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (int, arg1);
+    int C_arg1 = IDIO_C_TYPE_int (arg1);
+
+    int fsync_r = fsync (C_arg1);
+
+    /* check for errors */
+    if (-1 == fsync_r) {
+        idio_error_system_errno ("fsync", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_int (fsync_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE2_DS ("ftruncate", libc_ftruncate, (IDIO arg1, IDIO arg2), "arg1 arg2", "\
+in C: :samp:`ftruncate ({arg1}, {arg2})`		\n\
+a wrapper to libc :manpage:`ftruncate()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/int			\n\
+:param arg2: 				\n\
+:type arg2: libc/__off_t			\n\
+:return:				\n\
+:rtype: C/int	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+    IDIO_ASSERT (arg2);
+
+   /*
+    * Test Case: libc-errors/ftruncate-bad-arg1-type.idio
+    *
+    * ftruncate #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (int, arg1);
+    int C_arg1 = IDIO_C_TYPE_int (arg1);
+
+   /*
+    * Test Case: libc-errors/ftruncate-bad-arg2-type.idio
+    *
+    * ftruncate #t #t
+    */
+    IDIO_USER_libc_TYPE_ASSERT (__off_t, arg2);
+    __off_t C_arg2 = IDIO_C_TYPE_libc___off_t (arg2);
+
+    int ftruncate_r = ftruncate (C_arg1, C_arg2);
+
+    /* check for errors */
+    if (-1 == ftruncate_r) {
+        idio_error_system_errno ("ftruncate", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_int (ftruncate_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE2_DS ("futimes", libc_futimes, (IDIO arg1, IDIO arg2), "arg1 arg2", "\
+in C: :samp:`futimes ({arg1}, {arg2})`		\n\
+a wrapper to libc :manpage:`futimes()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/int			\n\
+:param arg2: 				\n\
+:type arg2: C/pointer			\n\
+:return:				\n\
+:rtype: C/int	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+    IDIO_ASSERT (arg2);
+
+   /*
+    * Test Case: libc-errors/futimes-bad-arg1-type.idio
+    *
+    * futimes #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (int, arg1);
+    int C_arg1 = IDIO_C_TYPE_int (arg1);
+
+   /*
+    * Test Case: libc-errors/futimes-bad-arg2-type.idio
+    *
+    * futimes #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg2);
+    struct timeval* C_arg2 = IDIO_C_TYPE_POINTER_P (arg2);
+
+    int futimes_r = futimes (C_arg1, C_arg2);
+
+    /* check for errors */
+    if (-1 == futimes_r) {
+        idio_error_system_errno ("futimes", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_int (futimes_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE3_DS ("futimesat", libc_futimesat, (IDIO arg1, IDIO arg2, IDIO arg3), "arg1 arg2 arg3", "\
+in C: :samp:`futimesat ({arg1}, {arg2}, {arg3})`		\n\
+a wrapper to libc :manpage:`futimesat()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/int			\n\
+:param arg2: 				\n\
+:type arg2: C/pointer			\n\
+:param arg3: 				\n\
+:type arg3: C/pointer			\n\
+:return:				\n\
+:rtype: C/int	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+    IDIO_ASSERT (arg2);
+    IDIO_ASSERT (arg3);
+
+   /*
+    * Test Case: libc-errors/futimesat-bad-arg1-type.idio
+    *
+    * futimesat #t #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (int, arg1);
+    int C_arg1 = IDIO_C_TYPE_int (arg1);
+
+   /*
+    * Test Case: libc-errors/futimesat-bad-arg2-type.idio
+    *
+    * futimesat #t #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg2);
+    char* C_arg2 = IDIO_C_TYPE_POINTER_P (arg2);
+
+   /*
+    * Test Case: libc-errors/futimesat-bad-arg3-type.idio
+    *
+    * futimesat #t #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg3);
+    struct timeval* C_arg3 = IDIO_C_TYPE_POINTER_P (arg3);
+
+    int futimesat_r = futimesat (C_arg1, C_arg2, C_arg3);
+
+    /* check for errors */
+    if (-1 == futimesat_r) {
+        idio_error_system_errno ("futimesat", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_int (futimesat_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE2_DS ("getcwd", libc_getcwd, (IDIO arg1, IDIO arg2), "arg1 arg2", "\
+in C: :samp:`getcwd ({arg1}, {arg2})`		\n\
+a wrapper to libc :manpage:`getcwd()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/pointer			\n\
+:param arg2: 				\n\
+:type arg2: libc/size_t			\n\
+:return:				\n\
+:rtype: C/pointer	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+    IDIO_ASSERT (arg2);
+
+   /*
+    * Test Case: libc-errors/getcwd-bad-arg1-type.idio
+    *
+    * getcwd #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg1);
+    char* C_arg1 = IDIO_C_TYPE_POINTER_P (arg1);
+
+   /*
+    * Test Case: libc-errors/getcwd-bad-arg2-type.idio
+    *
+    * getcwd #t #t
+    */
+    IDIO_USER_libc_TYPE_ASSERT (size_t, arg2);
+    size_t C_arg2 = IDIO_C_TYPE_libc_size_t (arg2);
+
+    char* getcwd_r = getcwd (C_arg1, C_arg2);
+
+    /* check for errors */
+    if (-1 == getcwd_r) {
+        idio_error_system_errno ("getcwd", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_pointer_free_me (getcwd_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE0_DS ("getegid", libc_getegid, (), "", "\
+in C: :samp:`getegid ()`		\n\
+a wrapper to libc :manpage:`getegid()`	\n\
+					\n\
+:return:				\n\
+:rtype: libc/__gid_t	\n\
+")
+{
+
+    __gid_t getegid_r = getegid ();
+
+    /* check for errors */
+    if (-1 == getegid_r) {
+        idio_error_system_errno ("getegid", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_libc___gid_t (getegid_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE0_DS ("geteuid", libc_geteuid, (), "", "\
+in C: :samp:`geteuid ()`		\n\
+a wrapper to libc :manpage:`geteuid()`	\n\
+					\n\
+:return:				\n\
+:rtype: libc/__uid_t	\n\
+")
+{
+
+    __uid_t geteuid_r = geteuid ();
+
+    /* check for errors */
+    if (-1 == geteuid_r) {
+        idio_error_system_errno ("geteuid", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_libc___uid_t (geteuid_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE0_DS ("getgid", libc_getgid, (), "", "\
+in C: :samp:`getgid ()`		\n\
+a wrapper to libc :manpage:`getgid()`	\n\
+					\n\
+:return:				\n\
+:rtype: libc/__gid_t	\n\
+")
+{
+
+    __gid_t getgid_r = getgid ();
+
+    /* check for errors */
+    if (-1 == getgid_r) {
+        idio_error_system_errno ("getgid", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_libc___gid_t (getgid_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("getgrgid", libc_getgrgid, (IDIO arg1), "arg1", "\
+in C: :samp:`getgrgid ({arg1})`		\n\
+a wrapper to libc :manpage:`getgrgid()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: libc/__gid_t			\n\
+:return:				\n\
+:rtype: C/pointer	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+
+   /*
+    * Test Case: libc-errors/getgrgid-bad-arg1-type.idio
+    *
+    * getgrgid #t
+    */
+    IDIO_USER_libc_TYPE_ASSERT (__gid_t, arg1);
+    __gid_t C_arg1 = IDIO_C_TYPE_libc___gid_t (arg1);
+
+    struct group* getgrgid_r = getgrgid (C_arg1);
+
+    /* check for errors */
+    if (-1 == getgrgid_r) {
+        idio_error_system_errno ("getgrgid", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_pointer_free_me (getgrgid_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("getgrnam", libc_getgrnam, (IDIO arg1), "arg1", "\
+in C: :samp:`getgrnam ({arg1})`		\n\
+a wrapper to libc :manpage:`getgrnam()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/pointer			\n\
+:return:				\n\
+:rtype: C/pointer	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+
+   /*
+    * Test Case: libc-errors/getgrnam-bad-arg1-type.idio
+    *
+    * getgrnam #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg1);
+    char* C_arg1 = IDIO_C_TYPE_POINTER_P (arg1);
+
+    struct group* getgrnam_r = getgrnam (C_arg1);
+
+    /* check for errors */
+    if (-1 == getgrnam_r) {
+        idio_error_system_errno ("getgrnam", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_pointer_free_me (getgrnam_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE0_DS ("getlogin", libc_getlogin, (), "", "\
+in C: :samp:`getlogin ()`		\n\
+a wrapper to libc :manpage:`getlogin()`	\n\
+					\n\
+:return:				\n\
+:rtype: C/pointer	\n\
+")
+{
+
+    char* getlogin_r = getlogin ();
+
+    /* check for errors */
+    if (-1 == getlogin_r) {
+        idio_error_system_errno ("getlogin", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_pointer_free_me (getlogin_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("getpgid", libc_getpgid, (IDIO arg1), "arg1", "\
+in C: :samp:`getpgid ({arg1})`		\n\
+a wrapper to libc :manpage:`getpgid()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: libc/__pid_t			\n\
+:return:				\n\
+:rtype: libc/__pid_t	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+
+   /*
+    * Test Case: libc-errors/getpgid-bad-arg1-type.idio
+    *
+    * getpgid #t
+    */
+    IDIO_USER_libc_TYPE_ASSERT (__pid_t, arg1);
+    __pid_t C_arg1 = IDIO_C_TYPE_libc___pid_t (arg1);
+
+    __pid_t getpgid_r = getpgid (C_arg1);
+
+    /* check for errors */
+    if (-1 == getpgid_r) {
+        idio_error_system_errno ("getpgid", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_libc___pid_t (getpgid_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE0_DS ("getpgrp", libc_getpgrp, (), "", "\
+in C: :samp:`getpgrp ()`		\n\
+a wrapper to libc :manpage:`getpgrp()`	\n\
+					\n\
+:return:				\n\
+:rtype: libc/__pid_t	\n\
+")
+{
+
+    __pid_t getpgrp_r = getpgrp ();
+
+    /* check for errors */
+    if (-1 == getpgrp_r) {
+        idio_error_system_errno ("getpgrp", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_libc___pid_t (getpgrp_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE0_DS ("getpid", libc_getpid, (), "", "\
+in C: :samp:`getpid ()`		\n\
+a wrapper to libc :manpage:`getpid()`	\n\
+					\n\
+:return:				\n\
+:rtype: libc/__pid_t	\n\
+")
+{
+
+    __pid_t getpid_r = getpid ();
+
+    /* check for errors */
+    if (-1 == getpid_r) {
+        idio_error_system_errno ("getpid", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_libc___pid_t (getpid_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE0_DS ("getppid", libc_getppid, (), "", "\
+in C: :samp:`getppid ()`		\n\
+a wrapper to libc :manpage:`getppid()`	\n\
+					\n\
+:return:				\n\
+:rtype: libc/__pid_t	\n\
+")
+{
+
+    __pid_t getppid_r = getppid ();
+
+    /* check for errors */
+    if (-1 == getppid_r) {
+        idio_error_system_errno ("getppid", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_libc___pid_t (getppid_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE2_DS ("getpriority", libc_getpriority, (IDIO arg1, IDIO arg2), "arg1 arg2", "\
+in C: :samp:`getpriority ({arg1}, {arg2})`		\n\
+a wrapper to libc :manpage:`getpriority()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: libc/__priority_which_t			\n\
+:param arg2: 				\n\
+:type arg2: libc/id_t			\n\
+:return:				\n\
+:rtype: C/int	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+    IDIO_ASSERT (arg2);
+
+   /*
+    * Test Case: libc-errors/getpriority-bad-arg1-type.idio
+    *
+    * getpriority #t #t
+    */
+    IDIO_USER_libc_TYPE_ASSERT (__priority_which_t, arg1);
+    __priority_which_t C_arg1 = IDIO_C_TYPE_libc___priority_which_t (arg1);
+
+   /*
+    * Test Case: libc-errors/getpriority-bad-arg2-type.idio
+    *
+    * getpriority #t #t
+    */
+    IDIO_USER_libc_TYPE_ASSERT (id_t, arg2);
+    id_t C_arg2 = IDIO_C_TYPE_libc_id_t (arg2);
+
+    int getpriority_r = getpriority (C_arg1, C_arg2);
+
+    /* check for errors */
+    if (-1 == getpriority_r) {
+        idio_error_system_errno ("getpriority", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_int (getpriority_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("getpwnam", libc_getpwnam, (IDIO arg1), "arg1", "\
+in C: :samp:`getpwnam ({arg1})`		\n\
+a wrapper to libc :manpage:`getpwnam()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/pointer			\n\
+:return:				\n\
+:rtype: C/pointer	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+
+   /*
+    * Test Case: libc-errors/getpwnam-bad-arg1-type.idio
+    *
+    * getpwnam #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg1);
+    char* C_arg1 = IDIO_C_TYPE_POINTER_P (arg1);
+
+    struct passwd* getpwnam_r = getpwnam (C_arg1);
+
+    /* check for errors */
+    if (-1 == getpwnam_r) {
+        idio_error_system_errno ("getpwnam", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_pointer_free_me (getpwnam_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("getpwuid", libc_getpwuid, (IDIO arg1), "arg1", "\
+in C: :samp:`getpwuid ({arg1})`		\n\
+a wrapper to libc :manpage:`getpwuid()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: libc/__uid_t			\n\
+:return:				\n\
+:rtype: C/pointer	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+
+   /*
+    * Test Case: libc-errors/getpwuid-bad-arg1-type.idio
+    *
+    * getpwuid #t
+    */
+    IDIO_USER_libc_TYPE_ASSERT (__uid_t, arg1);
+    __uid_t C_arg1 = IDIO_C_TYPE_libc___uid_t (arg1);
+
+    struct passwd* getpwuid_r = getpwuid (C_arg1);
+
+    /* check for errors */
+    if (-1 == getpwuid_r) {
+        idio_error_system_errno ("getpwuid", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_pointer_free_me (getpwuid_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE2_DS ("getrlimit", libc_getrlimit, (IDIO arg1, IDIO arg2), "arg1 arg2", "\
+in C: :samp:`getrlimit ({arg1}, {arg2})`		\n\
+a wrapper to libc :manpage:`getrlimit()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: libc/__rlimit_resource_t			\n\
+:param arg2: 				\n\
+:type arg2: C/pointer			\n\
+:return:				\n\
+:rtype: C/int	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+    IDIO_ASSERT (arg2);
+
+   /*
+    * Test Case: libc-errors/getrlimit-bad-arg1-type.idio
+    *
+    * getrlimit #t #t
+    */
+    IDIO_USER_libc_TYPE_ASSERT (__rlimit_resource_t, arg1);
+    __rlimit_resource_t C_arg1 = IDIO_C_TYPE_libc___rlimit_resource_t (arg1);
+
+   /*
+    * Test Case: libc-errors/getrlimit-bad-arg2-type.idio
+    *
+    * getrlimit #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg2);
+    struct rlimit* C_arg2 = IDIO_C_TYPE_POINTER_P (arg2);
+
+    int getrlimit_r = getrlimit (C_arg1, C_arg2);
+
+    /* check for errors */
+    if (-1 == getrlimit_r) {
+        idio_error_system_errno ("getrlimit", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_int (getrlimit_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE2_DS ("getrusage", libc_getrusage, (IDIO arg1, IDIO arg2), "arg1 arg2", "\
+in C: :samp:`getrusage ({arg1}, {arg2})`		\n\
+a wrapper to libc :manpage:`getrusage()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: libc/__rusage_who_t			\n\
+:param arg2: 				\n\
+:type arg2: C/pointer			\n\
+:return:				\n\
+:rtype: C/int	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+    IDIO_ASSERT (arg2);
+
+   /*
+    * Test Case: libc-errors/getrusage-bad-arg1-type.idio
+    *
+    * getrusage #t #t
+    */
+    IDIO_USER_libc_TYPE_ASSERT (__rusage_who_t, arg1);
+    __rusage_who_t C_arg1 = IDIO_C_TYPE_libc___rusage_who_t (arg1);
+
+   /*
+    * Test Case: libc-errors/getrusage-bad-arg2-type.idio
+    *
+    * getrusage #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg2);
+    struct rusage* C_arg2 = IDIO_C_TYPE_POINTER_P (arg2);
+
+    int getrusage_r = getrusage (C_arg1, C_arg2);
+
+    /* check for errors */
+    if (-1 == getrusage_r) {
+        idio_error_system_errno ("getrusage", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_int (getrusage_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("getsid", libc_getsid, (IDIO arg1), "arg1", "\
+in C: :samp:`getsid ({arg1})`		\n\
+a wrapper to libc :manpage:`getsid()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: libc/__pid_t			\n\
+:return:				\n\
+:rtype: libc/__pid_t	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+
+   /*
+    * Test Case: libc-errors/getsid-bad-arg1-type.idio
+    *
+    * getsid #t
+    */
+    IDIO_USER_libc_TYPE_ASSERT (__pid_t, arg1);
+    __pid_t C_arg1 = IDIO_C_TYPE_libc___pid_t (arg1);
+
+    __pid_t getsid_r = getsid (C_arg1);
+
+    /* check for errors */
+    if (-1 == getsid_r) {
+        idio_error_system_errno ("getsid", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_libc___pid_t (getsid_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE2_DS ("gettimeofday", libc_gettimeofday, (IDIO arg1, IDIO arg2), "arg1 arg2", "\
+in C: :samp:`gettimeofday ({arg1}, {arg2})`		\n\
+a wrapper to libc :manpage:`gettimeofday()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/pointer			\n\
+:param arg2: 				\n\
+:type arg2: C/pointer			\n\
+:return:				\n\
+:rtype: C/int	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+    IDIO_ASSERT (arg2);
+
+   /*
+    * Test Case: libc-errors/gettimeofday-bad-arg1-type.idio
+    *
+    * gettimeofday #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg1);
+    struct timeval* C_arg1 = IDIO_C_TYPE_POINTER_P (arg1);
+
+   /*
+    * Test Case: libc-errors/gettimeofday-bad-arg2-type.idio
+    *
+    * gettimeofday #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg2);
+    void* C_arg2 = IDIO_C_TYPE_POINTER_P (arg2);
+
+    int gettimeofday_r = gettimeofday (C_arg1, C_arg2);
+
+    /* check for errors */
+    if (-1 == gettimeofday_r) {
+        idio_error_system_errno ("gettimeofday", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_int (gettimeofday_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE0_DS ("getuid", libc_getuid, (), "", "\
+in C: :samp:`getuid ()`		\n\
+a wrapper to libc :manpage:`getuid()`	\n\
+					\n\
+:return:				\n\
+:rtype: libc/__uid_t	\n\
+")
+{
+
+    __uid_t getuid_r = getuid ();
+
+    /* check for errors */
+    if (-1 == getuid_r) {
+        idio_error_system_errno ("getuid", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_libc___uid_t (getuid_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("gmtime", libc_gmtime, (IDIO arg1), "arg1", "\
+in C: :samp:`gmtime ({arg1})`		\n\
+a wrapper to libc :manpage:`gmtime()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/pointer			\n\
+:return:				\n\
+:rtype: C/pointer	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+
+   /*
+    * Test Case: libc-errors/gmtime-bad-arg1-type.idio
+    *
+    * gmtime #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg1);
+    time_t* C_arg1 = IDIO_C_TYPE_POINTER_P (arg1);
+
+    struct tm* gmtime_r = gmtime (C_arg1);
+
+    /* check for errors */
+    if (-1 == gmtime_r) {
+        idio_error_system_errno ("gmtime", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_pointer_free_me (gmtime_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("grantpt", libc_grantpt, (IDIO arg1), "arg1", "\
+in C: :samp:`grantpt ({arg1})`		\n\
+a wrapper to libc :manpage:`grantpt()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/int			\n\
+:return:				\n\
+:rtype: C/int	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+
+   /*
+    * Test Case: libc-errors/grantpt-bad-arg1-type.idio
+    *
+    * grantpt #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (int, arg1);
+    int C_arg1 = IDIO_C_TYPE_int (arg1);
+
+    int grantpt_r = grantpt (C_arg1);
+
+    /* check for errors */
+    if (-1 == grantpt_r) {
+        idio_error_system_errno ("grantpt", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_int (grantpt_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE2_DS ("ioctl", libc_ioctl, (IDIO arg1, IDIO arg2), "arg1 arg2", "\
+in C: :samp:`ioctl ({arg1}, {arg2})`		\n\
+a wrapper to libc :manpage:`ioctl()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/int			\n\
+:param arg2: 				\n\
+:type arg2: C/ulong			\n\
+:return:				\n\
+:rtype: C/int	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+    IDIO_ASSERT (arg2);
+
+   /*
+    * Test Case: libc-errors/ioctl-bad-arg1-type.idio
+    *
+    * ioctl #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (int, arg1);
+    int C_arg1 = IDIO_C_TYPE_int (arg1);
+
+   /*
+    * Test Case: libc-errors/ioctl-bad-arg2-type.idio
+    *
+    * ioctl #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (ulong, arg2);
+    long unsigned int C_arg2 = IDIO_C_TYPE_ulong (arg2);
+
+    int ioctl_r = ioctl (C_arg1, C_arg2);
+
+    /* check for errors */
+    if (-1 == ioctl_r) {
+        idio_error_system_errno ("ioctl", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_int (ioctl_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("isatty", libc_isatty, (IDIO arg1), "arg1", "\
+in C: :samp:`isatty ({arg1})`		\n\
+a wrapper to libc :manpage:`isatty()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/int			\n\
+:return:				\n\
+:rtype: C/int	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+
+   /*
+    * Test Case: libc-errors/isatty-bad-arg1-type.idio
+    *
+    * isatty #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (int, arg1);
+    int C_arg1 = IDIO_C_TYPE_int (arg1);
+
+    int isatty_r = isatty (C_arg1);
+
+    /* check for errors */
+    if (-1 == isatty_r) {
+        idio_error_system_errno ("isatty", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_int (isatty_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE2_DS ("kill", libc_kill, (IDIO arg1, IDIO arg2), "arg1 arg2", "\
+in C: :samp:`kill ({arg1}, {arg2})`		\n\
+a wrapper to libc :manpage:`kill()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: libc/__pid_t			\n\
+:param arg2: 				\n\
+:type arg2: C/int			\n\
+:return:				\n\
+:rtype: C/int	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+    IDIO_ASSERT (arg2);
+
+   /*
+    * Test Case: libc-errors/kill-bad-arg1-type.idio
+    *
+    * kill #t #t
+    */
+    IDIO_USER_libc_TYPE_ASSERT (__pid_t, arg1);
+    __pid_t C_arg1 = IDIO_C_TYPE_libc___pid_t (arg1);
+
+   /*
+    * Test Case: libc-errors/kill-bad-arg2-type.idio
+    *
+    * kill #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (int, arg2);
+    int C_arg2 = IDIO_C_TYPE_int (arg2);
+
+    int kill_r = kill (C_arg1, C_arg2);
+
+    /* check for errors */
+    if (-1 == kill_r) {
+        idio_error_system_errno ("kill", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_int (kill_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE2_DS ("killpg", libc_killpg, (IDIO arg1, IDIO arg2), "arg1 arg2", "\
+in C: :samp:`killpg ({arg1}, {arg2})`		\n\
+a wrapper to libc :manpage:`killpg()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: libc/__pid_t			\n\
+:param arg2: 				\n\
+:type arg2: C/int			\n\
+:return:				\n\
+:rtype: C/int	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+    IDIO_ASSERT (arg2);
+
+   /*
+    * Test Case: libc-errors/killpg-bad-arg1-type.idio
+    *
+    * killpg #t #t
+    */
+    IDIO_USER_libc_TYPE_ASSERT (__pid_t, arg1);
+    __pid_t C_arg1 = IDIO_C_TYPE_libc___pid_t (arg1);
+
+   /*
+    * Test Case: libc-errors/killpg-bad-arg2-type.idio
+    *
+    * killpg #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (int, arg2);
+    int C_arg2 = IDIO_C_TYPE_int (arg2);
+
+    int killpg_r = killpg (C_arg1, C_arg2);
+
+    /* check for errors */
+    if (-1 == killpg_r) {
+        idio_error_system_errno ("killpg", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_int (killpg_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE2_DS ("link", libc_link, (IDIO arg1, IDIO arg2), "arg1 arg2", "\
+in C: :samp:`link ({arg1}, {arg2})`		\n\
+a wrapper to libc :manpage:`link()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/pointer			\n\
+:param arg2: 				\n\
+:type arg2: C/pointer			\n\
+:return:				\n\
+:rtype: C/int	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+    IDIO_ASSERT (arg2);
+
+   /*
+    * Test Case: libc-errors/link-bad-arg1-type.idio
+    *
+    * link #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg1);
+    char* C_arg1 = IDIO_C_TYPE_POINTER_P (arg1);
+
+   /*
+    * Test Case: libc-errors/link-bad-arg2-type.idio
+    *
+    * link #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg2);
+    char* C_arg2 = IDIO_C_TYPE_POINTER_P (arg2);
+
+    int link_r = link (C_arg1, C_arg2);
+
+    /* check for errors */
+    if (-1 == link_r) {
+        idio_error_system_errno ("link", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_int (link_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE5_DS ("linkat", libc_linkat, (IDIO arg1, IDIO arg2, IDIO arg3, IDIO arg4, IDIO arg5), "arg1 arg2 arg3 arg4 arg5", "\
+in C: :samp:`linkat ({arg1}, {arg2}, {arg3}, {arg4}, {arg5})`		\n\
+a wrapper to libc :manpage:`linkat()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/int			\n\
+:param arg2: 				\n\
+:type arg2: C/pointer			\n\
+:param arg3: 				\n\
+:type arg3: C/int			\n\
+:param arg4: 				\n\
+:type arg4: C/pointer			\n\
+:param arg5: 				\n\
+:type arg5: C/int			\n\
+:return:				\n\
+:rtype: C/int	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+    IDIO_ASSERT (arg2);
+    IDIO_ASSERT (arg3);
+    IDIO_ASSERT (arg4);
+    IDIO_ASSERT (arg5);
+
+   /*
+    * Test Case: libc-errors/linkat-bad-arg1-type.idio
+    *
+    * linkat #t #t #t #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (int, arg1);
+    int C_arg1 = IDIO_C_TYPE_int (arg1);
+
+   /*
+    * Test Case: libc-errors/linkat-bad-arg2-type.idio
+    *
+    * linkat #t #t #t #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg2);
+    char* C_arg2 = IDIO_C_TYPE_POINTER_P (arg2);
+
+   /*
+    * Test Case: libc-errors/linkat-bad-arg3-type.idio
+    *
+    * linkat #t #t #t #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (int, arg3);
+    int C_arg3 = IDIO_C_TYPE_int (arg3);
+
+   /*
+    * Test Case: libc-errors/linkat-bad-arg4-type.idio
+    *
+    * linkat #t #t #t #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg4);
+    char* C_arg4 = IDIO_C_TYPE_POINTER_P (arg4);
+
+   /*
+    * Test Case: libc-errors/linkat-bad-arg5-type.idio
+    *
+    * linkat #t #t #t #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (int, arg5);
+    int C_arg5 = IDIO_C_TYPE_int (arg5);
+
+    int linkat_r = linkat (C_arg1, C_arg2, C_arg3, C_arg4, C_arg5);
+
+    /* check for errors */
+    if (-1 == linkat_r) {
+        idio_error_system_errno ("linkat", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_int (linkat_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("localtime", libc_localtime, (IDIO arg1), "arg1", "\
+in C: :samp:`localtime ({arg1})`		\n\
+a wrapper to libc :manpage:`localtime()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/pointer			\n\
+:return:				\n\
+:rtype: C/pointer	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+
+   /*
+    * Test Case: libc-errors/localtime-bad-arg1-type.idio
+    *
+    * localtime #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg1);
+    time_t* C_arg1 = IDIO_C_TYPE_POINTER_P (arg1);
+
+    struct tm* localtime_r = localtime (C_arg1);
+
+    /* check for errors */
+    if (-1 == localtime_r) {
+        idio_error_system_errno ("localtime", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_pointer_free_me (localtime_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE3_DS ("lockf", libc_lockf, (IDIO arg1, IDIO arg2, IDIO arg3), "arg1 arg2 arg3", "\
+in C: :samp:`lockf ({arg1}, {arg2}, {arg3})`		\n\
+a wrapper to libc :manpage:`lockf()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/int			\n\
+:param arg2: 				\n\
+:type arg2: C/int			\n\
+:param arg3: 				\n\
+:type arg3: libc/__off_t			\n\
+:return:				\n\
+:rtype: C/int	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+    IDIO_ASSERT (arg2);
+    IDIO_ASSERT (arg3);
+
+   /*
+    * Test Case: libc-errors/lockf-bad-arg1-type.idio
+    *
+    * lockf #t #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (int, arg1);
+    int C_arg1 = IDIO_C_TYPE_int (arg1);
+
+   /*
+    * Test Case: libc-errors/lockf-bad-arg2-type.idio
+    *
+    * lockf #t #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (int, arg2);
+    int C_arg2 = IDIO_C_TYPE_int (arg2);
+
+   /*
+    * Test Case: libc-errors/lockf-bad-arg3-type.idio
+    *
+    * lockf #t #t #t
+    */
+    IDIO_USER_libc_TYPE_ASSERT (__off_t, arg3);
+    __off_t C_arg3 = IDIO_C_TYPE_libc___off_t (arg3);
+
+    int lockf_r = lockf (C_arg1, C_arg2, C_arg3);
+
+    /* check for errors */
+    if (-1 == lockf_r) {
+        idio_error_system_errno ("lockf", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_int (lockf_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE2_DS ("lstat", libc_lstat, (IDIO arg1, IDIO arg2), "arg1 arg2", "\
+in C: :samp:`lstat ({arg1}, {arg2})`		\n\
+a wrapper to libc :manpage:`lstat()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/pointer			\n\
+:param arg2: 				\n\
+:type arg2: C/pointer			\n\
+:return:				\n\
+:rtype: C/int	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+    IDIO_ASSERT (arg2);
+
+   /*
+    * Test Case: libc-errors/lstat-bad-arg1-type.idio
+    *
+    * lstat #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg1);
+    char* C_arg1 = IDIO_C_TYPE_POINTER_P (arg1);
+
+   /*
+    * Test Case: libc-errors/lstat-bad-arg2-type.idio
+    *
+    * lstat #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg2);
+    struct stat* C_arg2 = IDIO_C_TYPE_POINTER_P (arg2);
+
+    int lstat_r = lstat (C_arg1, C_arg2);
+
+    /* check for errors */
+    if (-1 == lstat_r) {
+        idio_error_system_errno ("lstat", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_int (lstat_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE2_DS ("mkdir", libc_mkdir, (IDIO arg1, IDIO arg2), "arg1 arg2", "\
+in C: :samp:`mkdir ({arg1}, {arg2})`		\n\
+a wrapper to libc :manpage:`mkdir()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/pointer			\n\
+:param arg2: 				\n\
+:type arg2: libc/__mode_t			\n\
+:return:				\n\
+:rtype: C/int	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+    IDIO_ASSERT (arg2);
+
+   /*
+    * Test Case: libc-errors/mkdir-bad-arg1-type.idio
+    *
+    * mkdir #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg1);
+    char* C_arg1 = IDIO_C_TYPE_POINTER_P (arg1);
+
+   /*
+    * Test Case: libc-errors/mkdir-bad-arg2-type.idio
+    *
+    * mkdir #t #t
+    */
+    IDIO_USER_libc_TYPE_ASSERT (__mode_t, arg2);
+    __mode_t C_arg2 = IDIO_C_TYPE_libc___mode_t (arg2);
+
+    int mkdir_r = mkdir (C_arg1, C_arg2);
+
+    /* check for errors */
+    if (-1 == mkdir_r) {
+        idio_error_system_errno ("mkdir", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_int (mkdir_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE3_DS ("mkdirat", libc_mkdirat, (IDIO arg1, IDIO arg2, IDIO arg3), "arg1 arg2 arg3", "\
+in C: :samp:`mkdirat ({arg1}, {arg2}, {arg3})`		\n\
+a wrapper to libc :manpage:`mkdirat()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/int			\n\
+:param arg2: 				\n\
+:type arg2: C/pointer			\n\
+:param arg3: 				\n\
+:type arg3: libc/__mode_t			\n\
+:return:				\n\
+:rtype: C/int	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+    IDIO_ASSERT (arg2);
+    IDIO_ASSERT (arg3);
+
+   /*
+    * Test Case: libc-errors/mkdirat-bad-arg1-type.idio
+    *
+    * mkdirat #t #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (int, arg1);
+    int C_arg1 = IDIO_C_TYPE_int (arg1);
+
+   /*
+    * Test Case: libc-errors/mkdirat-bad-arg2-type.idio
+    *
+    * mkdirat #t #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg2);
+    char* C_arg2 = IDIO_C_TYPE_POINTER_P (arg2);
+
+   /*
+    * Test Case: libc-errors/mkdirat-bad-arg3-type.idio
+    *
+    * mkdirat #t #t #t
+    */
+    IDIO_USER_libc_TYPE_ASSERT (__mode_t, arg3);
+    __mode_t C_arg3 = IDIO_C_TYPE_libc___mode_t (arg3);
+
+    int mkdirat_r = mkdirat (C_arg1, C_arg2, C_arg3);
+
+    /* check for errors */
+    if (-1 == mkdirat_r) {
+        idio_error_system_errno ("mkdirat", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_int (mkdirat_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("mkdtemp", libc_mkdtemp, (IDIO arg1), "arg1", "\
+in C: :samp:`mkdtemp ({arg1})`		\n\
+a wrapper to libc :manpage:`mkdtemp()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/pointer			\n\
+:return:				\n\
+:rtype: C/pointer	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+
+   /*
+    * Test Case: libc-errors/mkdtemp-bad-arg1-type.idio
+    *
+    * mkdtemp #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg1);
+    char* C_arg1 = IDIO_C_TYPE_POINTER_P (arg1);
+
+    char* mkdtemp_r = mkdtemp (C_arg1);
+
+    /* check for errors */
+    if (-1 == mkdtemp_r) {
+        idio_error_system_errno ("mkdtemp", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_pointer_free_me (mkdtemp_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE2_DS ("mkfifo", libc_mkfifo, (IDIO arg1, IDIO arg2), "arg1 arg2", "\
+in C: :samp:`mkfifo ({arg1}, {arg2})`		\n\
+a wrapper to libc :manpage:`mkfifo()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/pointer			\n\
+:param arg2: 				\n\
+:type arg2: libc/__mode_t			\n\
+:return:				\n\
+:rtype: C/int	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+    IDIO_ASSERT (arg2);
+
+   /*
+    * Test Case: libc-errors/mkfifo-bad-arg1-type.idio
+    *
+    * mkfifo #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg1);
+    char* C_arg1 = IDIO_C_TYPE_POINTER_P (arg1);
+
+   /*
+    * Test Case: libc-errors/mkfifo-bad-arg2-type.idio
+    *
+    * mkfifo #t #t
+    */
+    IDIO_USER_libc_TYPE_ASSERT (__mode_t, arg2);
+    __mode_t C_arg2 = IDIO_C_TYPE_libc___mode_t (arg2);
+
+    int mkfifo_r = mkfifo (C_arg1, C_arg2);
+
+    /* check for errors */
+    if (-1 == mkfifo_r) {
+        idio_error_system_errno ("mkfifo", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_int (mkfifo_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("mkstemp", libc_mkstemp, (IDIO arg1), "arg1", "\
+in C: :samp:`mkstemp ({arg1})`		\n\
+a wrapper to libc :manpage:`mkstemp()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/pointer			\n\
+:return:				\n\
+:rtype: C/int	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+
+   /*
+    * Test Case: libc-errors/mkstemp-bad-arg1-type.idio
+    *
+    * mkstemp #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg1);
+    char* C_arg1 = IDIO_C_TYPE_POINTER_P (arg1);
+
+    int mkstemp_r = mkstemp (C_arg1);
+
+    /* check for errors */
+    if (-1 == mkstemp_r) {
+        idio_error_system_errno ("mkstemp", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_int (mkstemp_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("mktime", libc_mktime, (IDIO arg1), "arg1", "\
+in C: :samp:`mktime ({arg1})`		\n\
+a wrapper to libc :manpage:`mktime()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/pointer			\n\
+:return:				\n\
+:rtype: libc/time_t	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+
+   /*
+    * Test Case: libc-errors/mktime-bad-arg1-type.idio
+    *
+    * mktime #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg1);
+    struct tm* C_arg1 = IDIO_C_TYPE_POINTER_P (arg1);
+
+    time_t mktime_r = mktime (C_arg1);
+
+    /* check for errors */
+    if (-1 == mktime_r) {
+        idio_error_system_errno ("mktime", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_libc_time_t (mktime_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE2_DS ("nanosleep", libc_nanosleep, (IDIO arg1, IDIO arg2), "arg1 arg2", "\
+in C: :samp:`nanosleep ({arg1}, {arg2})`		\n\
+a wrapper to libc :manpage:`nanosleep()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/pointer			\n\
+:param arg2: 				\n\
+:type arg2: C/pointer			\n\
+:return:				\n\
+:rtype: C/int	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+    IDIO_ASSERT (arg2);
+
+   /*
+    * Test Case: libc-errors/nanosleep-bad-arg1-type.idio
+    *
+    * nanosleep #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg1);
+    struct timespec* C_arg1 = IDIO_C_TYPE_POINTER_P (arg1);
+
+   /*
+    * Test Case: libc-errors/nanosleep-bad-arg2-type.idio
+    *
+    * nanosleep #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg2);
+    struct timespec* C_arg2 = IDIO_C_TYPE_POINTER_P (arg2);
+
+    int nanosleep_r = nanosleep (C_arg1, C_arg2);
+
+    /* check for errors */
+    if (-1 == nanosleep_r) {
+        idio_error_system_errno ("nanosleep", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_int (nanosleep_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE2_DS ("open", libc_open, (IDIO arg1, IDIO arg2), "arg1 arg2", "\
+in C: :samp:`open ({arg1}, {arg2})`		\n\
+a wrapper to libc :manpage:`open()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/pointer			\n\
+:param arg2: 				\n\
+:type arg2: C/int			\n\
+:return:				\n\
+:rtype: C/int	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+    IDIO_ASSERT (arg2);
+
+   /*
+    * Test Case: libc-errors/open-bad-arg1-type.idio
+    *
+    * open #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg1);
+    char* C_arg1 = IDIO_C_TYPE_POINTER_P (arg1);
+
+   /*
+    * Test Case: libc-errors/open-bad-arg2-type.idio
+    *
+    * open #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (int, arg2);
+    int C_arg2 = IDIO_C_TYPE_int (arg2);
+
+    int open_r = open (C_arg1, C_arg2);
+
+    /* check for errors */
+    if (-1 == open_r) {
+        idio_error_system_errno ("open", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_int (open_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE3_DS ("openat", libc_openat, (IDIO arg1, IDIO arg2, IDIO arg3), "arg1 arg2 arg3", "\
+in C: :samp:`openat ({arg1}, {arg2}, {arg3})`		\n\
+a wrapper to libc :manpage:`openat()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/int			\n\
+:param arg2: 				\n\
+:type arg2: C/pointer			\n\
+:param arg3: 				\n\
+:type arg3: C/int			\n\
+:return:				\n\
+:rtype: C/int	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+    IDIO_ASSERT (arg2);
+    IDIO_ASSERT (arg3);
+
+   /*
+    * Test Case: libc-errors/openat-bad-arg1-type.idio
+    *
+    * openat #t #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (int, arg1);
+    int C_arg1 = IDIO_C_TYPE_int (arg1);
+
+   /*
+    * Test Case: libc-errors/openat-bad-arg2-type.idio
+    *
+    * openat #t #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg2);
+    char* C_arg2 = IDIO_C_TYPE_POINTER_P (arg2);
+
+   /*
+    * Test Case: libc-errors/openat-bad-arg3-type.idio
+    *
+    * openat #t #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (int, arg3);
+    int C_arg3 = IDIO_C_TYPE_int (arg3);
+
+    int openat_r = openat (C_arg1, C_arg2, C_arg3);
+
+    /* check for errors */
+    if (-1 == openat_r) {
+        idio_error_system_errno ("openat", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_int (openat_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("pipe", libc_pipe, (IDIO arg1), "arg1", "\
+in C: :samp:`pipe ({arg1})`		\n\
+a wrapper to libc :manpage:`pipe()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/pointer			\n\
+:return:				\n\
+:rtype: C/int	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+
+   /*
+    * Test Case: libc-errors/pipe-bad-arg1-type.idio
+    *
+    * pipe #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg1);
+    int* C_arg1 = IDIO_C_TYPE_POINTER_P (arg1);
+
+    int pipe_r = pipe (C_arg1);
+
+    /* check for errors */
+    if (-1 == pipe_r) {
+        idio_error_system_errno ("pipe", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_int (pipe_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("posix_openpt", libc_posix_openpt, (IDIO arg1), "arg1", "\
+in C: :samp:`posix_openpt ({arg1})`		\n\
+a wrapper to libc :manpage:`posix_openpt()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/int			\n\
+:return:				\n\
+:rtype: C/int	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+
+   /*
+    * Test Case: libc-errors/posix_openpt-bad-arg1-type.idio
+    *
+    * posix_openpt #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (int, arg1);
+    int C_arg1 = IDIO_C_TYPE_int (arg1);
+
+    int posix_openpt_r = posix_openpt (C_arg1);
+
+    /* check for errors */
+    if (-1 == posix_openpt_r) {
+        idio_error_system_errno ("posix_openpt", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_int (posix_openpt_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE4_DS ("pread", libc_pread, (IDIO arg1, IDIO arg2, IDIO arg3, IDIO arg4), "arg1 arg2 arg3 arg4", "\
+in C: :samp:`pread ({arg1}, {arg2}, {arg3}, {arg4})`		\n\
+a wrapper to libc :manpage:`pread()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/int			\n\
+:param arg2: 				\n\
+:type arg2: C/pointer			\n\
+:param arg3: 				\n\
+:type arg3: libc/size_t			\n\
+:param arg4: 				\n\
+:type arg4: libc/__off_t			\n\
+:return:				\n\
+:rtype: libc/ssize_t	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+    IDIO_ASSERT (arg2);
+    IDIO_ASSERT (arg3);
+    IDIO_ASSERT (arg4);
+
+   /*
+    * Test Case: libc-errors/pread-bad-arg1-type.idio
+    *
+    * pread #t #t #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (int, arg1);
+    int C_arg1 = IDIO_C_TYPE_int (arg1);
+
+   /*
+    * Test Case: libc-errors/pread-bad-arg2-type.idio
+    *
+    * pread #t #t #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg2);
+    void* C_arg2 = IDIO_C_TYPE_POINTER_P (arg2);
+
+   /*
+    * Test Case: libc-errors/pread-bad-arg3-type.idio
+    *
+    * pread #t #t #t #t
+    */
+    IDIO_USER_libc_TYPE_ASSERT (size_t, arg3);
+    size_t C_arg3 = IDIO_C_TYPE_libc_size_t (arg3);
+
+   /*
+    * Test Case: libc-errors/pread-bad-arg4-type.idio
+    *
+    * pread #t #t #t #t
+    */
+    IDIO_USER_libc_TYPE_ASSERT (__off_t, arg4);
+    __off_t C_arg4 = IDIO_C_TYPE_libc___off_t (arg4);
+
+    ssize_t pread_r = pread (C_arg1, C_arg2, C_arg3, C_arg4);
+
+    /* check for errors */
+    if (-1 == pread_r) {
+        idio_error_system_errno ("pread", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_libc_ssize_t (pread_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("ptsname", libc_ptsname, (IDIO arg1), "arg1", "\
+in C: :samp:`ptsname ({arg1})`		\n\
+a wrapper to libc :manpage:`ptsname()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/int			\n\
+:return:				\n\
+:rtype: C/pointer	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+
+   /*
+    * Test Case: libc-errors/ptsname-bad-arg1-type.idio
+    *
+    * ptsname #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (int, arg1);
+    int C_arg1 = IDIO_C_TYPE_int (arg1);
+
+    char* ptsname_r = ptsname (C_arg1);
+
+    /* check for errors */
+    if (-1 == ptsname_r) {
+        idio_error_system_errno ("ptsname", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_pointer_free_me (ptsname_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE4_DS ("pwrite", libc_pwrite, (IDIO arg1, IDIO arg2, IDIO arg3, IDIO arg4), "arg1 arg2 arg3 arg4", "\
+in C: :samp:`pwrite ({arg1}, {arg2}, {arg3}, {arg4})`		\n\
+a wrapper to libc :manpage:`pwrite()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/int			\n\
+:param arg2: 				\n\
+:type arg2: C/pointer			\n\
+:param arg3: 				\n\
+:type arg3: libc/size_t			\n\
+:param arg4: 				\n\
+:type arg4: libc/__off_t			\n\
+:return:				\n\
+:rtype: libc/ssize_t	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+    IDIO_ASSERT (arg2);
+    IDIO_ASSERT (arg3);
+    IDIO_ASSERT (arg4);
+
+   /*
+    * Test Case: libc-errors/pwrite-bad-arg1-type.idio
+    *
+    * pwrite #t #t #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (int, arg1);
+    int C_arg1 = IDIO_C_TYPE_int (arg1);
+
+   /*
+    * Test Case: libc-errors/pwrite-bad-arg2-type.idio
+    *
+    * pwrite #t #t #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg2);
+    void* C_arg2 = IDIO_C_TYPE_POINTER_P (arg2);
+
+   /*
+    * Test Case: libc-errors/pwrite-bad-arg3-type.idio
+    *
+    * pwrite #t #t #t #t
+    */
+    IDIO_USER_libc_TYPE_ASSERT (size_t, arg3);
+    size_t C_arg3 = IDIO_C_TYPE_libc_size_t (arg3);
+
+   /*
+    * Test Case: libc-errors/pwrite-bad-arg4-type.idio
+    *
+    * pwrite #t #t #t #t
+    */
+    IDIO_USER_libc_TYPE_ASSERT (__off_t, arg4);
+    __off_t C_arg4 = IDIO_C_TYPE_libc___off_t (arg4);
+
+    ssize_t pwrite_r = pwrite (C_arg1, C_arg2, C_arg3, C_arg4);
+
+    /* check for errors */
+    if (-1 == pwrite_r) {
+        idio_error_system_errno ("pwrite", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_libc_ssize_t (pwrite_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE3_DS ("read", libc_read, (IDIO arg1, IDIO arg2, IDIO arg3), "arg1 arg2 arg3", "\
+in C: :samp:`read ({arg1}, {arg2}, {arg3})`		\n\
+a wrapper to libc :manpage:`read()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/int			\n\
+:param arg2: 				\n\
+:type arg2: C/pointer			\n\
+:param arg3: 				\n\
+:type arg3: libc/size_t			\n\
+:return:				\n\
+:rtype: libc/ssize_t	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+    IDIO_ASSERT (arg2);
+    IDIO_ASSERT (arg3);
+
+   /*
+    * Test Case: libc-errors/read-bad-arg1-type.idio
+    *
+    * read #t #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (int, arg1);
+    int C_arg1 = IDIO_C_TYPE_int (arg1);
+
+   /*
+    * Test Case: libc-errors/read-bad-arg2-type.idio
+    *
+    * read #t #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg2);
+    void* C_arg2 = IDIO_C_TYPE_POINTER_P (arg2);
+
+   /*
+    * Test Case: libc-errors/read-bad-arg3-type.idio
+    *
+    * read #t #t #t
+    */
+    IDIO_USER_libc_TYPE_ASSERT (size_t, arg3);
+    size_t C_arg3 = IDIO_C_TYPE_libc_size_t (arg3);
+
+    ssize_t read_r = read (C_arg1, C_arg2, C_arg3);
+
+    /* check for errors */
+    if (-1 == read_r) {
+        idio_error_system_errno ("read", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_libc_ssize_t (read_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE3_DS ("readlink", libc_readlink, (IDIO arg1, IDIO arg2, IDIO arg3), "arg1 arg2 arg3", "\
+in C: :samp:`readlink ({arg1}, {arg2}, {arg3})`		\n\
+a wrapper to libc :manpage:`readlink()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/pointer			\n\
+:param arg2: 				\n\
+:type arg2: C/pointer			\n\
+:param arg3: 				\n\
+:type arg3: libc/size_t			\n\
+:return:				\n\
+:rtype: libc/ssize_t	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+    IDIO_ASSERT (arg2);
+    IDIO_ASSERT (arg3);
+
+   /*
+    * Test Case: libc-errors/readlink-bad-arg1-type.idio
+    *
+    * readlink #t #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg1);
+    char* C_arg1 = IDIO_C_TYPE_POINTER_P (arg1);
+
+   /*
+    * Test Case: libc-errors/readlink-bad-arg2-type.idio
+    *
+    * readlink #t #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg2);
+    char* C_arg2 = IDIO_C_TYPE_POINTER_P (arg2);
+
+   /*
+    * Test Case: libc-errors/readlink-bad-arg3-type.idio
+    *
+    * readlink #t #t #t
+    */
+    IDIO_USER_libc_TYPE_ASSERT (size_t, arg3);
+    size_t C_arg3 = IDIO_C_TYPE_libc_size_t (arg3);
+
+    ssize_t readlink_r = readlink (C_arg1, C_arg2, C_arg3);
+
+    /* check for errors */
+    if (-1 == readlink_r) {
+        idio_error_system_errno ("readlink", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_libc_ssize_t (readlink_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE4_DS ("readlinkat", libc_readlinkat, (IDIO arg1, IDIO arg2, IDIO arg3, IDIO arg4), "arg1 arg2 arg3 arg4", "\
+in C: :samp:`readlinkat ({arg1}, {arg2}, {arg3}, {arg4})`		\n\
+a wrapper to libc :manpage:`readlinkat()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/int			\n\
+:param arg2: 				\n\
+:type arg2: C/pointer			\n\
+:param arg3: 				\n\
+:type arg3: C/pointer			\n\
+:param arg4: 				\n\
+:type arg4: libc/size_t			\n\
+:return:				\n\
+:rtype: libc/ssize_t	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+    IDIO_ASSERT (arg2);
+    IDIO_ASSERT (arg3);
+    IDIO_ASSERT (arg4);
+
+   /*
+    * Test Case: libc-errors/readlinkat-bad-arg1-type.idio
+    *
+    * readlinkat #t #t #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (int, arg1);
+    int C_arg1 = IDIO_C_TYPE_int (arg1);
+
+   /*
+    * Test Case: libc-errors/readlinkat-bad-arg2-type.idio
+    *
+    * readlinkat #t #t #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg2);
+    char* C_arg2 = IDIO_C_TYPE_POINTER_P (arg2);
+
+   /*
+    * Test Case: libc-errors/readlinkat-bad-arg3-type.idio
+    *
+    * readlinkat #t #t #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg3);
+    char* C_arg3 = IDIO_C_TYPE_POINTER_P (arg3);
+
+   /*
+    * Test Case: libc-errors/readlinkat-bad-arg4-type.idio
+    *
+    * readlinkat #t #t #t #t
+    */
+    IDIO_USER_libc_TYPE_ASSERT (size_t, arg4);
+    size_t C_arg4 = IDIO_C_TYPE_libc_size_t (arg4);
+
+    ssize_t readlinkat_r = readlinkat (C_arg1, C_arg2, C_arg3, C_arg4);
+
+    /* check for errors */
+    if (-1 == readlinkat_r) {
+        idio_error_system_errno ("readlinkat", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_libc_ssize_t (readlinkat_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE2_DS ("rename", libc_rename, (IDIO arg1, IDIO arg2), "arg1 arg2", "\
+in C: :samp:`rename ({arg1}, {arg2})`		\n\
+a wrapper to libc :manpage:`rename()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/pointer			\n\
+:param arg2: 				\n\
+:type arg2: C/pointer			\n\
+:return:				\n\
+:rtype: C/int	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+    IDIO_ASSERT (arg2);
+
+   /*
+    * Test Case: libc-errors/rename-bad-arg1-type.idio
+    *
+    * rename #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg1);
+    char* C_arg1 = IDIO_C_TYPE_POINTER_P (arg1);
+
+   /*
+    * Test Case: libc-errors/rename-bad-arg2-type.idio
+    *
+    * rename #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg2);
+    char* C_arg2 = IDIO_C_TYPE_POINTER_P (arg2);
+
+    int rename_r = rename (C_arg1, C_arg2);
+
+    /* check for errors */
+    if (-1 == rename_r) {
+        idio_error_system_errno ("rename", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_int (rename_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE4_DS ("renameat", libc_renameat, (IDIO arg1, IDIO arg2, IDIO arg3, IDIO arg4), "arg1 arg2 arg3 arg4", "\
+in C: :samp:`renameat ({arg1}, {arg2}, {arg3}, {arg4})`		\n\
+a wrapper to libc :manpage:`renameat()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/int			\n\
+:param arg2: 				\n\
+:type arg2: C/pointer			\n\
+:param arg3: 				\n\
+:type arg3: C/int			\n\
+:param arg4: 				\n\
+:type arg4: C/pointer			\n\
+:return:				\n\
+:rtype: C/int	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+    IDIO_ASSERT (arg2);
+    IDIO_ASSERT (arg3);
+    IDIO_ASSERT (arg4);
+
+   /*
+    * Test Case: libc-errors/renameat-bad-arg1-type.idio
+    *
+    * renameat #t #t #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (int, arg1);
+    int C_arg1 = IDIO_C_TYPE_int (arg1);
+
+   /*
+    * Test Case: libc-errors/renameat-bad-arg2-type.idio
+    *
+    * renameat #t #t #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg2);
+    char* C_arg2 = IDIO_C_TYPE_POINTER_P (arg2);
+
+   /*
+    * Test Case: libc-errors/renameat-bad-arg3-type.idio
+    *
+    * renameat #t #t #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (int, arg3);
+    int C_arg3 = IDIO_C_TYPE_int (arg3);
+
+   /*
+    * Test Case: libc-errors/renameat-bad-arg4-type.idio
+    *
+    * renameat #t #t #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg4);
+    char* C_arg4 = IDIO_C_TYPE_POINTER_P (arg4);
+
+    int renameat_r = renameat (C_arg1, C_arg2, C_arg3, C_arg4);
+
+    /* check for errors */
+    if (-1 == renameat_r) {
+        idio_error_system_errno ("renameat", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_int (renameat_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("rmdir", libc_rmdir, (IDIO arg1), "arg1", "\
+in C: :samp:`rmdir ({arg1})`		\n\
+a wrapper to libc :manpage:`rmdir()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/pointer			\n\
+:return:				\n\
+:rtype: C/int	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+
+   /*
+    * Test Case: libc-errors/rmdir-bad-arg1-type.idio
+    *
+    * rmdir #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg1);
+    char* C_arg1 = IDIO_C_TYPE_POINTER_P (arg1);
+
+    int rmdir_r = rmdir (C_arg1);
+
+    /* check for errors */
+    if (-1 == rmdir_r) {
+        idio_error_system_errno ("rmdir", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_int (rmdir_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("setegid", libc_setegid, (IDIO arg1), "arg1", "\
+in C: :samp:`setegid ({arg1})`		\n\
+a wrapper to libc :manpage:`setegid()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: libc/__gid_t			\n\
+:return:				\n\
+:rtype: C/int	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+
+   /*
+    * Test Case: libc-errors/setegid-bad-arg1-type.idio
+    *
+    * setegid #t
+    */
+    IDIO_USER_libc_TYPE_ASSERT (__gid_t, arg1);
+    __gid_t C_arg1 = IDIO_C_TYPE_libc___gid_t (arg1);
+
+    int setegid_r = setegid (C_arg1);
+
+    /* check for errors */
+    if (-1 == setegid_r) {
+        idio_error_system_errno ("setegid", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_int (setegid_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("seteuid", libc_seteuid, (IDIO arg1), "arg1", "\
+in C: :samp:`seteuid ({arg1})`		\n\
+a wrapper to libc :manpage:`seteuid()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: libc/__uid_t			\n\
+:return:				\n\
+:rtype: C/int	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+
+   /*
+    * Test Case: libc-errors/seteuid-bad-arg1-type.idio
+    *
+    * seteuid #t
+    */
+    IDIO_USER_libc_TYPE_ASSERT (__uid_t, arg1);
+    __uid_t C_arg1 = IDIO_C_TYPE_libc___uid_t (arg1);
+
+    int seteuid_r = seteuid (C_arg1);
+
+    /* check for errors */
+    if (-1 == seteuid_r) {
+        idio_error_system_errno ("seteuid", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_int (seteuid_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("setgid", libc_setgid, (IDIO arg1), "arg1", "\
+in C: :samp:`setgid ({arg1})`		\n\
+a wrapper to libc :manpage:`setgid()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: libc/__gid_t			\n\
+:return:				\n\
+:rtype: C/int	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+
+   /*
+    * Test Case: libc-errors/setgid-bad-arg1-type.idio
+    *
+    * setgid #t
+    */
+    IDIO_USER_libc_TYPE_ASSERT (__gid_t, arg1);
+    __gid_t C_arg1 = IDIO_C_TYPE_libc___gid_t (arg1);
+
+    int setgid_r = setgid (C_arg1);
+
+    /* check for errors */
+    if (-1 == setgid_r) {
+        idio_error_system_errno ("setgid", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_int (setgid_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE2_DS ("setpgid", libc_setpgid, (IDIO arg1, IDIO arg2), "arg1 arg2", "\
+in C: :samp:`setpgid ({arg1}, {arg2})`		\n\
+a wrapper to libc :manpage:`setpgid()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: libc/__pid_t			\n\
+:param arg2: 				\n\
+:type arg2: libc/__pid_t			\n\
+:return:				\n\
+:rtype: C/int	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+    IDIO_ASSERT (arg2);
+
+   /*
+    * Test Case: libc-errors/setpgid-bad-arg1-type.idio
+    *
+    * setpgid #t #t
+    */
+    IDIO_USER_libc_TYPE_ASSERT (__pid_t, arg1);
+    __pid_t C_arg1 = IDIO_C_TYPE_libc___pid_t (arg1);
+
+   /*
+    * Test Case: libc-errors/setpgid-bad-arg2-type.idio
+    *
+    * setpgid #t #t
+    */
+    IDIO_USER_libc_TYPE_ASSERT (__pid_t, arg2);
+    __pid_t C_arg2 = IDIO_C_TYPE_libc___pid_t (arg2);
+
+    int setpgid_r = setpgid (C_arg1, C_arg2);
+
+    /* check for errors */
+    if (-1 == setpgid_r) {
+        idio_error_system_errno ("setpgid", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_int (setpgid_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE3_DS ("setpriority", libc_setpriority, (IDIO arg1, IDIO arg2, IDIO arg3), "arg1 arg2 arg3", "\
+in C: :samp:`setpriority ({arg1}, {arg2}, {arg3})`		\n\
+a wrapper to libc :manpage:`setpriority()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: libc/__priority_which_t			\n\
+:param arg2: 				\n\
+:type arg2: libc/id_t			\n\
+:param arg3: 				\n\
+:type arg3: C/int			\n\
+:return:				\n\
+:rtype: C/int	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+    IDIO_ASSERT (arg2);
+    IDIO_ASSERT (arg3);
+
+   /*
+    * Test Case: libc-errors/setpriority-bad-arg1-type.idio
+    *
+    * setpriority #t #t #t
+    */
+    IDIO_USER_libc_TYPE_ASSERT (__priority_which_t, arg1);
+    __priority_which_t C_arg1 = IDIO_C_TYPE_libc___priority_which_t (arg1);
+
+   /*
+    * Test Case: libc-errors/setpriority-bad-arg2-type.idio
+    *
+    * setpriority #t #t #t
+    */
+    IDIO_USER_libc_TYPE_ASSERT (id_t, arg2);
+    id_t C_arg2 = IDIO_C_TYPE_libc_id_t (arg2);
+
+   /*
+    * Test Case: libc-errors/setpriority-bad-arg3-type.idio
+    *
+    * setpriority #t #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (int, arg3);
+    int C_arg3 = IDIO_C_TYPE_int (arg3);
+
+    int setpriority_r = setpriority (C_arg1, C_arg2, C_arg3);
+
+    /* check for errors */
+    if (-1 == setpriority_r) {
+        idio_error_system_errno ("setpriority", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_int (setpriority_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE2_DS ("setregid", libc_setregid, (IDIO arg1, IDIO arg2), "arg1 arg2", "\
+in C: :samp:`setregid ({arg1}, {arg2})`		\n\
+a wrapper to libc :manpage:`setregid()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: libc/__gid_t			\n\
+:param arg2: 				\n\
+:type arg2: libc/__gid_t			\n\
+:return:				\n\
+:rtype: C/int	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+    IDIO_ASSERT (arg2);
+
+   /*
+    * Test Case: libc-errors/setregid-bad-arg1-type.idio
+    *
+    * setregid #t #t
+    */
+    IDIO_USER_libc_TYPE_ASSERT (__gid_t, arg1);
+    __gid_t C_arg1 = IDIO_C_TYPE_libc___gid_t (arg1);
+
+   /*
+    * Test Case: libc-errors/setregid-bad-arg2-type.idio
+    *
+    * setregid #t #t
+    */
+    IDIO_USER_libc_TYPE_ASSERT (__gid_t, arg2);
+    __gid_t C_arg2 = IDIO_C_TYPE_libc___gid_t (arg2);
+
+    int setregid_r = setregid (C_arg1, C_arg2);
+
+    /* check for errors */
+    if (-1 == setregid_r) {
+        idio_error_system_errno ("setregid", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_int (setregid_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE3_DS ("setresgid", libc_setresgid, (IDIO arg1, IDIO arg2, IDIO arg3), "arg1 arg2 arg3", "\
+in C: :samp:`setresgid ({arg1}, {arg2}, {arg3})`		\n\
+a wrapper to libc :manpage:`setresgid()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: libc/__gid_t			\n\
+:param arg2: 				\n\
+:type arg2: libc/__gid_t			\n\
+:param arg3: 				\n\
+:type arg3: libc/__gid_t			\n\
+:return:				\n\
+:rtype: C/int	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+    IDIO_ASSERT (arg2);
+    IDIO_ASSERT (arg3);
+
+   /*
+    * Test Case: libc-errors/setresgid-bad-arg1-type.idio
+    *
+    * setresgid #t #t #t
+    */
+    IDIO_USER_libc_TYPE_ASSERT (__gid_t, arg1);
+    __gid_t C_arg1 = IDIO_C_TYPE_libc___gid_t (arg1);
+
+   /*
+    * Test Case: libc-errors/setresgid-bad-arg2-type.idio
+    *
+    * setresgid #t #t #t
+    */
+    IDIO_USER_libc_TYPE_ASSERT (__gid_t, arg2);
+    __gid_t C_arg2 = IDIO_C_TYPE_libc___gid_t (arg2);
+
+   /*
+    * Test Case: libc-errors/setresgid-bad-arg3-type.idio
+    *
+    * setresgid #t #t #t
+    */
+    IDIO_USER_libc_TYPE_ASSERT (__gid_t, arg3);
+    __gid_t C_arg3 = IDIO_C_TYPE_libc___gid_t (arg3);
+
+    int setresgid_r = setresgid (C_arg1, C_arg2, C_arg3);
+
+    /* check for errors */
+    if (-1 == setresgid_r) {
+        idio_error_system_errno ("setresgid", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_int (setresgid_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE3_DS ("setresuid", libc_setresuid, (IDIO arg1, IDIO arg2, IDIO arg3), "arg1 arg2 arg3", "\
+in C: :samp:`setresuid ({arg1}, {arg2}, {arg3})`		\n\
+a wrapper to libc :manpage:`setresuid()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: libc/__uid_t			\n\
+:param arg2: 				\n\
+:type arg2: libc/__uid_t			\n\
+:param arg3: 				\n\
+:type arg3: libc/__uid_t			\n\
+:return:				\n\
+:rtype: C/int	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+    IDIO_ASSERT (arg2);
+    IDIO_ASSERT (arg3);
+
+   /*
+    * Test Case: libc-errors/setresuid-bad-arg1-type.idio
+    *
+    * setresuid #t #t #t
+    */
+    IDIO_USER_libc_TYPE_ASSERT (__uid_t, arg1);
+    __uid_t C_arg1 = IDIO_C_TYPE_libc___uid_t (arg1);
+
+   /*
+    * Test Case: libc-errors/setresuid-bad-arg2-type.idio
+    *
+    * setresuid #t #t #t
+    */
+    IDIO_USER_libc_TYPE_ASSERT (__uid_t, arg2);
+    __uid_t C_arg2 = IDIO_C_TYPE_libc___uid_t (arg2);
+
+   /*
+    * Test Case: libc-errors/setresuid-bad-arg3-type.idio
+    *
+    * setresuid #t #t #t
+    */
+    IDIO_USER_libc_TYPE_ASSERT (__uid_t, arg3);
+    __uid_t C_arg3 = IDIO_C_TYPE_libc___uid_t (arg3);
+
+    int setresuid_r = setresuid (C_arg1, C_arg2, C_arg3);
+
+    /* check for errors */
+    if (-1 == setresuid_r) {
+        idio_error_system_errno ("setresuid", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_int (setresuid_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE2_DS ("setreuid", libc_setreuid, (IDIO arg1, IDIO arg2), "arg1 arg2", "\
+in C: :samp:`setreuid ({arg1}, {arg2})`		\n\
+a wrapper to libc :manpage:`setreuid()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: libc/__uid_t			\n\
+:param arg2: 				\n\
+:type arg2: libc/__uid_t			\n\
+:return:				\n\
+:rtype: C/int	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+    IDIO_ASSERT (arg2);
+
+   /*
+    * Test Case: libc-errors/setreuid-bad-arg1-type.idio
+    *
+    * setreuid #t #t
+    */
+    IDIO_USER_libc_TYPE_ASSERT (__uid_t, arg1);
+    __uid_t C_arg1 = IDIO_C_TYPE_libc___uid_t (arg1);
+
+   /*
+    * Test Case: libc-errors/setreuid-bad-arg2-type.idio
+    *
+    * setreuid #t #t
+    */
+    IDIO_USER_libc_TYPE_ASSERT (__uid_t, arg2);
+    __uid_t C_arg2 = IDIO_C_TYPE_libc___uid_t (arg2);
+
+    int setreuid_r = setreuid (C_arg1, C_arg2);
+
+    /* check for errors */
+    if (-1 == setreuid_r) {
+        idio_error_system_errno ("setreuid", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_int (setreuid_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE2_DS ("setrlimit", libc_setrlimit, (IDIO arg1, IDIO arg2), "arg1 arg2", "\
+in C: :samp:`setrlimit ({arg1}, {arg2})`		\n\
+a wrapper to libc :manpage:`setrlimit()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: libc/__rlimit_resource_t			\n\
+:param arg2: 				\n\
+:type arg2: C/pointer			\n\
+:return:				\n\
+:rtype: C/int	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+    IDIO_ASSERT (arg2);
+
+   /*
+    * Test Case: libc-errors/setrlimit-bad-arg1-type.idio
+    *
+    * setrlimit #t #t
+    */
+    IDIO_USER_libc_TYPE_ASSERT (__rlimit_resource_t, arg1);
+    __rlimit_resource_t C_arg1 = IDIO_C_TYPE_libc___rlimit_resource_t (arg1);
+
+   /*
+    * Test Case: libc-errors/setrlimit-bad-arg2-type.idio
+    *
+    * setrlimit #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg2);
+    struct rlimit* C_arg2 = IDIO_C_TYPE_POINTER_P (arg2);
+
+    int setrlimit_r = setrlimit (C_arg1, C_arg2);
+
+    /* check for errors */
+    if (-1 == setrlimit_r) {
+        idio_error_system_errno ("setrlimit", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_int (setrlimit_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE0_DS ("setsid", libc_setsid, (), "", "\
+in C: :samp:`setsid ()`		\n\
+a wrapper to libc :manpage:`setsid()`	\n\
+					\n\
+:return:				\n\
+:rtype: libc/__pid_t	\n\
+")
+{
+
+    __pid_t setsid_r = setsid ();
+
+    /* check for errors */
+    if (-1 == setsid_r) {
+        idio_error_system_errno ("setsid", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_libc___pid_t (setsid_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("setuid", libc_setuid, (IDIO arg1), "arg1", "\
+in C: :samp:`setuid ({arg1})`		\n\
+a wrapper to libc :manpage:`setuid()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: libc/__uid_t			\n\
+:return:				\n\
+:rtype: C/int	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+
+   /*
+    * Test Case: libc-errors/setuid-bad-arg1-type.idio
+    *
+    * setuid #t
+    */
+    IDIO_USER_libc_TYPE_ASSERT (__uid_t, arg1);
+    __uid_t C_arg1 = IDIO_C_TYPE_libc___uid_t (arg1);
+
+    int setuid_r = setuid (C_arg1);
+
+    /* check for errors */
+    if (-1 == setuid_r) {
+        idio_error_system_errno ("setuid", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_int (setuid_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE3_DS ("sigaction", libc_sigaction, (IDIO arg1, IDIO arg2, IDIO arg3), "arg1 arg2 arg3", "\
+in C: :samp:`sigaction ({arg1}, {arg2}, {arg3})`		\n\
+a wrapper to libc :manpage:`sigaction()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/int			\n\
+:param arg2: 				\n\
+:type arg2: C/pointer			\n\
+:param arg3: 				\n\
+:type arg3: C/pointer			\n\
+:return:				\n\
+:rtype: C/int	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+    IDIO_ASSERT (arg2);
+    IDIO_ASSERT (arg3);
+
+   /*
+    * Test Case: libc-errors/sigaction-bad-arg1-type.idio
+    *
+    * sigaction #t #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (int, arg1);
+    int C_arg1 = IDIO_C_TYPE_int (arg1);
+
+   /*
+    * Test Case: libc-errors/sigaction-bad-arg2-type.idio
+    *
+    * sigaction #t #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg2);
+    struct sigaction* C_arg2 = IDIO_C_TYPE_POINTER_P (arg2);
+
+   /*
+    * Test Case: libc-errors/sigaction-bad-arg3-type.idio
+    *
+    * sigaction #t #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg3);
+    struct sigaction* C_arg3 = IDIO_C_TYPE_POINTER_P (arg3);
+
+    int sigaction_r = sigaction (C_arg1, C_arg2, C_arg3);
+
+    /* check for errors */
+    if (-1 == sigaction_r) {
+        idio_error_system_errno ("sigaction", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_int (sigaction_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE2_DS ("signal", libc_signal, (IDIO arg1, IDIO arg2), "arg1 arg2", "\
+in C: :samp:`signal ({arg1}, {arg2})`		\n\
+a wrapper to libc :manpage:`signal()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/int			\n\
+:param arg2: 				\n\
+:type arg2: libc/__sighandler_t			\n\
+:return:				\n\
+:rtype: libc/__sighandler_t	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+    IDIO_ASSERT (arg2);
+
+   /*
+    * Test Case: libc-errors/signal-bad-arg1-type.idio
+    *
+    * signal #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (int, arg1);
+    int C_arg1 = IDIO_C_TYPE_int (arg1);
+
+   /*
+    * Test Case: libc-errors/signal-bad-arg2-type.idio
+    *
+    * signal #t #t
+    */
+    IDIO_USER_libc_TYPE_ASSERT (__sighandler_t, arg2);
+    __sighandler_t C_arg2 = IDIO_C_TYPE_libc___sighandler_t (arg2);
+
+    __sighandler_t signal_r = signal (C_arg1, C_arg2);
+
+    /* check for errors */
+    if (-1 == signal_r) {
+        idio_error_system_errno ("signal", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_libc___sighandler_t (signal_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("sleep", libc_sleep, (IDIO arg1), "arg1", "\
+in C: :samp:`sleep ({arg1})`		\n\
+a wrapper to libc :manpage:`sleep()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/uint			\n\
+:return:				\n\
+:rtype: C/uint	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+
+   /*
+    * Test Case: libc-errors/sleep-bad-arg1-type.idio
+    *
+    * sleep #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (uint, arg1);
+    unsigned int C_arg1 = IDIO_C_TYPE_uint (arg1);
+
+    unsigned int sleep_r = sleep (C_arg1);
+
+    /* check for errors */
+    if (-1 == sleep_r) {
+        idio_error_system_errno ("sleep", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_uint (sleep_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE2_DS ("stat", libc_stat, (IDIO arg1, IDIO arg2), "arg1 arg2", "\
+in C: :samp:`stat ({arg1}, {arg2})`		\n\
+a wrapper to libc :manpage:`stat()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/pointer			\n\
+:param arg2: 				\n\
+:type arg2: C/pointer			\n\
+:return:				\n\
+:rtype: C/int	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+    IDIO_ASSERT (arg2);
+
+   /*
+    * Test Case: libc-errors/stat-bad-arg1-type.idio
+    *
+    * stat #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg1);
+    char* C_arg1 = IDIO_C_TYPE_POINTER_P (arg1);
+
+   /*
+    * Test Case: libc-errors/stat-bad-arg2-type.idio
+    *
+    * stat #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg2);
+    struct stat* C_arg2 = IDIO_C_TYPE_POINTER_P (arg2);
+
+    int stat_r = stat (C_arg1, C_arg2);
+
+    /* check for errors */
+    if (-1 == stat_r) {
+        idio_error_system_errno ("stat", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_int (stat_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE2_DS ("statvfs", libc_statvfs, (IDIO arg1, IDIO arg2), "arg1 arg2", "\
+in C: :samp:`statvfs ({arg1}, {arg2})`		\n\
+a wrapper to libc :manpage:`statvfs()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/pointer			\n\
+:param arg2: 				\n\
+:type arg2: C/pointer			\n\
+:return:				\n\
+:rtype: C/int	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+    IDIO_ASSERT (arg2);
+
+   /*
+    * Test Case: libc-errors/statvfs-bad-arg1-type.idio
+    *
+    * statvfs #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg1);
+    char* C_arg1 = IDIO_C_TYPE_POINTER_P (arg1);
+
+   /*
+    * Test Case: libc-errors/statvfs-bad-arg2-type.idio
+    *
+    * statvfs #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg2);
+    struct statvfs* C_arg2 = IDIO_C_TYPE_POINTER_P (arg2);
+
+    int statvfs_r = statvfs (C_arg1, C_arg2);
+
+    /* check for errors */
+    if (-1 == statvfs_r) {
+        idio_error_system_errno ("statvfs", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_int (statvfs_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("strerror", libc_strerror, (IDIO arg1), "arg1", "\
+in C: :samp:`strerror ({arg1})`		\n\
+a wrapper to libc :manpage:`strerror()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/int			\n\
+:return:				\n\
+:rtype: C/pointer	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+
+   /*
+    * Test Case: libc-errors/strerror-bad-arg1-type.idio
+    *
+    * strerror #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (int, arg1);
+    int C_arg1 = IDIO_C_TYPE_int (arg1);
+
+    char* strerror_r = strerror (C_arg1);
+
+    /* check for errors */
+    if (-1 == strerror_r) {
+        idio_error_system_errno ("strerror", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_pointer_free_me (strerror_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE4_DS ("strftime", libc_strftime, (IDIO arg1, IDIO arg2, IDIO arg3, IDIO arg4), "arg1 arg2 arg3 arg4", "\
+in C: :samp:`strftime ({arg1}, {arg2}, {arg3}, {arg4})`		\n\
+a wrapper to libc :manpage:`strftime()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/pointer			\n\
+:param arg2: 				\n\
+:type arg2: libc/size_t			\n\
+:param arg3: 				\n\
+:type arg3: C/pointer			\n\
+:param arg4: 				\n\
+:type arg4: C/pointer			\n\
+:return:				\n\
+:rtype: libc/size_t	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+    IDIO_ASSERT (arg2);
+    IDIO_ASSERT (arg3);
+    IDIO_ASSERT (arg4);
+
+   /*
+    * Test Case: libc-errors/strftime-bad-arg1-type.idio
+    *
+    * strftime #t #t #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg1);
+    char* C_arg1 = IDIO_C_TYPE_POINTER_P (arg1);
+
+   /*
+    * Test Case: libc-errors/strftime-bad-arg2-type.idio
+    *
+    * strftime #t #t #t #t
+    */
+    IDIO_USER_libc_TYPE_ASSERT (size_t, arg2);
+    size_t C_arg2 = IDIO_C_TYPE_libc_size_t (arg2);
+
+   /*
+    * Test Case: libc-errors/strftime-bad-arg3-type.idio
+    *
+    * strftime #t #t #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg3);
+    char* C_arg3 = IDIO_C_TYPE_POINTER_P (arg3);
+
+   /*
+    * Test Case: libc-errors/strftime-bad-arg4-type.idio
+    *
+    * strftime #t #t #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg4);
+    struct tm* C_arg4 = IDIO_C_TYPE_POINTER_P (arg4);
+
+    size_t strftime_r = strftime (C_arg1, C_arg2, C_arg3, C_arg4);
+
+    /* check for errors */
+    if (-1 == strftime_r) {
+        idio_error_system_errno ("strftime", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_libc_size_t (strftime_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE3_DS ("strptime", libc_strptime, (IDIO arg1, IDIO arg2, IDIO arg3), "arg1 arg2 arg3", "\
+in C: :samp:`strptime ({arg1}, {arg2}, {arg3})`		\n\
+a wrapper to libc :manpage:`strptime()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/pointer			\n\
+:param arg2: 				\n\
+:type arg2: C/pointer			\n\
+:param arg3: 				\n\
+:type arg3: C/pointer			\n\
+:return:				\n\
+:rtype: C/pointer	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+    IDIO_ASSERT (arg2);
+    IDIO_ASSERT (arg3);
+
+   /*
+    * Test Case: libc-errors/strptime-bad-arg1-type.idio
+    *
+    * strptime #t #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg1);
+    char* C_arg1 = IDIO_C_TYPE_POINTER_P (arg1);
+
+   /*
+    * Test Case: libc-errors/strptime-bad-arg2-type.idio
+    *
+    * strptime #t #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg2);
+    char* C_arg2 = IDIO_C_TYPE_POINTER_P (arg2);
+
+   /*
+    * Test Case: libc-errors/strptime-bad-arg3-type.idio
+    *
+    * strptime #t #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg3);
+    struct tm* C_arg3 = IDIO_C_TYPE_POINTER_P (arg3);
+
+    char* strptime_r = strptime (C_arg1, C_arg2, C_arg3);
+
+    /* check for errors */
+    if (-1 == strptime_r) {
+        idio_error_system_errno ("strptime", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_pointer_free_me (strptime_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("strsignal", libc_strsignal, (IDIO arg1), "arg1", "\
+in C: :samp:`strsignal ({arg1})`		\n\
+a wrapper to libc :manpage:`strsignal()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/int			\n\
+:return:				\n\
+:rtype: C/pointer	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+
+   /*
+    * Test Case: libc-errors/strsignal-bad-arg1-type.idio
+    *
+    * strsignal #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (int, arg1);
+    int C_arg1 = IDIO_C_TYPE_int (arg1);
+
+    char* strsignal_r = strsignal (C_arg1);
+
+    /* check for errors */
+    if (-1 == strsignal_r) {
+        idio_error_system_errno ("strsignal", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_pointer_free_me (strsignal_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE2_DS ("symlink", libc_symlink, (IDIO arg1, IDIO arg2), "arg1 arg2", "\
+in C: :samp:`symlink ({arg1}, {arg2})`		\n\
+a wrapper to libc :manpage:`symlink()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/pointer			\n\
+:param arg2: 				\n\
+:type arg2: C/pointer			\n\
+:return:				\n\
+:rtype: C/int	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+    IDIO_ASSERT (arg2);
+
+   /*
+    * Test Case: libc-errors/symlink-bad-arg1-type.idio
+    *
+    * symlink #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg1);
+    char* C_arg1 = IDIO_C_TYPE_POINTER_P (arg1);
+
+   /*
+    * Test Case: libc-errors/symlink-bad-arg2-type.idio
+    *
+    * symlink #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg2);
+    char* C_arg2 = IDIO_C_TYPE_POINTER_P (arg2);
+
+    int symlink_r = symlink (C_arg1, C_arg2);
+
+    /* check for errors */
+    if (-1 == symlink_r) {
+        idio_error_system_errno ("symlink", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_int (symlink_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE3_DS ("symlinkat", libc_symlinkat, (IDIO arg1, IDIO arg2, IDIO arg3), "arg1 arg2 arg3", "\
+in C: :samp:`symlinkat ({arg1}, {arg2}, {arg3})`		\n\
+a wrapper to libc :manpage:`symlinkat()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/pointer			\n\
+:param arg2: 				\n\
+:type arg2: C/int			\n\
+:param arg3: 				\n\
+:type arg3: C/pointer			\n\
+:return:				\n\
+:rtype: C/int	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+    IDIO_ASSERT (arg2);
+    IDIO_ASSERT (arg3);
+
+   /*
+    * Test Case: libc-errors/symlinkat-bad-arg1-type.idio
+    *
+    * symlinkat #t #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg1);
+    char* C_arg1 = IDIO_C_TYPE_POINTER_P (arg1);
+
+   /*
+    * Test Case: libc-errors/symlinkat-bad-arg2-type.idio
+    *
+    * symlinkat #t #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (int, arg2);
+    int C_arg2 = IDIO_C_TYPE_int (arg2);
+
+   /*
+    * Test Case: libc-errors/symlinkat-bad-arg3-type.idio
+    *
+    * symlinkat #t #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg3);
+    char* C_arg3 = IDIO_C_TYPE_POINTER_P (arg3);
+
+    int symlinkat_r = symlinkat (C_arg1, C_arg2, C_arg3);
+
+    /* check for errors */
+    if (-1 == symlinkat_r) {
+        idio_error_system_errno ("symlinkat", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_int (symlinkat_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE0_DS ("sync", libc_sync, (), "", "\
+in C: :samp:`sync ()`		\n\
+a wrapper to libc :manpage:`sync()`	\n\
+					\n\
+:return:				\n\
+:rtype: void	\n\
+")
+{
+
+    sync ();
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_S_unspec;
+
+}
+
+IDIO_DEFINE_PRIMITIVE2_DS ("tcgetattr", libc_tcgetattr, (IDIO arg1, IDIO arg2), "arg1 arg2", "\
+in C: :samp:`tcgetattr ({arg1}, {arg2})`		\n\
+a wrapper to libc :manpage:`tcgetattr()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/int			\n\
+:param arg2: 				\n\
+:type arg2: C/pointer			\n\
+:return:				\n\
+:rtype: C/int	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+    IDIO_ASSERT (arg2);
+
+   /*
+    * Test Case: libc-errors/tcgetattr-bad-arg1-type.idio
+    *
+    * tcgetattr #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (int, arg1);
+    int C_arg1 = IDIO_C_TYPE_int (arg1);
+
+   /*
+    * Test Case: libc-errors/tcgetattr-bad-arg2-type.idio
+    *
+    * tcgetattr #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg2);
+    struct termios* C_arg2 = IDIO_C_TYPE_POINTER_P (arg2);
+
+    int tcgetattr_r = tcgetattr (C_arg1, C_arg2);
+
+    /* check for errors */
+    if (-1 == tcgetattr_r) {
+        idio_error_system_errno ("tcgetattr", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_int (tcgetattr_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("tcgetpgrp", libc_tcgetpgrp, (IDIO arg1), "arg1", "\
+in C: :samp:`tcgetpgrp ({arg1})`		\n\
+a wrapper to libc :manpage:`tcgetpgrp()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/int			\n\
+:return:				\n\
+:rtype: libc/__pid_t	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+
+   /*
+    * Test Case: libc-errors/tcgetpgrp-bad-arg1-type.idio
+    *
+    * tcgetpgrp #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (int, arg1);
+    int C_arg1 = IDIO_C_TYPE_int (arg1);
+
+    __pid_t tcgetpgrp_r = tcgetpgrp (C_arg1);
+
+    /* check for errors */
+    if (-1 == tcgetpgrp_r) {
+        idio_error_system_errno ("tcgetpgrp", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_libc___pid_t (tcgetpgrp_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE3_DS ("tcsetattr", libc_tcsetattr, (IDIO arg1, IDIO arg2, IDIO arg3), "arg1 arg2 arg3", "\
+in C: :samp:`tcsetattr ({arg1}, {arg2}, {arg3})`		\n\
+a wrapper to libc :manpage:`tcsetattr()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/int			\n\
+:param arg2: 				\n\
+:type arg2: C/int			\n\
+:param arg3: 				\n\
+:type arg3: C/pointer			\n\
+:return:				\n\
+:rtype: C/int	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+    IDIO_ASSERT (arg2);
+    IDIO_ASSERT (arg3);
+
+   /*
+    * Test Case: libc-errors/tcsetattr-bad-arg1-type.idio
+    *
+    * tcsetattr #t #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (int, arg1);
+    int C_arg1 = IDIO_C_TYPE_int (arg1);
+
+   /*
+    * Test Case: libc-errors/tcsetattr-bad-arg2-type.idio
+    *
+    * tcsetattr #t #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (int, arg2);
+    int C_arg2 = IDIO_C_TYPE_int (arg2);
+
+   /*
+    * Test Case: libc-errors/tcsetattr-bad-arg3-type.idio
+    *
+    * tcsetattr #t #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg3);
+    struct termios* C_arg3 = IDIO_C_TYPE_POINTER_P (arg3);
+
+    int tcsetattr_r = tcsetattr (C_arg1, C_arg2, C_arg3);
+
+    /* check for errors */
+    if (-1 == tcsetattr_r) {
+        idio_error_system_errno ("tcsetattr", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_int (tcsetattr_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE2_DS ("tcsetpgrp", libc_tcsetpgrp, (IDIO arg1, IDIO arg2), "arg1 arg2", "\
+in C: :samp:`tcsetpgrp ({arg1}, {arg2})`		\n\
+a wrapper to libc :manpage:`tcsetpgrp()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/int			\n\
+:param arg2: 				\n\
+:type arg2: libc/__pid_t			\n\
+:return:				\n\
+:rtype: C/int	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+    IDIO_ASSERT (arg2);
+
+   /*
+    * Test Case: libc-errors/tcsetpgrp-bad-arg1-type.idio
+    *
+    * tcsetpgrp #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (int, arg1);
+    int C_arg1 = IDIO_C_TYPE_int (arg1);
+
+   /*
+    * Test Case: libc-errors/tcsetpgrp-bad-arg2-type.idio
+    *
+    * tcsetpgrp #t #t
+    */
+    IDIO_USER_libc_TYPE_ASSERT (__pid_t, arg2);
+    __pid_t C_arg2 = IDIO_C_TYPE_libc___pid_t (arg2);
+
+    int tcsetpgrp_r = tcsetpgrp (C_arg1, C_arg2);
+
+    /* check for errors */
+    if (-1 == tcsetpgrp_r) {
+        idio_error_system_errno ("tcsetpgrp", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_int (tcsetpgrp_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("time", libc_time, (IDIO arg1), "arg1", "\
+in C: :samp:`time ({arg1})`		\n\
+a wrapper to libc :manpage:`time()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/pointer			\n\
+:return:				\n\
+:rtype: libc/time_t	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+
+   /*
+    * Test Case: libc-errors/time-bad-arg1-type.idio
+    *
+    * time #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg1);
+    time_t* C_arg1 = IDIO_C_TYPE_POINTER_P (arg1);
+
+    time_t time_r = time (C_arg1);
+
+    /* check for errors */
+    if (-1 == time_r) {
+        idio_error_system_errno ("time", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_libc_time_t (time_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("times", libc_times, (IDIO arg1), "arg1", "\
+in C: :samp:`times ({arg1})`		\n\
+a wrapper to libc :manpage:`times()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/pointer			\n\
+:return:				\n\
+:rtype: libc/clock_t	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+
+   /*
+    * Test Case: libc-errors/times-bad-arg1-type.idio
+    *
+    * times #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg1);
+    struct tms* C_arg1 = IDIO_C_TYPE_POINTER_P (arg1);
+
+    clock_t times_r = times (C_arg1);
+
+    /* check for errors */
+    if (-1 == times_r) {
+        idio_error_system_errno ("times", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_libc_clock_t (times_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE2_DS ("truncate", libc_truncate, (IDIO arg1, IDIO arg2), "arg1 arg2", "\
+in C: :samp:`truncate ({arg1}, {arg2})`		\n\
+a wrapper to libc :manpage:`truncate()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/pointer			\n\
+:param arg2: 				\n\
+:type arg2: libc/__off_t			\n\
+:return:				\n\
+:rtype: C/int	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+    IDIO_ASSERT (arg2);
+
+   /*
+    * Test Case: libc-errors/truncate-bad-arg1-type.idio
+    *
+    * truncate #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg1);
+    char* C_arg1 = IDIO_C_TYPE_POINTER_P (arg1);
+
+   /*
+    * Test Case: libc-errors/truncate-bad-arg2-type.idio
+    *
+    * truncate #t #t
+    */
+    IDIO_USER_libc_TYPE_ASSERT (__off_t, arg2);
+    __off_t C_arg2 = IDIO_C_TYPE_libc___off_t (arg2);
+
+    int truncate_r = truncate (C_arg1, C_arg2);
+
+    /* check for errors */
+    if (-1 == truncate_r) {
+        idio_error_system_errno ("truncate", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_int (truncate_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("ttyname", libc_ttyname, (IDIO arg1), "arg1", "\
+in C: :samp:`ttyname ({arg1})`		\n\
+a wrapper to libc :manpage:`ttyname()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/int			\n\
+:return:				\n\
+:rtype: C/pointer	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+
+   /*
+    * Test Case: libc-errors/ttyname-bad-arg1-type.idio
+    *
+    * ttyname #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (int, arg1);
+    int C_arg1 = IDIO_C_TYPE_int (arg1);
+
+    char* ttyname_r = ttyname (C_arg1);
+
+    /* check for errors */
+    if (-1 == ttyname_r) {
+        idio_error_system_errno ("ttyname", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_pointer_free_me (ttyname_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("umask", libc_umask, (IDIO arg1), "arg1", "\
+in C: :samp:`umask ({arg1})`		\n\
+a wrapper to libc :manpage:`umask()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: libc/__mode_t			\n\
+:return:				\n\
+:rtype: libc/__mode_t	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+
+   /*
+    * Test Case: libc-errors/umask-bad-arg1-type.idio
+    *
+    * umask #t
+    */
+    IDIO_USER_libc_TYPE_ASSERT (__mode_t, arg1);
+    __mode_t C_arg1 = IDIO_C_TYPE_libc___mode_t (arg1);
+
+    __mode_t umask_r = umask (C_arg1);
+
+    /* check for errors */
+    if (-1 == umask_r) {
+        idio_error_system_errno ("umask", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_libc___mode_t (umask_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("uname", libc_uname, (IDIO arg1), "arg1", "\
+in C: :samp:`uname ({arg1})`		\n\
+a wrapper to libc :manpage:`uname()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/pointer			\n\
+:return:				\n\
+:rtype: C/int	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+
+   /*
+    * Test Case: libc-errors/uname-bad-arg1-type.idio
+    *
+    * uname #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg1);
+    struct utsname* C_arg1 = IDIO_C_TYPE_POINTER_P (arg1);
+
+    int uname_r = uname (C_arg1);
+
+    /* check for errors */
+    if (-1 == uname_r) {
+        idio_error_system_errno ("uname", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_int (uname_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("unlink", libc_unlink, (IDIO arg1), "arg1", "\
+in C: :samp:`unlink ({arg1})`		\n\
+a wrapper to libc :manpage:`unlink()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/pointer			\n\
+:return:				\n\
+:rtype: C/int	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+
+   /*
+    * Test Case: libc-errors/unlink-bad-arg1-type.idio
+    *
+    * unlink #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg1);
+    char* C_arg1 = IDIO_C_TYPE_POINTER_P (arg1);
+
+    int unlink_r = unlink (C_arg1);
+
+    /* check for errors */
+    if (-1 == unlink_r) {
+        idio_error_system_errno ("unlink", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_int (unlink_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE3_DS ("unlinkat", libc_unlinkat, (IDIO arg1, IDIO arg2, IDIO arg3), "arg1 arg2 arg3", "\
+in C: :samp:`unlinkat ({arg1}, {arg2}, {arg3})`		\n\
+a wrapper to libc :manpage:`unlinkat()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/int			\n\
+:param arg2: 				\n\
+:type arg2: C/pointer			\n\
+:param arg3: 				\n\
+:type arg3: C/int			\n\
+:return:				\n\
+:rtype: C/int	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+    IDIO_ASSERT (arg2);
+    IDIO_ASSERT (arg3);
+
+   /*
+    * Test Case: libc-errors/unlinkat-bad-arg1-type.idio
+    *
+    * unlinkat #t #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (int, arg1);
+    int C_arg1 = IDIO_C_TYPE_int (arg1);
+
+   /*
+    * Test Case: libc-errors/unlinkat-bad-arg2-type.idio
+    *
+    * unlinkat #t #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg2);
+    char* C_arg2 = IDIO_C_TYPE_POINTER_P (arg2);
+
+   /*
+    * Test Case: libc-errors/unlinkat-bad-arg3-type.idio
+    *
+    * unlinkat #t #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (int, arg3);
+    int C_arg3 = IDIO_C_TYPE_int (arg3);
+
+    int unlinkat_r = unlinkat (C_arg1, C_arg2, C_arg3);
+
+    /* check for errors */
+    if (-1 == unlinkat_r) {
+        idio_error_system_errno ("unlinkat", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_int (unlinkat_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("unlockpt", libc_unlockpt, (IDIO arg1), "arg1", "\
+in C: :samp:`unlockpt ({arg1})`		\n\
+a wrapper to libc :manpage:`unlockpt()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/int			\n\
+:return:				\n\
+:rtype: C/int	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+
+   /*
+    * Test Case: libc-errors/unlockpt-bad-arg1-type.idio
+    *
+    * unlockpt #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (int, arg1);
+    int C_arg1 = IDIO_C_TYPE_int (arg1);
+
+    int unlockpt_r = unlockpt (C_arg1);
+
+    /* check for errors */
+    if (-1 == unlockpt_r) {
+        idio_error_system_errno ("unlockpt", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_int (unlockpt_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE2_DS ("utimes", libc_utimes, (IDIO arg1, IDIO arg2), "arg1 arg2", "\
+in C: :samp:`utimes ({arg1}, {arg2})`		\n\
+a wrapper to libc :manpage:`utimes()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/pointer			\n\
+:param arg2: 				\n\
+:type arg2: C/pointer			\n\
+:return:				\n\
+:rtype: C/int	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+    IDIO_ASSERT (arg2);
+
+   /*
+    * Test Case: libc-errors/utimes-bad-arg1-type.idio
+    *
+    * utimes #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg1);
+    char* C_arg1 = IDIO_C_TYPE_POINTER_P (arg1);
+
+   /*
+    * Test Case: libc-errors/utimes-bad-arg2-type.idio
+    *
+    * utimes #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg2);
+    struct timeval* C_arg2 = IDIO_C_TYPE_POINTER_P (arg2);
+
+    int utimes_r = utimes (C_arg1, C_arg2);
+
+    /* check for errors */
+    if (-1 == utimes_r) {
+        idio_error_system_errno ("utimes", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_C_int (utimes_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("wait", libc_wait, (IDIO arg1), "arg1", "\
+in C: :samp:`wait ({arg1})`		\n\
+a wrapper to libc :manpage:`wait()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/pointer			\n\
+:return:				\n\
+:rtype: libc/__pid_t	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+
+   /*
+    * Test Case: libc-errors/wait-bad-arg1-type.idio
+    *
+    * wait #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg1);
+    int* C_arg1 = IDIO_C_TYPE_POINTER_P (arg1);
+
+    __pid_t wait_r = wait (C_arg1);
+
+    /* check for errors */
+    if (-1 == wait_r) {
+        idio_error_system_errno ("wait", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_libc___pid_t (wait_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE3_DS ("waitpid", libc_waitpid, (IDIO arg1, IDIO arg2, IDIO arg3), "arg1 arg2 arg3", "\
+in C: :samp:`waitpid ({arg1}, {arg2}, {arg3})`		\n\
+a wrapper to libc :manpage:`waitpid()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: libc/__pid_t			\n\
+:param arg2: 				\n\
+:type arg2: C/pointer			\n\
+:param arg3: 				\n\
+:type arg3: C/int			\n\
+:return:				\n\
+:rtype: libc/__pid_t	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+    IDIO_ASSERT (arg2);
+    IDIO_ASSERT (arg3);
+
+   /*
+    * Test Case: libc-errors/waitpid-bad-arg1-type.idio
+    *
+    * waitpid #t #t #t
+    */
+    IDIO_USER_libc_TYPE_ASSERT (__pid_t, arg1);
+    __pid_t C_arg1 = IDIO_C_TYPE_libc___pid_t (arg1);
+
+   /*
+    * Test Case: libc-errors/waitpid-bad-arg2-type.idio
+    *
+    * waitpid #t #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg2);
+    int* C_arg2 = IDIO_C_TYPE_POINTER_P (arg2);
+
+   /*
+    * Test Case: libc-errors/waitpid-bad-arg3-type.idio
+    *
+    * waitpid #t #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (int, arg3);
+    int C_arg3 = IDIO_C_TYPE_int (arg3);
+
+    __pid_t waitpid_r = waitpid (C_arg1, C_arg2, C_arg3);
+
+    /* check for errors */
+    if (-1 == waitpid_r) {
+        idio_error_system_errno ("waitpid", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_libc___pid_t (waitpid_r);
+
+}
+
+IDIO_DEFINE_PRIMITIVE3_DS ("write", libc_write, (IDIO arg1, IDIO arg2, IDIO arg3), "arg1 arg2 arg3", "\
+in C: :samp:`write ({arg1}, {arg2}, {arg3})`		\n\
+a wrapper to libc :manpage:`write()`	\n\
+					\n\
+:param arg1: 				\n\
+:type arg1: C/int			\n\
+:param arg2: 				\n\
+:type arg2: C/pointer			\n\
+:param arg3: 				\n\
+:type arg3: libc/size_t			\n\
+:return:				\n\
+:rtype: libc/ssize_t	\n\
+")
+{
+    IDIO_ASSERT (arg1);
+    IDIO_ASSERT (arg2);
+    IDIO_ASSERT (arg3);
+
+   /*
+    * Test Case: libc-errors/write-bad-arg1-type.idio
+    *
+    * write #t #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (int, arg1);
+    int C_arg1 = IDIO_C_TYPE_int (arg1);
+
+   /*
+    * Test Case: libc-errors/write-bad-arg2-type.idio
+    *
+    * write #t #t #t
+    */
+    IDIO_USER_C_TYPE_ASSERT (pointer, arg2);
+    void* C_arg2 = IDIO_C_TYPE_POINTER_P (arg2);
+
+   /*
+    * Test Case: libc-errors/write-bad-arg3-type.idio
+    *
+    * write #t #t #t
+    */
+    IDIO_USER_libc_TYPE_ASSERT (size_t, arg3);
+    size_t C_arg3 = IDIO_C_TYPE_libc_size_t (arg3);
+
+    ssize_t write_r = write (C_arg1, C_arg2, C_arg3);
+
+    /* check for errors */
+    if (-1 == write_r) {
+        idio_error_system_errno ("write", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+        return idio_S_notreached;
+    }
+
+
+    /*
+     * WARNING: this is probably an incorrect return
+     */
+    return idio_libc_ssize_t (write_r);
+
+}
+
+void idio_libc_api_add_primitives ()
+{
+    IDIO struct_fields;
+
+#define IDIO_FIELD_DEF(iname,cname)		\
+    IDIO_SYMBOL_DEF(iname,cname);		\
+    struct_fields = idio_pair (idio_S_ ## cname, struct_fields);
+
+#define IDIO_ADD_STRUCT(iname,cname,mname)				\
+    {									\
+	IDIO fgvi = IDIO_EXPORT_MODULE_PRIMITIVE (idio_ ## mname ## _module, cname ## _ref); \
+	IDIO struct_name = IDIO_SYMBOLS_C_INTERN (iname);		\
+	IDIO_C_STRUCT_IDENT_DEF (struct_name, idio_list_nreverse (struct_fields), cname, fgvi); \
+	IDIO I_vt = idio_C_pointer_type_add_vtable (idio_CSI_ ## cname); \
+	IDIO printer = IDIO_EXPORT_MODULE_PRIMITIVE (idio_ ## mname ## _module, cname ## _as_string); \
+	IDIO printer_func = idio_vm_values_ref (IDIO_FIXNUM_VAL (printer)); \
+	idio_vtable_add_method (IDIO_C_TYPE_POINTER_P (I_vt),		\
+				idio_S_2string,				\
+				idio_vtable_create_method_value (idio_util_method_run, \
+								 IDIO_LIST2 (printer_func, idio_S_nil))); \
+    }
+
+    /* libc struct group is defined in /usr/include/grp.h */
+    struct_fields = idio_S_nil;
+    IDIO_FIELD_DEF ("gr_name", gr_name);
+    IDIO_FIELD_DEF ("gr_passwd", gr_passwd);
+    IDIO_FIELD_DEF ("gr_gid", gr_gid);
+    IDIO_FIELD_DEF ("gr_mem", gr_mem);
+
+    IDIO_ADD_STRUCT ("libc/struct-group", libc_struct_group, libc)
+
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_struct_group_set);
+
+    /* libc struct passwd is defined in /usr/include/pwd.h */
+    struct_fields = idio_S_nil;
+    IDIO_FIELD_DEF ("pw_name", pw_name);
+    IDIO_FIELD_DEF ("pw_passwd", pw_passwd);
+    IDIO_FIELD_DEF ("pw_uid", pw_uid);
+    IDIO_FIELD_DEF ("pw_gid", pw_gid);
+    IDIO_FIELD_DEF ("pw_gecos", pw_gecos);
+    IDIO_FIELD_DEF ("pw_dir", pw_dir);
+    IDIO_FIELD_DEF ("pw_shell", pw_shell);
+
+    IDIO_ADD_STRUCT ("libc/struct-passwd", libc_struct_passwd, libc)
+
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_struct_passwd_set);
+
+    /* libc struct pollfd is defined in /usr/include/x86_64-linux-gnu/sys/poll.h */
+    struct_fields = idio_S_nil;
+    IDIO_FIELD_DEF ("fd", fd);
+    IDIO_FIELD_DEF ("events", events);
+    IDIO_FIELD_DEF ("revents", revents);
+
+    IDIO_ADD_STRUCT ("libc/struct-pollfd", libc_struct_pollfd, libc)
+
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_struct_pollfd_set);
+
+    /* libc struct rlimit is defined in /usr/include/x86_64-linux-gnu/bits/resource.h */
+    struct_fields = idio_S_nil;
+    IDIO_FIELD_DEF ("rlim_cur", rlim_cur);
+    IDIO_FIELD_DEF ("rlim_max", rlim_max);
+
+    IDIO_ADD_STRUCT ("libc/struct-rlimit", libc_struct_rlimit, libc)
+
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_struct_rlimit_set);
+
+    /* libc struct rusage is defined in /usr/include/x86_64-linux-gnu/bits/types/struct_rusage.h */
+    struct_fields = idio_S_nil;
+    IDIO_FIELD_DEF ("ru_utime", ru_utime);
+    IDIO_FIELD_DEF ("ru_stime", ru_stime);
+
+    IDIO_ADD_STRUCT ("libc/struct-rusage", libc_struct_rusage, libc)
+
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_struct_rusage_set);
+
+    /* libc struct sigaction is defined in /usr/include/x86_64-linux-gnu/bits/sigaction.h */
+    struct_fields = idio_S_nil;
+    IDIO_FIELD_DEF ("__sigaction_handler", __sigaction_handler);
+    IDIO_FIELD_DEF ("sa_mask", sa_mask);
+    IDIO_FIELD_DEF ("sa_flags", sa_flags);
+    IDIO_FIELD_DEF ("sa_restorer", sa_restorer);
+
+    IDIO_ADD_STRUCT ("libc/struct-sigaction", libc_struct_sigaction, libc)
+
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_struct_sigaction_set);
+
+    /* libc struct stat is defined in /usr/include/x86_64-linux-gnu/bits/struct_stat.h */
+    struct_fields = idio_S_nil;
+    IDIO_FIELD_DEF ("st_dev", st_dev);
+    IDIO_FIELD_DEF ("st_ino", st_ino);
+    IDIO_FIELD_DEF ("st_nlink", st_nlink);
+    IDIO_FIELD_DEF ("st_mode", st_mode);
+    IDIO_FIELD_DEF ("st_uid", st_uid);
+    IDIO_FIELD_DEF ("st_gid", st_gid);
+    IDIO_FIELD_DEF ("__pad0", __pad0);
+    IDIO_FIELD_DEF ("st_rdev", st_rdev);
+    IDIO_FIELD_DEF ("st_size", st_size);
+    IDIO_FIELD_DEF ("st_blksize", st_blksize);
+    IDIO_FIELD_DEF ("st_blocks", st_blocks);
+    IDIO_FIELD_DEF ("st_atim", st_atim);
+    IDIO_FIELD_DEF ("st_mtim", st_mtim);
+    IDIO_FIELD_DEF ("st_ctim", st_ctim);
+    IDIO_FIELD_DEF ("__glibc_reserved", __glibc_reserved);
+
+    IDIO_ADD_STRUCT ("libc/struct-stat", libc_struct_stat, libc)
+
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_struct_stat_set);
+
+    /* libc struct statvfs is defined in /usr/include/x86_64-linux-gnu/bits/statvfs.h */
+    struct_fields = idio_S_nil;
+    IDIO_FIELD_DEF ("f_bsize", f_bsize);
+    IDIO_FIELD_DEF ("f_frsize", f_frsize);
+    IDIO_FIELD_DEF ("f_blocks", f_blocks);
+    IDIO_FIELD_DEF ("f_bfree", f_bfree);
+    IDIO_FIELD_DEF ("f_bavail", f_bavail);
+    IDIO_FIELD_DEF ("f_files", f_files);
+    IDIO_FIELD_DEF ("f_ffree", f_ffree);
+    IDIO_FIELD_DEF ("f_favail", f_favail);
+    IDIO_FIELD_DEF ("f_fsid", f_fsid);
+    IDIO_FIELD_DEF ("f_flag", f_flag);
+    IDIO_FIELD_DEF ("f_namemax", f_namemax);
+    IDIO_FIELD_DEF ("__f_spare", __f_spare);
+
+    IDIO_ADD_STRUCT ("libc/struct-statvfs", libc_struct_statvfs, libc)
+
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_struct_statvfs_set);
+
+    /* libc struct termios is defined in /usr/include/x86_64-linux-gnu/bits/termios-struct.h */
+    struct_fields = idio_S_nil;
+    IDIO_FIELD_DEF ("c_iflag", c_iflag);
+    IDIO_FIELD_DEF ("c_oflag", c_oflag);
+    IDIO_FIELD_DEF ("c_cflag", c_cflag);
+    IDIO_FIELD_DEF ("c_lflag", c_lflag);
+    IDIO_FIELD_DEF ("c_line", c_line);
+    IDIO_FIELD_DEF ("c_cc", c_cc);
+    IDIO_FIELD_DEF ("c_ispeed", c_ispeed);
+    IDIO_FIELD_DEF ("c_ospeed", c_ospeed);
+
+    IDIO_ADD_STRUCT ("libc/struct-termios", libc_struct_termios, libc)
+
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_struct_termios_set);
+
+    /* libc struct timespec is defined in /usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h */
+    struct_fields = idio_S_nil;
+    IDIO_FIELD_DEF ("tv_sec", tv_sec);
+    IDIO_FIELD_DEF ("tv_nsec", tv_nsec);
+
+    IDIO_ADD_STRUCT ("libc/struct-timespec", libc_struct_timespec, libc)
+
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_struct_timespec_set);
+
+    /* libc struct timeval is defined in /usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h */
+    struct_fields = idio_S_nil;
+    /* tv_sec already declared */
+    struct_fields = idio_pair (idio_S_tv_sec, struct_fields);
+    IDIO_FIELD_DEF ("tv_usec", tv_usec);
+
+    IDIO_ADD_STRUCT ("libc/struct-timeval", libc_struct_timeval, libc)
+
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_struct_timeval_set);
+
+    /* libc struct tm is defined in /usr/include/x86_64-linux-gnu/bits/types/struct_tm.h */
+    struct_fields = idio_S_nil;
+    IDIO_FIELD_DEF ("tm_sec", tm_sec);
+    IDIO_FIELD_DEF ("tm_min", tm_min);
+    IDIO_FIELD_DEF ("tm_hour", tm_hour);
+    IDIO_FIELD_DEF ("tm_mday", tm_mday);
+    IDIO_FIELD_DEF ("tm_mon", tm_mon);
+    IDIO_FIELD_DEF ("tm_year", tm_year);
+    IDIO_FIELD_DEF ("tm_wday", tm_wday);
+    IDIO_FIELD_DEF ("tm_yday", tm_yday);
+    IDIO_FIELD_DEF ("tm_isdst", tm_isdst);
+    IDIO_FIELD_DEF ("tm_gmtoff", tm_gmtoff);
+    IDIO_FIELD_DEF ("tm_zone", tm_zone);
+
+    IDIO_ADD_STRUCT ("libc/struct-tm", libc_struct_tm, libc)
+
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_struct_tm_set);
+
+    /* libc struct tms is defined in /usr/include/x86_64-linux-gnu/sys/times.h */
+    struct_fields = idio_S_nil;
+    IDIO_FIELD_DEF ("tms_utime", tms_utime);
+    IDIO_FIELD_DEF ("tms_stime", tms_stime);
+    IDIO_FIELD_DEF ("tms_cutime", tms_cutime);
+    IDIO_FIELD_DEF ("tms_cstime", tms_cstime);
+
+    IDIO_ADD_STRUCT ("libc/struct-tms", libc_struct_tms, libc)
+
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_struct_tms_set);
+
+    /* libc struct utsname is defined in /usr/include/x86_64-linux-gnu/sys/utsname.h */
+    struct_fields = idio_S_nil;
+    IDIO_FIELD_DEF ("sysname", sysname);
+    IDIO_FIELD_DEF ("nodename", nodename);
+    IDIO_FIELD_DEF ("release", release);
+    /* version already declared */
+    struct_fields = idio_pair (idio_S_version, struct_fields);
+    IDIO_FIELD_DEF ("machine", machine);
+    IDIO_FIELD_DEF ("domainname", domainname);
+
+    IDIO_ADD_STRUCT ("libc/struct-utsname", libc_struct_utsname, libc)
+
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_struct_utsname_set);
+
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_access);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_asctime);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_chdir);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_chmod);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_chown);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_chroot);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_close);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_ctermid);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_ctime);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_dup);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_dup2);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_faccessat);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_fchdir);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_fchmod);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_fchmodat);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_fchown);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_fchownat);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_fcntl);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_fork);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_fstat);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_fstatat);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_fstatvfs);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_fsync);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_ftruncate);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_futimes);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_futimesat);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_getcwd);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_getegid);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_geteuid);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_getgid);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_getgrgid);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_getgrnam);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_getlogin);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_getpgid);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_getpgrp);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_getpid);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_getppid);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_getpriority);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_getpwnam);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_getpwuid);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_getrlimit);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_getrusage);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_getsid);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_gettimeofday);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_getuid);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_gmtime);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_grantpt);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_ioctl);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_isatty);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_kill);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_killpg);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_link);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_linkat);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_localtime);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_lockf);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_lstat);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_mkdir);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_mkdirat);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_mkdtemp);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_mkfifo);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_mkstemp);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_mktime);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_nanosleep);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_open);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_openat);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_pipe);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_posix_openpt);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_pread);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_ptsname);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_pwrite);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_read);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_readlink);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_readlinkat);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_rename);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_renameat);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_rmdir);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_setegid);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_seteuid);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_setgid);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_setpgid);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_setpriority);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_setregid);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_setresgid);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_setresuid);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_setreuid);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_setrlimit);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_setsid);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_setuid);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_sigaction);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_signal);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_sleep);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_stat);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_statvfs);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_strerror);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_strftime);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_strptime);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_strsignal);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_symlink);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_symlinkat);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_sync);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_tcgetattr);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_tcgetpgrp);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_tcsetattr);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_tcsetpgrp);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_time);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_times);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_truncate);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_ttyname);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_umask);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_uname);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_unlink);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_unlinkat);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_unlockpt);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_utimes);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_wait);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_waitpid);
+    IDIO_EXPORT_MODULE_PRIMITIVE (idio_libc_module, libc_write);
+
+}
+
+void idio_init_libc_api ()
+{
+
+    /* /usr/include/x86_64-linux-gnu/bits/resource.h */
+    /* enum __priority_which */
+#ifdef __priority_which
+    idio_module_export_symbol_value (IDIO_SYMBOLS_C_INTERN ("PRIO_PROCESS"), idio_C_uint (PRIO_PROCESS), idio_libc_module);
+    idio_module_export_symbol_value (IDIO_SYMBOLS_C_INTERN ("PRIO_PGRP"), idio_C_uint (PRIO_PGRP), idio_libc_module);
+    idio_module_export_symbol_value (IDIO_SYMBOLS_C_INTERN ("PRIO_USER"), idio_C_uint (PRIO_USER), idio_libc_module);
+#endif	/* __priority_which */
+
+    /* /usr/include/x86_64-linux-gnu/bits/resource.h */
+    /* enum __rlimit_resource */
+#ifdef __rlimit_resource
+    idio_module_export_symbol_value (IDIO_SYMBOLS_C_INTERN ("RLIMIT_CPU"), idio_C_uint (RLIMIT_CPU), idio_libc_module);
+    idio_module_export_symbol_value (IDIO_SYMBOLS_C_INTERN ("RLIMIT_FSIZE"), idio_C_uint (RLIMIT_FSIZE), idio_libc_module);
+    idio_module_export_symbol_value (IDIO_SYMBOLS_C_INTERN ("RLIMIT_DATA"), idio_C_uint (RLIMIT_DATA), idio_libc_module);
+    idio_module_export_symbol_value (IDIO_SYMBOLS_C_INTERN ("RLIMIT_STACK"), idio_C_uint (RLIMIT_STACK), idio_libc_module);
+    idio_module_export_symbol_value (IDIO_SYMBOLS_C_INTERN ("RLIMIT_CORE"), idio_C_uint (RLIMIT_CORE), idio_libc_module);
+    idio_module_export_symbol_value (IDIO_SYMBOLS_C_INTERN ("__RLIMIT_RSS"), idio_C_uint (__RLIMIT_RSS), idio_libc_module);
+    idio_module_export_symbol_value (IDIO_SYMBOLS_C_INTERN ("RLIMIT_NOFILE"), idio_C_uint (RLIMIT_NOFILE), idio_libc_module);
+    idio_module_export_symbol_value (IDIO_SYMBOLS_C_INTERN ("__RLIMIT_OFILE"), idio_C_uint (__RLIMIT_OFILE), idio_libc_module);
+    idio_module_export_symbol_value (IDIO_SYMBOLS_C_INTERN ("RLIMIT_AS"), idio_C_uint (RLIMIT_AS), idio_libc_module);
+    idio_module_export_symbol_value (IDIO_SYMBOLS_C_INTERN ("__RLIMIT_NPROC"), idio_C_uint (__RLIMIT_NPROC), idio_libc_module);
+    idio_module_export_symbol_value (IDIO_SYMBOLS_C_INTERN ("__RLIMIT_MEMLOCK"), idio_C_uint (__RLIMIT_MEMLOCK), idio_libc_module);
+    idio_module_export_symbol_value (IDIO_SYMBOLS_C_INTERN ("__RLIMIT_LOCKS"), idio_C_uint (__RLIMIT_LOCKS), idio_libc_module);
+    idio_module_export_symbol_value (IDIO_SYMBOLS_C_INTERN ("__RLIMIT_SIGPENDING"), idio_C_uint (__RLIMIT_SIGPENDING), idio_libc_module);
+    idio_module_export_symbol_value (IDIO_SYMBOLS_C_INTERN ("__RLIMIT_MSGQUEUE"), idio_C_uint (__RLIMIT_MSGQUEUE), idio_libc_module);
+    idio_module_export_symbol_value (IDIO_SYMBOLS_C_INTERN ("__RLIMIT_NICE"), idio_C_uint (__RLIMIT_NICE), idio_libc_module);
+    idio_module_export_symbol_value (IDIO_SYMBOLS_C_INTERN ("__RLIMIT_RTPRIO"), idio_C_uint (__RLIMIT_RTPRIO), idio_libc_module);
+    idio_module_export_symbol_value (IDIO_SYMBOLS_C_INTERN ("__RLIMIT_RTTIME"), idio_C_uint (__RLIMIT_RTTIME), idio_libc_module);
+    idio_module_export_symbol_value (IDIO_SYMBOLS_C_INTERN ("__RLIMIT_NLIMITS"), idio_C_uint (__RLIMIT_NLIMITS), idio_libc_module);
+    idio_module_export_symbol_value (IDIO_SYMBOLS_C_INTERN ("__RLIM_NLIMITS"), idio_C_uint (__RLIM_NLIMITS), idio_libc_module);
+#endif	/* __rlimit_resource */
+
+    /* /usr/include/x86_64-linux-gnu/bits/resource.h */
+    /* enum __rusage_who */
+#ifdef __rusage_who
+    idio_module_export_symbol_value (IDIO_SYMBOLS_C_INTERN ("RUSAGE_SELF"), idio_C_int (RUSAGE_SELF), idio_libc_module);
+    idio_module_export_symbol_value (IDIO_SYMBOLS_C_INTERN ("RUSAGE_CHILDREN"), idio_C_int (RUSAGE_CHILDREN), idio_libc_module);
+    idio_module_export_symbol_value (IDIO_SYMBOLS_C_INTERN ("RUSAGE_THREAD"), idio_C_int (RUSAGE_THREAD), idio_libc_module);
+#endif	/* __rusage_who */
+
+}
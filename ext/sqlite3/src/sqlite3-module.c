@@ -53,6 +53,7 @@
 #include "idio-config.h"
 
 #include "bignum.h"
+#include "bytevector.h"
 #include "c-type.h"
 #include "closure.h"
 #include "condition.h"
@@ -487,6 +488,32 @@ IDIO idio_sqlite3_bind_blob (sqlite3_stmt *stmt, int i, IDIO v)
 {
     IDIO_ASSERT (v);
 
+    if (idio_isa_bytevector (v)) {
+	/*
+	 * sqlite3 takes its own copy of the bytes with
+	 * SQLITE_TRANSIENT.  SQLITE_STATIC would need the bytes to
+	 * outlive the binding but nothing stops the GC from freeing
+	 * (or a resize from moving) them before the statement is
+	 * stepped or finalized.
+	 *
+	 * An empty bytevector has no data pointer which sqlite3 would
+	 * bind as NULL.
+	 */
+	size_t blen = IDIO_BYTEVECTOR_LEN (v);
+	int rc;
+	if (0 == blen) {
+	    rc = sqlite3_bind_zeroblob (stmt, i, 0);
+	} else {
+#if defined (IDIO_NO_SQLITE3_BIND_BLOB64)
+	    rc = sqlite3_bind_blob (stmt, i, IDIO_BYTEVECTOR_DATA (v), blen, SQLITE_TRANSIENT);
+#else
+	    rc = sqlite3_bind_blob64 (stmt, i, IDIO_BYTEVECTOR_DATA (v), blen, SQLITE_TRANSIENT);
+#endif
+	}
+
+	return idio_C_int (rc);
+    }
+
     if (! (idio_isa_octet_string (v) ||
 	   idio_isa_pathname (v))) {
 	/*
@@ -494,7 +521,7 @@ IDIO idio_sqlite3_bind_blob (sqlite3_stmt *stmt, int i, IDIO v)
 	 *
 	 * sqlite3-bind-blob stmt 1 #t
 	 */
-	idio_error_param_type ("octet-string|pathname", v, IDIO_C_FUNC_LOCATION ());
+	idio_error_param_type ("octet-string|pathname|bytevector", v, IDIO_C_FUNC_LOCATION ());
 
 	return idio_S_notreached;
     }
@@ -530,7 +557,7 @@ Replace parameter `i` with blob `v` in `stmt`	\n\
 :param i: parameter index	\n\
 :type i: fixnum			\n\
 :param v: parameter value	\n\
-:type v: octet-string		\n\
+:type v: octet-string or bytevector	\n\
 :return: sqlite3 return code	\n\
 :rtype: C/int			\n\
 :raises ^rt-sqlite3-error:	\n\
@@ -1022,7 +1049,8 @@ The sqlite3 *type* will be inferred from `val`'s :lname:`Idio` type.	\n\
 	    } else if (idio_isa_libc_int64_t (val)) {
 		rc = idio_sqlite3_bind_int (C_stmt, C_idx, val);
 	    } else if (idio_isa_octet_string (val) ||
-		       idio_isa_pathname (val)) {
+		       idio_isa_pathname (val) ||
+		       idio_isa_bytevector (val)) {
 		rc = idio_sqlite3_bind_blob (C_stmt, C_idx, val);
 	    } else if (idio_isa_string (val)) {
 		rc = idio_sqlite3_bind_text (C_stmt, C_idx, val);
@@ -1151,6 +1179,13 @@ Return the next row for `stmt`	\n\
 			col = idio_S_nil;
 			break;
 		    case SQLITE_BLOB:
+			/*
+			 * The blob is only valid until the next step so
+			 * we must copy it.  Blobs have always been
+			 * returned as octet strings and callers compare
+			 * them as such so we keep doing that rather than
+			 * returning a bytevector.
+			 */
 			{
 			    const void *sblob = sqlite3_column_blob (C_stmt, c);
 
@@ -1261,6 +1296,9 @@ Return column `idx` for the current row of `stmt`	\n\
 	col = idio_S_nil;
 	break;
     case SQLITE_BLOB:
+	/*
+	 * Copied into an octet string as for %sqlite3-step, above
+	 */
 	{
 	    const void *sblob = sqlite3_column_blob (C_stmt, C_idx);
 
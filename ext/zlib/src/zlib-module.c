@@ -41,6 +41,7 @@
 #include "gc.h"
 
 #include "bignum.h"
+#include "bytevector.h"
 #include "c-type.h"
 #include "condition.h"
 #include "error.h"
@@ -164,12 +165,54 @@ Return the zlib version	\n\
 
 #define IDIO_ZLIB_CHUNK 16384
 
+/*
+ * idio_zlib_deflate_bytevector() compresses the bytes of bv in one
+ * call to deflate() directly into a bytevector sized by
+ * deflateBound().
+ */
+static IDIO idio_zlib_deflate_bytevector (z_stream *zs, IDIO bv)
+{
+    IDIO_C_ASSERT (zs);
+    IDIO_ASSERT (bv);
+
+    IDIO_TYPE_ASSERT (bytevector, bv);
+
+    size_t len = IDIO_BYTEVECTOR_LEN (bv);
+    uLong bound = deflateBound (zs, len);
+
+    if (bound > IDIO_BYTEVECTOR_MAX_LEN) {
+	bound = IDIO_BYTEVECTOR_MAX_LEN;
+    }
+
+    IDIO obv = idio_bytevector (bound);
+
+    zs->next_in   = IDIO_BYTEVECTOR_DATA (bv);
+    zs->avail_in  = len;
+    zs->next_out  = IDIO_BYTEVECTOR_DATA (obv);
+    zs->avail_out = bound;
+
+    int ret = deflate (zs, Z_FINISH);
+
+    if (Z_STREAM_END != ret) {
+	/*
+	 * Test Case: ??
+	 *
+	 * deflateBound() should have been enough
+	 */
+	idio_zlib_error_printf (ret, idio_S_nil, IDIO_C_FUNC_LOCATION (), "deflate(): Z_STREAM_END != ret");
+
+	return idio_S_notreached;
+    }
+
+    idio_bytevector_resize_C (obv, zs->total_out);
+
+    return obv;
+}
+
 IDIO idio_zlib_deflate (IDIO handle, int level, int method, int windowBits, int memLevel, int strategy)
 {
     IDIO_ASSERT (handle);
 
-    IDIO_TYPE_ASSERT (input_handle, handle);
-
     z_stream *zs = idio_alloc (sizeof (z_stream));
     IDIO C_p = idio_C_pointer_type (idio_CSI_zlib_z_stream, zs);
 
@@ -190,6 +233,17 @@ IDIO idio_zlib_deflate (IDIO handle, int level, int method, int windowBits, int
 
     idio_gc_register_finalizer (C_p, idio_zlib_deflate_finalizer);
 
+    if (idio_isa_bytevector (handle)) {
+	IDIO r = idio_zlib_deflate_bytevector (zs, handle);
+
+	idio_gc_deregister_finalizer (C_p);
+	deflateEnd (zs);
+
+	return r;
+    }
+
+    IDIO_TYPE_ASSERT (input_handle, handle);
+
     IDIO osh = idio_open_output_string_handle_C ();
 
     int flush;
@@ -280,8 +334,8 @@ IDIO_DEFINE_PRIMITIVE1V_DS ("deflate", zlib_deflate, (IDIO handle, IDIO args), "
 Return zlib compression of the UTF-8 encoded	\n\
 data stream in `handle`.			\n\
 				\n\
-:param handle: handle		\n\
-:type handle: input handle	\n\
+:param handle: handle or bytevector	\n\
+:type handle: input handle or bytevector	\n\
 :param level: compression level, defaults to ``Z_DEFAULT_COMPRESSION``	\n\
 :type level: C/int|fixnum, optional	\n\
 :param windowBits: base two logarithm of the window size, defaults to 15	\n\
@@ -289,8 +343,11 @@ data stream in `handle`.			\n\
 :param strategy: strategy, defaults to ``Z_DEFAULT_STRATEGY``	\n\
 :type strategy: C/int|fixnum, optional	\n\
 :return: compressed data	\n\
-:rtype: octet string		\n\
+:rtype: octet string or bytevector	\n\
 :raises ^rt-zlib-error:		\n\
+				\n\
+If `handle` is a bytevector its bytes are	\n\
+compressed as is and the result is a bytevector.	\n\
 ")
 {
     IDIO_ASSERT (handle);
@@ -300,7 +357,9 @@ data stream in `handle`.			\n\
      *
      * deflate #t
      */
-    IDIO_USER_TYPE_ASSERT (input_handle, handle);
+    if (! idio_isa_bytevector (handle)) {
+	IDIO_USER_TYPE_ASSERT (input_handle, handle);
+    }
 
     int C_level      = Z_DEFAULT_COMPRESSION;
     int C_method     = Z_DEFLATED;	/* only available value */
@@ -410,8 +469,8 @@ IDIO_DEFINE_PRIMITIVE1V_DS ("zlib-compress", zlib_compress, (IDIO handle, IDIO a
 Return zlib compression of the UTF-8 encoded	\n\
 data stream in `handle`.			\n\
 				\n\
-:param handle: handle		\n\
-:type handle: input handle	\n\
+:param handle: handle or bytevector	\n\
+:type handle: input handle or bytevector	\n\
 :param level: compression level, defaults to ``Z_DEFAULT_COMPRESSION``	\n\
 :type level: C/int|fixnum, optional	\n\
 :param windowBits: base two logarithm of the window size, defaults to 15	\n\
@@ -419,8 +478,11 @@ data stream in `handle`.			\n\
 :param strategy: strategy, defaults to ``Z_DEFAULT_STRATEGY``	\n\
 :type strategy: C/int|fixnum, optional	\n\
 :return: compressed data	\n\
-:rtype: octet string		\n\
+:rtype: octet string or bytevector	\n\
 :raises ^rt-zlib-error:		\n\
+				\n\
+If `handle` is a bytevector its bytes are	\n\
+compressed as is and the result is a bytevector.	\n\
 ")
 {
     IDIO_ASSERT (handle);
@@ -430,7 +492,9 @@ data stream in `handle`.			\n\
      *
      * zlib-compress #t
      */
-    IDIO_USER_TYPE_ASSERT (input_handle, handle);
+    if (! idio_isa_bytevector (handle)) {
+	IDIO_USER_TYPE_ASSERT (input_handle, handle);
+    }
 
     int C_level      = Z_DEFAULT_COMPRESSION;
     int C_method     = Z_DEFLATED;	/* only available value */
@@ -530,8 +594,8 @@ IDIO_DEFINE_PRIMITIVE1V_DS ("gzip-compress", gzip_compress, (IDIO handle, IDIO a
 Return gzip compression of the UTF-8 encoded	\n\
 data stream in `handle`.			\n\
 				\n\
-:param handle: handle		\n\
-:type handle: input handle	\n\
+:param handle: handle or bytevector	\n\
+:type handle: input handle or bytevector	\n\
 :param level: compression level, defaults to ``Z_DEFAULT_COMPRESSION``	\n\
 :type level: C/int|fixnum, optional	\n\
 :param windowBits: base two logarithm of the window size, defaults to 15	\n\
@@ -539,8 +603,11 @@ data stream in `handle`.			\n\
 :param strategy: strategy, defaults to ``Z_DEFAULT_STRATEGY``	\n\
 :type strategy: C/int|fixnum, optional	\n\
 :return: compressed data	\n\
-:rtype: octet string		\n\
+:rtype: octet string or bytevector	\n\
 :raises ^rt-zlib-error:		\n\
+				\n\
+If `handle` is a bytevector its bytes are	\n\
+compressed as is and the result is a bytevector.	\n\
 ")
 {
     IDIO_ASSERT (handle);
@@ -550,7 +617,9 @@ data stream in `handle`.			\n\
      *
      * gzip-compress #t
      */
-    IDIO_USER_TYPE_ASSERT (input_handle, handle);
+    if (! idio_isa_bytevector (handle)) {
+	IDIO_USER_TYPE_ASSERT (input_handle, handle);
+    }
 
     int C_level      = Z_DEFAULT_COMPRESSION;
     int C_method     = Z_DEFLATED;	/* only available value */
@@ -648,12 +717,89 @@ data stream in `handle`.			\n\
     return idio_zlib_deflate (handle, C_level, C_method, C_windowBits, C_memLevel, C_strategy);
 }
 
+/*
+ * idio_zlib_inflate_bytevector() decompresses the bytes of bv
+ * directly into a bytevector doubling its size as required.
+ */
+static IDIO idio_zlib_inflate_bytevector (z_stream *zs, IDIO bv)
+{
+    IDIO_C_ASSERT (zs);
+    IDIO_ASSERT (bv);
+
+    IDIO_TYPE_ASSERT (bytevector, bv);
+
+    size_t len = IDIO_BYTEVECTOR_LEN (bv);
+    size_t olen = len * 4;
+    if (olen < IDIO_ZLIB_CHUNK) {
+	olen = IDIO_ZLIB_CHUNK;
+    } else if (olen > IDIO_BYTEVECTOR_MAX_LEN) {
+	olen = IDIO_BYTEVECTOR_MAX_LEN;
+    }
+
+    IDIO obv = idio_bytevector (olen);
+
+    zs->next_in  = IDIO_BYTEVECTOR_DATA (bv);
+    zs->avail_in = len;
+
+    for (;;) {
+	zs->next_out  = IDIO_BYTEVECTOR_DATA (obv) + zs->total_out;
+	zs->avail_out = olen - zs->total_out;
+
+	int ret = inflate (zs, Z_NO_FLUSH);
+
+	if (Z_STREAM_END == ret) {
+	    break;
+	}
+
+	switch (ret) {
+	case Z_NEED_DICT:
+	    ret = Z_DATA_ERROR;
+	    /* fall through */
+	case Z_STREAM_ERROR:
+	case Z_DATA_ERROR:
+	case Z_MEM_ERROR:
+	    /*
+	     * Test case: ??
+	     *
+	     * As for the handle variant
+	     */
+	    idio_zlib_error_printf (ret, idio_S_nil, IDIO_C_FUNC_LOCATION (), "inflate(): Z_STREAM_END != ret");
+
+	    return idio_S_notreached;
+	}
+
+	if (zs->avail_out) {
+	    /*
+	     * truncated input: return what we have
+	     */
+	    break;
+	}
+
+	if (olen == IDIO_BYTEVECTOR_MAX_LEN) {
+	    /*
+	     * Test case: ??
+	     */
+	    idio_zlib_error_printf (Z_BUF_ERROR, idio_S_nil, IDIO_C_FUNC_LOCATION (), "inflate(): result too large for a bytevector");
+
+	    return idio_S_notreached;
+	}
+
+	olen *= 2;
+	if (olen > IDIO_BYTEVECTOR_MAX_LEN) {
+	    olen = IDIO_BYTEVECTOR_MAX_LEN;
+	}
+	idio_bytevector_resize_C (obv, olen);
+    }
+
+    idio_bytevector_resize_C (obv, zs->total_out);
+
+    return obv;
+}
+
 IDIO idio_zlib_inflate (IDIO handle, int windowBits)
 {
     IDIO_ASSERT (handle);
 
-    IDIO_TYPE_ASSERT (input_handle, handle);
-
     z_stream *zs = idio_alloc (sizeof (z_stream));
     IDIO C_p = idio_C_pointer_type (idio_CSI_zlib_z_stream, zs);
 
@@ -676,6 +822,17 @@ IDIO idio_zlib_inflate (IDIO handle, int windowBits)
 
     idio_gc_register_finalizer (C_p, idio_zlib_inflate_finalizer);
 
+    if (idio_isa_bytevector (handle)) {
+	IDIO r = idio_zlib_inflate_bytevector (zs, handle);
+
+	idio_gc_deregister_finalizer (C_p);
+	inflateEnd (zs);
+
+	return r;
+    }
+
+    IDIO_TYPE_ASSERT (input_handle, handle);
+
     IDIO osh = idio_open_output_string_handle_C ();
 
     do {
@@ -761,13 +918,15 @@ IDIO idio_zlib_inflate (IDIO handle, int windowBits)
 IDIO_DEFINE_PRIMITIVE1V_DS ("inflate", zlib_inflate, (IDIO handle, IDIO args), "handle [windowBits]", "\
 Return zlib decompression of the bytes in `handle`.	\n\
 				\n\
-:param handle: handle		\n\
-:type handle: input handle	\n\
+:param handle: handle or bytevector	\n\
+:type handle: input handle or bytevector	\n\
 :param windowBits: base two logarithm of the window size, defaults to 15	\n\
 :type windowBits: C/int|fixnum, optional	\n\
 :return: decompressed data	\n\
-:rtype: octet string		\n\
+:rtype: octet string or bytevector	\n\
 :raises ^rt-zlib-error:		\n\
+				\n\
+If `handle` is a bytevector the result is a bytevector.	\n\
 ")
 {
     IDIO_ASSERT (handle);
@@ -777,7 +936,9 @@ Return zlib decompression of the bytes in `handle`.	\n\
      *
      * inflate #t
      */
-    IDIO_USER_TYPE_ASSERT (input_handle, handle);
+    if (! idio_isa_bytevector (handle)) {
+	IDIO_USER_TYPE_ASSERT (input_handle, handle);
+    }
 
     int C_windowBits = 15;	/* default for inflateInit() */
 
@@ -833,13 +994,15 @@ Return zlib decompression of the bytes in `handle`.	\n\
 IDIO_DEFINE_PRIMITIVE1V_DS ("zlib-decompress", zlib_decompress, (IDIO handle, IDIO args), "handle [windowBits]", "\
 Return zlib decompression of the bytes in `handle`.	\n\
 				\n\
-:param handle: handle		\n\
-:type handle: input handle	\n\
+:param handle: handle or bytevector	\n\
+:type handle: input handle or bytevector	\n\
 :param windowBits: base two logarithm of the window size, defaults to 15	\n\
 :type windowBits: C/int|fixnum, optional	\n\
 :return: decompressed data	\n\
-:rtype: octet string		\n\
+:rtype: octet string or bytevector	\n\
 :raises ^rt-zlib-error:		\n\
+				\n\
+If `handle` is a bytevector the result is a bytevector.	\n\
 ")
 {
     IDIO_ASSERT (handle);
@@ -849,7 +1012,9 @@ Return zlib decompression of the bytes in `handle`.	\n\
      *
      * zlib-decompress #t
      */
-    IDIO_USER_TYPE_ASSERT (input_handle, handle);
+    if (! idio_isa_bytevector (handle)) {
+	IDIO_USER_TYPE_ASSERT (input_handle, handle);
+    }
 
     int C_windowBits = 15;	/* default for inflateInit() */
 
@@ -895,13 +1060,15 @@ Return zlib decompression of the bytes in `handle`.	\n\
 IDIO_DEFINE_PRIMITIVE1V_DS ("gzip-decompress", gzip_decompress, (IDIO handle, IDIO args), "handle [windowBits]", "\
 Return gzip decompression of the bytes in `handle`.	\n\
 				\n\
-:param handle: handle		\n\
-:type handle: input handle	\n\
+:param handle: handle or bytevector	\n\
+:type handle: input handle or bytevector	\n\
 :param windowBits: base two logarithm of the window size, defaults to 15	\n\
 :type windowBits: C/int|fixnum, optional	\n\
 :return: decompressed data	\n\
-:rtype: octet string		\n\
+:rtype: octet string or bytevector	\n\
 :raises ^rt-zlib-error:		\n\
+				\n\
+If `handle` is a bytevector the result is a bytevector.	\n\
 ")
 {
     IDIO_ASSERT (handle);
@@ -911,7 +1078,9 @@ Return gzip decompression of the bytes in `handle`.	\n\
      *
      * gzip-decompress #t
      */
-    IDIO_USER_TYPE_ASSERT (input_handle, handle);
+    if (! idio_isa_bytevector (handle)) {
+	IDIO_USER_TYPE_ASSERT (input_handle, handle);
+    }
 
     int C_windowBits = 15;	/* default for inflateInit() */
 
@@ -58,6 +58,7 @@
 #include <stddef.h>
 #include <stdint.h>
 #include <stdio.h>
+#include <string.h>
 #include <unistd.h>
 
 #include "idio-config.h"
@@ -161,6 +162,7 @@ void idio_assign_array (IDIO a, idio_as_t asize, IDIO dv)
     IDIO_ARRAY_GREY (a) = NULL;
     IDIO_ARRAY_ASIZE (a) = asize;
     IDIO_ARRAY_USIZE (a) = 0;
+    IDIO_ARRAY_HEAD (a) = 0;
     IDIO_ARRAY_DV (a) = dv;
     IDIO_ARRAY_FLAGS (a) = IDIO_ARRAY_FLAG_NONE;
 
@@ -189,7 +191,6 @@ IDIO idio_array_dv (idio_as_t size0, IDIO dv)
     }
 
     IDIO a = idio_gc_get (IDIO_TYPE_ARRAY);
-    a->vtable = idio_vtable (IDIO_TYPE_ARRAY);
     idio_assign_array (a, size, dv);
 
     return a;
@@ -221,7 +222,7 @@ void idio_free_array (IDIO a)
     IDIO_ASSERT (a);
     IDIO_TYPE_ASSERT (array, a);
 
-    IDIO_GC_FREE (a->u.array->ae, IDIO_ARRAY_ASIZE (a) * sizeof (IDIO));
+    IDIO_GC_FREE (a->u.array->ae - IDIO_ARRAY_HEAD (a), (IDIO_ARRAY_HEAD (a) + IDIO_ARRAY_ASIZE (a)) * sizeof (IDIO));
     IDIO_GC_FREE (a->u.array, sizeof (idio_array_t));
 }
 
@@ -234,8 +235,13 @@ void idio_resize_array_to (IDIO a, idio_as_t nsize)
 
     IDIO_ASSERT_NOT_CONST (array, a);
 
-    IDIO_GC_REALLOC (a->u.array->ae, nsize * sizeof (IDIO));
+    idio_as_t head = IDIO_ARRAY_HEAD (a);
+    IDIO *base = a->u.array->ae - head;
 
+    idio_gc_stats_free ((head + IDIO_ARRAY_ASIZE (a)) * sizeof (IDIO));
+    IDIO_GC_REALLOC (base, (head + nsize) * sizeof (IDIO));
+
+    a->u.array->ae = base + head;
     IDIO_ARRAY_ASIZE (a) = nsize;
 
     idio_as_t i;
@@ -252,6 +258,31 @@ void idio_resize_array (IDIO a)
 
     IDIO_ASSERT_NOT_CONST (array, a);
 
+    idio_as_t head = IDIO_ARRAY_HEAD (a);
+
+    if (head &&
+	head >= IDIO_ARRAY_USIZE (a)) {
+	/*
+	 * At least as many elements have been shifted off the front
+	 * as remain so moving the remainder back to the start of the
+	 * allocation is paid for.  This is the queue case: push at
+	 * the end, shift from the front.
+	 */
+	IDIO *base = a->u.array->ae - head;
+	memmove (base, a->u.array->ae, IDIO_ARRAY_USIZE (a) * sizeof (IDIO));
+
+	a->u.array->ae = base;
+	IDIO_ARRAY_HEAD (a) = 0;
+	IDIO_ARRAY_ASIZE (a) += head;
+
+	idio_as_t i;
+	for (i = IDIO_ARRAY_USIZE (a); i < IDIO_ARRAY_ASIZE (a); i++) {
+	    IDIO_ARRAY_AE (a, i) = IDIO_ARRAY_DV (a);
+	}
+
+	return;
+    }
+
     idio_as_t oasize = IDIO_ARRAY_ASIZE (a);
     idio_as_t nsize = oasize + 1024;
     if (oasize < 1024) {
@@ -447,6 +478,10 @@ IDIO idio_array_pop (IDIO a)
  * idio_array_shift() - pop value off the front of an array
  * @a: array
  *
+ * The start of the array is advanced over the shifted element,
+ * leaving a gap in front of @a which idio_array_unshift() can
+ * re-use, so that shifting is O(1).
+ *
  * Return:
  * ``IDIO`` value or %idio_S_nil if the array is empty.
  */
@@ -462,16 +497,20 @@ IDIO idio_array_shift (IDIO a)
 	return idio_S_nil;
     }
 
-    IDIO e = idio_array_ref_index (a, 0);
-    idio_as_t i;
-    for (i = 0 ; i < (IDIO_ARRAY_USIZE (a) - 1); i++) {
-	IDIO e = idio_array_ref_index (a, i + 1);
-	IDIO_ASSERT (e);
+    /*
+     * Rather than move the remaining elements down we advance the
+     * start of the array
+     */
+    IDIO e = IDIO_ARRAY_AE (a, 0);
+    IDIO_ARRAY_AE (a, 0) = IDIO_ARRAY_DV (a);
 
-	idio_array_insert_index (a, e, i);
-    }
+    a->u.array->ae++;
+    IDIO_ARRAY_HEAD (a)++;
+    IDIO_ARRAY_ASIZE (a)--;
+    IDIO_ARRAY_USIZE (a)--;
 
-    idio_array_pop (a);
+    IDIO_ASSERT (e);
+    IDIO_ASSERT_NOT_FREED (e);
 
     return e;
 }
@@ -481,7 +520,9 @@ IDIO idio_array_shift (IDIO a)
  * @a: array
  * @o: ``IDIO`` value to be pushed
  *
- * idio_array_insert_index() is called with &idio_array_s.usize.
+ * Any gap left in front of @a by idio_array_shift() is used first.
+ * Otherwise a gap proportional to the array's used size is created
+ * so that a run of unshifts is amortised O(1).
  *
  * Return:
  * void
@@ -494,16 +535,32 @@ void idio_array_unshift (IDIO a, IDIO o)
 
     IDIO_ASSERT_NOT_CONST (array, a);
 
-    idio_ai_t i;
-    if (IDIO_ARRAY_USIZE (a) > 0) {
-	for (i = IDIO_ARRAY_USIZE (a); i > 0; i--) {
-	    IDIO e = idio_array_ref_index (a, i - 1);
-	    IDIO_ASSERT (e);
-
-	    idio_array_insert_index (a, e, i);
+    if (0 == IDIO_ARRAY_HEAD (a)) {
+	/*
+	 * Make room at the front in proportion to the array so that
+	 * the cost of moving the elements is amortised over the
+	 * following unshifts.
+	 */
+	idio_as_t asize = IDIO_ARRAY_ASIZE (a);
+	idio_as_t head = IDIO_ARRAY_USIZE (a);
+	if (head < 8) {
+	    head = 8;
 	}
+
+	IDIO *base = a->u.array->ae;
+	idio_gc_stats_free (asize * sizeof (IDIO));
+	IDIO_GC_REALLOC (base, (head + asize) * sizeof (IDIO));
+	memmove (base + head, base, asize * sizeof (IDIO));
+
+	a->u.array->ae = base + head;
+	IDIO_ARRAY_HEAD (a) = head;
     }
-    idio_array_insert_index (a, o, 0);
+
+    a->u.array->ae--;
+    IDIO_ARRAY_HEAD (a)--;
+    IDIO_ARRAY_ASIZE (a)++;
+    IDIO_ARRAY_USIZE (a)++;
+    IDIO_ARRAY_AE (a, 0) = o;
 
     IDIO_C_ASSERT (IDIO_ARRAY_USIZE (a) <= IDIO_ARRAY_ASIZE (a));
 }
@@ -813,8 +870,10 @@ void idio_duplicate_array (IDIO a, IDIO o, idio_as_t n, int depth)
     }
     if (osz > IDIO_ARRAY_ASIZE (a)) {
 	fprintf (stderr, "dupe %zu -> %zu\n", IDIO_ARRAY_ASIZE (a), osz);
-	IDIO_GC_FREE (a->u.array->ae, IDIO_ARRAY_ASIZE (a) * sizeof (IDIO));
+	IDIO_GC_FREE (a->u.array->ae - IDIO_ARRAY_HEAD (a), (IDIO_ARRAY_HEAD (a) + IDIO_ARRAY_ASIZE (a)) * sizeof (IDIO));
 	IDIO_GC_ALLOC (a->u.array->ae, osz * sizeof (IDIO));
+	IDIO_ARRAY_HEAD (a) = 0;
+	IDIO_ARRAY_ASIZE (a) = osz;
     }
     IDIO_ARRAY_USIZE (a) = osz;
 
@@ -1546,6 +1605,421 @@ The final value of `val` is returned.				\n\
     return val;
 }
 
+/*
+ * idio_array_C_index() converts an Idio integer (or an integral
+ * bignum) into a C index for the bulk array operations
+ */
+static idio_ai_t idio_array_C_index (IDIO index)
+{
+    IDIO_ASSERT (index);
+
+    if (idio_isa_fixnum (index)) {
+	return IDIO_FIXNUM_VAL (index);
+    } else if (idio_isa_bignum (index)) {
+	if (IDIO_BIGNUM_INTEGER_P (index)) {
+	    /*
+	     * Code coverage: to get here we'd need to pass
+	     * FIXNUM-MAX+1 and that is to too big to allocate...
+	     */
+	    return idio_bignum_ptrdiff_t_value (index);
+	} else {
+	    IDIO index_i = idio_bignum_real_to_integer (index);
+	    if (idio_S_nil == index_i) {
+		/*
+		 * Test Case: array-errors/array-slice-float.idio
+		 *
+		 * array-slice #[ 1 2 3 ] 1.1
+		 */
+		idio_error_param_type ("integer", index, IDIO_C_FUNC_LOCATION ());
+
+		return -1;
+	    } else {
+		return idio_bignum_ptrdiff_t_value (index_i);
+	    }
+	}
+    }
+
+    /*
+     * Test Case: array-errors/array-slice-not-integer.idio
+     *
+     * array-slice #[ 1 2 3 ] #t
+     */
+    idio_error_param_type ("integer", index, IDIO_C_FUNC_LOCATION ());
+
+    return -1;
+}
+
+/*
+ * idio_array_range() sets *startp and *endp from the optional [start
+ * [end]] in args, defaulting to the whole of a.
+ */
+static void idio_array_range (IDIO a, IDIO args, idio_ai_t *startp, idio_ai_t *endp, char const *func)
+{
+    IDIO_ASSERT (a);
+    IDIO_ASSERT (args);
+    IDIO_C_ASSERT (startp);
+    IDIO_C_ASSERT (endp);
+    IDIO_C_ASSERT (func);
+
+    idio_ai_t al = IDIO_ARRAY_USIZE (a);
+    idio_ai_t start = 0;
+    idio_ai_t end = al;
+
+    if (idio_isa_pair (args)) {
+	start = idio_array_C_index (IDIO_PAIR_H (args));
+	args = IDIO_PAIR_T (args);
+	if (idio_isa_pair (args)) {
+	    end = idio_array_C_index (IDIO_PAIR_H (args));
+	}
+    }
+
+    if (start < 0 ||
+	start > end ||
+	end > al) {
+	/*
+	 * Test Case: array-errors/array-slice-bad-range.idio
+	 *
+	 * array-slice #[ 1 2 3 ] 2 1
+	 */
+	char em[BUFSIZ];
+	idio_snprintf (em, BUFSIZ, "range %td-%td is not within 0-%td", start, end, al);
+	idio_error_param_value_msg_only (func, "start/end", em, IDIO_C_FUNC_LOCATION ());
+
+	return;
+    }
+
+    *startp = start;
+    *endp = end;
+}
+
+IDIO_DEFINE_PRIMITIVE1V_DS ("array-slice", array_slice, (IDIO a, IDIO args), "a [start [end]]", "\
+return a new array of the elements of `a` from	\n\
+`start` up to but not including `end`		\n\
+						\n\
+:param a: the array				\n\
+:type a: array					\n\
+:param start: starting index, defaults to 0	\n\
+:type start: integer, optional			\n\
+:param end: end index, defaults to the length of `a`	\n\
+:type end: integer, optional			\n\
+:return: the new array				\n\
+:rtype: array					\n\
+						\n\
+The new array has the same default value as `a`.	\n\
+")
+{
+    IDIO_ASSERT (a);
+    IDIO_ASSERT (args);
+
+    /*
+     * Test Case: array-errors/array-slice-bad-type.idio
+     *
+     * array-slice #t
+     */
+    IDIO_USER_TYPE_ASSERT (array, a);
+    /*
+     * Test Case: n/a
+     *
+     * args is the varargs parameter -- should always be a list
+     */
+    IDIO_USER_TYPE_ASSERT (list, args);
+
+    idio_ai_t start;
+    idio_ai_t end;
+    idio_array_range (a, args, &start, &end, "array-slice");
+
+    idio_as_t n = end - start;
+    IDIO r = idio_array_dv (n, IDIO_ARRAY_DV (a));
+    memcpy (r->u.array->ae, &IDIO_ARRAY_AE (a, start), n * sizeof (IDIO));
+    IDIO_ARRAY_USIZE (r) = n;
+
+    return r;
+}
+
+IDIO_DEFINE_PRIMITIVE0V_DS ("array-append", array_append, (IDIO args), "[a ...]", "\
+return a new array of the elements of the arrays `a ...`	\n\
+								\n\
+:param a: array							\n\
+:type a: array							\n\
+:return: the new array						\n\
+:rtype: array							\n\
+								\n\
+The new array has the same default value as the first `a`.	\n\
+")
+{
+    IDIO_ASSERT (args);
+
+    /*
+     * Test Case: n/a
+     *
+     * args is the varargs parameter -- should always be a list
+     */
+    IDIO_USER_TYPE_ASSERT (list, args);
+
+    idio_as_t n = 0;
+    IDIO dv = idio_array_default_value;
+    IDIO as = args;
+    while (idio_S_nil != as) {
+	IDIO a = IDIO_PAIR_H (as);
+
+	/*
+	 * Test Case: array-errors/array-append-bad-type.idio
+	 *
+	 * array-append #[ 1 2 3 ] #t
+	 */
+	IDIO_USER_TYPE_ASSERT (array, a);
+
+	if (as == args) {
+	    dv = IDIO_ARRAY_DV (a);
+	}
+	n += IDIO_ARRAY_USIZE (a);
+
+	as = IDIO_PAIR_T (as);
+    }
+
+    IDIO r = idio_array_dv (n, dv);
+
+    idio_as_t ri = 0;
+    while (idio_S_nil != args) {
+	IDIO a = IDIO_PAIR_H (args);
+	idio_as_t al = IDIO_ARRAY_USIZE (a);
+
+	memcpy (&IDIO_ARRAY_AE (r, ri), a->u.array->ae, al * sizeof (IDIO));
+	ri += al;
+
+	args = IDIO_PAIR_T (args);
+    }
+    IDIO_ARRAY_USIZE (r) = n;
+
+    return r;
+}
+
+IDIO_DEFINE_PRIMITIVE3V_DS ("array-copy!", array_copy_into, (IDIO dst, IDIO at, IDIO src, IDIO args), "dst at src [start [end]]", "\
+copy the elements of `src` from `start` up to but	\n\
+not including `end` into `dst` from index `at`		\n\
+							\n\
+:param dst: the destination array			\n\
+:type dst: array					\n\
+:param at: the destination index			\n\
+:type at: integer					\n\
+:param src: the source array				\n\
+:type src: array					\n\
+:param start: starting index, defaults to 0		\n\
+:type start: integer, optional				\n\
+:param end: end index, defaults to the length of `src`	\n\
+:type end: integer, optional				\n\
+:return: ``#<unspec>``					\n\
+							\n\
+`at` can be up to the length of `dst` and `dst` will	\n\
+be extended as required.				\n\
+							\n\
+`dst` and `src` can be the same array.			\n\
+")
+{
+    IDIO_ASSERT (dst);
+    IDIO_ASSERT (at);
+    IDIO_ASSERT (src);
+    IDIO_ASSERT (args);
+
+    /*
+     * Test Case: array-errors/array-copy-bad-dst-type.idio
+     *
+     * array-copy! #t 0 #[ 1 2 3 ]
+     */
+    IDIO_USER_TYPE_ASSERT (array, dst);
+    /*
+     * Test Case: n/a
+     *
+     * The VM returns a copy of any constant array when referenced.
+     */
+    IDIO_ASSERT_NOT_CONST (array, dst);
+    /*
+     * Test Case: array-errors/array-copy-bad-src-type.idio
+     *
+     * array-copy! #[ 1 2 3 ] 0 #t
+     */
+    IDIO_USER_TYPE_ASSERT (array, src);
+    /*
+     * Test Case: n/a
+     *
+     * args is the varargs parameter -- should always be a list
+     */
+    IDIO_USER_TYPE_ASSERT (list, args);
+
+    idio_ai_t dl = IDIO_ARRAY_USIZE (dst);
+    idio_ai_t ai = idio_array_C_index (at);
+
+    if (ai < 0 ||
+	ai > dl) {
+	/*
+	 * Test Case: array-errors/array-copy-bad-at.idio
+	 *
+	 * array-copy! #[ 1 2 3 ] 4 #[ 1 2 3 ]
+	 */
+	char em[BUFSIZ];
+	idio_snprintf (em, BUFSIZ, "is not within 0-%td", dl);
+	idio_error_param_value_msg ("array-copy!", "at", at, em, IDIO_C_FUNC_LOCATION ());
+
+	return idio_S_notreached;
+    }
+
+    idio_ai_t start;
+    idio_ai_t end;
+    idio_array_range (src, args, &start, &end, "array-copy!");
+
+    idio_ai_t n = end - start;
+    if (0 == n) {
+	return idio_S_unspec;
+    }
+
+    if (ai + n > dl) {
+	if ((idio_as_t) (ai + n) > IDIO_ARRAY_ASIZE (dst)) {
+	    idio_resize_array_to (dst, ai + n);
+	}
+	IDIO_ARRAY_USIZE (dst) = ai + n;
+    }
+
+    /*
+     * dst and src may be the same array, hence memmove()
+     */
+    memmove (&IDIO_ARRAY_AE (dst, ai), &IDIO_ARRAY_AE (src, start), n * sizeof (IDIO));
+
+    return idio_S_unspec;
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("array-reverse!", array_nreverse, (IDIO a), "a", "\
+reverse the elements of `a` in place		\n\
+						\n\
+:param a: the array				\n\
+:type a: array					\n\
+:return: `a`					\n\
+:rtype: array					\n\
+")
+{
+    IDIO_ASSERT (a);
+
+    /*
+     * Test Case: array-errors/array-reverse-bad-type.idio
+     *
+     * array-reverse! #t
+     */
+    IDIO_USER_TYPE_ASSERT (array, a);
+    /*
+     * Test Case: n/a
+     *
+     * The VM returns a copy of any constant array when referenced.
+     */
+    IDIO_ASSERT_NOT_CONST (array, a);
+
+    IDIO *lo = a->u.array->ae;
+    IDIO *hi = lo + IDIO_ARRAY_USIZE (a) - 1;
+
+    while (lo < hi) {
+	IDIO t = *lo;
+	*lo++ = *hi;
+	*hi-- = t;
+    }
+
+    return a;
+}
+
+IDIO_DEFINE_PRIMITIVE2_DS ("array-map", array_map, (IDIO a, IDIO func), "a func", "\
+return a new array of the results of calling	\n\
+`func` on each element of `a`			\n\
+						\n\
+:param a: the array				\n\
+:type a: array					\n\
+:param func: func to be called with each value	\n\
+:type func: 1-ary function			\n\
+:return: the new array				\n\
+:rtype: array					\n\
+")
+{
+    IDIO_ASSERT (a);
+    IDIO_ASSERT (func);
+
+    /*
+     * Test Case: array-errors/array-map-bad-array-type.idio
+     *
+     * array-map #t #t
+     */
+    IDIO_USER_TYPE_ASSERT (array, a);
+    /*
+     * Test Case: array-errors/array-map-bad-func-type.idio
+     *
+     * array-map #[] #t
+     */
+    IDIO_USER_TYPE_ASSERT (function, func);
+
+    IDIO r = idio_array_dv (IDIO_ARRAY_USIZE (a), IDIO_ARRAY_DV (a));
+
+    /*
+     * func can provoke a GC and nothing else knows about r
+     */
+    IDIO_GC_ROOT_FRAME (rf, &a, &func, &r);
+
+    /*
+     * func might modify a so re-check its length each time around
+     */
+    idio_ai_t ai;
+    for (ai = 0; ai < (idio_ai_t) IDIO_ARRAY_USIZE (a); ai++) {
+	IDIO v = idio_vm_invoke_C_argv (func, 1, &IDIO_ARRAY_AE (a, ai));
+	idio_array_insert_index (r, v, ai);
+    }
+
+    idio_gc_root_frame_pop (&rf);
+
+    return r;
+}
+
+IDIO_DEFINE_PRIMITIVE2_DS ("array-filter", array_filter, (IDIO a, IDIO func), "a func", "\
+return a new array of the elements of `a` for	\n\
+which `func` does not return ``#f``		\n\
+						\n\
+:param a: the array				\n\
+:type a: array					\n\
+:param func: func to be called with each value	\n\
+:type func: 1-ary function			\n\
+:return: the new array				\n\
+:rtype: array					\n\
+")
+{
+    IDIO_ASSERT (a);
+    IDIO_ASSERT (func);
+
+    /*
+     * Test Case: array-errors/array-filter-bad-array-type.idio
+     *
+     * array-filter #t #t
+     */
+    IDIO_USER_TYPE_ASSERT (array, a);
+    /*
+     * Test Case: array-errors/array-filter-bad-func-type.idio
+     *
+     * array-filter #[] #t
+     */
+    IDIO_USER_TYPE_ASSERT (function, func);
+
+    IDIO r = idio_array_dv (IDIO_ARRAY_USIZE (a), IDIO_ARRAY_DV (a));
+
+    /*
+     * func can provoke a GC and nothing else knows about r
+     */
+    IDIO_GC_ROOT_FRAME (rf, &a, &func, &r);
+
+    idio_ai_t ai;
+    for (ai = 0; ai < (idio_ai_t) IDIO_ARRAY_USIZE (a); ai++) {
+	IDIO v = IDIO_ARRAY_AE (a, ai);
+	if (idio_S_false != idio_vm_invoke_C_argv (func, 1, &v)) {
+	    idio_array_push (r, v);
+	}
+    }
+
+    idio_gc_root_frame_pop (&rf);
+
+    return r;
+}
+
 char *idio_array_report_string (IDIO v, size_t *sizep, idio_unicode_t format, IDIO seen, int depth)
 {
     IDIO_ASSERT (v);
@@ -1686,6 +2160,12 @@ void idio_array_add_primitives ()
     IDIO_ADD_PRIMITIVE (array2list);
     IDIO_ADD_PRIMITIVE (array_for_each_set);
     IDIO_ADD_PRIMITIVE (fold_array);
+    IDIO_ADD_PRIMITIVE (array_slice);
+    IDIO_ADD_PRIMITIVE (array_append);
+    IDIO_ADD_PRIMITIVE (array_copy_into);
+    IDIO_ADD_PRIMITIVE (array_nreverse);
+    IDIO_ADD_PRIMITIVE (array_map);
+    IDIO_ADD_PRIMITIVE (array_filter);
 }
 
 void idio_init_array ()
@@ -354,7 +354,6 @@ void idio_bignum_dump (IDIO bn)
 IDIO idio_bignum (int flags, IDIO_BE_T exp, IDIO_BSA sig_a)
 {
     IDIO o = idio_gc_get (IDIO_TYPE_BIGNUM);
-    o->vtable = idio_vtable (IDIO_TYPE_BIGNUM);
 
     IDIO_BIGNUM_FLAGS (o) = flags;
     IDIO_BIGNUM_EXP (o) = exp;
@@ -314,6 +314,7 @@ IDIO idio_bignum_add (IDIO a, IDIO b);
 int idio_bignum_zero_p (IDIO a);
 int idio_bignum_lt_p (IDIO a, IDIO b);
 int idio_bignum_equal_p (IDIO a, IDIO b);
+int idio_bignum_real_lt_p (IDIO a, IDIO b);
 IDIO idio_bignum_subtract (IDIO a, IDIO b);
 IDIO idio_bignum_shift_left (IDIO a, int fill);
 IDIO idio_bignum_shift_right (IDIO a);
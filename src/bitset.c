@@ -110,7 +110,6 @@ static void idio_bitset_size_mismatch_error (size_t const s1, size_t const s2, I
 IDIO idio_bitset (size_t const size)
 {
     IDIO bs = idio_gc_get (IDIO_TYPE_BITSET);
-    bs->vtable = idio_vtable (IDIO_TYPE_BITSET);
 
     IDIO_BITSET_SIZE (bs) = size;
     bs->u.bitset.words = NULL;
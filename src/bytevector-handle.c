@@ -0,0 +1,714 @@
+/*
+ * Copyright (c) 2020-2022 Ian Fitchet <idf(at)idio-lang.org>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License.  You
+ * may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/*
+ * bytevector-handle.c
+ *
+ * Binary I/O: handles over bytevectors and bulk reads and writes of
+ * bytevectors to any handle.
+ *
+ * An input bytevector handle reads from the bytevector itself rather
+ * than a copy so the contents should not be modified whilst reading.
+ */
+
+#define _GNU_SOURCE
+
+#include <sys/types.h>
+
+#include <assert.h>
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "idio-config.h"
+
+#include "gc.h"
+#include "idio.h"
+
+#include "bytevector.h"
+#include "bytevector-handle.h"
+#include "error.h"
+#include "evaluate.h"
+#include "file-handle.h"
+#include "fixnum.h"
+#include "handle.h"
+#include "idio-string.h"
+#include "pair.h"
+#include "unicode.h"
+#include "util.h"
+#include "vm.h"
+
+static size_t idio_bytevector_handle_instance = 1;
+
+#define IDIO_BYTEVECTOR_HANDLE_DEFAULT_OUTPUT_SIZE	256
+
+static idio_handle_methods_t idio_bytevector_handle_methods = {
+    idio_free_bytevector_handle,
+    idio_readyp_bytevector_handle,
+    idio_getb_bytevector_handle,
+    idio_eofp_bytevector_handle,
+    idio_close_bytevector_handle,
+    idio_putb_bytevector_handle,
+    idio_putc_bytevector_handle,
+    idio_puts_bytevector_handle,
+    idio_flush_bytevector_handle,
+    idio_seek_bytevector_handle,
+    idio_print_bytevector_handle
+};
+
+static IDIO idio_open_bytevector_handle (IDIO bv, uint8_t *buf, size_t const blen, int bflags)
+{
+    IDIO_ASSERT (bv);
+
+    idio_bytevector_handle_stream_t *bhsp = idio_alloc (sizeof (idio_bytevector_handle_stream_t));
+
+    IDIO_BYTEVECTOR_HANDLE_STREAM_BV (bhsp) = bv;
+    IDIO_BYTEVECTOR_HANDLE_STREAM_BUF (bhsp) = buf;
+    IDIO_BYTEVECTOR_HANDLE_STREAM_BLEN (bhsp) = blen;
+    IDIO_BYTEVECTOR_HANDLE_STREAM_PTR (bhsp) = 0;
+
+    if (bflags & IDIO_HANDLE_FLAG_WRITE) {
+	IDIO_BYTEVECTOR_HANDLE_STREAM_END (bhsp) = 0;
+    } else {
+	IDIO_BYTEVECTOR_HANDLE_STREAM_END (bhsp) = IDIO_BYTEVECTOR_LEN (bv);
+    }
+
+    IDIO_BYTEVECTOR_HANDLE_STREAM_EOF (bhsp) = 0;
+
+    IDIO bvh = idio_handle ();
+
+    IDIO_HANDLE_FLAGS (bvh) |= bflags | IDIO_HANDLE_FLAG_BYTEVECTOR;
+
+    char name[BUFSIZ];
+    size_t name_len = idio_snprintf (name, BUFSIZ, "%s bytevector-handle #%zu",
+				     (bflags & IDIO_HANDLE_FLAG_WRITE) ? "output" : "input",
+				     idio_bytevector_handle_instance++);
+
+    IDIO_HANDLE_FILENAME (bvh) = idio_string_C_len (name, name_len);
+    IDIO_HANDLE_PATHNAME (bvh) = IDIO_HANDLE_FILENAME (bvh);
+    IDIO_HANDLE_STREAM (bvh) = bhsp;
+    IDIO_HANDLE_METHODS (bvh) = &idio_bytevector_handle_methods;
+
+    return bvh;
+}
+
+IDIO idio_open_input_bytevector_handle (IDIO bv)
+{
+    IDIO_ASSERT (bv);
+
+    IDIO_TYPE_ASSERT (bytevector, bv);
+
+    return idio_open_bytevector_handle (bv, NULL, 0, IDIO_HANDLE_FLAG_READ);
+}
+
+IDIO idio_open_output_bytevector_handle ()
+{
+    uint8_t *buf = idio_alloc (IDIO_BYTEVECTOR_HANDLE_DEFAULT_OUTPUT_SIZE);
+
+    /*
+     * buf will be freed when the handle is freed
+     */
+
+    return idio_open_bytevector_handle (idio_S_nil, buf, IDIO_BYTEVECTOR_HANDLE_DEFAULT_OUTPUT_SIZE, IDIO_HANDLE_FLAG_WRITE);
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("open-input-bytevector", open_input_bytevector_handle, (IDIO bv), "bv", "\
+create an input bytevector handle from `bv`	\n\
+						\n\
+:param bv: contents of input bytevector handle	\n\
+:type bv: bytevector				\n\
+:return: input bytevector handle		\n\
+:rtype: handle					\n\
+						\n\
+The bytes of `bv` are not copied.		\n\
+")
+{
+    IDIO_ASSERT (bv);
+
+    /*
+     * Test Case: bytevector-errors/open-input-bytevector-bad-type.idio
+     *
+     * open-input-bytevector #t
+     */
+    IDIO_USER_TYPE_ASSERT (bytevector, bv);
+
+    return idio_open_input_bytevector_handle (bv);
+}
+
+IDIO_DEFINE_PRIMITIVE0_DS ("open-output-bytevector", open_output_bytevector_handle, (void), "", "\
+create an output bytevector handle		\n\
+						\n\
+:return: output bytevector handle		\n\
+:rtype: handle					\n\
+")
+{
+    return idio_open_output_bytevector_handle ();
+}
+
+int idio_isa_bytevector_handle (IDIO o)
+{
+    IDIO_ASSERT (o);
+
+    return (idio_isa_handle (o) &&
+	    IDIO_HANDLE_FLAGS (o) & IDIO_HANDLE_FLAG_BYTEVECTOR);
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("bytevector-handle?", bytevector_handlep, (IDIO o), "o", "\
+test if `o` is a bytevector handle		\n\
+						\n\
+:param o: object to test			\n\
+:return: ``#t`` if `o` is a bytevector handle, ``#f`` otherwise	\n\
+")
+{
+    IDIO_ASSERT (o);
+
+    IDIO r = idio_S_false;
+
+    if (idio_isa_bytevector_handle (o)) {
+	r = idio_S_true;
+    }
+
+    return r;
+}
+
+static int idio_input_bytevector_handlep (IDIO o)
+{
+    IDIO_ASSERT (o);
+
+    return (idio_isa_bytevector_handle (o) &&
+	    IDIO_INPUTP_HANDLE (o));
+}
+
+static int idio_output_bytevector_handlep (IDIO o)
+{
+    IDIO_ASSERT (o);
+
+    return (idio_isa_bytevector_handle (o) &&
+	    IDIO_OUTPUTP_HANDLE (o));
+}
+
+void idio_free_bytevector_handle (IDIO bvh)
+{
+    IDIO_ASSERT (bvh);
+
+    if (NULL != IDIO_BYTEVECTOR_HANDLE_BUF (bvh)) {
+	idio_free (IDIO_BYTEVECTOR_HANDLE_BUF (bvh));
+    }
+    idio_free (IDIO_HANDLE_STREAM (bvh));
+}
+
+int idio_readyp_bytevector_handle (IDIO bvh)
+{
+    IDIO_ASSERT (bvh);
+
+    if (IDIO_CLOSEDP_HANDLE (bvh)) {
+	/*
+	 * Test Case: bytevector-errors/ready-handlep-closed-handle.idio
+	 *
+	 * bvh := open-input-bytevector (make-bytevector 1)
+	 * close-handle bvh
+	 * ready-handle? bvh
+	 */
+	idio_handle_closed_error (bvh, IDIO_C_FUNC_LOCATION ());
+
+	/* notreached */
+	return 0;
+    }
+
+    return (idio_eofp_bytevector_handle (bvh) == 0);
+}
+
+int idio_getb_bytevector_handle (IDIO bvh)
+{
+    IDIO_ASSERT (bvh);
+
+    if (! idio_input_bytevector_handlep (bvh)) {
+	/*
+	 * Test Case: ??
+	 *
+	 * We don't expose the getb method
+	 */
+	idio_handle_read_error (bvh, IDIO_C_FUNC_LOCATION ());
+
+	/* notreached */
+	return EOF;
+    }
+
+    if (IDIO_BYTEVECTOR_HANDLE_PTR (bvh) < IDIO_BYTEVECTOR_HANDLE_END (bvh)) {
+	IDIO bv = IDIO_BYTEVECTOR_HANDLE_BV (bvh);
+	int c = IDIO_BYTEVECTOR_DATA (bv)[IDIO_BYTEVECTOR_HANDLE_PTR (bvh)];
+	IDIO_BYTEVECTOR_HANDLE_PTR (bvh) += 1;
+	return c;
+    } else {
+	IDIO_BYTEVECTOR_HANDLE_EOF (bvh) = 1;
+	return EOF;
+    }
+}
+
+int idio_eofp_bytevector_handle (IDIO bvh)
+{
+    IDIO_ASSERT (bvh);
+
+    IDIO_TYPE_ASSERT (bytevector_handle, bvh);
+
+    return IDIO_BYTEVECTOR_HANDLE_EOF (bvh);
+}
+
+int idio_close_bytevector_handle (IDIO bvh)
+{
+    IDIO_ASSERT (bvh);
+
+    IDIO_TYPE_ASSERT (bytevector_handle, bvh);
+
+    IDIO_HANDLE_FLAGS (bvh) |= IDIO_HANDLE_FLAG_CLOSED;
+
+    return 0;
+}
+
+ptrdiff_t idio_puts_bytevector_handle (IDIO bvh, char const *s, size_t const slen)
+{
+    IDIO_ASSERT (bvh);
+
+    if (! idio_output_bytevector_handlep (bvh)) {
+	/*
+	 * Test Case: ??
+	 *
+	 * idio_handle_or_current() does the output test for us
+	 */
+	idio_handle_write_error (bvh, IDIO_C_FUNC_LOCATION ());
+
+	/* notreached */
+	return EOF;
+    }
+
+    size_t ptr = IDIO_BYTEVECTOR_HANDLE_PTR (bvh);
+
+    if ((ptr + slen) > IDIO_BYTEVECTOR_HANDLE_BLEN (bvh)) {
+	size_t blen = IDIO_BYTEVECTOR_HANDLE_BLEN (bvh);
+	blen += blen / 2;	/* 50% more */
+	if (blen < (ptr + slen)) {
+	    blen = ptr + slen;
+	}
+
+	IDIO_BYTEVECTOR_HANDLE_BUF (bvh) = idio_realloc (IDIO_BYTEVECTOR_HANDLE_BUF (bvh), blen);
+	IDIO_BYTEVECTOR_HANDLE_BLEN (bvh) = blen;
+    }
+
+    memcpy (IDIO_BYTEVECTOR_HANDLE_BUF (bvh) + ptr, s, slen);
+    ptr += slen;
+    IDIO_BYTEVECTOR_HANDLE_PTR (bvh) = ptr;
+    if (ptr > IDIO_BYTEVECTOR_HANDLE_END (bvh)) {
+	IDIO_BYTEVECTOR_HANDLE_END (bvh) = ptr;
+    }
+
+    return slen;
+}
+
+int idio_putb_bytevector_handle (IDIO bvh, uint8_t c)
+{
+    IDIO_ASSERT (bvh);
+
+    return idio_puts_bytevector_handle (bvh, (char const *) &c, 1);
+}
+
+int idio_putc_bytevector_handle (IDIO bvh, idio_unicode_t c)
+{
+    IDIO_ASSERT (bvh);
+
+    char buf[4];
+    int size;
+    idio_utf8_code_point (c, buf, &size);
+
+    return idio_puts_bytevector_handle (bvh, buf, size);
+}
+
+int idio_flush_bytevector_handle (IDIO bvh)
+{
+    IDIO_ASSERT (bvh);
+
+    IDIO_TYPE_ASSERT (bytevector_handle, bvh);
+
+    return 0;
+}
+
+off_t idio_seek_bytevector_handle (IDIO bvh, off_t offset, int whence)
+{
+    IDIO_ASSERT (bvh);
+
+    IDIO_TYPE_ASSERT (bytevector_handle, bvh);
+
+    off_t pos;
+
+    switch (whence) {
+    case SEEK_SET:
+	pos = offset;
+	break;
+    case SEEK_CUR:
+	/*
+	 * Code coverage:
+	 *
+	 * seek-handle will rewrite SEEK_CUR into a SEEK_SET.
+	 */
+	pos = IDIO_BYTEVECTOR_HANDLE_PTR (bvh) + offset;
+	break;
+    case SEEK_END:
+	pos = IDIO_BYTEVECTOR_HANDLE_END (bvh) + offset;
+	break;
+    default:
+	/*
+	 * Test Case: ??
+	 *
+	 * seek-handle should have protected us leaving a coding error
+	 */
+	idio_error_printf (IDIO_C_FUNC_LOCATION (), "idio_seek_bytevector_handle: unexpected whence %d", whence);
+	return -1;
+    }
+
+    if (pos >= 0 &&
+	(size_t) pos <= IDIO_BYTEVECTOR_HANDLE_END (bvh)) {
+	IDIO_BYTEVECTOR_HANDLE_EOF (bvh) = 0;
+	IDIO_BYTEVECTOR_HANDLE_PTR (bvh) = pos;
+	return pos;
+    } else {
+	return -1;
+    }
+}
+
+/*
+ * Code coverage:
+ *
+ * We don't expose the print method.
+ */
+void idio_print_bytevector_handle (IDIO bvh, IDIO o)
+{
+    IDIO_ASSERT (bvh);
+
+    size_t size = 0;
+    char *os = idio_display_string (o, &size);
+    idio_puts_bytevector_handle (bvh, os, size);
+    idio_puts_bytevector_handle (bvh, "\n", 1);
+
+    IDIO_GC_FREE (os, size);
+}
+
+IDIO idio_get_output_bytevector (IDIO bvh)
+{
+    IDIO_ASSERT (bvh);
+
+    IDIO_TYPE_ASSERT (bytevector_handle, bvh);
+
+    return idio_bytevector_C ((char const *) IDIO_BYTEVECTOR_HANDLE_BUF (bvh), IDIO_BYTEVECTOR_HANDLE_END (bvh));
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("get-output-bytevector", get_output_bytevector, (IDIO bvh), "bvh", "\
+return the accumulated bytes in output		\n\
+bytevector handle `bvh`				\n\
+						\n\
+:param bvh: output bytevector handle		\n\
+:type bvh: output bytevector handle		\n\
+:return: accumulated bytes			\n\
+:rtype: bytevector				\n\
+")
+{
+    IDIO_ASSERT (bvh);
+
+    if (! idio_output_bytevector_handlep (bvh)) {
+	/*
+	 * Test Case: bytevector-errors/get-output-bytevector-bad-type.idio
+	 *
+	 * get-output-bytevector #t
+	 */
+	idio_error_param_type ("output bytevector handle", bvh, IDIO_C_FUNC_LOCATION ());
+
+	return idio_S_notreached;
+    }
+
+    return idio_get_output_bytevector (bvh);
+}
+
+/*
+ * idio_bytevector_handle_read() reads up to len bytes from h into buf
+ * returning the number read which is only less than len at
+ * end-of-file.
+ *
+ * func and param name the caller's argument limiting len should a
+ * peeked character not fit.
+ *
+ * Bytevector and file descriptor handles are copied into buf in bulk
+ * and everything else a byte at a time.
+ */
+static size_t idio_bytevector_handle_read (IDIO h, uint8_t *buf, size_t const len, char const *func, char const *param)
+{
+    IDIO_ASSERT (h);
+
+    if (IDIO_CLOSEDP_HANDLE (h)) {
+	/*
+	 * Test Case: bytevector-errors/read-bytevector-closed-handle.idio
+	 *
+	 * bvh := open-input-bytevector (make-bytevector 1)
+	 * close-handle bvh
+	 * read-bytevector 1 bvh
+	 */
+	idio_handle_closed_error (h, IDIO_C_FUNC_LOCATION ());
+
+	/* notreached */
+	return 0;
+    }
+
+    size_t n = 0;
+
+    if (0 == len) {
+	return 0;
+    }
+
+    /*
+     * A peeked character is returned as its UTF-8 bytes.  There is
+     * nowhere to keep any bytes that do not fit so the character is
+     * left peeked and we complain.
+     */
+    int lc = IDIO_HANDLE_LC (h);
+    if (EOF != lc) {
+	char u[4];
+	int size;
+	idio_utf8_code_point (lc, u, &size);
+
+	if ((size_t) size > len) {
+	    /*
+	     * Test Case: bytevector-errors/read-bytevector-peeked-char.idio
+	     *
+	     * sh := open-input-string "\u00e9"
+	     * peek-char sh
+	     * read-bytevector 1 sh
+	     */
+	    idio_error_param_value_msg_only (func, param, "too small for the peeked character", IDIO_C_FUNC_LOCATION ());
+
+	    /* notreached */
+	    return 0;
+	}
+
+	IDIO_HANDLE_LC (h) = EOF;
+	n = size;
+	memcpy (buf, u, n);
+    }
+
+    if (idio_isa_bytevector_handle (h)) {
+	size_t avail = IDIO_BYTEVECTOR_HANDLE_END (h) - IDIO_BYTEVECTOR_HANDLE_PTR (h);
+	size_t want = len - n;
+	if (want > avail) {
+	    want = avail;
+	    IDIO_BYTEVECTOR_HANDLE_EOF (h) = 1;
+	}
+	if (want) {
+	    memcpy (buf + n, IDIO_BYTEVECTOR_DATA (IDIO_BYTEVECTOR_HANDLE_BV (h)) + IDIO_BYTEVECTOR_HANDLE_PTR (h), want);
+	    IDIO_BYTEVECTOR_HANDLE_PTR (h) += want;
+	    n += want;
+	}
+    } else if (idio_isa_fd_handle (h)) {
+	n += idio_file_handle_read_into (h, buf + n, len - n);
+    } else {
+	/*
+	 * getb returns EOF for a 0xff byte from some handles so
+	 * check the handle's EOF state instead
+	 */
+	while (n < len) {
+	    int c = IDIO_HANDLE_M_GETB (h) (h);
+	    if (idio_eofp_handle (h)) {
+		break;
+	    }
+	    buf[n++] = c;
+	}
+    }
+
+    IDIO_HANDLE_POS (h) += n;
+
+    return n;
+}
+
+IDIO_DEFINE_PRIMITIVE1V_DS ("read-bytevector", read_bytevector, (IDIO k, IDIO args), "k [handle]", "\
+read up to `k` bytes from `handle`		\n\
+						\n\
+:param k: number of bytes to read		\n\
+:type k: integer				\n\
+:param handle: handle to read from, defaults to the current input handle	\n\
+:type handle: input handle, optional		\n\
+:return: bytevector or ``#<eof>``		\n\
+						\n\
+Fewer than `k` bytes are returned at end-of-file.	\n\
+``#<eof>`` is returned if no bytes are available.	\n\
+")
+{
+    IDIO_ASSERT (k);
+    IDIO_ASSERT (args);
+
+    ptrdiff_t C_k = idio_bytevector_C_index (k);
+    if (C_k < 0 ||
+	(uintmax_t) C_k > IDIO_BYTEVECTOR_MAX_LEN) {
+	/*
+	 * Test Case: bytevector-errors/read-bytevector-negative-count.idio
+	 *
+	 * read-bytevector -1
+	 */
+	idio_error_param_value_msg ("read-bytevector", "k", k, "should be a non-negative 32-bit integer", IDIO_C_FUNC_LOCATION ());
+
+	return idio_S_notreached;
+    }
+
+    /*
+     * Test Case: bytevector-errors/read-bytevector-bad-handle.idio
+     *
+     * read-bytevector 1 #t
+     */
+    IDIO h = idio_handle_or_current (idio_list_head (args), IDIO_HANDLE_FLAG_READ);
+
+    IDIO bv = idio_bytevector (C_k);
+    size_t n = idio_bytevector_handle_read (h, IDIO_BYTEVECTOR_DATA (bv), C_k, "read-bytevector", "k");
+
+    if (0 == n &&
+	C_k) {
+	return idio_S_eof;
+    }
+
+    if (n < (size_t) C_k) {
+	idio_bytevector_resize_C (bv, n);
+    }
+
+    return bv;
+}
+
+IDIO_DEFINE_PRIMITIVE1V_DS ("read-bytevector!", read_bytevector_into, (IDIO bv, IDIO args), "bv [handle [start [end]]]", "\
+read bytes from `handle` into bytevector `bv`	\n\
+from `start` up to `end`			\n\
+						\n\
+:param bv: bytevector to read into		\n\
+:type bv: bytevector				\n\
+:param handle: handle to read from, defaults to the current input handle	\n\
+:type handle: input handle, optional		\n\
+:param start: first index, defaults to 0	\n\
+:type start: integer, optional			\n\
+:param end: index after the last, defaults to the length of `bv`	\n\
+:type end: integer, optional			\n\
+:return: number of bytes read or ``#<eof>``	\n\
+")
+{
+    IDIO_ASSERT (bv);
+    IDIO_ASSERT (args);
+
+    /*
+     * Test Case: bytevector-errors/read-bytevector-into-bad-type.idio
+     *
+     * read-bytevector! #t
+     */
+    IDIO_USER_TYPE_ASSERT (bytevector, bv);
+    /*
+     * Test Case: n/a
+     *
+     * args is the varargs parameter -- should always be a list
+     */
+    IDIO_USER_TYPE_ASSERT (list, args);
+
+    IDIO h = idio_handle_or_current (idio_list_head (args), IDIO_HANDLE_FLAG_READ);
+
+    size_t start;
+    size_t end;
+    idio_bytevector_range (bv, idio_S_nil == args ? idio_S_nil : IDIO_PAIR_T (args), &start, &end, "read-bytevector!");
+
+    if (start == end) {
+	return idio_fixnum (0);
+    }
+
+    size_t n = idio_bytevector_handle_read (h, IDIO_BYTEVECTOR_DATA (bv) + start, end - start, "read-bytevector!", "bv");
+
+    if (0 == n) {
+	return idio_S_eof;
+    }
+
+    return idio_integer (n);
+}
+
+IDIO_DEFINE_PRIMITIVE1V_DS ("write-bytevector", write_bytevector, (IDIO bv, IDIO args), "bv [handle [start [end]]]", "\
+write the bytes of bytevector `bv` from `start`	\n\
+up to `end` to `handle`				\n\
+						\n\
+:param bv: bytevector to write			\n\
+:type bv: bytevector				\n\
+:param handle: handle to write to, defaults to the current output handle	\n\
+:type handle: output handle, optional		\n\
+:param start: first index, defaults to 0	\n\
+:type start: integer, optional			\n\
+:param end: index after the last, defaults to the length of `bv`	\n\
+:type end: integer, optional			\n\
+:return: ``#<unspec>``				\n\
+")
+{
+    IDIO_ASSERT (bv);
+    IDIO_ASSERT (args);
+
+    /*
+     * Test Case: bytevector-errors/write-bytevector-bad-type.idio
+     *
+     * write-bytevector #t
+     */
+    IDIO_USER_TYPE_ASSERT (bytevector, bv);
+    /*
+     * Test Case: n/a
+     *
+     * args is the varargs parameter -- should always be a list
+     */
+    IDIO_USER_TYPE_ASSERT (list, args);
+
+    /*
+     * Test Case: bytevector-errors/write-bytevector-bad-handle.idio
+     *
+     * write-bytevector (make-bytevector 1) (current-input-handle)
+     */
+    IDIO h = idio_handle_or_current (idio_list_head (args), IDIO_HANDLE_FLAG_WRITE);
+
+    size_t start;
+    size_t end;
+    idio_bytevector_range (bv, idio_S_nil == args ? idio_S_nil : IDIO_PAIR_T (args), &start, &end, "write-bytevector");
+
+    if (end > start) {
+	idio_puts_handle (h, (char const *) IDIO_BYTEVECTOR_DATA (bv) + start, end - start);
+    }
+
+    return idio_S_unspec;
+}
+
+void idio_bytevector_handle_add_primitives ()
+{
+    IDIO_ADD_PRIMITIVE (open_input_bytevector_handle);
+    IDIO_ADD_PRIMITIVE (open_output_bytevector_handle);
+    IDIO_ADD_PRIMITIVE (get_output_bytevector);
+    IDIO_ADD_PRIMITIVE (bytevector_handlep);
+    IDIO_ADD_PRIMITIVE (read_bytevector);
+    IDIO_ADD_PRIMITIVE (read_bytevector_into);
+    IDIO_ADD_PRIMITIVE (write_bytevector);
+}
+
+void idio_init_bytevector_handle ()
+{
+    idio_module_table_register (idio_bytevector_handle_add_primitives, NULL, NULL);
+}
+
+/* Local Variables: */
+/* mode: C */
+/* coding: utf-8-unix */
+/* End: */
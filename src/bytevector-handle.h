@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2020-2022 Ian Fitchet <idf(at)idio-lang.org>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License.  You
+ * may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/*
+ * bytevector-handle.h
+ *
+ */
+
+#ifndef BYTEVECTOR_HANDLE_H
+#define BYTEVECTOR_HANDLE_H
+
+/*
+ * An input bytevector handle reads directly from bv, which the GC
+ * must therefore mark.  An output bytevector handle has bv #n and
+ * accumulates into buf.
+ */
+typedef struct idio_bytevector_handle_stream_s {
+    struct idio_s *bv;		/* input bytevector */
+    uint8_t *buf;		/* output buffer */
+    size_t blen;
+    size_t ptr;			/* offset into data */
+    size_t end;			/* offset of end of data */
+    char eof;			/* EOF flag */
+} idio_bytevector_handle_stream_t;
+
+#define IDIO_BYTEVECTOR_HANDLE_STREAM_BV(S)   ((S)->bv)
+#define IDIO_BYTEVECTOR_HANDLE_STREAM_BUF(S)  ((S)->buf)
+#define IDIO_BYTEVECTOR_HANDLE_STREAM_BLEN(S) ((S)->blen)
+#define IDIO_BYTEVECTOR_HANDLE_STREAM_PTR(S)  ((S)->ptr)
+#define IDIO_BYTEVECTOR_HANDLE_STREAM_END(S)  ((S)->end)
+#define IDIO_BYTEVECTOR_HANDLE_STREAM_EOF(S)  ((S)->eof)
+
+#define IDIO_BYTEVECTOR_HANDLE_BV(H)   IDIO_BYTEVECTOR_HANDLE_STREAM_BV((idio_bytevector_handle_stream_t *) IDIO_HANDLE_STREAM(H))
+#define IDIO_BYTEVECTOR_HANDLE_BUF(H)  IDIO_BYTEVECTOR_HANDLE_STREAM_BUF((idio_bytevector_handle_stream_t *) IDIO_HANDLE_STREAM(H))
+#define IDIO_BYTEVECTOR_HANDLE_BLEN(H) IDIO_BYTEVECTOR_HANDLE_STREAM_BLEN((idio_bytevector_handle_stream_t *) IDIO_HANDLE_STREAM(H))
+#define IDIO_BYTEVECTOR_HANDLE_PTR(H)  IDIO_BYTEVECTOR_HANDLE_STREAM_PTR((idio_bytevector_handle_stream_t *) IDIO_HANDLE_STREAM(H))
+#define IDIO_BYTEVECTOR_HANDLE_END(H)  IDIO_BYTEVECTOR_HANDLE_STREAM_END((idio_bytevector_handle_stream_t *) IDIO_HANDLE_STREAM(H))
+#define IDIO_BYTEVECTOR_HANDLE_EOF(H)  IDIO_BYTEVECTOR_HANDLE_STREAM_EOF((idio_bytevector_handle_stream_t *) IDIO_HANDLE_STREAM(H))
+
+IDIO idio_open_input_bytevector_handle (IDIO bv);
+IDIO idio_open_output_bytevector_handle ();
+void idio_free_bytevector_handle (IDIO bvh);
+int idio_readyp_bytevector_handle (IDIO bvh);
+int idio_getb_bytevector_handle (IDIO bvh);
+int idio_eofp_bytevector_handle (IDIO bvh);
+int idio_close_bytevector_handle (IDIO bvh);
+int idio_putb_bytevector_handle (IDIO bvh, uint8_t c);
+int idio_putc_bytevector_handle (IDIO bvh, idio_unicode_t c);
+ptrdiff_t idio_puts_bytevector_handle (IDIO bvh, char const *s, size_t slen);
+int idio_flush_bytevector_handle (IDIO bvh);
+off_t idio_seek_bytevector_handle (IDIO bvh, off_t offset, int whence);
+void idio_print_bytevector_handle (IDIO bvh, IDIO o);
+
+int idio_isa_bytevector_handle (IDIO o);
+IDIO idio_get_output_bytevector (IDIO bvh);
+
+void idio_init_bytevector_handle ();
+
+#endif
+
+/* Local Variables: */
+/* mode: C */
+/* coding: utf-8-unix */
+/* End: */
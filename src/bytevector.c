@@ -0,0 +1,1549 @@
+/*
+ * Copyright (c) 2020-2022 Ian Fitchet <idf(at)idio-lang.org>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License.  You
+ * may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/*
+ * bytevector.c
+ *
+ * Bytevectors: mutable runs of bytes for binary data.
+ *
+ * An octet string is still a string: it is immutable in practice and
+ * substring and friends make copies.  A bytevector can be modified in
+ * place and bytevector-slice returns a view onto the same bytes, not
+ * a copy.
+ *
+ * The multi-byte accessors take an optional endianness, big or
+ * little, defaulting to big, network byte order.  They assemble the
+ * value a byte at a time so the index need not be aligned.
+ */
+
+#define _GNU_SOURCE
+
+#include <sys/types.h>
+
+#include <assert.h>
+#include <inttypes.h>
+#include <limits.h>
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "idio-config.h"
+
+#include "gc.h"
+#include "idio.h"
+
+#include "bignum.h"
+#include "bytevector.h"
+#include "c-type.h"
+#include "error.h"
+#include "evaluate.h"
+#include "fixnum.h"
+#include "hash.h"
+#include "idio-string.h"
+#include "pair.h"
+#include "symbol.h"
+#include "util.h"
+#include "vm.h"
+#include "vtable.h"
+
+IDIO idio_bytevector (size_t const len)
+{
+    IDIO bv = idio_gc_get (IDIO_TYPE_BYTEVECTOR);
+
+    IDIO_BYTEVECTOR_PARENT (bv) = idio_S_nil;
+    IDIO_BYTEVECTOR_LEN (bv) = len;
+    IDIO_BYTEVECTOR_DATA (bv) = NULL;
+
+    if (len) {
+	IDIO_GC_ALLOC (IDIO_BYTEVECTOR_DATA (bv), len);
+	memset (IDIO_BYTEVECTOR_DATA (bv), 0, len);
+    }
+
+    return bv;
+}
+
+IDIO idio_bytevector_C (char const *s, size_t const len)
+{
+    IDIO_C_ASSERT (s);
+
+    IDIO bv = idio_bytevector (len);
+
+    if (len) {
+	memcpy (IDIO_BYTEVECTOR_DATA (bv), s, len);
+    }
+
+    return bv;
+}
+
+/*
+ * idio_bytevector_slice_C() returns a view of bytes [start, end) of
+ * bv.  A slice of a slice refers back to the owner of the bytes.
+ */
+IDIO idio_bytevector_slice_C (IDIO bv, size_t const start, size_t const end)
+{
+    IDIO_ASSERT (bv);
+    IDIO_TYPE_ASSERT (bytevector, bv);
+
+    IDIO_C_ASSERT (start <= end);
+    IDIO_C_ASSERT (end <= IDIO_BYTEVECTOR_LEN (bv));
+
+    IDIO parent = IDIO_BYTEVECTOR_PARENT (bv);
+    if (idio_S_nil == parent) {
+	parent = bv;
+    }
+
+    IDIO r = idio_gc_get (IDIO_TYPE_BYTEVECTOR);
+
+    IDIO_BYTEVECTOR_PARENT (r) = parent;
+    IDIO_BYTEVECTOR_LEN (r) = end - start;
+    IDIO_BYTEVECTOR_DATA (r) = IDIO_BYTEVECTOR_DATA (bv) + start;
+
+    return r;
+}
+
+/*
+ * idio_bytevector_resize_C() is for C code building a bytevector of
+ * unknown size, zlib output, say.  bv must not have been sliced as
+ * the bytes may move.
+ */
+void idio_bytevector_resize_C (IDIO bv, size_t const len)
+{
+    IDIO_ASSERT (bv);
+    IDIO_TYPE_ASSERT (bytevector, bv);
+
+    IDIO_C_ASSERT (idio_S_nil == IDIO_BYTEVECTOR_PARENT (bv));
+    IDIO_C_ASSERT (len <= IDIO_BYTEVECTOR_MAX_LEN);
+
+    if (0 == len) {
+	IDIO_GC_FREE (IDIO_BYTEVECTOR_DATA (bv), IDIO_BYTEVECTOR_LEN (bv));
+	IDIO_BYTEVECTOR_DATA (bv) = NULL;
+    } else {
+	IDIO_GC_REALLOC (IDIO_BYTEVECTOR_DATA (bv), len);
+    }
+
+    IDIO_BYTEVECTOR_LEN (bv) = len;
+}
+
+int idio_isa_bytevector (IDIO o)
+{
+    IDIO_ASSERT (o);
+
+    return idio_isa (o, IDIO_TYPE_BYTEVECTOR);
+}
+
+void idio_free_bytevector (IDIO bv)
+{
+    IDIO_ASSERT (bv);
+    IDIO_TYPE_ASSERT (bytevector, bv);
+
+    if (idio_S_nil == IDIO_BYTEVECTOR_PARENT (bv)) {
+	IDIO_GC_FREE (IDIO_BYTEVECTOR_DATA (bv), IDIO_BYTEVECTOR_LEN (bv));
+    }
+}
+
+IDIO idio_copy_bytevector (IDIO bv)
+{
+    IDIO_ASSERT (bv);
+    IDIO_TYPE_ASSERT (bytevector, bv);
+
+    return idio_bytevector_C ((char const *) IDIO_BYTEVECTOR_DATA (bv), IDIO_BYTEVECTOR_LEN (bv));
+}
+
+int idio_bytevector_equal (IDIO bv1, IDIO bv2)
+{
+    IDIO_ASSERT (bv1);
+    IDIO_ASSERT (bv2);
+    IDIO_TYPE_ASSERT (bytevector, bv1);
+    IDIO_TYPE_ASSERT (bytevector, bv2);
+
+    size_t len = IDIO_BYTEVECTOR_LEN (bv1);
+
+    if (IDIO_BYTEVECTOR_LEN (bv2) != len) {
+	return 0;
+    }
+
+    if (0 == len) {
+	return 1;
+    }
+
+    return (0 == memcmp (IDIO_BYTEVECTOR_DATA (bv1), IDIO_BYTEVECTOR_DATA (bv2), len));
+}
+
+/*
+ * idio_bytevector_hash_C() hashes the bytes of bv for an equal? hash
+ * table so that slices and copies hash the same.
+ */
+idio_hi_t idio_bytevector_hash_C (IDIO bv)
+{
+    IDIO_ASSERT (bv);
+    IDIO_TYPE_ASSERT (bytevector, bv);
+
+    size_t len = IDIO_BYTEVECTOR_LEN (bv);
+
+    if (0 == len) {
+	return idio_hash_default_hash_C_string_C (0, "");
+    }
+
+    return idio_hash_default_hash_C_string_C (len, (char const *) IDIO_BYTEVECTOR_DATA (bv));
+}
+
+/*
+ * idio_bytevector_C_index() converts an Idio integer (or an integral
+ * bignum) into a C index.  The caller checks the bounds.
+ */
+ptrdiff_t idio_bytevector_C_index (IDIO index)
+{
+    IDIO_ASSERT (index);
+
+    if (idio_isa_fixnum (index)) {
+	return IDIO_FIXNUM_VAL (index);
+    } else if (idio_isa_bignum (index)) {
+	if (IDIO_BIGNUM_INTEGER_P (index)) {
+	    /*
+	     * Code coverage: requires a large bytevector
+	     */
+	    return idio_bignum_ptrdiff_t_value (index);
+	} else {
+	    IDIO index_i = idio_bignum_real_to_integer (index);
+	    if (idio_S_nil == index_i) {
+		/*
+		 * Test Case: bytevector-errors/bytevector-u8-ref-float.idio
+		 *
+		 * bytevector-u8-ref (make-bytevector 3) 1.1
+		 */
+		idio_error_param_type ("integer", index, IDIO_C_FUNC_LOCATION ());
+
+		return -1;
+	    } else {
+		return idio_bignum_ptrdiff_t_value (index_i);
+	    }
+	}
+    }
+
+    /*
+     * Test Case: bytevector-errors/bytevector-u8-ref-not-integer.idio
+     *
+     * bytevector-u8-ref (make-bytevector 3) #t
+     */
+    idio_error_param_type ("integer", index, IDIO_C_FUNC_LOCATION ());
+
+    return -1;
+}
+
+/*
+ * idio_bytevector_range() sets *startp and *endp from the optional
+ * [start [end]] in args, defaulting to the whole of bv.
+ */
+void idio_bytevector_range (IDIO bv, IDIO args, size_t *startp, size_t *endp, char const *func)
+{
+    IDIO_ASSERT (bv);
+    IDIO_ASSERT (args);
+    IDIO_C_ASSERT (startp);
+    IDIO_C_ASSERT (endp);
+    IDIO_C_ASSERT (func);
+
+    size_t len = IDIO_BYTEVECTOR_LEN (bv);
+    ptrdiff_t start = 0;
+    ptrdiff_t end = len;
+
+    if (idio_isa_pair (args)) {
+	start = idio_bytevector_C_index (IDIO_PAIR_H (args));
+	args = IDIO_PAIR_T (args);
+	if (idio_isa_pair (args)) {
+	    end = idio_bytevector_C_index (IDIO_PAIR_H (args));
+	}
+    }
+
+    if (start < 0 ||
+	start > end ||
+	(size_t) end > len) {
+	/*
+	 * Test Case: bytevector-errors/bytevector-slice-bad-range.idio
+	 *
+	 * bytevector-slice (make-bytevector 3) 2 1
+	 */
+	char em[BUFSIZ];
+	idio_snprintf (em, BUFSIZ, "range %td-%td is not within 0-%zu", start, end, len);
+	idio_error_param_value_msg_only (func, "start/end", em, IDIO_C_FUNC_LOCATION ());
+
+	return;
+    }
+
+    *startp = start;
+    *endp = end;
+}
+
+/*
+ * idio_bytevector_ref_index() returns the C index of a width byte
+ * element at index in bv.  Negative indexes count back from the end.
+ */
+static size_t idio_bytevector_ref_index (IDIO bv, IDIO index, size_t const width, char const *func)
+{
+    IDIO_ASSERT (bv);
+    IDIO_ASSERT (index);
+    IDIO_C_ASSERT (func);
+
+    ptrdiff_t i = idio_bytevector_C_index (index);
+    ptrdiff_t len = IDIO_BYTEVECTOR_LEN (bv);
+
+    if (i < 0) {
+	i += len;
+    }
+
+    if (i < 0 ||
+	i + (ptrdiff_t) width > len) {
+	/*
+	 * Test Case: bytevector-errors/bytevector-u8-ref-bounds.idio
+	 *
+	 * bytevector-u8-ref (make-bytevector 3) 3
+	 */
+	char em[BUFSIZ];
+	idio_snprintf (em, BUFSIZ, "out of bounds for %zu byte(s) in length %td", width, len);
+	idio_error_param_value_msg (func, "index", index, em, IDIO_C_FUNC_LOCATION ());
+
+	return 0;
+    }
+
+    return i;
+}
+
+/*
+ * idio_bytevector_big_endian() returns 1 for big endian, the default,
+ * or 0 for little endian from the optional endianness in args.
+ */
+static int idio_bytevector_big_endian (IDIO args, char const *func)
+{
+    IDIO_ASSERT (args);
+    IDIO_C_ASSERT (func);
+
+    if (idio_isa_pair (args)) {
+	IDIO endian = IDIO_PAIR_H (args);
+
+	if (idio_S_big == endian) {
+	    return 1;
+	} else if (idio_S_little == endian) {
+	    return 0;
+	}
+
+	/*
+	 * Test Case: bytevector-errors/bytevector-u16-ref-bad-endian.idio
+	 *
+	 * bytevector-u16-ref (make-bytevector 2) 0 'middle
+	 */
+	idio_error_param_value_msg (func, "endian", endian, "should be one of big, little", IDIO_C_FUNC_LOCATION ());
+
+	return 1;
+    }
+
+    return 1;
+}
+
+static uint64_t idio_bytevector_get_bits (uint8_t const *p, size_t const width, int const big)
+{
+    uint64_t v = 0;
+    size_t i;
+
+    if (big) {
+	for (i = 0; i < width; i++) {
+	    v = (v << 8) | p[i];
+	}
+    } else {
+	for (i = width; i > 0; i--) {
+	    v = (v << 8) | p[i - 1];
+	}
+    }
+
+    return v;
+}
+
+static void idio_bytevector_put_bits (uint8_t *p, size_t const width, uint64_t v, int const big)
+{
+    size_t i;
+
+    if (big) {
+	for (i = width; i > 0; i--) {
+	    p[i - 1] = v & 0xff;
+	    v >>= 8;
+	}
+    } else {
+	for (i = 0; i < width; i++) {
+	    p[i] = v & 0xff;
+	    v >>= 8;
+	}
+    }
+}
+
+/*
+ * idio_bytevector_integer_bits() returns the two's complement bits of
+ * integer v checking that it fits in a width byte, possibly signed,
+ * integer called kind.
+ */
+static uint64_t idio_bytevector_integer_bits (IDIO v, size_t const width, int const is_signed, char const *kind, char const *func, char const *param)
+{
+    IDIO_ASSERT (v);
+    IDIO_C_ASSERT (kind);
+    IDIO_C_ASSERT (func);
+    IDIO_C_ASSERT (param);
+
+    int neg = 0;
+    intmax_t i = 0;
+    uintmax_t u = 0;
+
+    if (idio_isa_fixnum (v)) {
+	i = IDIO_FIXNUM_VAL (v);
+	neg = (i < 0);
+	u = i;
+    } else if (idio_isa_bignum (v) &&
+	       IDIO_BIGNUM_INTEGER_P (v)) {
+	if (idio_bignum_negative_p (v)) {
+	    i = idio_bignum_intmax_t_value (v);
+	    neg = 1;
+	    u = i;
+	} else {
+	    u = idio_bignum_uintmax_t_value (v);
+	}
+    } else {
+	/*
+	 * Test Case: bytevector-errors/bytevector-u8-set-not-integer.idio
+	 *
+	 * bytevector-u8-set! (make-bytevector 3) 0 1.5
+	 */
+	idio_error_param_type ("integer", v, IDIO_C_FUNC_LOCATION ());
+
+	return 0;
+    }
+
+    intmax_t min = 0;
+    uintmax_t max = 0;
+
+    switch (width) {
+    case 1:
+	min = is_signed ? INT8_MIN : 0;
+	max = is_signed ? INT8_MAX : UINT8_MAX;
+	break;
+    case 2:
+	min = is_signed ? INT16_MIN : 0;
+	max = is_signed ? INT16_MAX : UINT16_MAX;
+	break;
+    case 4:
+	min = is_signed ? INT32_MIN : 0;
+	max = is_signed ? INT32_MAX : UINT32_MAX;
+	break;
+    case 8:
+	min = is_signed ? INT64_MIN : 0;
+	max = is_signed ? INT64_MAX : UINT64_MAX;
+	break;
+    }
+
+    if ((neg && i < min) ||
+	(! neg && u > max)) {
+	/*
+	 * Test Case: bytevector-errors/bytevector-u8-set-range.idio
+	 *
+	 * bytevector-u8-set! (make-bytevector 3) 0 256
+	 */
+	char em[BUFSIZ];
+	idio_snprintf (em, BUFSIZ, "out of range for %s", kind);
+	idio_error_param_value_msg (func, param, v, em, IDIO_C_FUNC_LOCATION ());
+
+	return 0;
+    }
+
+    return u;
+}
+
+static double idio_bytevector_double_value (IDIO v)
+{
+    IDIO_ASSERT (v);
+
+    if (idio_isa_fixnum (v)) {
+	return IDIO_FIXNUM_VAL (v);
+    } else if (idio_isa_bignum (v)) {
+	return idio_bignum_double_value (v);
+    } else if (idio_isa_C_double (v)) {
+	return IDIO_C_TYPE_double (v);
+    } else if (idio_isa_C_float (v)) {
+	return IDIO_C_TYPE_float (v);
+    }
+
+    /*
+     * Test Case: bytevector-errors/bytevector-f64-set-not-number.idio
+     *
+     * bytevector-f64-set! (make-bytevector 8) 0 #t
+     */
+    idio_error_param_type ("number", v, IDIO_C_FUNC_LOCATION ());
+
+    return 0;
+}
+
+static IDIO idio_bytevector_int_ref (IDIO bv, IDIO index, IDIO args, size_t const width, int const is_signed, char const *func)
+{
+    IDIO_ASSERT (bv);
+    IDIO_ASSERT (index);
+    IDIO_ASSERT (args);
+    IDIO_C_ASSERT (func);
+
+    /*
+     * Test Case: bytevector-errors/bytevector-u16-ref-bad-type.idio
+     *
+     * bytevector-u16-ref #t 0
+     */
+    IDIO_USER_TYPE_ASSERT (bytevector, bv);
+
+    size_t i = idio_bytevector_ref_index (bv, index, width, func);
+    int big = idio_bytevector_big_endian (args, func);
+
+    uint64_t v = idio_bytevector_get_bits (IDIO_BYTEVECTOR_DATA (bv) + i, width, big);
+
+    if (is_signed) {
+	if (width < 8) {
+	    uint64_t sign = UINT64_C (1) << (width * 8 - 1);
+	    if (v & sign) {
+		v |= ~((sign << 1) - 1);
+	    }
+	}
+
+	return idio_integer ((int64_t) v);
+    }
+
+    return idio_uinteger (v);
+}
+
+static void idio_bytevector_int_set (IDIO bv, IDIO index, IDIO v, IDIO args, size_t const width, int const is_signed, char const *kind, char const *func)
+{
+    IDIO_ASSERT (bv);
+    IDIO_ASSERT (index);
+    IDIO_ASSERT (v);
+    IDIO_ASSERT (args);
+    IDIO_C_ASSERT (kind);
+    IDIO_C_ASSERT (func);
+
+    /*
+     * Test Case: bytevector-errors/bytevector-u16-set-bad-type.idio
+     *
+     * bytevector-u16-set! #t 0 0
+     */
+    IDIO_USER_TYPE_ASSERT (bytevector, bv);
+
+    size_t i = idio_bytevector_ref_index (bv, index, width, func);
+    uint64_t bits = idio_bytevector_integer_bits (v, width, is_signed, kind, func, "v");
+    int big = idio_bytevector_big_endian (args, func);
+
+    idio_bytevector_put_bits (IDIO_BYTEVECTOR_DATA (bv) + i, width, bits, big);
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("bytevector?", bytevector_p, (IDIO o), "o", "\
+test if `o` is a bytevector			\n\
+						\n\
+:param o: object to test			\n\
+:return: ``#t`` if `o` is a bytevector, ``#f`` otherwise	\n\
+")
+{
+    IDIO_ASSERT (o);
+
+    IDIO r = idio_S_false;
+
+    if (idio_isa_bytevector (o)) {
+	r = idio_S_true;
+    }
+
+    return r;
+}
+
+IDIO_DEFINE_PRIMITIVE1V_DS ("make-bytevector", make_bytevector, (IDIO size, IDIO args), "size [fill]", "\
+create a bytevector of `size` bytes		\n\
+						\n\
+:param size: number of bytes			\n\
+:type size: integer				\n\
+:param fill: initial value, defaults to zero	\n\
+:type fill: integer 0-255, optional		\n\
+:rtype: bytevector				\n\
+")
+{
+    IDIO_ASSERT (size);
+    IDIO_ASSERT (args);
+
+    /*
+     * Test Case: n/a
+     *
+     * args is the varargs parameter -- should always be a list
+     */
+    IDIO_USER_TYPE_ASSERT (list, args);
+
+    ptrdiff_t len = idio_bytevector_C_index (size);
+    if (len < 0 ||
+	(uintmax_t) len > IDIO_BYTEVECTOR_MAX_LEN) {
+	/*
+	 * Test Case: bytevector-errors/make-bytevector-negative-size.idio
+	 *
+	 * make-bytevector -1
+	 */
+	idio_error_param_value_msg ("make-bytevector", "size", size, "should be a non-negative 32-bit integer", IDIO_C_FUNC_LOCATION ());
+
+	return idio_S_notreached;
+    }
+
+    uint8_t fill = 0;
+    if (idio_isa_pair (args)) {
+	/*
+	 * Test Case: bytevector-errors/make-bytevector-bad-fill.idio
+	 *
+	 * make-bytevector 3 256
+	 */
+	fill = idio_bytevector_integer_bits (IDIO_PAIR_H (args), 1, 0, "u8", "make-bytevector", "fill");
+    }
+
+    IDIO bv = idio_bytevector (len);
+
+    if (fill &&
+	len) {
+	memset (IDIO_BYTEVECTOR_DATA (bv), fill, len);
+    }
+
+    return bv;
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("bytevector-length", bytevector_length, (IDIO bv), "bv", "\
+return the number of bytes in bytevector `bv`	\n\
+						\n\
+:param bv: bytevector				\n\
+:type bv: bytevector				\n\
+:rtype: integer					\n\
+")
+{
+    IDIO_ASSERT (bv);
+
+    /*
+     * Test Case: bytevector-errors/bytevector-length-bad-type.idio
+     *
+     * bytevector-length #t
+     */
+    IDIO_USER_TYPE_ASSERT (bytevector, bv);
+
+    return idio_integer (IDIO_BYTEVECTOR_LEN (bv));
+}
+
+IDIO_DEFINE_PRIMITIVE2_DS ("bytevector-u8-ref", bytevector_u8_ref, (IDIO bv, IDIO index), "bv index", "\
+return the byte at `index` of bytevector `bv`	\n\
+						\n\
+:param bv: bytevector				\n\
+:type bv: bytevector				\n\
+:param index: index, negative indexes count back from the end	\n\
+:type index: integer				\n\
+:rtype: integer					\n\
+")
+{
+    IDIO_ASSERT (bv);
+    IDIO_ASSERT (index);
+
+    /*
+     * Test Case: bytevector-errors/bytevector-u8-ref-bad-type.idio
+     *
+     * bytevector-u8-ref #t 0
+     */
+    IDIO_USER_TYPE_ASSERT (bytevector, bv);
+
+    size_t i = idio_bytevector_ref_index (bv, index, 1, "bytevector-u8-ref");
+
+    return idio_fixnum (IDIO_BYTEVECTOR_DATA (bv)[i]);
+}
+
+IDIO_DEFINE_PRIMITIVE3_DS ("bytevector-u8-set!", bytevector_u8_set, (IDIO bv, IDIO index, IDIO v), "bv index v", "\
+set the byte at `index` of bytevector `bv` to `v`	\n\
+						\n\
+:param bv: bytevector				\n\
+:type bv: bytevector				\n\
+:param index: index, negative indexes count back from the end	\n\
+:type index: integer				\n\
+:param v: value					\n\
+:type v: integer 0-255				\n\
+:return: ``#<unspec>``				\n\
+")
+{
+    IDIO_ASSERT (bv);
+    IDIO_ASSERT (index);
+    IDIO_ASSERT (v);
+
+    /*
+     * Test Case: bytevector-errors/bytevector-u8-set-bad-type.idio
+     *
+     * bytevector-u8-set! #t 0 0
+     */
+    IDIO_USER_TYPE_ASSERT (bytevector, bv);
+
+    size_t i = idio_bytevector_ref_index (bv, index, 1, "bytevector-u8-set!");
+
+    IDIO_BYTEVECTOR_DATA (bv)[i] = idio_bytevector_integer_bits (v, 1, 0, "u8", "bytevector-u8-set!", "v");
+
+    return idio_S_unspec;
+}
+
+IDIO_DEFINE_PRIMITIVE2V_DS ("bytevector-u16-ref", bytevector_u16_ref, (IDIO bv, IDIO index, IDIO args), "bv index [endian]", "\
+return the unsigned 16-bit integer at `index`	\n\
+of bytevector `bv`				\n\
+						\n\
+:param bv: bytevector				\n\
+:type bv: bytevector				\n\
+:param index: byte index			\n\
+:type index: integer				\n\
+:param endian: byte order, defaults to ``'big``	\n\
+:type endian: symbol, ``'big`` or ``'little``, optional	\n\
+:rtype: integer					\n\
+")
+{
+    IDIO_ASSERT (bv);
+    IDIO_ASSERT (index);
+    IDIO_ASSERT (args);
+
+    return idio_bytevector_int_ref (bv, index, args, 2, 0, "bytevector-u16-ref");
+}
+
+IDIO_DEFINE_PRIMITIVE2V_DS ("bytevector-s16-ref", bytevector_s16_ref, (IDIO bv, IDIO index, IDIO args), "bv index [endian]", "\
+return the signed 16-bit integer at `index`	\n\
+of bytevector `bv`				\n\
+						\n\
+:param bv: bytevector				\n\
+:type bv: bytevector				\n\
+:param index: byte index			\n\
+:type index: integer				\n\
+:param endian: byte order, defaults to ``'big``	\n\
+:type endian: symbol, ``'big`` or ``'little``, optional	\n\
+:rtype: integer					\n\
+")
+{
+    IDIO_ASSERT (bv);
+    IDIO_ASSERT (index);
+    IDIO_ASSERT (args);
+
+    return idio_bytevector_int_ref (bv, index, args, 2, 1, "bytevector-s16-ref");
+}
+
+IDIO_DEFINE_PRIMITIVE2V_DS ("bytevector-u32-ref", bytevector_u32_ref, (IDIO bv, IDIO index, IDIO args), "bv index [endian]", "\
+return the unsigned 32-bit integer at `index`	\n\
+of bytevector `bv`				\n\
+						\n\
+:param bv: bytevector				\n\
+:type bv: bytevector				\n\
+:param index: byte index			\n\
+:type index: integer				\n\
+:param endian: byte order, defaults to ``'big``	\n\
+:type endian: symbol, ``'big`` or ``'little``, optional	\n\
+:rtype: integer					\n\
+")
+{
+    IDIO_ASSERT (bv);
+    IDIO_ASSERT (index);
+    IDIO_ASSERT (args);
+
+    return idio_bytevector_int_ref (bv, index, args, 4, 0, "bytevector-u32-ref");
+}
+
+IDIO_DEFINE_PRIMITIVE2V_DS ("bytevector-s32-ref", bytevector_s32_ref, (IDIO bv, IDIO index, IDIO args), "bv index [endian]", "\
+return the signed 32-bit integer at `index`	\n\
+of bytevector `bv`				\n\
+						\n\
+:param bv: bytevector				\n\
+:type bv: bytevector				\n\
+:param index: byte index			\n\
+:type index: integer				\n\
+:param endian: byte order, defaults to ``'big``	\n\
+:type endian: symbol, ``'big`` or ``'little``, optional	\n\
+:rtype: integer					\n\
+")
+{
+    IDIO_ASSERT (bv);
+    IDIO_ASSERT (index);
+    IDIO_ASSERT (args);
+
+    return idio_bytevector_int_ref (bv, index, args, 4, 1, "bytevector-s32-ref");
+}
+
+IDIO_DEFINE_PRIMITIVE2V_DS ("bytevector-u64-ref", bytevector_u64_ref, (IDIO bv, IDIO index, IDIO args), "bv index [endian]", "\
+return the unsigned 64-bit integer at `index`	\n\
+of bytevector `bv`				\n\
+						\n\
+:param bv: bytevector				\n\
+:type bv: bytevector				\n\
+:param index: byte index			\n\
+:type index: integer				\n\
+:param endian: byte order, defaults to ``'big``	\n\
+:type endian: symbol, ``'big`` or ``'little``, optional	\n\
+:rtype: integer					\n\
+")
+{
+    IDIO_ASSERT (bv);
+    IDIO_ASSERT (index);
+    IDIO_ASSERT (args);
+
+    return idio_bytevector_int_ref (bv, index, args, 8, 0, "bytevector-u64-ref");
+}
+
+IDIO_DEFINE_PRIMITIVE2V_DS ("bytevector-s64-ref", bytevector_s64_ref, (IDIO bv, IDIO index, IDIO args), "bv index [endian]", "\
+return the signed 64-bit integer at `index`	\n\
+of bytevector `bv`				\n\
+						\n\
+:param bv: bytevector				\n\
+:type bv: bytevector				\n\
+:param index: byte index			\n\
+:type index: integer				\n\
+:param endian: byte order, defaults to ``'big``	\n\
+:type endian: symbol, ``'big`` or ``'little``, optional	\n\
+:rtype: integer					\n\
+")
+{
+    IDIO_ASSERT (bv);
+    IDIO_ASSERT (index);
+    IDIO_ASSERT (args);
+
+    return idio_bytevector_int_ref (bv, index, args, 8, 1, "bytevector-s64-ref");
+}
+
+IDIO_DEFINE_PRIMITIVE3V_DS ("bytevector-u16-set!", bytevector_u16_set, (IDIO bv, IDIO index, IDIO v, IDIO args), "bv index v [endian]", "\
+set the unsigned 16-bit integer at `index` of	\n\
+bytevector `bv` to `v`				\n\
+						\n\
+:param bv: bytevector				\n\
+:type bv: bytevector				\n\
+:param index: byte index			\n\
+:type index: integer				\n\
+:param v: value					\n\
+:type v: integer				\n\
+:param endian: byte order, defaults to ``'big``	\n\
+:type endian: symbol, ``'big`` or ``'little``, optional	\n\
+:return: ``#<unspec>``				\n\
+")
+{
+    IDIO_ASSERT (bv);
+    IDIO_ASSERT (index);
+    IDIO_ASSERT (v);
+    IDIO_ASSERT (args);
+
+    idio_bytevector_int_set (bv, index, v, args, 2, 0, "u16", "bytevector-u16-set!");
+
+    return idio_S_unspec;
+}
+
+IDIO_DEFINE_PRIMITIVE3V_DS ("bytevector-s16-set!", bytevector_s16_set, (IDIO bv, IDIO index, IDIO v, IDIO args), "bv index v [endian]", "\
+set the signed 16-bit integer at `index` of	\n\
+bytevector `bv` to `v`				\n\
+						\n\
+:param bv: bytevector				\n\
+:type bv: bytevector				\n\
+:param index: byte index			\n\
+:type index: integer				\n\
+:param v: value					\n\
+:type v: integer				\n\
+:param endian: byte order, defaults to ``'big``	\n\
+:type endian: symbol, ``'big`` or ``'little``, optional	\n\
+:return: ``#<unspec>``				\n\
+")
+{
+    IDIO_ASSERT (bv);
+    IDIO_ASSERT (index);
+    IDIO_ASSERT (v);
+    IDIO_ASSERT (args);
+
+    idio_bytevector_int_set (bv, index, v, args, 2, 1, "s16", "bytevector-s16-set!");
+
+    return idio_S_unspec;
+}
+
+IDIO_DEFINE_PRIMITIVE3V_DS ("bytevector-u32-set!", bytevector_u32_set, (IDIO bv, IDIO index, IDIO v, IDIO args), "bv index v [endian]", "\
+set the unsigned 32-bit integer at `index` of	\n\
+bytevector `bv` to `v`				\n\
+						\n\
+:param bv: bytevector				\n\
+:type bv: bytevector				\n\
+:param index: byte index			\n\
+:type index: integer				\n\
+:param v: value					\n\
+:type v: integer				\n\
+:param endian: byte order, defaults to ``'big``	\n\
+:type endian: symbol, ``'big`` or ``'little``, optional	\n\
+:return: ``#<unspec>``				\n\
+")
+{
+    IDIO_ASSERT (bv);
+    IDIO_ASSERT (index);
+    IDIO_ASSERT (v);
+    IDIO_ASSERT (args);
+
+    idio_bytevector_int_set (bv, index, v, args, 4, 0, "u32", "bytevector-u32-set!");
+
+    return idio_S_unspec;
+}
+
+IDIO_DEFINE_PRIMITIVE3V_DS ("bytevector-s32-set!", bytevector_s32_set, (IDIO bv, IDIO index, IDIO v, IDIO args), "bv index v [endian]", "\
+set the signed 32-bit integer at `index` of	\n\
+bytevector `bv` to `v`				\n\
+						\n\
+:param bv: bytevector				\n\
+:type bv: bytevector				\n\
+:param index: byte index			\n\
+:type index: integer				\n\
+:param v: value					\n\
+:type v: integer				\n\
+:param endian: byte order, defaults to ``'big``	\n\
+:type endian: symbol, ``'big`` or ``'little``, optional	\n\
+:return: ``#<unspec>``				\n\
+")
+{
+    IDIO_ASSERT (bv);
+    IDIO_ASSERT (index);
+    IDIO_ASSERT (v);
+    IDIO_ASSERT (args);
+
+    idio_bytevector_int_set (bv, index, v, args, 4, 1, "s32", "bytevector-s32-set!");
+
+    return idio_S_unspec;
+}
+
+IDIO_DEFINE_PRIMITIVE3V_DS ("bytevector-u64-set!", bytevector_u64_set, (IDIO bv, IDIO index, IDIO v, IDIO args), "bv index v [endian]", "\
+set the unsigned 64-bit integer at `index` of	\n\
+bytevector `bv` to `v`				\n\
+						\n\
+:param bv: bytevector				\n\
+:type bv: bytevector				\n\
+:param index: byte index			\n\
+:type index: integer				\n\
+:param v: value					\n\
+:type v: integer				\n\
+:param endian: byte order, defaults to ``'big``	\n\
+:type endian: symbol, ``'big`` or ``'little``, optional	\n\
+:return: ``#<unspec>``				\n\
+")
+{
+    IDIO_ASSERT (bv);
+    IDIO_ASSERT (index);
+    IDIO_ASSERT (v);
+    IDIO_ASSERT (args);
+
+    idio_bytevector_int_set (bv, index, v, args, 8, 0, "u64", "bytevector-u64-set!");
+
+    return idio_S_unspec;
+}
+
+IDIO_DEFINE_PRIMITIVE3V_DS ("bytevector-s64-set!", bytevector_s64_set, (IDIO bv, IDIO index, IDIO v, IDIO args), "bv index v [endian]", "\
+set the signed 64-bit integer at `index` of	\n\
+bytevector `bv` to `v`				\n\
+						\n\
+:param bv: bytevector				\n\
+:type bv: bytevector				\n\
+:param index: byte index			\n\
+:type index: integer				\n\
+:param v: value					\n\
+:type v: integer				\n\
+:param endian: byte order, defaults to ``'big``	\n\
+:type endian: symbol, ``'big`` or ``'little``, optional	\n\
+:return: ``#<unspec>``				\n\
+")
+{
+    IDIO_ASSERT (bv);
+    IDIO_ASSERT (index);
+    IDIO_ASSERT (v);
+    IDIO_ASSERT (args);
+
+    idio_bytevector_int_set (bv, index, v, args, 8, 1, "s64", "bytevector-s64-set!");
+
+    return idio_S_unspec;
+}
+
+IDIO_DEFINE_PRIMITIVE2V_DS ("bytevector-f32-ref", bytevector_f32_ref, (IDIO bv, IDIO index, IDIO args), "bv index [endian]", "\
+return the IEEE 754 single precision number at	\n\
+`index` of bytevector `bv`			\n\
+						\n\
+:param bv: bytevector				\n\
+:type bv: bytevector				\n\
+:param index: byte index			\n\
+:type index: integer				\n\
+:param endian: byte order, defaults to ``'big``	\n\
+:type endian: symbol, ``'big`` or ``'little``, optional	\n\
+:rtype: ``C/float``				\n\
+")
+{
+    IDIO_ASSERT (bv);
+    IDIO_ASSERT (index);
+    IDIO_ASSERT (args);
+
+    /*
+     * Test Case: bytevector-errors/bytevector-f32-ref-bad-type.idio
+     *
+     * bytevector-f32-ref #t 0
+     */
+    IDIO_USER_TYPE_ASSERT (bytevector, bv);
+
+    size_t i = idio_bytevector_ref_index (bv, index, 4, "bytevector-f32-ref");
+    int big = idio_bytevector_big_endian (args, "bytevector-f32-ref");
+
+    uint32_t bits = idio_bytevector_get_bits (IDIO_BYTEVECTOR_DATA (bv) + i, 4, big);
+    float f;
+    memcpy (&f, &bits, sizeof (f));
+
+    return idio_C_float (f);
+}
+
+IDIO_DEFINE_PRIMITIVE2V_DS ("bytevector-f64-ref", bytevector_f64_ref, (IDIO bv, IDIO index, IDIO args), "bv index [endian]", "\
+return the IEEE 754 double precision number at	\n\
+`index` of bytevector `bv`			\n\
+						\n\
+:param bv: bytevector				\n\
+:type bv: bytevector				\n\
+:param index: byte index			\n\
+:type index: integer				\n\
+:param endian: byte order, defaults to ``'big``	\n\
+:type endian: symbol, ``'big`` or ``'little``, optional	\n\
+:rtype: ``C/double``				\n\
+")
+{
+    IDIO_ASSERT (bv);
+    IDIO_ASSERT (index);
+    IDIO_ASSERT (args);
+
+    /*
+     * Test Case: bytevector-errors/bytevector-f64-ref-bad-type.idio
+     *
+     * bytevector-f64-ref #t 0
+     */
+    IDIO_USER_TYPE_ASSERT (bytevector, bv);
+
+    size_t i = idio_bytevector_ref_index (bv, index, 8, "bytevector-f64-ref");
+    int big = idio_bytevector_big_endian (args, "bytevector-f64-ref");
+
+    uint64_t bits = idio_bytevector_get_bits (IDIO_BYTEVECTOR_DATA (bv) + i, 8, big);
+    double d;
+    memcpy (&d, &bits, sizeof (d));
+
+    return idio_C_double (d);
+}
+
+IDIO_DEFINE_PRIMITIVE3V_DS ("bytevector-f32-set!", bytevector_f32_set, (IDIO bv, IDIO index, IDIO v, IDIO args), "bv index v [endian]", "\
+set the IEEE 754 single precision number at	\n\
+`index` of bytevector `bv` to `v`		\n\
+						\n\
+:param bv: bytevector				\n\
+:type bv: bytevector				\n\
+:param index: byte index			\n\
+:type index: integer				\n\
+:param v: value					\n\
+:type v: number, ``C/float`` or ``C/double``	\n\
+:param endian: byte order, defaults to ``'big``	\n\
+:type endian: symbol, ``'big`` or ``'little``, optional	\n\
+:return: ``#<unspec>``				\n\
+")
+{
+    IDIO_ASSERT (bv);
+    IDIO_ASSERT (index);
+    IDIO_ASSERT (v);
+    IDIO_ASSERT (args);
+
+    /*
+     * Test Case: bytevector-errors/bytevector-f32-set-bad-type.idio
+     *
+     * bytevector-f32-set! #t 0 0
+     */
+    IDIO_USER_TYPE_ASSERT (bytevector, bv);
+
+    size_t i = idio_bytevector_ref_index (bv, index, 4, "bytevector-f32-set!");
+    float f = idio_bytevector_double_value (v);
+    int big = idio_bytevector_big_endian (args, "bytevector-f32-set!");
+
+    uint32_t bits;
+    memcpy (&bits, &f, sizeof (bits));
+    idio_bytevector_put_bits (IDIO_BYTEVECTOR_DATA (bv) + i, 4, bits, big);
+
+    return idio_S_unspec;
+}
+
+IDIO_DEFINE_PRIMITIVE3V_DS ("bytevector-f64-set!", bytevector_f64_set, (IDIO bv, IDIO index, IDIO v, IDIO args), "bv index v [endian]", "\
+set the IEEE 754 double precision number at	\n\
+`index` of bytevector `bv` to `v`		\n\
+						\n\
+:param bv: bytevector				\n\
+:type bv: bytevector				\n\
+:param index: byte index			\n\
+:type index: integer				\n\
+:param v: value					\n\
+:type v: number, ``C/float`` or ``C/double``	\n\
+:param endian: byte order, defaults to ``'big``	\n\
+:type endian: symbol, ``'big`` or ``'little``, optional	\n\
+:return: ``#<unspec>``				\n\
+")
+{
+    IDIO_ASSERT (bv);
+    IDIO_ASSERT (index);
+    IDIO_ASSERT (v);
+    IDIO_ASSERT (args);
+
+    /*
+     * Test Case: bytevector-errors/bytevector-f64-set-bad-type.idio
+     *
+     * bytevector-f64-set! #t 0 0
+     */
+    IDIO_USER_TYPE_ASSERT (bytevector, bv);
+
+    size_t i = idio_bytevector_ref_index (bv, index, 8, "bytevector-f64-set!");
+    double d = idio_bytevector_double_value (v);
+    int big = idio_bytevector_big_endian (args, "bytevector-f64-set!");
+
+    uint64_t bits;
+    memcpy (&bits, &d, sizeof (bits));
+    idio_bytevector_put_bits (IDIO_BYTEVECTOR_DATA (bv) + i, 8, bits, big);
+
+    return idio_S_unspec;
+}
+
+IDIO_DEFINE_PRIMITIVE1V_DS ("bytevector-slice", bytevector_slice, (IDIO bv, IDIO args), "bv [start [end]]", "\
+return a bytevector sharing the bytes of	\n\
+bytevector `bv` from `start` up to `end`	\n\
+						\n\
+:param bv: bytevector				\n\
+:type bv: bytevector				\n\
+:param start: first index, defaults to 0	\n\
+:type start: integer, optional			\n\
+:param end: index after the last, defaults to the length of `bv`	\n\
+:type end: integer, optional			\n\
+:rtype: bytevector				\n\
+						\n\
+No bytes are copied: changes to the slice are	\n\
+seen in `bv` and vice versa.			\n\
+")
+{
+    IDIO_ASSERT (bv);
+    IDIO_ASSERT (args);
+
+    /*
+     * Test Case: bytevector-errors/bytevector-slice-bad-type.idio
+     *
+     * bytevector-slice #t
+     */
+    IDIO_USER_TYPE_ASSERT (bytevector, bv);
+    /*
+     * Test Case: n/a
+     *
+     * args is the varargs parameter -- should always be a list
+     */
+    IDIO_USER_TYPE_ASSERT (list, args);
+
+    size_t start;
+    size_t end;
+    idio_bytevector_range (bv, args, &start, &end, "bytevector-slice");
+
+    return idio_bytevector_slice_C (bv, start, end);
+}
+
+IDIO_DEFINE_PRIMITIVE1V_DS ("bytevector-copy", bytevector_copy, (IDIO bv, IDIO args), "bv [start [end]]", "\
+return a new bytevector of the bytes of		\n\
+bytevector `bv` from `start` up to `end`	\n\
+						\n\
+:param bv: bytevector				\n\
+:type bv: bytevector				\n\
+:param start: first index, defaults to 0	\n\
+:type start: integer, optional			\n\
+:param end: index after the last, defaults to the length of `bv`	\n\
+:type end: integer, optional			\n\
+:rtype: bytevector				\n\
+")
+{
+    IDIO_ASSERT (bv);
+    IDIO_ASSERT (args);
+
+    /*
+     * Test Case: bytevector-errors/bytevector-copy-bad-type.idio
+     *
+     * bytevector-copy #t
+     */
+    IDIO_USER_TYPE_ASSERT (bytevector, bv);
+    /*
+     * Test Case: n/a
+     *
+     * args is the varargs parameter -- should always be a list
+     */
+    IDIO_USER_TYPE_ASSERT (list, args);
+
+    size_t start;
+    size_t end;
+    idio_bytevector_range (bv, args, &start, &end, "bytevector-copy");
+
+    return idio_bytevector_C ((char const *) IDIO_BYTEVECTOR_DATA (bv) + start, end - start);
+}
+
+IDIO_DEFINE_PRIMITIVE3V_DS ("bytevector-copy!", bytevector_copy_into, (IDIO dst, IDIO at, IDIO src, IDIO args), "dst at src [start [end]]", "\
+copy the bytes of bytevector `src` from `start`	\n\
+up to `end` into bytevector `dst` at index `at`	\n\
+						\n\
+:param dst: bytevector to copy into		\n\
+:type dst: bytevector				\n\
+:param at: index in `dst`			\n\
+:type at: integer				\n\
+:param src: bytevector to copy from		\n\
+:type src: bytevector				\n\
+:param start: first index, defaults to 0	\n\
+:type start: integer, optional			\n\
+:param end: index after the last, defaults to the length of `src`	\n\
+:type end: integer, optional			\n\
+:return: ``#<unspec>``				\n\
+						\n\
+`dst` and `src` may overlap.			\n\
+")
+{
+    IDIO_ASSERT (dst);
+    IDIO_ASSERT (at);
+    IDIO_ASSERT (src);
+    IDIO_ASSERT (args);
+
+    /*
+     * Test Case: bytevector-errors/bytevector-copy-into-bad-dst-type.idio
+     *
+     * bytevector-copy! #t 0 (make-bytevector 3)
+     */
+    IDIO_USER_TYPE_ASSERT (bytevector, dst);
+    /*
+     * Test Case: bytevector-errors/bytevector-copy-into-bad-src-type.idio
+     *
+     * bytevector-copy! (make-bytevector 3) 0 #t
+     */
+    IDIO_USER_TYPE_ASSERT (bytevector, src);
+    /*
+     * Test Case: n/a
+     *
+     * args is the varargs parameter -- should always be a list
+     */
+    IDIO_USER_TYPE_ASSERT (list, args);
+
+    size_t start;
+    size_t end;
+    idio_bytevector_range (src, args, &start, &end, "bytevector-copy!");
+
+    ptrdiff_t C_at = idio_bytevector_C_index (at);
+    if (C_at < 0 ||
+	(size_t) C_at + (end - start) > IDIO_BYTEVECTOR_LEN (dst)) {
+	/*
+	 * Test Case: bytevector-errors/bytevector-copy-into-overflow.idio
+	 *
+	 * bytevector-copy! (make-bytevector 3) 2 (make-bytevector 3)
+	 */
+	idio_error_param_value_msg ("bytevector-copy!", "at", at, "the bytes do not fit in dst", IDIO_C_FUNC_LOCATION ());
+
+	return idio_S_notreached;
+    }
+
+    if (end > start) {
+	memmove (IDIO_BYTEVECTOR_DATA (dst) + C_at, IDIO_BYTEVECTOR_DATA (src) + start, end - start);
+    }
+
+    return idio_S_unspec;
+}
+
+IDIO_DEFINE_PRIMITIVE2V_DS ("bytevector-fill!", bytevector_fill, (IDIO bv, IDIO v, IDIO args), "bv v [start [end]]", "\
+set the bytes of bytevector `bv` from `start`	\n\
+up to `end` to `v`				\n\
+						\n\
+:param bv: bytevector				\n\
+:type bv: bytevector				\n\
+:param v: value					\n\
+:type v: integer 0-255				\n\
+:param start: first index, defaults to 0	\n\
+:type start: integer, optional			\n\
+:param end: index after the last, defaults to the length of `bv`	\n\
+:type end: integer, optional			\n\
+:return: ``#<unspec>``				\n\
+")
+{
+    IDIO_ASSERT (bv);
+    IDIO_ASSERT (v);
+    IDIO_ASSERT (args);
+
+    /*
+     * Test Case: bytevector-errors/bytevector-fill-bad-type.idio
+     *
+     * bytevector-fill! #t 0
+     */
+    IDIO_USER_TYPE_ASSERT (bytevector, bv);
+    /*
+     * Test Case: n/a
+     *
+     * args is the varargs parameter -- should always be a list
+     */
+    IDIO_USER_TYPE_ASSERT (list, args);
+
+    uint8_t fill = idio_bytevector_integer_bits (v, 1, 0, "u8", "bytevector-fill!", "v");
+
+    size_t start;
+    size_t end;
+    idio_bytevector_range (bv, args, &start, &end, "bytevector-fill!");
+
+    if (end > start) {
+	memset (IDIO_BYTEVECTOR_DATA (bv) + start, fill, end - start);
+    }
+
+    return idio_S_unspec;
+}
+
+IDIO_DEFINE_PRIMITIVE2V_DS ("bytevector-search", bytevector_search, (IDIO bv, IDIO needle, IDIO args), "bv needle [start]", "\
+return the index of the first occurrence of	\n\
+`needle` in bytevector `bv` at or after `start`	\n\
+						\n\
+:param bv: bytevector				\n\
+:type bv: bytevector				\n\
+:param needle: bytes to look for		\n\
+:type needle: bytevector or octet string	\n\
+:param start: first index, defaults to 0	\n\
+:type start: integer, optional			\n\
+:return: index or ``#f``			\n\
+:rtype: integer or ``#f``			\n\
+")
+{
+    IDIO_ASSERT (bv);
+    IDIO_ASSERT (needle);
+    IDIO_ASSERT (args);
+
+    /*
+     * Test Case: bytevector-errors/bytevector-search-bad-type.idio
+     *
+     * bytevector-search #t (make-bytevector 1)
+     */
+    IDIO_USER_TYPE_ASSERT (bytevector, bv);
+    /*
+     * Test Case: n/a
+     *
+     * args is the varargs parameter -- should always be a list
+     */
+    IDIO_USER_TYPE_ASSERT (list, args);
+
+    char const *n;
+    size_t nlen;
+    if (idio_isa_bytevector (needle)) {
+	n = (char const *) IDIO_BYTEVECTOR_DATA (needle);
+	nlen = IDIO_BYTEVECTOR_LEN (needle);
+    } else if (idio_isa_octet_string (needle)) {
+	if (idio_isa_substring (needle)) {
+	    n = IDIO_SUBSTRING_S (needle);
+	    nlen = IDIO_SUBSTRING_LEN (needle);
+	} else {
+	    n = IDIO_STRING_S (needle);
+	    nlen = IDIO_STRING_LEN (needle);
+	}
+    } else {
+	/*
+	 * Test Case: bytevector-errors/bytevector-search-bad-needle-type.idio
+	 *
+	 * bytevector-search (make-bytevector 1) #t
+	 */
+	idio_error_param_type ("bytevector|octet-string", needle, IDIO_C_FUNC_LOCATION ());
+
+	return idio_S_notreached;
+    }
+
+    size_t start;
+    size_t end;
+    idio_bytevector_range (bv, args, &start, &end, "bytevector-search");
+
+    if (0 == nlen) {
+	return idio_integer (start);
+    }
+
+    uint8_t *h = IDIO_BYTEVECTOR_DATA (bv);
+    uint8_t *p = memmem (h + start, end - start, n, nlen);
+
+    if (NULL == p) {
+	return idio_S_false;
+    }
+
+    return idio_integer (p - h);
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("bytevector->octet-string", bytevector2octet_string, (IDIO bv), "bv", "\
+return an octet string of the bytes of		\n\
+bytevector `bv`					\n\
+						\n\
+:param bv: bytevector				\n\
+:type bv: bytevector				\n\
+:rtype: octet string				\n\
+")
+{
+    IDIO_ASSERT (bv);
+
+    /*
+     * Test Case: bytevector-errors/bytevector2octet-string-bad-type.idio
+     *
+     * bytevector->octet-string #t
+     */
+    IDIO_USER_TYPE_ASSERT (bytevector, bv);
+
+    return idio_octet_string_C_len ((char *) IDIO_BYTEVECTOR_DATA (bv), IDIO_BYTEVECTOR_LEN (bv));
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("octet-string->bytevector", octet_string2bytevector, (IDIO os), "os", "\
+return a bytevector of the bytes of octet	\n\
+string `os`					\n\
+						\n\
+:param os: octet string				\n\
+:type os: octet string				\n\
+:rtype: bytevector				\n\
+")
+{
+    IDIO_ASSERT (os);
+
+    /*
+     * Test Case: bytevector-errors/octet-string2bytevector-bad-type.idio
+     *
+     * octet-string->bytevector #t
+     */
+    IDIO_USER_TYPE_ASSERT (octet_string, os);
+
+    if (idio_isa_substring (os)) {
+	return idio_bytevector_C (IDIO_SUBSTRING_S (os), IDIO_SUBSTRING_LEN (os));
+    } else {
+	return idio_bytevector_C (IDIO_STRING_S (os), IDIO_STRING_LEN (os));
+    }
+}
+
+char *idio_bytevector_report_string (IDIO v, size_t *sizep, idio_unicode_t format, IDIO seen, int depth)
+{
+    IDIO_ASSERT (v);
+    IDIO_ASSERT (seen);
+
+    IDIO_TYPE_ASSERT (bytevector, v);
+
+    char *r = NULL;
+
+    *sizep = idio_asprintf (&r, "#<BYTEVECTOR /%" PRIu32 ">", IDIO_BYTEVECTOR_LEN (v));
+
+    return r;
+}
+
+char *idio_bytevector_as_C_string (IDIO v, size_t *sizep, idio_unicode_t format, IDIO seen, int depth)
+{
+    IDIO_ASSERT (v);
+    IDIO_ASSERT (seen);
+
+    IDIO_TYPE_ASSERT (bytevector, v);
+
+    size_t len = IDIO_BYTEVECTOR_LEN (v);
+
+    /*
+     * "#<BYTEVECTOR" + " xx" per byte + ">"
+     */
+    size_t size = sizeof ("#<BYTEVECTOR") - 1 + len * 3 + 1;
+    char *r = idio_alloc (size + 1);
+    memcpy (r, "#<BYTEVECTOR", sizeof ("#<BYTEVECTOR") - 1);
+
+    static char const hex[] = "0123456789abcdef";
+    char *p = r + sizeof ("#<BYTEVECTOR") - 1;
+    uint8_t *data = IDIO_BYTEVECTOR_DATA (v);
+    size_t i;
+    for (i = 0; i < len; i++) {
+	*p++ = ' ';
+	*p++ = hex[data[i] >> 4];
+	*p++ = hex[data[i] & 0xf];
+    }
+    *p++ = '>';
+    *p = '\0';
+
+    *sizep = size;
+
+    return r;
+}
+
+IDIO idio_bytevector_method_2string (idio_vtable_method_t *m, IDIO v, ...)
+{
+    IDIO_C_ASSERT (m);
+    IDIO_ASSERT (v);
+
+    va_list ap;
+    va_start (ap, v);
+    size_t *sizep = va_arg (ap, size_t *);
+    va_end (ap);
+
+    char *C_r = idio_bytevector_as_C_string (v, sizep, 0, idio_S_nil, 0);
+
+    IDIO r = idio_string_C_len (C_r, *sizep);
+
+    IDIO_GC_FREE (C_r, *sizep);
+
+    return r;
+}
+
+void idio_bytevector_add_primitives ()
+{
+    IDIO_ADD_PRIMITIVE (bytevector_p);
+    IDIO_ADD_PRIMITIVE (make_bytevector);
+    IDIO_ADD_PRIMITIVE (bytevector_length);
+
+    idio_vtable_t *bv_vt = idio_vtable (IDIO_TYPE_BYTEVECTOR);
+
+    IDIO ref = IDIO_ADD_PRIMITIVE (bytevector_u8_ref);
+    idio_vtable_add_method (bv_vt,
+			    idio_S_value_index,
+			    idio_vtable_create_method_value (idio_util_method_value_index,
+							     idio_vm_default_values_ref (IDIO_FIXNUM_VAL (ref))));
+
+    IDIO set = IDIO_ADD_PRIMITIVE (bytevector_u8_set);
+    idio_vtable_add_method (bv_vt,
+			    idio_S_set_value_index,
+			    idio_vtable_create_method_value (idio_util_method_set_value_index,
+							     idio_vm_default_values_ref (IDIO_FIXNUM_VAL (set))));
+
+    IDIO_ADD_PRIMITIVE (bytevector_u16_ref);
+    IDIO_ADD_PRIMITIVE (bytevector_s16_ref);
+    IDIO_ADD_PRIMITIVE (bytevector_u32_ref);
+    IDIO_ADD_PRIMITIVE (bytevector_s32_ref);
+    IDIO_ADD_PRIMITIVE (bytevector_u64_ref);
+    IDIO_ADD_PRIMITIVE (bytevector_s64_ref);
+    IDIO_ADD_PRIMITIVE (bytevector_u16_set);
+    IDIO_ADD_PRIMITIVE (bytevector_s16_set);
+    IDIO_ADD_PRIMITIVE (bytevector_u32_set);
+    IDIO_ADD_PRIMITIVE (bytevector_s32_set);
+    IDIO_ADD_PRIMITIVE (bytevector_u64_set);
+    IDIO_ADD_PRIMITIVE (bytevector_s64_set);
+    IDIO_ADD_PRIMITIVE (bytevector_f32_ref);
+    IDIO_ADD_PRIMITIVE (bytevector_f64_ref);
+    IDIO_ADD_PRIMITIVE (bytevector_f32_set);
+    IDIO_ADD_PRIMITIVE (bytevector_f64_set);
+    IDIO_ADD_PRIMITIVE (bytevector_slice);
+    IDIO_ADD_PRIMITIVE (bytevector_copy);
+    IDIO_ADD_PRIMITIVE (bytevector_copy_into);
+    IDIO_ADD_PRIMITIVE (bytevector_fill);
+    IDIO_ADD_PRIMITIVE (bytevector_search);
+    IDIO_ADD_PRIMITIVE (bytevector2octet_string);
+    IDIO_ADD_PRIMITIVE (octet_string2bytevector);
+}
+
+void idio_init_bytevector ()
+{
+    idio_module_table_register (idio_bytevector_add_primitives, NULL, NULL);
+
+    idio_vtable_t *bv_vt = idio_vtable (IDIO_TYPE_BYTEVECTOR);
+
+    idio_vtable_add_method (bv_vt,
+			    idio_S_typename,
+			    idio_vtable_create_method_value (idio_util_method_typename,
+							     idio_S_bytevector));
+
+    idio_vtable_add_method (bv_vt,
+			    idio_S_2string,
+			    idio_vtable_create_method_simple (idio_bytevector_method_2string));
+}
+
+/* Local Variables: */
+/* mode: C */
+/* coding: utf-8-unix */
+/* End: */
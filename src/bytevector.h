@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2020-2022 Ian Fitchet <idf(at)idio-lang.org>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License.  You
+ * may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/*
+ * bytevector.h
+ *
+ */
+
+#ifndef BYTEVECTOR_H
+#define BYTEVECTOR_H
+
+/*
+ * The length of a bytevector is held in the 32-bit tlen
+ */
+#define IDIO_BYTEVECTOR_MAX_LEN	UINT32_MAX
+
+IDIO idio_bytevector (size_t len);
+IDIO idio_bytevector_C (char const *s, size_t len);
+IDIO idio_bytevector_slice_C (IDIO bv, size_t start, size_t end);
+void idio_bytevector_resize_C (IDIO bv, size_t len);
+int idio_isa_bytevector (IDIO o);
+void idio_free_bytevector (IDIO bv);
+IDIO idio_copy_bytevector (IDIO bv);
+int idio_bytevector_equal (IDIO bv1, IDIO bv2);
+idio_hi_t idio_bytevector_hash_C (IDIO bv);
+ptrdiff_t idio_bytevector_C_index (IDIO index);
+void idio_bytevector_range (IDIO bv, IDIO args, size_t *startp, size_t *endp, char const *func);
+
+char *idio_bytevector_report_string (IDIO v, size_t *sizep, idio_unicode_t format, IDIO seen, int depth);
+char *idio_bytevector_as_C_string (IDIO v, size_t *sizep, idio_unicode_t format, IDIO seen, int depth);
+
+void idio_init_bytevector ();
+
+#endif
+
+/* Local Variables: */
+/* mode: C */
+/* coding: utf-8-unix */
+/* End: */
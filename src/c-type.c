@@ -126,7 +126,6 @@ static void idio_C_conversion_error (char const *msg, IDIO n, IDIO c_location)
 IDIO idio_C_char (char const v)
 {
     IDIO co = idio_gc_get (IDIO_TYPE_C_CHAR);
-    co->vtable = idio_vtable (IDIO_TYPE_C_CHAR);
 
     IDIO_C_TYPE_char (co) = v;
 
@@ -161,7 +160,6 @@ test if `o` is a C/char				\n\
 IDIO idio_C_schar (signed char const v)
 {
     IDIO co = idio_gc_get (IDIO_TYPE_C_SCHAR);
-    co->vtable = idio_vtable (IDIO_TYPE_C_SCHAR);
 
     IDIO_C_TYPE_schar (co) = v;
 
@@ -196,7 +194,6 @@ test if `o` is a C/schar				\n\
 IDIO idio_C_uchar (unsigned char const v)
 {
     IDIO co = idio_gc_get (IDIO_TYPE_C_UCHAR);
-    co->vtable = idio_vtable (IDIO_TYPE_C_UCHAR);
 
     IDIO_C_TYPE_uchar (co) = v;
 
@@ -231,7 +228,6 @@ test if `o` is a C/uchar				\n\
 IDIO idio_C_short (short const v)
 {
     IDIO co = idio_gc_get (IDIO_TYPE_C_SHORT);
-    co->vtable = idio_vtable (IDIO_TYPE_C_SHORT);
 
     IDIO_C_TYPE_short (co) = v;
 
@@ -266,7 +262,6 @@ test if `o` is a C/short				\n\
 IDIO idio_C_ushort (unsigned short const v)
 {
     IDIO co = idio_gc_get (IDIO_TYPE_C_USHORT);
-    co->vtable = idio_vtable (IDIO_TYPE_C_USHORT);
 
     IDIO_C_TYPE_ushort (co) = v;
 
@@ -301,7 +296,6 @@ test if `o` is a C/ushort			\n\
 IDIO idio_C_int (int const v)
 {
     IDIO co = idio_gc_get (IDIO_TYPE_C_INT);
-    co->vtable = idio_vtable (IDIO_TYPE_C_INT);
 
     IDIO_C_TYPE_int (co) = v;
 
@@ -336,7 +330,6 @@ test if `o` is a C/int				\n\
 IDIO idio_C_uint (unsigned int const v)
 {
     IDIO co = idio_gc_get (IDIO_TYPE_C_UINT);
-    co->vtable = idio_vtable (IDIO_TYPE_C_UINT);
 
     IDIO_C_TYPE_uint (co) = v;
 
@@ -371,7 +364,6 @@ test if `o` is a C/uint			\n\
 IDIO idio_C_long (long const v)
 {
     IDIO co = idio_gc_get (IDIO_TYPE_C_LONG);
-    co->vtable = idio_vtable (IDIO_TYPE_C_LONG);
 
     IDIO_C_TYPE_long (co) = v;
 
@@ -406,7 +398,6 @@ test if `o` is a C/long				\n\
 IDIO idio_C_ulong (unsigned long const v)
 {
     IDIO co = idio_gc_get (IDIO_TYPE_C_ULONG);
-    co->vtable = idio_vtable (IDIO_TYPE_C_ULONG);
 
     IDIO_C_TYPE_ulong (co) = v;
 
@@ -441,7 +432,6 @@ test if `o` is a C/ulong			\n\
 IDIO idio_C_longlong (long long const v)
 {
     IDIO co = idio_gc_get (IDIO_TYPE_C_LONGLONG);
-    co->vtable = idio_vtable (IDIO_TYPE_C_LONGLONG);
 
     IDIO_C_TYPE_longlong (co) = v;
 
@@ -476,7 +466,6 @@ test if `o` is a C/longlong				\n\
 IDIO idio_C_ulonglong (unsigned long long const v)
 {
     IDIO co = idio_gc_get (IDIO_TYPE_C_ULONGLONG);
-    co->vtable = idio_vtable (IDIO_TYPE_C_ULONGLONG);
 
     IDIO_C_TYPE_ulonglong (co) = v;
 
@@ -511,7 +500,6 @@ test if `o` is a C/ulonglong			\n\
 IDIO idio_C_float (float const v)
 {
     IDIO co = idio_gc_get (IDIO_TYPE_C_FLOAT);
-    co->vtable = idio_vtable (IDIO_TYPE_C_FLOAT);
 
     IDIO_C_TYPE_float (co) = v;
 
@@ -546,7 +534,6 @@ test if `o` is a C/float			\n\
 IDIO idio_C_double (double const v)
 {
     IDIO co = idio_gc_get (IDIO_TYPE_C_DOUBLE);
-    co->vtable = idio_vtable (IDIO_TYPE_C_DOUBLE);
 
     IDIO_C_TYPE_double (co) = v;
 
@@ -581,7 +568,6 @@ test if `o` is a C/double			\n\
 IDIO idio_C_longdouble (long double const v)
 {
     IDIO co = idio_gc_get (IDIO_TYPE_C_LONGDOUBLE);
-    co->vtable = idio_vtable (IDIO_TYPE_C_LONGDOUBLE);
 
     IDIO_GC_ALLOC (co->u.C_type.u.C_longdouble, sizeof (long double));
 
@@ -630,11 +616,11 @@ IDIO idio_C_pointer (void * v)
      */
 
     IDIO co = idio_gc_get (IDIO_TYPE_C_POINTER);
-    co->vtable = idio_vtable (IDIO_TYPE_C_POINTER);
 
     IDIO_GC_ALLOC (co->u.C_type.u.C_pointer, sizeof (idio_C_pointer_t));
 
     IDIO_C_TYPE_POINTER_PTYPE (co) = idio_S_nil;
+    IDIO_C_TYPE_POINTER_VTABLE (co) = idio_vtable (IDIO_TYPE_C_POINTER);
     IDIO_C_TYPE_POINTER_P (co) = v;
     IDIO_C_TYPE_POINTER_FREEP (co) = 0;
 
@@ -661,7 +647,7 @@ void idio_invalidate_C_pointer (IDIO po)
 
     IDIO_TYPE_ASSERT (C_pointer, po);
 
-    po->vtable = idio_vtable (IDIO_TYPE_C_POINTER);
+    IDIO_C_TYPE_POINTER_VTABLE (po) = idio_vtable (IDIO_TYPE_C_POINTER);
 
     IDIO_C_TYPE_POINTER_PTYPE (po) = idio_S_nil;
     /*
@@ -758,7 +744,7 @@ IDIO idio_C_pointer_type (IDIO t, void * v)
     if (idio_S_false == I_vt) {
 	I_vt = idio_C_pointer_type_add_vtable (t);
     }
-    co->vtable = IDIO_C_TYPE_POINTER_P (I_vt);
+    IDIO_C_TYPE_POINTER_VTABLE (co) = IDIO_C_TYPE_POINTER_P (I_vt);
 
     IDIO_C_TYPE_POINTER_PTYPE (co) = t;
 
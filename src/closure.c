@@ -83,7 +83,6 @@ IDIO idio_toplevel_closure (idio_xi_t xi, size_t const code_pc, size_t const cod
     IDIO_TYPE_ASSERT (module, env);
 
     IDIO c = idio_gc_get (IDIO_TYPE_CLOSURE);
-    c->vtable = idio_vtable (IDIO_TYPE_CLOSURE);
 
     IDIO_GC_ALLOC (c->u.closure, sizeof (idio_closure_t));
 
@@ -178,7 +177,6 @@ IDIO idio_closure (IDIO cl, IDIO frame)
     }
 
     IDIO c = idio_gc_get (IDIO_TYPE_CLOSURE);
-    c->vtable = idio_vtable (IDIO_TYPE_CLOSURE);
 
     IDIO_GC_ALLOC (c->u.closure, sizeof (idio_closure_t));
 
@@ -152,6 +152,7 @@ IDIO idio_condition_rt_vtable_method_unbound_error_type;
 IDIO idio_condition_rt_instance_error_type;
 IDIO idio_condition_rt_instance_invocation_error_type;
 IDIO idio_condition_rt_slot_not_found_error_type;
+IDIO idio_condition_rt_heap_limit_error_type;
 
 IDIO idio_condition_rt_command_error_type;
 IDIO idio_condition_rt_command_argv_type_error_type;
@@ -1365,6 +1366,8 @@ void idio_init_condition ()
 
     IDIO_DEFINE_CONDITION1 (idio_condition_rt_slot_not_found_error_type, "^rt-slot-not-found-error", idio_condition_rt_instance_error_type, "slot");
 
+    IDIO_DEFINE_CONDITION2 (idio_condition_rt_heap_limit_error_type, "^rt-heap-limit-error", idio_condition_runtime_error_type, "size", "limit");
+
     IDIO_DEFINE_CONDITION1 (idio_condition_rt_signal_type, IDIO_CONDITION_RT_SIGNAL_TYPE_NAME, idio_condition_error_type, "signum");
 
     idio_S_condition_report = IDIO_SYMBOL ("condition-report");
@@ -191,6 +191,7 @@ extern IDIO idio_condition_rt_vtable_method_unbound_error_type;
 extern IDIO idio_condition_rt_instance_error_type;
 extern IDIO idio_condition_rt_instance_invocation_error_type;
 extern IDIO idio_condition_rt_slot_not_found_error_type;
+extern IDIO idio_condition_rt_heap_limit_error_type;
 
 extern IDIO idio_condition_rt_signal_type;
 
@@ -59,7 +59,6 @@ IDIO idio_continuation (IDIO thr, int kind)
     IDIO_TYPE_ASSERT (thread, thr);
 
     IDIO k = idio_gc_get (IDIO_TYPE_CONTINUATION);
-    k->vtable = idio_vtable (IDIO_TYPE_CONTINUATION);
 
     IDIO_GC_ALLOC (k->u.continuation, sizeof (idio_continuation_t));
 
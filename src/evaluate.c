@@ -5698,6 +5698,10 @@ static IDIO idio_meaning (IDIO src, IDIO e, IDIO nametree, int flags, IDIO eenv)
 		case IDIO_TYPE_HASH:
 		case IDIO_TYPE_BIGNUM:
 		case IDIO_TYPE_BITSET:
+		case IDIO_TYPE_PMAP:
+		case IDIO_TYPE_OMAP:
+		case IDIO_TYPE_TVECTOR:
+		case IDIO_TYPE_BYTEVECTOR:
 		    return idio_meaning_quotation (src, e, nametree, flags);
 
 		case IDIO_TYPE_CLOSURE:
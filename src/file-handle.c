@@ -2099,6 +2099,60 @@ int idio_getb_file_handle (IDIO fh)
     }
 }
 
+/*
+ * idio_file_handle_read_into() is for bulk reads, read-bytevector!,
+ * say: drain the buffer then read(2) directly into buf rather than
+ * byte-by-byte through the buffer.
+ *
+ * Returns the number of bytes read which is only less than len at
+ * end-of-file.
+ */
+size_t idio_file_handle_read_into (IDIO fh, uint8_t *buf, size_t const len)
+{
+    IDIO_ASSERT (fh);
+    IDIO_C_ASSERT (buf);
+
+    IDIO_TYPE_ASSERT (fd_handle, fh);
+
+    size_t n = 0;
+
+    size_t avail = IDIO_FILE_HANDLE_END (fh) - IDIO_FILE_HANDLE_PTR (fh);
+    if (avail) {
+	if (avail > len) {
+	    avail = len;
+	}
+	memcpy (buf, IDIO_FILE_HANDLE_PTR (fh), avail);
+	IDIO_FILE_HANDLE_PTR (fh) += avail;
+	n = avail;
+    }
+
+    while (n < len &&
+	   ! (IDIO_FILE_HANDLE_FLAGS (fh) & IDIO_FILE_HANDLE_FLAG_EOF)) {
+	ssize_t nread = read (IDIO_FILE_HANDLE_FD (fh), buf + n, len - n);
+	if (-1 == nread) {
+	    if (EINTR == errno) {
+		continue;
+	    }
+
+	    /*
+	     * Test Case: ??
+	     *
+	     * As for idio_file_handle_read_more()
+	     */
+	    idio_error_system_errno ("read", fh, IDIO_C_FUNC_LOCATION ());
+
+	    /* notreached */
+	    return n;
+	} else if (0 == nread) {
+	    IDIO_FILE_HANDLE_FLAGS (fh) |= IDIO_FILE_HANDLE_FLAG_EOF;
+	} else {
+	    n += nread;
+	}
+    }
+
+    return n;
+}
+
 inline int idio_eofp_file_handle (IDIO fh)
 {
     IDIO_ASSERT (fh);
@@ -3804,15 +3858,14 @@ void idio_load_set_eenv_chksum (IDIO eenv, IDIO efn)
     idio_struct_instance_set_direct (eenv, IDIO_EENV_ST_FILE, efn);
 
     IDIO chk = idio_open_output_string_handle_C ();
-
-    idio_gc_protect (chk);
+    IDIO_GC_ROOT_FRAME (rf, &chk);
 
     idio_display_C ("SHA256:", chk);
     idio_display (idio_rfc6234_shasum_file ("save-xenvs", efn, idio_rfc6234_SHA256_sym), chk);
 
     idio_struct_instance_set_direct (eenv, IDIO_EENV_ST_CHKSUM, idio_get_output_string (chk));
 
-    idio_gc_expose (chk);
+    idio_gc_root_frame_pop (&rf);
 }
 
 int idio_load_idio_cache (char *pathname, size_t pathname_len, IDIO eenv)
@@ -79,6 +79,7 @@ IDIO idio_stdout_file_handle ();
 IDIO idio_stderr_file_handle ();
 int idio_readyp_file_handle (IDIO fh);
 int idio_getb_file_handle (IDIO fh);
+size_t idio_file_handle_read_into (IDIO fh, uint8_t *buf, size_t len);
 int idio_eofp_file_handle (IDIO fh);
 int idio_close_file_handle (IDIO fh);
 int idio_putb_file_handle (IDIO fh, uint8_t c);
@@ -70,7 +70,6 @@ IDIO idio_frame_allocate (idio_fi_t arityp1)
     IDIO_C_ASSERT (arityp1);
 
     IDIO fo = idio_gc_get (IDIO_TYPE_FRAME);
-    fo->vtable = idio_vtable (IDIO_TYPE_FRAME);
 
     IDIO_GC_ALLOC (fo->u.frame, sizeof (idio_frame_t));
     IDIO_GC_ALLOC (fo->u.frame->args, arityp1 * sizeof (IDIO));
@@ -27,6 +27,7 @@
 #include <sys/resource.h>
 
 #include <assert.h>
+#include <errno.h>
 #include <inttypes.h>
 #include <limits.h>
 #include <setjmp.h>
@@ -46,11 +47,15 @@
 #include "array.h"
 #include "bignum.h"
 #include "bitset.h"
+#include "bytevector.h"
+#include "bytevector-handle.h"
 #include "c-type.h"
 #include "closure.h"
+#include "condition.h"
 #include "continuation.h"
 #include "error.h"
 #include "evaluate.h"
+#include "fixnum.h"
 #include "frame.h"
 #include "handle.h"
 #include "hash.h"
@@ -59,18 +64,136 @@
 #include "keyword.h"
 #include "malloc.h"
 #include "module.h"
+#include "omap.h"
 #include "pair.h"
+#include "pmap.h"
 #include "primitive.h"
+#include "string-handle.h"
 #include "struct.h"
 #include "symbol.h"
 #include "thread.h"
+#include "tvector.h"
 #include "util.h"
 #include "vm.h"
 #include "vtable.h"
 
 static idio_gc_t *idio_gc0;
 static idio_gc_t *idio_gc = NULL;
-static IDIO idio_gc_finalizer_hash = idio_S_nil;
+
+static size_t idio_gc_sweep_finish (idio_gc_t *gc);
+static void idio_gc_sweep_lazy (idio_gc_t *gc);
+void idio_gc_gcc_mark (idio_gc_t *gc, IDIO o, idio_gc_flag_gcc_enum colour);
+void idio_gc_process_grey (idio_gc_t *gc, unsigned colour);
+
+/*
+ * Is there anything on the grey list or the pair mark stack?
+ */
+#define IDIO_GC_GREYP(gc)	(NULL != (gc)->grey || (gc)->pairs.n)
+
+/*
+ * Collection triggering
+ *
+ * A collection is requested when the bytes in use exceed the
+ * trigger: the bytes in use after the previous collection multiplied
+ * by the heap growth factor but no less than the minimum heap size.
+ * Small heaps then rarely collect and large heaps collect in
+ * proportion to their size.
+ *
+ * Both can be set through the environment variables
+ * IDIO_GC_HEAP_FACTOR and IDIO_GC_HEAP_MIN (optionally suffixed with
+ * K, M or G) and the primitives gc/heap-factor and gc/heap-min.
+ */
+#define IDIO_GC_HEAP_FACTOR		2.0
+#define IDIO_GC_HEAP_FACTOR_MIN		1.1
+#define IDIO_GC_HEAP_MIN		(16LL * 1024 * 1024)
+#define IDIO_GC_HEAP_MIN_MIN		(1LL * 1024 * 1024)
+
+static double idio_gc_heap_factor = IDIO_GC_HEAP_FACTOR;
+static long long idio_gc_heap_min = IDIO_GC_HEAP_MIN;
+
+/*
+ * Heap limits
+ *
+ * Crossing the soft limit, if set, forces a full collection
+ * regardless of the trigger above.
+ *
+ * Exceeding the hard limit, if set, after a full collection raises an
+ * ^rt-heap-limit-error condition.  We can't raise a condition from
+ * within the allocator -- the caller will have half-built values on
+ * the used list -- so the check is made at the VM's collection safe
+ * point, see idio_gc_heap_limit_condition().  The limit can be
+ * overshot by the allocations between safe points.
+ *
+ * The condition is raised once.  The handler gets some headroom to
+ * release memory and the limit is re-armed when a collection brings
+ * the bytes in use back under it.
+ *
+ * Both can be set through the environment variables
+ * IDIO_GC_HEAP_SOFT_LIMIT and IDIO_GC_HEAP_HARD_LIMIT (optionally
+ * suffixed with K, M or G) and the primitives gc/heap-soft-limit and
+ * gc/heap-hard-limit.  Zero, the default, means no limit.
+ */
+static long long idio_gc_heap_soft_limit = 0;
+static long long idio_gc_heap_hard_limit = 0;
+static int idio_gc_heap_limit_raised = 0;
+
+/*
+ * Compilation garbage
+ *
+ * Reading, expanding and evaluating a top-level form creates many
+ * short-lived values: the source, the expander's intermediates and
+ * the meaning which are, by and large, garbage once idio_codegen()
+ * has finished.  We can't free them wholesale -- meanings are keys
+ * in the (weak) source properties table, are visible to Idio code
+ * through evaluate and codegen and templates run arbitrary code
+ * during expansion -- but we know when they become garbage.
+ *
+ * idio_gc_compile_start() and idio_gc_compile_finish() bracket the
+ * compilation of a form.  If the bytes requested while compiling,
+ * accumulated since the last collection, exceed the bytes in use
+ * after the last collection multiplied by the compile factor, and
+ * are at least IDIO_GC_COMPILE_MIN, then we request a collection.
+ * It will run at the next safe point rather than waiting for the
+ * heap growth factor to be reached.
+ *
+ * The factor can be set through the environment variable
+ * IDIO_GC_COMPILE_FACTOR and the primitive gc/compile-factor.  Zero
+ * disables it.
+ */
+#define IDIO_GC_COMPILE_FACTOR		0.5
+#define IDIO_GC_COMPILE_MIN		(4LL * 1024 * 1024)
+
+static double idio_gc_compile_factor = IDIO_GC_COMPILE_FACTOR;
+static long long idio_gc_compile_live = 0;
+static long long idio_gc_compile_pending = 0;
+
+/*
+ * Collection telemetry
+ *
+ * idio_gc_event describes the most recent collection.  When it
+ * completes, ie. once the lazy sweep has finished, it is written as a
+ * line of JSON to the file named by the environment variable
+ * IDIO_GC_EVENTS, if set.
+ *
+ * Pause durations are recorded in a log-linear histogram: pauses of
+ * less than 32us have their own bucket then each power of two is
+ * split into eight buckets giving a worst case error of 12.5% for the
+ * percentiles.
+ */
+static idio_gc_event_t idio_gc_event;
+static FILE *idio_gc_events_FILE = NULL;
+
+#define IDIO_GC_PAUSE_LINEAR	32
+#define IDIO_GC_PAUSE_SUB_BITS	3
+#define IDIO_GC_PAUSE_BUCKETS	(IDIO_GC_PAUSE_LINEAR + (64 - 5) * (1 << IDIO_GC_PAUSE_SUB_BITS))
+
+static long long idio_gc_pause_hist[IDIO_GC_PAUSE_BUCKETS];
+static long long idio_gc_pause_total = 0;
+static long long idio_gc_pause_max = 0;
+static long long idio_gc_pause_count = 0;
+
+static IDIO idio_gc_stats_type = idio_S_nil;
+static IDIO idio_gc_event_type = idio_S_nil;
 
 /**
  * idio_alloc() - Idio wrapper to allocate memory
@@ -118,6 +241,34 @@ void *idio_alloc (size_t const s)
     return blob;
 }
 
+/**
+ * idio_calloc() - Idio wrapper to allocate zeroed memory
+ * @num: number of elements
+ * @s: size of each element in bytes
+ *
+ * Large allocations come straight from mmap(2) and are already zero
+ * so their pages are only touched as they are used.
+ *
+ * Return:
+ * The allocated blob.
+ */
+void *idio_calloc (size_t const num, size_t const s)
+{
+#ifdef IDIO_MALLOC
+    void *blob = idio_malloc_calloc (num, s);
+#else
+    void *blob = calloc (num, s);
+#endif
+    if (NULL == blob) {
+	idio_error_alloc ("calloc");
+
+	/* notreached */
+	return NULL;
+    }
+
+    return blob;
+}
+
 void *idio_realloc (void *p, size_t const s)
 {
     void *np;
@@ -159,6 +310,157 @@ void idio_gc_free (void *p, size_t size)
     idio_gc_stats_free (size);
 }
 
+/*
+ * Allocation profiling
+ *
+ * When enabled by gc/profile-start every idio_gc_profile_interval'th
+ * allocation, either of an IDIO value through idio_gc_get() or of
+ * memory through idio_gc_alloc(), is attributed to the current
+ * thread's source expression.  idio_gc_alloc() doesn't know the type
+ * it is allocating for but it is nearly always called immediately
+ * after the idio_gc_get() for the value that will own the memory so
+ * we use the most recently got type.
+ *
+ * Sites are identified by (xi, sei, type) and held in a fixed size
+ * open addressed table.  Sampled IDIO values are remembered (up to
+ * IDIO_GC_PROFILE_SAMPLES of them) so that after marking we can count
+ * how many of them from each site have been retained.  Unmarked
+ * samples are dropped before the sweep so we never hold a pointer to
+ * a freed value.
+ */
+#define IDIO_GC_PROFILE_INTERVAL	1024
+#define IDIO_GC_PROFILE_SITES		4096
+#define IDIO_GC_PROFILE_SAMPLES		(64 * 1024)
+
+typedef struct idio_gc_profile_site_s {
+    idio_xi_t xi;
+    IDIO fsei;			/* fixnum or #f */
+    idio_type_e type;
+    size_t count;
+    size_t bytes;
+    size_t retained;
+} idio_gc_profile_site_t;
+
+typedef struct idio_gc_profile_sample_s {
+    IDIO o;
+    idio_gc_profile_site_t *site;
+} idio_gc_profile_sample_t;
+
+static size_t idio_gc_profile_interval = 0;
+static size_t idio_gc_profile_rate = 0;
+static size_t idio_gc_profile_countdown = 0;
+static idio_type_e idio_gc_profile_type = IDIO_TYPE_NONE;
+static idio_gc_profile_site_t *idio_gc_profile_sites = NULL;
+static size_t idio_gc_profile_nsites = 0;
+static size_t idio_gc_profile_dropped = 0;
+static idio_gc_profile_sample_t *idio_gc_profile_samples = NULL;
+static size_t idio_gc_profile_nsamples = 0;
+
+static idio_gc_profile_site_t *idio_gc_profile_site (idio_type_e type)
+{
+    IDIO thr = idio_thread_current_thread ();
+    idio_xi_t xi = IDIO_THREAD_XI (thr);
+    IDIO fsei = IDIO_THREAD_EXPR (thr);
+    if (! idio_isa_fixnum (fsei)) {
+	fsei = idio_S_false;
+    }
+
+    uintptr_t h = (((uintptr_t) fsei) * 31 + xi) * 31 + type;
+    h ^= h >> 16;
+    size_t i = h & (IDIO_GC_PROFILE_SITES - 1);
+    size_t n;
+    for (n = 0; n < IDIO_GC_PROFILE_SITES; n++) {
+	idio_gc_profile_site_t *s = &idio_gc_profile_sites[i];
+	if (0 == s->count) {
+	    /*
+	     * Leave some room so the probe sequences stay short
+	     */
+	    if (idio_gc_profile_nsites >= (IDIO_GC_PROFILE_SITES * 3) / 4) {
+		return NULL;
+	    }
+	    idio_gc_profile_nsites++;
+	    s->xi = xi;
+	    s->fsei = fsei;
+	    s->type = type;
+	    return s;
+	}
+	if (s->fsei == fsei &&
+	    s->xi == xi &&
+	    s->type == type) {
+	    return s;
+	}
+	i = (i + 1) & (IDIO_GC_PROFILE_SITES - 1);
+    }
+
+    return NULL;
+}
+
+static void idio_gc_profile_sample (IDIO o, idio_type_e type, size_t size)
+{
+    idio_gc_profile_countdown = idio_gc_profile_interval;
+
+    idio_gc_profile_site_t *s = idio_gc_profile_site (type);
+    if (NULL == s) {
+	idio_gc_profile_dropped++;
+	return;
+    }
+
+    s->count++;
+    s->bytes += size;
+
+    if (NULL != o &&
+	idio_gc_profile_nsamples < IDIO_GC_PROFILE_SAMPLES) {
+	idio_gc_profile_samples[idio_gc_profile_nsamples].o = o;
+	idio_gc_profile_samples[idio_gc_profile_nsamples].site = s;
+	idio_gc_profile_nsamples++;
+    }
+}
+
+/*
+ * idio_gc_profile_survey() is called between the mark and the sweep
+ */
+static void idio_gc_profile_survey ()
+{
+    if (NULL == idio_gc_profile_sites) {
+	return;
+    }
+
+    size_t i;
+    for (i = 0; i < IDIO_GC_PROFILE_SITES; i++) {
+	idio_gc_profile_sites[i].retained = 0;
+    }
+
+    size_t j = 0;
+    for (i = 0; i < idio_gc_profile_nsamples; i++) {
+	IDIO o = idio_gc_profile_samples[i].o;
+	if (IDIO_GC_FLAG_NOTSTICKY == o->sticky &&
+	    IDIO_GC_FLAG_GCC_WHITE == o->colour) {
+	    continue;
+	}
+
+	idio_gc_profile_samples[i].site->retained++;
+	idio_gc_profile_samples[j++] = idio_gc_profile_samples[i];
+    }
+    idio_gc_profile_nsamples = j;
+}
+
+static void idio_gc_profile_free ()
+{
+    idio_gc_profile_interval = 0;
+
+    if (NULL != idio_gc_profile_sites) {
+	idio_free (idio_gc_profile_sites);
+	idio_gc_profile_sites = NULL;
+    }
+    if (NULL != idio_gc_profile_samples) {
+	idio_free (idio_gc_profile_samples);
+	idio_gc_profile_samples = NULL;
+    }
+    idio_gc_profile_nsites = 0;
+    idio_gc_profile_nsamples = 0;
+    idio_gc_profile_dropped = 0;
+}
+
 /**
  * idio_gc_get_alloc() - get or allocate another ``IDIO`` value
  *
@@ -174,7 +476,6 @@ IDIO idio_gc_get_alloc ()
 {
     IDIO o;
     int n;
-    IDIO_GC_FLAGS (idio_gc0) |= IDIO_GC_FLAG_REQUEST;
     IDIO p = NULL;
     for (n = 0 ; n < IDIO_GC_ALLOC_POOL; n++) {
 	idio_gc->stats.allocs++;
@@ -221,6 +522,11 @@ IDIO idio_gc_get (idio_type_e type)
     idio_gc->stats.tgets[type]++;
 
     IDIO o = idio_gc->free;
+    if (NULL == o &&
+	NULL != idio_gc->unswept) {
+	idio_gc_sweep_lazy (idio_gc);
+	o = idio_gc->free;
+    }
     if (NULL == o) {
 	o = idio_gc_get_alloc ();
     } else {
@@ -229,13 +535,21 @@ IDIO idio_gc_get (idio_type_e type)
 	idio_gc->free = o->next;
     }
 
-    if (idio_gc->stats.igets++ > IDIO_GC_ALLOC_MANY) {
+    if (idio_gc_profile_interval) {
+	idio_gc_profile_type = type;
+	if (0 == --idio_gc_profile_countdown) {
+	    idio_gc_profile_sample (o, type, sizeof (idio_t));
+	}
+    }
+
+    idio_gc->stats.igets++;
+    idio_gc->stats.rbytes += sizeof (idio_t);
+    if (idio_gc_inuse (idio_gc) > idio_gc->stats.trigger) {
 	IDIO_GC_FLAGS (idio_gc0) |= IDIO_GC_FLAG_REQUEST;
     }
 
     /* assign type late in case we've re-used a previous object */
     o->type      = type;
-    o->vtable    = NULL;
     o->gen       = idio_gc->gen;
     o->colour    = IDIO_GC_FLAG_GCC_WHITE;
     o->free      = IDIO_GC_FLAG_NOTFREE;
@@ -269,17 +583,51 @@ IDIO idio_gc_get (idio_type_e type)
  *
  */
 
-void idio_gc_alloc (void **p, size_t const size)
+static void idio_gc_alloc_stats (size_t const size)
 {
-    *p = idio_alloc (size);
     idio_gc->stats.nbytes += size;
     idio_gc->stats.tbytes += size;
+    idio_gc->stats.rbytes += size;
+
+    if (idio_gc_profile_interval &&
+	0 == --idio_gc_profile_countdown) {
+	idio_gc_profile_sample (NULL, idio_gc_profile_type, size);
+    }
+
+    /*
+     * Large buffers can take us over the trigger as readily as many
+     * small values
+     */
+    if (idio_gc_inuse (idio_gc) > idio_gc->stats.trigger) {
+	IDIO_GC_FLAGS (idio_gc0) |= IDIO_GC_FLAG_REQUEST;
+    }
+}
+
+void idio_gc_alloc (void **p, size_t const size)
+{
+    *p = idio_alloc (size);
+    idio_gc_alloc_stats (size);
+}
+
+/**
+ * idio_gc_calloc() - wrappered by IDIO_GC_CALLOC()
+ * @p: pointer to be set
+ * @num: number of elements
+ * @size: size of each element in bytes
+ *
+ */
+
+void idio_gc_calloc (void **p, size_t const num, size_t const size)
+{
+    *p = idio_calloc (num, size);
+    idio_gc_alloc_stats (num * size);
 }
 
 void *idio_gc_realloc (void *p, size_t const size)
 {
     idio_gc->stats.nbytes += size;
     idio_gc->stats.tbytes += size;
+    idio_gc->stats.rbytes += size;
     return idio_realloc (p, size);
 }
 
@@ -341,14 +689,210 @@ void idio_gc_stats_free (size_t const n)
     idio_gc->stats.nbytes -= n;
 }
 
+/*
+ * idio_gc_inuse() - the bytes in use, ie. not counting the free list
+ */
+long long idio_gc_inuse (idio_gc_t *gc)
+{
+    return gc->stats.nbytes - gc->stats.nfree * (long long) sizeof (idio_t);
+}
+
+static void idio_gc_set_trigger (idio_gc_t *gc)
+{
+    long long inuse = idio_gc_inuse (gc);
+    long long trigger = inuse * idio_gc_heap_factor;
+    if (trigger < idio_gc_heap_min) {
+	trigger = idio_gc_heap_min;
+    }
+
+    /*
+     * Don't let the trigger overshoot a limit we are still under
+     * otherwise we'll collect at every safe point
+     */
+    if (idio_gc_heap_soft_limit &&
+	inuse < idio_gc_heap_soft_limit &&
+	trigger > idio_gc_heap_soft_limit) {
+	trigger = idio_gc_heap_soft_limit;
+    }
+
+    if (idio_gc_heap_hard_limit &&
+	inuse < idio_gc_heap_hard_limit) {
+	if (trigger > idio_gc_heap_hard_limit) {
+	    trigger = idio_gc_heap_hard_limit;
+	}
+	idio_gc_heap_limit_raised = 0;
+    }
+
+    gc->stats.trigger = trigger;
+
+    if (gc == idio_gc) {
+	idio_gc_compile_live = inuse;
+    }
+}
+
+/**
+ * idio_gc_compile_start() - note the start of compiling a form
+ *
+ * Return:
+ * a marker to be passed to idio_gc_compile_finish()
+ */
+long long idio_gc_compile_start ()
+{
+    return idio_gc->stats.rbytes;
+}
+
+/**
+ * idio_gc_compile_finish() - note the end of compiling a form
+ * @start: the marker from idio_gc_compile_start()
+ *
+ * Request a collection if enough compilation garbage has accumulated,
+ * see the Compilation garbage commentary, above.
+ */
+void idio_gc_compile_finish (long long start)
+{
+    long long n = idio_gc->stats.rbytes - start;
+
+    idio_gc->stats.compiles++;
+    idio_gc->stats.compile_bytes += n;
+    idio_gc_compile_pending += n;
+
+    if (idio_gc_compile_factor > 0 &&
+	idio_gc_compile_pending >= IDIO_GC_COMPILE_MIN &&
+	idio_gc_compile_pending > idio_gc_compile_live * idio_gc_compile_factor) {
+	IDIO_GC_FLAGS (idio_gc0) |= IDIO_GC_FLAG_REQUEST;
+    }
+}
+
+/*
+ * Finalizers
+ *
+ * Values with a finalizer are held in an open addressed table,
+ * hashed on their address like the root sets, together with their
+ * finalizer function.
+ *
+ * At the end of the mark phase the table is scanned for unmarked
+ * values.  They are moved to the pending queue and, along with
+ * everything they refer to, marked so that they survive this
+ * collection's sweep.  The finalizers are run, in a batch, once the
+ * collection has finished and the values are then regular garbage
+ * for the next collection.
+ *
+ * A slow finalizer, eg. close(2) on a network file system, no longer
+ * holds up the sweep.
+ */
+typedef struct idio_gc_finalizer_s {
+    IDIO o;
+    void (*func) (IDIO o);
+} idio_gc_finalizer_t;
+
+#define IDIO_GC_FINALIZER_TOMBSTONE	idio_S_false
+#define IDIO_GC_FINALIZERS_INITIAL	64
+
+static idio_gc_finalizer_t *idio_gc_finalizers = NULL;
+static size_t idio_gc_finalizers_size = 0;
+static size_t idio_gc_finalizers_count = 0;
+static size_t idio_gc_finalizers_used = 0;
+
+static idio_gc_finalizer_t *idio_gc_finalizers_pending = NULL;
+static size_t idio_gc_finalizers_pending_size = 0;
+static size_t idio_gc_finalizers_npending = 0;
+static size_t idio_gc_finalizers_phead = 0;
+
+static size_t idio_gc_finalizer_index (IDIO o)
+{
+    uint64_t h = (uint64_t) (uintptr_t) o;
+    h *= 0x9E3779B97F4A7C15ULL;
+
+    return (size_t) (h >> 32) & (idio_gc_finalizers_size - 1);
+}
+
+static void idio_gc_finalizer_resize ()
+{
+    size_t osize = idio_gc_finalizers_size;
+    idio_gc_finalizer_t *ofs = idio_gc_finalizers;
+
+    size_t size = IDIO_GC_FINALIZERS_INITIAL;
+    while (size < (idio_gc_finalizers_count + 1) * 4) {
+	size <<= 1;
+    }
+
+    idio_gc_finalizers_size = size;
+    idio_gc_finalizers_used = idio_gc_finalizers_count;
+    idio_gc_finalizers = idio_alloc (size * sizeof (idio_gc_finalizer_t));
+    memset (idio_gc_finalizers, 0, size * sizeof (idio_gc_finalizer_t));
+
+    size_t i;
+    for (i = 0; i < osize; i++) {
+	IDIO o = ofs[i].o;
+	if (NULL != o &&
+	    IDIO_GC_FINALIZER_TOMBSTONE != o) {
+	    size_t j = idio_gc_finalizer_index (o);
+	    while (NULL != idio_gc_finalizers[j].o) {
+		j = (j + 1) & (size - 1);
+	    }
+	    idio_gc_finalizers[j] = ofs[i];
+	}
+    }
+
+    if (NULL != ofs) {
+	idio_free (ofs);
+    }
+}
+
+static idio_gc_finalizer_t *idio_gc_finalizer_find (IDIO o)
+{
+    if (0 == idio_gc_finalizers_count) {
+	return NULL;
+    }
+
+    size_t i = idio_gc_finalizer_index (o);
+    for (;;) {
+	IDIO fo = idio_gc_finalizers[i].o;
+	if (o == fo) {
+	    return &idio_gc_finalizers[i];
+	} else if (NULL == fo) {
+	    return NULL;
+	}
+	i = (i + 1) & (idio_gc_finalizers_size - 1);
+    }
+}
+
+static void idio_gc_finalizer_remove (idio_gc_finalizer_t *f)
+{
+    f->o = IDIO_GC_FINALIZER_TOMBSTONE;
+    f->func = NULL;
+    idio_gc_finalizers_count--;
+}
+
 void idio_gc_register_finalizer (IDIO o, void (*func) (IDIO o))
 {
     IDIO_ASSERT (o);
     IDIO_C_ASSERT (func);
 
-    IDIO ofunc = idio_C_pointer (func);
+    idio_gc_finalizer_t *f = idio_gc_finalizer_find (o);
+    if (NULL != f) {
+	f->func = func;
+	o->finalizer = IDIO_GC_FLAG_FINALIZER;
+	return;
+    }
+
+    if ((idio_gc_finalizers_used + 1) * 4 > idio_gc_finalizers_size * 3) {
+	idio_gc_finalizer_resize ();
+    }
+
+    size_t i = idio_gc_finalizer_index (o);
+    while (NULL != idio_gc_finalizers[i].o &&
+	   IDIO_GC_FINALIZER_TOMBSTONE != idio_gc_finalizers[i].o) {
+	i = (i + 1) & (idio_gc_finalizers_size - 1);
+    }
+
+    if (NULL == idio_gc_finalizers[i].o) {
+	idio_gc_finalizers_used++;
+    }
+    idio_gc_finalizers[i].o = o;
+    idio_gc_finalizers[i].func = func;
+    idio_gc_finalizers_count++;
 
-    idio_hash_put (idio_gc_finalizer_hash, o, ofunc);
     o->finalizer = IDIO_GC_FLAG_FINALIZER;
 }
 
@@ -358,37 +902,109 @@ void idio_gc_deregister_finalizer (IDIO o)
 
     if (IDIO_GC_FLAG_FINALIZER == o->finalizer) {
 	o->finalizer = IDIO_GC_FLAG_NOFINALIZER;
-    } else {
-	/* fprintf (stderr, "final del: already done?\n"); */
-	/* idio_dump (idio_gc_finalizer_hash, 2); */
+
+	idio_gc_finalizer_t *f = idio_gc_finalizer_find (o);
+	if (NULL != f) {
+	    idio_gc_finalizer_remove (f);
+	}
     }
 }
 
+/*
+ * idio_gc_finalizer_run() runs o's finalizer immediately -- it should
+ * only be required when values are being freed without having been
+ * marked, ie. at shutdown
+ */
 static void idio_gc_finalizer_run (IDIO o)
 {
     IDIO_ASSERT (o);
 
-    if (idio_S_nil == o) {
-	return;
+    idio_gc_finalizer_t *f = idio_gc_finalizer_find (o);
+    if (NULL != f) {
+	void (*func) (IDIO o) = f->func;
+	idio_gc_finalizer_remove (f);
+	o->finalizer = IDIO_GC_FLAG_NOFINALIZER;
+
+	(*func) (o);
+	idio_gc->stats.finalized++;
+    } else {
+	fprintf (stderr, "gc-finalizer-run: no finalizer for %10p? (%s)\n", o, idio_type2string (o));
+	exit (4);
     }
+}
 
-    if (idio_S_nil == idio_gc_finalizer_hash) {
-	return;
+/*
+ * idio_gc_finalizer_queue() is called after marking and moves any
+ * unmarked finalizable values to the pending queue, marking them so
+ * they survive the sweep.
+ *
+ * Return:
+ * the number of values queued
+ */
+static size_t idio_gc_finalizer_queue (idio_gc_t *gc)
+{
+    size_t n = 0;
+    size_t i;
+    for (i = 0; i < idio_gc_finalizers_size; i++) {
+	idio_gc_finalizer_t *f = &idio_gc_finalizers[i];
+	IDIO o = f->o;
+	if (NULL == o ||
+	    IDIO_GC_FINALIZER_TOMBSTONE == o ||
+	    IDIO_GC_FLAG_GCC_WHITE != o->colour ||
+	    IDIO_GC_FLAG_NOTSTICKY != o->sticky) {
+	    continue;
+	}
+
+	if (idio_gc_finalizers_npending == idio_gc_finalizers_pending_size) {
+	    idio_gc_finalizers_pending_size = idio_gc_finalizers_pending_size ? idio_gc_finalizers_pending_size * 2 : IDIO_GC_FINALIZERS_INITIAL;
+	    idio_gc_finalizers_pending = idio_realloc (idio_gc_finalizers_pending, idio_gc_finalizers_pending_size * sizeof (idio_gc_finalizer_t));
+	}
+	idio_gc_finalizers_pending[idio_gc_finalizers_npending++] = *f;
+
+	idio_gc_finalizer_remove (f);
+	o->finalizer = IDIO_GC_FLAG_NOFINALIZER;
+
+	idio_gc_gcc_mark (gc, o, IDIO_GC_FLAG_GCC_BLACK);
+	n++;
     }
 
-    IDIO ofunc = idio_hash_ref (idio_gc_finalizer_hash, o);
-    if (idio_S_unspec != ofunc) {
-	IDIO_TYPE_ASSERT (C_pointer, ofunc);
+    while (IDIO_GC_GREYP (gc)) {
+	idio_gc_process_grey (gc, IDIO_GC_FLAG_GCC_BLACK);
+    }
 
-	void (*p) (IDIO o) = IDIO_C_TYPE_POINTER_P (ofunc);
-	(*p) (o);
+    return n;
+}
 
-	idio_gc_deregister_finalizer (o);
-    } else {
-	fprintf (stderr, "gc-finalizer-run: no finalizer for %10p? (%s)\n", o, idio_type2string (o));
-	idio_dump (idio_gc_finalizer_hash, 2);
-	exit (4);
+/*
+ * Pending values must survive any collection triggered before their
+ * finalizers have run
+ */
+static void idio_gc_finalizer_mark_pending (idio_gc_t *gc)
+{
+    size_t i;
+    for (i = idio_gc_finalizers_phead; i < idio_gc_finalizers_npending; i++) {
+	idio_gc_gcc_mark (gc, idio_gc_finalizers_pending[i].o, IDIO_GC_FLAG_GCC_BLACK);
+    }
+}
+
+/*
+ * idio_gc_finalizer_run_pending() runs the queued finalizers in
+ * batch.  Finalizers are run in the order they were queued, a
+ * finalizer that registers or queues more is safe.
+ *
+ * The queue head is advanced before each finalizer is called so that
+ * one that raises a condition (and siglongjmps out of here) or runs a
+ * nested collection does not see its entry run again.
+ */
+static void idio_gc_finalizer_run_pending ()
+{
+    while (idio_gc_finalizers_phead < idio_gc_finalizers_npending) {
+	idio_gc_finalizer_t f = idio_gc_finalizers_pending[idio_gc_finalizers_phead++];
+	(*f.func) (f.o);
+	idio_gc->stats.finalized++;
     }
+    idio_gc_finalizers_phead = 0;
+    idio_gc_finalizers_npending = 0;
 }
 
 void idio_gc_gcc_mark (idio_gc_t *gc, IDIO o, idio_gc_flag_gcc_enum colour)
@@ -436,6 +1052,8 @@ void idio_gc_gcc_mark (idio_gc_t *gc, IDIO o, idio_gc_flag_gcc_enum colour)
 	    break;
 	}
 
+	idio_gc_event.survivors[o->type]++;
+
 	switch (o->type) {
 	case IDIO_TYPE_NONE:
 	    IDIO_C_ASSERT (0);
@@ -448,10 +1066,20 @@ void idio_gc_gcc_mark (idio_gc_t *gc, IDIO o, idio_gc_flag_gcc_enum colour)
 	    o->colour = colour;
 	    idio_gc_gcc_mark (gc, IDIO_SUBSTRING_PARENT (o), colour);
 	    break;
+	case IDIO_TYPE_BYTEVECTOR:
+	    o->colour = colour;
+	    idio_gc_gcc_mark (gc, IDIO_BYTEVECTOR_PARENT (o), colour);
+	    break;
 	case IDIO_TYPE_PAIR:
+	    /*
+	     * Pairs have no grey pointer, push them on the mark stack
+	     */
 	    o->colour = IDIO_GC_FLAG_GCC_LGREY;
-	    IDIO_PAIR_GREY (o) = gc->grey;
-	    gc->grey = o;
+	    if (gc->pairs.n == gc->pairs.size) {
+		gc->pairs.size = gc->pairs.size ? gc->pairs.size * 2 : 1024;
+		gc->pairs.objects = idio_realloc (gc->pairs.objects, gc->pairs.size * sizeof (IDIO));
+	    }
+	    gc->pairs.objects[gc->pairs.n++] = o;
 	    break;
 	case IDIO_TYPE_ARRAY:
 	    o->colour = IDIO_GC_FLAG_GCC_LGREY;
@@ -463,7 +1091,17 @@ void idio_gc_gcc_mark (idio_gc_t *gc, IDIO o, idio_gc_flag_gcc_enum colour)
 	    IDIO_HASH_GREY (o) = gc->grey;
 	    gc->grey = o;
 	    break;
-	case IDIO_TYPE_CLOSURE:
+	case IDIO_TYPE_PMAP:
+	    o->colour = IDIO_GC_FLAG_GCC_LGREY;
+	    IDIO_PMAP_GREY (o) = gc->grey;
+	    gc->grey = o;
+	    break;
+	case IDIO_TYPE_OMAP:
+	    o->colour = IDIO_GC_FLAG_GCC_LGREY;
+	    IDIO_OMAP_GREY (o) = gc->grey;
+	    gc->grey = o;
+	    break;
+	case IDIO_TYPE_CLOSURE:
 	    o->colour = IDIO_GC_FLAG_GCC_LGREY;
 	    IDIO_CLOSURE_GREY (o) = gc->grey;
 	    gc->grey = o;
@@ -539,13 +1177,54 @@ void idio_gc_gcc_mark (idio_gc_t *gc, IDIO o, idio_gc_flag_gcc_enum colour)
     }
 }
 
+/*
+ * idio_gc_mark_hash_entries() marks the live entries in slots [from,
+ * to) of the hash table array hes, which is either of the arrays of
+ * a resizing table.
+ */
+static void idio_gc_mark_hash_entries (idio_gc_t *gc, IDIO o, idio_hash_entry_t *hes, idio_hi_t from, idio_hi_t to, unsigned colour)
+{
+    idio_hi_t i;
+    for (i = from; i < to; i++) {
+	idio_hash_entry_t *he = &hes[i];
+	if (IDIO_HASH_HE_LIVE_P (he)) {
+	    if (!(IDIO_HASH_FLAGS (o) & IDIO_HASH_FLAG_STRING_KEYS)) {
+		idio_gc_gcc_mark (gc, IDIO_HASH_HE_KEY (he), colour);
+	    }
+	    IDIO v = IDIO_HASH_HE_VALUE (he);
+	    if (idio_S_nil != v) {
+		idio_gc_gcc_mark (gc, v, colour);
+	    }
+	}
+    }
+}
+
+static void idio_gc_mark_omap_node (idio_gc_t *gc, idio_omap_node_t *node, unsigned colour)
+{
+    unsigned int i;
+    for (i = 0; i < node->n; i++) {
+	idio_gc_gcc_mark (gc, node->keys[i], colour);
+	idio_gc_gcc_mark (gc, node->values[i], colour);
+    }
+
+    if (! node->leaf) {
+	for (i = 0; i <= node->n; i++) {
+	    idio_gc_mark_omap_node (gc, node->child[i], colour);
+	}
+    }
+}
+
 void idio_gc_process_grey (idio_gc_t *gc, unsigned colour)
 {
 
     IDIO o = gc->grey;
 
     if (NULL == o) {
-	return;
+	if (0 == gc->pairs.n) {
+	    return;
+	}
+
+	o = gc->pairs.objects[--gc->pairs.n];
     }
 
     size_t i;
@@ -554,7 +1233,6 @@ void idio_gc_process_grey (idio_gc_t *gc, unsigned colour)
 
     switch (o->type) {
     case IDIO_TYPE_PAIR:
-	gc->grey = IDIO_PAIR_GREY (o);
 	idio_gc_gcc_mark (gc, IDIO_PAIR_H (o), colour);
 	idio_gc_gcc_mark (gc, IDIO_PAIR_T (o), colour);
 	break;
@@ -569,24 +1247,41 @@ void idio_gc_process_grey (idio_gc_t *gc, unsigned colour)
 	break;
     case IDIO_TYPE_HASH:
 	gc->grey = IDIO_HASH_GREY (o);
-	for (i = 0; i < IDIO_HASH_SIZE (o); i++) {
-	    idio_hash_entry_t *he = IDIO_HASH_HA (o, i);
-	    for ( ; NULL != he; he = IDIO_HASH_HE_NEXT (he)) {
-		if (!(IDIO_HASH_FLAGS (o) & IDIO_HASH_FLAG_STRING_KEYS)) {
-		    IDIO k = IDIO_HASH_HE_KEY (he);
-		    if (idio_S_nil != k) {
-			idio_gc_gcc_mark (gc, k, colour);
-		    }
-		}
-		IDIO v = IDIO_HASH_HE_VALUE (he);
-		if (idio_S_nil != v) {
-		    idio_gc_gcc_mark (gc, v, colour);
-		}
-	    }
+	if (IDIO_HASH_FLAGS (o) & IDIO_HASH_FLAG_WEAK_KEYS) {
+	    /*
+	     * The entries are left to idio_gc_mark_weak() and the
+	     * (now free) grey pointer chains o onto the weak list
+	     */
+	    IDIO_HASH_GREY (o) = gc->weak;
+	    gc->weak = o;
+	    idio_gc_gcc_mark (gc, IDIO_HASH_COMP (o), colour);
+	    idio_gc_gcc_mark (gc, IDIO_HASH_HASH (o), colour);
+	    break;
+	}
+	idio_gc_mark_hash_entries (gc, o, IDIO_HASH_HE (o, 0), 0, IDIO_HASH_SIZE (o), colour);
+	if (NULL != o->u.hash->ohe) {
+	    idio_gc_mark_hash_entries (gc, o, IDIO_HASH_OHE (o, 0), IDIO_HASH_OMIG (o), IDIO_HASH_OSIZE (o), colour);
 	}
 	idio_gc_gcc_mark (gc, IDIO_HASH_COMP (o), colour);
 	idio_gc_gcc_mark (gc, IDIO_HASH_HASH (o), colour);
 	break;
+    case IDIO_TYPE_PMAP:
+	gc->grey = IDIO_PMAP_GREY (o);
+	for (i = 0; i < IDIO_PMAP_N (o); i++) {
+	    idio_hash_entry_t *he = IDIO_PMAP_E (o, i);
+	    if (NULL != IDIO_HASH_HE_KEY (he)) {
+		idio_gc_gcc_mark (gc, IDIO_HASH_HE_KEY (he), colour);
+	    }
+	    idio_gc_gcc_mark (gc, IDIO_HASH_HE_VALUE (he), colour);
+	}
+	break;
+    case IDIO_TYPE_OMAP:
+	gc->grey = IDIO_OMAP_GREY (o);
+	idio_gc_gcc_mark (gc, IDIO_OMAP_LESS (o), colour);
+	if (NULL != IDIO_OMAP_ROOT (o)) {
+	    idio_gc_mark_omap_node (gc, IDIO_OMAP_ROOT (o), colour);
+	}
+	break;
     case IDIO_TYPE_CLOSURE:
 	gc->grey = IDIO_CLOSURE_GREY (o);
 	idio_gc_gcc_mark (gc, IDIO_CLOSURE_FRAME (o), colour);
@@ -618,6 +1313,9 @@ void idio_gc_process_grey (idio_gc_t *gc, unsigned colour)
 	gc->grey = IDIO_HANDLE_GREY (o);
 	idio_gc_gcc_mark (gc, IDIO_HANDLE_FILENAME (o), colour);
 	idio_gc_gcc_mark (gc, IDIO_HANDLE_PATHNAME (o), colour);
+	if (IDIO_HANDLE_FLAGS (o) & IDIO_HANDLE_FLAG_BYTEVECTOR) {
+	    idio_gc_gcc_mark (gc, IDIO_BYTEVECTOR_HANDLE_BV (o), colour);
+	}
 	break;
     case IDIO_TYPE_STRUCT_TYPE:
 	IDIO_C_ASSERT (gc->grey != IDIO_STRUCT_TYPE_GREY (o));
@@ -688,36 +1386,187 @@ void idio_gc_process_grey (idio_gc_t *gc, unsigned colour)
     }
 }
 
-idio_root_t *idio_gc_new_root ()
+/*
+ * The root sets
+ *
+ * Roots are hashed on their address (Fibonacci hashing) and linearly
+ * probed.  Exposing a root leaves a tombstone which is recycled by
+ * the next protect that probes past it or dropped when the set is
+ * resized.
+ */
+#define IDIO_GC_ROOT_TOMBSTONE	idio_S_false
+#define IDIO_GC_ROOTS_INITIAL	64
+
+static idio_root_frame_t *idio_gc_root_frames = NULL;
+
+static size_t idio_gc_root_index (idio_root_t *rs, IDIO o)
 {
+    uint64_t h = (uint64_t) (uintptr_t) o;
+    h *= 0x9E3779B97F4A7C15ULL;
 
-    idio_root_t *r = idio_alloc (sizeof (idio_root_t));
-    r->next = idio_gc->roots;
-    idio_gc->roots = r;
-    r->object = idio_S_nil;
-    return r;
+    return (size_t) (h >> 32) & (rs->size - 1);
 }
 
-idio_root_t *idio_gc_new_auto ()
+static void idio_gc_root_resize (idio_root_t *rs)
 {
+    size_t osize = rs->size;
+    IDIO *oobjects = rs->objects;
 
-    idio_root_t *r = idio_alloc (sizeof (idio_root_t));
-    r->next = idio_gc->autos;
-    idio_gc->autos = r;
-    r->object = idio_S_nil;
-    return r;
+    size_t size = IDIO_GC_ROOTS_INITIAL;
+    while (size < (rs->count + 1) * 4) {
+	size <<= 1;
+    }
+
+    rs->size = size;
+    rs->used = rs->count;
+    rs->objects = idio_alloc (size * sizeof (IDIO));
+    memset (rs->objects, 0, size * sizeof (IDIO));
+
+    size_t i;
+    for (i = 0; i < osize; i++) {
+	IDIO o = oobjects[i];
+	if (NULL != o &&
+	    IDIO_GC_ROOT_TOMBSTONE != o) {
+	    size_t j = idio_gc_root_index (rs, o);
+	    while (NULL != rs->objects[j]) {
+		j = (j + 1) & (size - 1);
+	    }
+	    rs->objects[j] = o;
+	}
+    }
+
+    if (NULL != oobjects) {
+	idio_free (oobjects);
+    }
+}
+
+/*
+ * idio_gc_root_add() returns 0 if o is already in the set
+ */
+static int idio_gc_root_add (idio_root_t *rs, IDIO o)
+{
+    if ((rs->used + 1) * 4 > rs->size * 3) {
+	idio_gc_root_resize (rs);
+    }
+
+    IDIO *ts = NULL;
+    size_t i = idio_gc_root_index (rs, o);
+    for (;;) {
+	IDIO ro = rs->objects[i];
+	if (o == ro) {
+	    return 0;
+	} else if (NULL == ro) {
+	    break;
+	} else if (IDIO_GC_ROOT_TOMBSTONE == ro &&
+		   NULL == ts) {
+	    ts = &rs->objects[i];
+	}
+	i = (i + 1) & (rs->size - 1);
+    }
+
+    if (NULL != ts) {
+	*ts = o;
+    } else {
+	rs->objects[i] = o;
+	rs->used++;
+    }
+    rs->count++;
+
+    return 1;
+}
+
+/*
+ * idio_gc_root_remove() returns 0 if o is not in the set
+ */
+static int idio_gc_root_remove (idio_root_t *rs, IDIO o)
+{
+    if (0 == rs->count) {
+	return 0;
+    }
+
+    size_t i = idio_gc_root_index (rs, o);
+    for (;;) {
+	IDIO ro = rs->objects[i];
+	if (o == ro) {
+	    rs->objects[i] = IDIO_GC_ROOT_TOMBSTONE;
+	    rs->count--;
+	    return 1;
+	} else if (NULL == ro) {
+	    return 0;
+	}
+	i = (i + 1) & (rs->size - 1);
+    }
+}
+
+static void idio_gc_root_mark (idio_gc_t *gc, idio_root_t *rs, idio_gc_flag_gcc_enum colour)
+{
+    size_t i;
+    for (i = 0; i < rs->size; i++) {
+	IDIO o = rs->objects[i];
+	if (NULL != o &&
+	    IDIO_GC_ROOT_TOMBSTONE != o) {
+	    idio_gc_gcc_mark (gc, o, colour);
+	}
+    }
+}
+
+static void idio_gc_root_free (idio_root_t *rs)
+{
+    if (NULL != rs->objects) {
+	idio_free (rs->objects);
+    }
+    rs->size = 0;
+    rs->count = 0;
+    rs->used = 0;
+    rs->objects = NULL;
+}
+
+void idio_gc_root_frame_push (idio_root_frame_t *frame)
+{
+    IDIO_C_ASSERT (frame);
+
+    frame->prev = idio_gc_root_frames;
+    idio_gc_root_frames = frame;
 }
 
-void idio_gc_dump_root (idio_root_t *root)
+void idio_gc_root_frame_pop (idio_root_frame_t *frame)
 {
-    IDIO_C_ASSERT (root);
+    IDIO_C_ASSERT (frame);
+
+    if (frame != idio_gc_root_frames) {
+	idio_coding_error_C ("root frame popped out of order", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+
+	/* notreached */
+	return;
+    }
+
+    idio_gc_root_frames = frame->prev;
+}
+
+idio_root_frame_t *idio_gc_root_frame_top ()
+{
+    return idio_gc_root_frames;
 }
 
-void idio_gc_gcc_mark_root (idio_gc_t *gc, idio_root_t *r, unsigned colour)
+/*
+ * idio_gc_root_frame_reset() discards any frames abandoned by a
+ * siglongjmp()
+ */
+void idio_gc_root_frame_reset (idio_root_frame_t *frame)
 {
-    IDIO_C_ASSERT (r);
+    idio_gc_root_frames = frame;
+}
 
-    idio_gc_gcc_mark (gc, r->object, colour);
+static void idio_gc_root_frame_mark (idio_gc_t *gc, idio_gc_flag_gcc_enum colour)
+{
+    idio_root_frame_t *f = idio_gc_root_frames;
+    while (NULL != f) {
+	size_t i;
+	for (i = 0; i < f->n; i++) {
+	    idio_gc_gcc_mark (gc, *(f->vars[i]), colour);
+	}
+	f = f->prev;
+    }
 }
 
 idio_gc_t *idio_gc_obj_new ()
@@ -731,11 +1580,18 @@ idio_gc_t *idio_gc_obj_new ()
 
     idio_gc_t *c = idio_alloc (sizeof (idio_gc_t));
     c->next = NULL;
-    c->roots = NULL;
-    c->autos = NULL;
+    c->roots.size = 0;
+    c->roots.count = 0;
+    c->roots.used = 0;
+    c->roots.objects = NULL;
+    c->autos = c->roots;
     c->free = NULL;
     c->used = NULL;
+    c->unswept = NULL;
     c->grey = NULL;
+    c->pairs.size = 0;
+    c->pairs.n = 0;
+    c->pairs.objects = NULL;
     c->weak = NULL;
     c->pause = 0;
     c->verbose = 0;
@@ -757,11 +1613,17 @@ idio_gc_t *idio_gc_obj_new ()
     c->stats.allocs = 0;
     c->stats.tbytes = 0;
     c->stats.nbytes = 0;
+    c->stats.rbytes = 0;
+    c->stats.trigger = idio_gc_heap_min;
     for (i = 0; i < IDIO_TYPE_MAX; i++) {
 	c->stats.nused[i] = 0;
     }
     c->stats.collections = 0;
     c->stats.bounces = 0;
+    c->stats.lazy_sweeps = 0;
+    c->stats.finalized = 0;
+    c->stats.compiles = 0;
+    c->stats.compile_bytes = 0;
     c->stats.mark_dur.tv_sec = 0;
     c->stats.mark_dur.tv_usec = 0;
     c->stats.sweep_dur.tv_sec = 0;
@@ -819,13 +1681,7 @@ void idio_gc_dump ()
     idio_gc_t *gc = idio_gc0;
 
     while (NULL != gc) {
-	size_t n = 0;
-	idio_root_t *r = gc->roots;
-	while (NULL != r) {
-	    n++;
-	    idio_gc_dump_root (r);
-	    r = r->next;
-	}
+	size_t n = gc->roots.count;
 	if (n) {
 	    fprintf (stderr, "idio_gc_dump: %" PRIdPTR " roots\n", n);
 	}
@@ -898,20 +1754,9 @@ void idio_gc_protect (IDIO o)
 	return;
     }
 
-    idio_root_t *r = idio_gc->roots;
-    while (NULL != r) {
-	if (o == r->object) {
-	    fprintf (stderr, "root dupe %p\n", o);
-	    return;
-	} else if (idio_S_nil == r->object) {
-	    r->object = o;
-	    return;
-	}
-	r = r->next;
+    if (0 == idio_gc_root_add (&idio_gc->roots, o)) {
+	fprintf (stderr, "root dupe %p\n", o);
     }
-
-    r = idio_gc_new_root ();
-    r->object = o;
 }
 
 /*
@@ -942,20 +1787,9 @@ void idio_gc_protect_auto (IDIO o)
 	return;
     }
 
-    idio_root_t *a = idio_gc->autos;
-    while (NULL != a) {
-	if (o == a->object) {
-	    fprintf (stderr, "auto dupe %p\n", o);
-	    return;
-	} else if (idio_S_nil == a->object) {
-	    a->object = o;
-	    return;
-	}
-	a = a->next;
+    if (0 == idio_gc_root_add (&idio_gc->autos, o)) {
+	fprintf (stderr, "auto dupe %p\n", o);
     }
-
-    a = idio_gc_new_auto ();
-    a->object = o;
 }
 
 /**
@@ -980,58 +1814,31 @@ void idio_gc_expose (IDIO o)
 	return;
     }
 
-    int seen = 0;
     idio_gc_t *gc = idio_gc0;
-    idio_root_t *r;
-    while (! seen &&
-	   NULL != gc) {
-	r = gc->roots;
-	idio_root_t *p = NULL;
-	while (NULL != r) {
-	    if (o == r->object) {
-		seen = 1;
-		if (p) {
-		    p->next = r->next;
-		} else {
-		    gc->roots = r->next;
-		}
-		idio_free (r);
-		break;
-	    } else {
-		p = r;
-	    }
-	    r = r->next;
-	}
-	if (seen) {
-	    break;
-	} else {
-	    gc = gc->next;
+    while (NULL != gc) {
+	if (idio_gc_root_remove (&gc->roots, o)) {
+	    return;
 	}
+	gc = gc->next;
     }
 
-    if (0 == seen) {
-	fprintf (stderr, "idio_gc_expose: o %10p not previously protected\n", o);
-	idio_debug ("o = %s\n", o);
+    fprintf (stderr, "idio_gc_expose: o %10p not previously protected\n", o);
+    idio_debug ("o = %s\n", o);
 
+    gc = idio_gc0;
+    while (NULL != gc) {
 	fprintf (stderr, "idio_gc_expose: #%d currently protected:\n", gc->gen);
-	gc = idio_gc0;
-	while (NULL != gc) {
-	    r = gc->roots;
-	    while (NULL != r) {
-		fprintf (stderr, " %d %10p %s\n", gc->gen, r->object, idio_type2string (r->object));
-		r = r->next;
+	size_t i;
+	for (i = 0; i < gc->roots.size; i++) {
+	    IDIO ro = gc->roots.objects[i];
+	    if (NULL != ro &&
+		IDIO_GC_ROOT_TOMBSTONE != ro) {
+		fprintf (stderr, " %d %10p %s\n", gc->gen, ro, idio_type2string (ro));
 	    }
-	    gc = gc->next;
 	}
-	IDIO_C_ASSERT (seen);
-	return;
-    }
-
-    r = gc->roots;
-    while (NULL != r) {
-	idio_gc_dump_root (r);
-	r = r->next;
+	gc = gc->next;
     }
+    IDIO_C_ASSERT (0);
 }
 
 void idio_gc_expose_roots ()
@@ -1040,48 +1847,45 @@ void idio_gc_expose_roots ()
     while (NULL != gc) {
 #ifdef IDIO_GC_DEBUG
 	fprintf (stderr, "gc-expose-roots #%d\n", gc->gen);
-#endif
-	idio_root_t *r = gc->roots;
-#ifdef IDIO_GC_DEBUG
 	size_t rc = 0;
-#endif
-	while (NULL != r) {
+	size_t i;
+	for (i = 0; i < gc->roots.size; i++) {
+	    IDIO ro = gc->roots.objects[i];
+	    if (NULL == ro ||
+		IDIO_GC_ROOT_TOMBSTONE == ro) {
+		continue;
+	    }
+
 	    /*
-	     * Calling idio_dump (r->object, 1); on shutdown
-	     * is...unwise.  Ultimately, you may end up dumping a
-	     * struct-instance, say, which may require running the VM
-	     * for its as-string function.
+	     * Calling idio_dump (ro, 1); on shutdown is...unwise.
+	     * Ultimately, you may end up dumping a struct-instance,
+	     * say, which may require running the VM for its as-string
+	     * function.
 	     *
 	     * Instead, just a quick note.
 	     */
-#ifdef IDIO_GC_DEBUG
-	    fprintf (stderr, "gc-expose-roots: %10p %-15s ", r->object, idio_type2string (r->object));
-	    switch (idio_type (r->object)) {
+	    fprintf (stderr, "gc-expose-roots: %10p %-15s ", ro, idio_type2string (ro));
+	    switch (idio_type (ro)) {
 	    case IDIO_TYPE_STRUCT_INSTANCE:
 		{
-		    IDIO sit = IDIO_STRUCT_INSTANCE_TYPE (r->object);
+		    IDIO sit = IDIO_STRUCT_INSTANCE_TYPE (ro);
 		    idio_debug ("%s", IDIO_STRUCT_TYPE_NAME (sit));
 		    if (idio_struct_type_isa (sit, idio_evaluate_eenv_type)) {
-			idio_debug (" %s", idio_struct_instance_ref_direct(r->object, IDIO_EENV_ST_DESC));
+			idio_debug (" %s", idio_struct_instance_ref_direct(ro, IDIO_EENV_ST_DESC));
 		    }
 		}
 		break;
 	    }
 	    fprintf (stderr, "\n");
 	    rc++;
-#endif
-	    idio_root_t *n = r->next;
-	    idio_free (r);
-	    r = n;
 	}
 
-#ifdef IDIO_GC_DEBUG
 	if (rc) {
 	    fprintf (stderr, "gc-expose-roots #%d: for %zd roots\n", gc->gen, rc);
 	}
 #endif
 
-	gc->roots = NULL;
+	idio_gc_root_free (&gc->roots);
 	gc = gc->next;
     }
 }
@@ -1090,41 +1894,27 @@ void idio_gc_expose_autos ()
 {
     idio_gc_t *gc = idio_gc0;
     while (NULL != gc) {
-	idio_root_t *a = gc->autos;
-	while (NULL != a) {
-	    idio_root_t *n = a->next;
-	    idio_free (a);
-	    a = n;
-	}
-	gc->autos = NULL;
+	idio_gc_root_free (&gc->autos);
 	gc = gc->next;
     }
 }
 
+/*
+ * idio_gc_add_weak_object() makes the keys of hash table o weak.
+ *
+ * o remains a regular value on the used list, it is only when it is
+ * reached during marking that it is chained onto the collector's weak
+ * list for idio_gc_mark_weak() to process.
+ */
 void idio_gc_add_weak_object (IDIO o)
 {
     IDIO_ASSERT (o);
 
     IDIO_TYPE_ASSERT (hash, o);
 
-    if (idio_gc->used == o) {
-	idio_gc->used = o->next;
-    } else {
-	IDIO p = idio_gc->used;
-	while (NULL != p &&
-	       p->next != o) {
-	    p = p->next;
-	}
-	if (NULL != p) {
-	    p->next = o->next;
-	} else {
-	    fprintf (stderr, "add-weak-obj: %p not on used list?\n", o);
-	    abort ();
-	}
-    }
+    IDIO_C_ASSERT (0 == (IDIO_HASH_FLAGS (o) & IDIO_HASH_FLAG_STRING_KEYS));
 
-    o->next = idio_gc->weak;
-    idio_gc->weak = o;
+    IDIO_HASH_FLAGS (o) |= IDIO_HASH_FLAG_WEAK_KEYS;
 }
 
 void idio_gc_remove_weak_object (IDIO o)
@@ -1133,208 +1923,127 @@ void idio_gc_remove_weak_object (IDIO o)
 
     IDIO_TYPE_ASSERT (hash, o);
 
-    idio_gc_t *gc = idio_gc0;
-    while (NULL != gc) {
-	if (gc->weak == o) {
-	    gc->weak = o->next;
-	    break;
-	} else {
-	    IDIO p = gc->weak;
-	    while (NULL != p &&
-		   p->next != o) {
-		p = p->next;
-	    }
-	    if (NULL != p) {
-		p->next = o->next;
-		break;
-	    }
-	}
-	gc = gc->next;
-    }
+    IDIO_HASH_FLAGS (o) &= ~IDIO_HASH_FLAG_WEAK_KEYS;
+}
 
-    if (NULL != gc) {
-	o->next = gc->used;
-	gc->used = o;
-    } else {
-	fprintf (stderr, "remove weak obj: NULL?\n");
-	abort ();
+/*
+ * idio_gc_weak_key_live() - is weak key k reachable?
+ *
+ * Non-pointer keys, fixnums, constants etc., can never be collected
+ * and so are always live.
+ */
+static int idio_gc_weak_key_live (IDIO k)
+{
+    switch ((uintptr_t) k & IDIO_TYPE_MASK) {
+    case IDIO_TYPE_FIXNUM_MARK:
+    case IDIO_TYPE_CONSTANT_MARK:
+    case IDIO_TYPE_PLACEHOLDER_MARK:
+	return 1;
+    case IDIO_TYPE_POINTER_MARK:
+	return (IDIO_GC_FLAG_GCC_BLACK == k->colour ||
+		IDIO_GC_FLAG_NOTSTICKY != k->sticky);
+    default:
+	/* inconceivable! */
+	idio_error_printf (IDIO_C_FUNC_LOCATION (), "unexpected weak key type %#x", k);
+
+	/* notreached */
+	return 1;
     }
 }
 
 /*
- * This follows in the style of "Implementation - Second try" of Bruno
- * Haible's (commonly referenced) paper:
- * https://www.haible.de/bruno/papers/cs/weak/WeakDatastructures-writeup.html
- *
- * The third, more efficient try, requires "a bit more effort" and
- * only affects large numbers of weak objects.
+ * Weak hash tables are ephemerons: an entry's value is only reachable
+ * through the table if the entry's key is reachable from elsewhere.
  *
- * We can review if it proves to be a problem.
+ * This is "Implementation - Second try" of Bruno Haible's (commonly
+ * referenced) paper:
+ * https://www.haible.de/bruno/papers/cs/weak/WeakDatastructures-writeup.html
+ * although only the weak tables reached in this mark phase are
+ * visited.
  */
-void idio_gc_mark_weak (idio_gc_t *gc)
+static int idio_gc_mark_weak_value (idio_gc_t *gc, idio_hash_entry_t *he)
+{
+    if (IDIO_HASH_HE_LIVE_P (he)) {
+	IDIO v = IDIO_HASH_HE_VALUE (he);
+	if (IDIO_TYPE_POINTER_MARK == ((uintptr_t) v & IDIO_TYPE_MASK) &&
+	    IDIO_GC_FLAG_GCC_BLACK != v->colour &&
+	    idio_gc_weak_key_live (IDIO_HASH_HE_KEY (he))) {
+	    idio_gc_gcc_mark (gc, v, IDIO_GC_FLAG_GCC_BLACK);
+	    return 1;
+	}
+    }
+
+    return 0;
+}
+
+static void idio_gc_mark_weak_values (idio_gc_t *gc)
 {
-    /*
-     * Weak hash table values only get marked if the key has been
-     * marked in the regular mark phase.
-     *
-     * Pass 1: loop until we stop marking values because the key was
-     * marked -- we loop partly as the value (of a weak key) or its
-     * descendents could be a weak key itself.
-     */
-    IDIO o = gc->weak;
     int modified = 1;
     while (modified) {
 	modified = 0;
-	while (NULL != o) {
-	    switch ((uintptr_t) o & IDIO_TYPE_MASK) {
-	    case IDIO_TYPE_FIXNUM_MARK:
-	    case IDIO_TYPE_CONSTANT_MARK:
-	    case IDIO_TYPE_PLACEHOLDER_MARK:
-		break;
-	    case IDIO_TYPE_POINTER_MARK:
-		switch (o->type) {
-		case IDIO_TYPE_HASH:
-		    {
-			idio_hi_t i;
-			for (i = 0; i < IDIO_HASH_SIZE (o); i++) {
-			    idio_hash_entry_t *he = IDIO_HASH_HA (o, i);
-			    for ( ; NULL != he; he = IDIO_HASH_HE_NEXT (he)) {
-				IDIO k = IDIO_HASH_HE_KEY (he);
-				switch ((uintptr_t) k & IDIO_TYPE_MASK) {
-				case IDIO_TYPE_FIXNUM_MARK:
-				case IDIO_TYPE_CONSTANT_MARK:
-				case IDIO_TYPE_PLACEHOLDER_MARK:
-				    break;
-				case IDIO_TYPE_POINTER_MARK:
-				    if (IDIO_GC_FLAG_GCC_BLACK == k->colour) {
-					idio_gc_gcc_mark (gc, IDIO_HASH_HE_VALUE (he), IDIO_GC_FLAG_GCC_BLACK);
-					modified++;
-				    }
-				    break;
-				default:
-				    /* inconceivable! */
-				    idio_error_printf (IDIO_C_FUNC_LOCATION (), "unexpected weak key type %#x", k);
-
-				    /* notreached */
-				    return;
-				}
-			    }
-			}
-		    }
-		    break;
-		default:
-		    /* inconceivable! */
-		    idio_error_printf (IDIO_C_FUNC_LOCATION (), "unexpected weak object type %#x", o);
-
-		    /* notreached */
-		    return;
-		}
-		break;
-	    default:
-		/* inconceivable! */
-		idio_error_printf (IDIO_C_FUNC_LOCATION (), "unexpected weak object type %#x", o);
 
-		/* notreached */
-		return;
+	IDIO o = gc->weak;
+	while (NULL != o) {
+	    idio_hi_t i;
+	    for (i = 0; i < IDIO_HASH_SIZE (o); i++) {
+		modified += idio_gc_mark_weak_value (gc, IDIO_HASH_HE (o, i));
+	    }
+	    for (i = IDIO_HASH_OMIG (o); i < IDIO_HASH_OSIZE (o); i++) {
+		modified += idio_gc_mark_weak_value (gc, IDIO_HASH_OHE (o, i));
 	    }
 
-	    o = o->next;
+	    o = IDIO_HASH_GREY (o);
 	}
 
-	/*
-	 * (Re-)processing the grey list seems like a good idea at
-	 * this point to flush through the values -- which might be
-	 * keys elsewhere.
-	 */
-	while (NULL != gc->grey) {
+	while (IDIO_GC_GREYP (gc)) {
 	    idio_gc_process_grey (gc, IDIO_GC_FLAG_GCC_BLACK);
 	}
     }
+}
 
+void idio_gc_mark_weak (idio_gc_t *gc)
+{
     /*
-     * Pass 2: ditch unmarked key/value pairs
+     * Pass 1: mark the values of live keys.  Marking a value can make
+     * other keys live, or reach other weak tables, so loop until
+     * nothing changes.
      */
-    o = gc->weak;
-    while (NULL != o) {
-	switch ((uintptr_t) o & IDIO_TYPE_MASK) {
-	case IDIO_TYPE_FIXNUM_MARK:
-	case IDIO_TYPE_CONSTANT_MARK:
-	case IDIO_TYPE_PLACEHOLDER_MARK:
-	    break;
-	case IDIO_TYPE_POINTER_MARK:
-	    switch (o->type) {
-	    case IDIO_TYPE_HASH:
-		{
-		    idio_hi_t i;
-		    for (i = 0; i < IDIO_HASH_SIZE (o); i++) {
-			idio_hash_entry_t *hel = IDIO_HASH_HA (o, i);
-			idio_hash_entry_t *he = hel;
-
-			while (NULL != he) {
-			    idio_hash_entry_t *hen = IDIO_HASH_HE_NEXT (he);
-			    IDIO k = IDIO_HASH_HE_KEY (he);
-			    switch ((uintptr_t) k & IDIO_TYPE_MASK) {
-			    case IDIO_TYPE_FIXNUM_MARK:
-			    case IDIO_TYPE_CONSTANT_MARK:
-			    case IDIO_TYPE_PLACEHOLDER_MARK:
-				break;
-			    case IDIO_TYPE_POINTER_MARK:
-				if (IDIO_GC_FLAG_GCC_BLACK == k->colour) {
-				    idio_gc_gcc_mark (gc, IDIO_HASH_HE_VALUE (he), IDIO_GC_FLAG_GCC_BLACK);
-				} else {
-				    if (IDIO_GC_FLAG_FINALIZER == k->finalizer) {
-					idio_gc_finalizer_run (k);
-				    }
-
-				    if (he == hel) {
-					hel = IDIO_HASH_HE_NEXT (he);
-					IDIO_HASH_HA (o, i) = hel;
-					hen = hel;
-				    } else {
-					idio_hash_entry_t *hep = hel;
-					while (IDIO_HASH_HE_NEXT (hep) != he) {
-					    hep = IDIO_HASH_HE_NEXT (hep);
-					}
-					IDIO_HASH_HE_NEXT (hep) = hen;
-				    }
-
-				    IDIO_GC_FREE (he, sizeof (idio_hash_entry_t));
-				    IDIO_HASH_COUNT (o) -= 1;
-				}
-				break;
-			    default:
-				/* inconceivable! */
-				idio_error_printf (IDIO_C_FUNC_LOCATION (), "unexpected weak key type %#x", k);
-
-				/* notreached */
-				return;
-			    }
-
-			    he = hen;
-			}
-		    }
-		}
-		break;
-	    default:
-		/* inconceivable! */
-		idio_error_printf (IDIO_C_FUNC_LOCATION (), "unexpected weak object type %#x", o);
+    idio_gc_mark_weak_values (gc);
 
-		/* notreached */
-		return;
-	    }
-	    break;
-	default:
-	    /* inconceivable! */
-	    idio_error_printf (IDIO_C_FUNC_LOCATION (), "unexpected weak object type %#x", o);
+    /*
+     * Unreachable values with finalizers are resurrected until their
+     * finalizers have run which may, in turn, make more weak keys
+     * live
+     */
+    if (idio_gc_finalizer_queue (gc)) {
+	idio_gc_mark_weak_values (gc);
+    }
 
-	    /* notreached */
-	    return;
+    /*
+     * Pass 2: ditch the entries with dead keys
+     */
+    IDIO o = gc->weak;
+    while (NULL != o) {
+	idio_hi_t i;
+	for (i = 0; i < IDIO_HASH_SIZE (o); i++) {
+	    idio_hash_entry_t *he = IDIO_HASH_HE (o, i);
+	    if (IDIO_HASH_HE_LIVE_P (he) &&
+		! idio_gc_weak_key_live (IDIO_HASH_HE_KEY (he))) {
+		idio_hash_delete_he (o, i);
+	    }
+	}
+	for (i = IDIO_HASH_OMIG (o); i < IDIO_HASH_OSIZE (o); i++) {
+	    idio_hash_entry_t *he = IDIO_HASH_OHE (o, i);
+	    if (IDIO_HASH_HE_LIVE_P (he) &&
+		! idio_gc_weak_key_live (IDIO_HASH_HE_KEY (he))) {
+		idio_hash_delete_ohe (o, i);
+	    }
 	}
 
-	o = o->next;
+	o = IDIO_HASH_GREY (o);
     }
 
-    while (NULL != gc->grey) {
+    while (IDIO_GC_GREYP (gc)) {
 	idio_gc_process_grey (gc, IDIO_GC_FLAG_GCC_BLACK);
     }
 
@@ -1342,72 +2051,44 @@ void idio_gc_mark_weak (idio_gc_t *gc)
     /*
      * Pass 3: verify - because I'm of a nervous disposition
      */
-    int lost = 0;
     o = gc->weak;
     while (NULL != o) {
-	switch ((uintptr_t) o & IDIO_TYPE_MASK) {
-	case IDIO_TYPE_FIXNUM_MARK:
-	case IDIO_TYPE_CONSTANT_MARK:
-	case IDIO_TYPE_PLACEHOLDER_MARK:
-	    break;
-	case IDIO_TYPE_POINTER_MARK:
-	    switch (o->type) {
-	    case IDIO_TYPE_HASH:
-		{
-		    idio_hi_t i;
-		    for (i = 0; i < IDIO_HASH_SIZE (o); i++) {
-			idio_hash_entry_t *hel = IDIO_HASH_HA (o, i);
-			idio_hash_entry_t *he = hel;
-			for ( ; NULL != he; he = IDIO_HASH_HE_NEXT (he)) {
-			    IDIO k = IDIO_HASH_HE_KEY (he);
-			    switch ((uintptr_t) k & IDIO_TYPE_MASK) {
-			    case IDIO_TYPE_FIXNUM_MARK:
-			    case IDIO_TYPE_CONSTANT_MARK:
-			    case IDIO_TYPE_PLACEHOLDER_MARK:
-				break;
-			    case IDIO_TYPE_POINTER_MARK:
-				if (IDIO_GC_FLAG_GCC_BLACK != k->colour) {
-				    fprintf (stderr, "lost key %10p %10p in chain %5zu\n", o, k, i);
-				    lost++;
-				}
-				break;
-			    default:
-				/* inconceivable! */
-				idio_error_printf (IDIO_C_FUNC_LOCATION (), "unexpected weak key type %#x", k);
-
-				/* notreached */
-				return;
-			    }
-			}
-		    }
-		    if (lost) {
-			idio_dump (o, 1);
-		    }
-		}
-		break;
-	    default:
-		/* inconceivable! */
-		idio_error_printf (IDIO_C_FUNC_LOCATION (), "unexpected weak object type %#x", o);
-
-		/* notreached */
-		return;
+	int lost = 0;
+	idio_hi_t i;
+	for (i = 0; i < IDIO_HASH_SIZE (o); i++) {
+	    idio_hash_entry_t *he = IDIO_HASH_HE (o, i);
+	    if (IDIO_HASH_HE_LIVE_P (he) &&
+		! idio_gc_weak_key_live (IDIO_HASH_HE_KEY (he))) {
+		fprintf (stderr, "lost key %10p %10p in slot %5zu\n", o, IDIO_HASH_HE_KEY (he), i);
+		lost++;
 	    }
-	    break;
-	default:
-	    /* inconceivable! */
-	    idio_error_printf (IDIO_C_FUNC_LOCATION (), "unexpected weak object type %#x", o);
-
-	    /* notreached */
-	    return;
 	}
-
-	o = o->next;
+	for (i = IDIO_HASH_OMIG (o); i < IDIO_HASH_OSIZE (o); i++) {
+	    idio_hash_entry_t *he = IDIO_HASH_OHE (o, i);
+	    if (IDIO_HASH_HE_LIVE_P (he) &&
+		! idio_gc_weak_key_live (IDIO_HASH_HE_KEY (he))) {
+		fprintf (stderr, "lost key %10p %10p in old slot %5zu\n", o, IDIO_HASH_HE_KEY (he), i);
+		lost++;
+	    }
+	}
+	if (lost) {
+	    idio_dump (o, 1);
+	}
+
+	o = IDIO_HASH_GREY (o);
     }
 #endif
+
+    gc->weak = NULL;
 }
 
 void idio_gc_mark (idio_gc_t *gc)
 {
+    /*
+     * Anything left unswept from the previous collection must be
+     * swept before we reset the colours
+     */
+    idio_gc_sweep_finish (gc);
 
     IDIO o = gc->used;
     while (NULL != o) {
@@ -1415,20 +2096,15 @@ void idio_gc_mark (idio_gc_t *gc)
 	o = o->next;
     }
     gc->grey = NULL;
+    gc->pairs.n = 0;
+    gc->weak = NULL;
 
-    idio_root_t *r = gc->roots;
-    while (NULL != r) {
-	idio_gc_gcc_mark_root (gc, r, IDIO_GC_FLAG_GCC_BLACK);
-	r = r->next;
-    }
-
-    idio_root_t *a = gc->autos;
-    while (NULL != a) {
-	idio_gc_gcc_mark_root (gc, a, IDIO_GC_FLAG_GCC_BLACK);
-	a = a->next;
-    }
+    idio_gc_root_mark (gc, &gc->roots, IDIO_GC_FLAG_GCC_BLACK);
+    idio_gc_root_mark (gc, &gc->autos, IDIO_GC_FLAG_GCC_BLACK);
+    idio_gc_root_frame_mark (gc, IDIO_GC_FLAG_GCC_BLACK);
+    idio_gc_finalizer_mark_pending (gc);
 
-    while (NULL != gc->grey) {
+    while (IDIO_GC_GREYP (gc)) {
 	idio_gc_process_grey (gc, IDIO_GC_FLAG_GCC_BLACK);
     }
 
@@ -1652,6 +2328,18 @@ void idio_gc_sweep_free_value (IDIO vo)
     case IDIO_TYPE_BITSET:
 	idio_free_bitset (vo);
 	break;
+    case IDIO_TYPE_PMAP:
+	idio_free_pmap (vo);
+	break;
+    case IDIO_TYPE_OMAP:
+	idio_free_omap (vo);
+	break;
+    case IDIO_TYPE_TVECTOR:
+	idio_free_tvector (vo);
+	break;
+    case IDIO_TYPE_BYTEVECTOR:
+	idio_free_bytevector (vo);
+	break;
     default:
 	idio_coding_error_C ("unexpected type", vo, IDIO_C_FUNC_LOCATION ());
 
@@ -1661,24 +2349,182 @@ void idio_gc_sweep_free_value (IDIO vo)
     }
 }
 
-size_t idio_gc_sweep (idio_gc_t *gc)
+static int idio_gc_pause_bucket (long long us)
 {
-    while (gc->stats.nfree > IDIO_GC_ALLOC_MANY) {
-    	IDIO fo = gc->free;
-	gc->free = fo->next;
-	IDIO_GC_FREE (fo, sizeof (idio_t));
-	gc->stats.nfree--;
+    if (us < IDIO_GC_PAUSE_LINEAR) {
+	if (us < 0) {
+	    us = 0;
+	}
+	return us;
+    }
+
+    int e = 63 - __builtin_clzll ((unsigned long long) us);
+    int m = (us >> (e - IDIO_GC_PAUSE_SUB_BITS)) & ((1 << IDIO_GC_PAUSE_SUB_BITS) - 1);
+
+    return IDIO_GC_PAUSE_LINEAR + (e - 5) * (1 << IDIO_GC_PAUSE_SUB_BITS) + m;
+}
+
+/*
+ * idio_gc_pause_bucket_max() - the largest pause in bucket b
+ */
+static long long idio_gc_pause_bucket_max (int b)
+{
+    if (b < IDIO_GC_PAUSE_LINEAR) {
+	return b;
+    }
+
+    b -= IDIO_GC_PAUSE_LINEAR;
+    int e = 5 + b / (1 << IDIO_GC_PAUSE_SUB_BITS);
+    int m = b % (1 << IDIO_GC_PAUSE_SUB_BITS);
+
+    return ((long long) ((1 << IDIO_GC_PAUSE_SUB_BITS) + m + 1) << (e - IDIO_GC_PAUSE_SUB_BITS)) - 1;
+}
+
+/*
+ * idio_gc_pause_percentile() - the pause, in usec, at or below which
+ * pc percent of pauses fall
+ */
+static long long idio_gc_pause_percentile (int pc)
+{
+    if (0 == idio_gc_pause_count) {
+	return 0;
+    }
+
+    long long rank = (idio_gc_pause_count * pc + 99) / 100;
+    long long n = 0;
+    int b;
+    for (b = 0; b < IDIO_GC_PAUSE_BUCKETS; b++) {
+	n += idio_gc_pause_hist[b];
+	if (n >= rank) {
+	    long long r = idio_gc_pause_bucket_max (b);
+	    if (r > idio_gc_pause_max) {
+		r = idio_gc_pause_max;
+	    }
+	    return r;
+	}
+    }
+
+    return idio_gc_pause_max;
+}
+
+static void idio_gc_event_begin (idio_gc_t *gc, char const *reason, struct timeval *startp)
+{
+    idio_gc_event.seq = gc->stats.collections;
+    idio_gc_event.reason = reason;
+    idio_gc_event.start = *startp;
+    idio_gc_event.pause = 0;
+
+    long long nobj = 0;
+    int i;
+    for (i = 0; i < IDIO_TYPE_MAX; i++) {
+	nobj += gc->stats.nused[i];
+	idio_gc_event.survivors[i] = 0;
+    }
+    idio_gc_event.objects_before = nobj;
+    idio_gc_event.objects_after = 0;
+    idio_gc_event.bytes_before = idio_gc_inuse (idio_gc);
+    idio_gc_event.bytes_after = -1;
+    idio_gc_event.bytes_freed = 0;
+    idio_gc_event.pausing = 1;
+    idio_gc_event.sweeping = 0;
+}
+
+/*
+ * idio_gc_event_pause() is called at the end of idio_gc_collect()
+ */
+static void idio_gc_event_pause ()
+{
+    struct timeval t;
+    if (gettimeofday (&t, NULL) < 0) {
+	perror ("gc-event-pause: gettimeofday");
+    }
+
+    long long us = (t.tv_sec - idio_gc_event.start.tv_sec) * 1000000LL + (t.tv_usec - idio_gc_event.start.tv_usec);
+    if (us < 0) {
+	us = 0;
+    }
+
+    idio_gc_event.pause = us;
+    idio_gc_event.pausing = 0;
+
+    long long nobj = 0;
+    int i;
+    for (i = 0; i < IDIO_TYPE_MAX; i++) {
+	nobj += idio_gc_event.survivors[i];
+    }
+    idio_gc_event.objects_after = nobj;
+
+    idio_gc_pause_hist[idio_gc_pause_bucket (us)]++;
+    idio_gc_pause_count++;
+    idio_gc_pause_total += us;
+    if (us > idio_gc_pause_max) {
+	idio_gc_pause_max = us;
+    }
+}
+
+/*
+ * idio_gc_event_complete() is called when both the pause and the
+ * sweep are done
+ */
+static void idio_gc_event_complete ()
+{
+    if (NULL == idio_gc_events_FILE) {
+	return;
+    }
+
+    fprintf (idio_gc_events_FILE,
+	     "{\"pid\":%" PRIdMAX ",\"gc\":%lld,\"reason\":\"%s\",\"start\":%" PRIdMAX ".%06ld,\"pause_us\":%lld,\"objects_before\":%lld,\"objects_after\":%lld,\"bytes_before\":%lld,\"bytes_after\":%lld,\"survivors\":{",
+	     (intmax_t) getpid (),
+	     idio_gc_event.seq,
+	     idio_gc_event.reason,
+	     (intmax_t) idio_gc_event.start.tv_sec,
+	     (long) idio_gc_event.start.tv_usec,
+	     idio_gc_event.pause,
+	     idio_gc_event.objects_before,
+	     idio_gc_event.objects_after,
+	     idio_gc_event.bytes_before,
+	     idio_gc_event.bytes_after);
+
+    char *sep = "";
+    int i;
+    for (i = 1; i < IDIO_TYPE_MAX; i++) {
+	if (idio_gc_event.survivors[i]) {
+	    fprintf (idio_gc_events_FILE, "%s\"%s\":%lld", sep, idio_type_enum2string (i), idio_gc_event.survivors[i]);
+	    sep = ",";
+	}
     }
 
+    fprintf (idio_gc_events_FILE, "}}\n");
+}
+
+/*
+ * Lazy sweeping
+ *
+ * Rather than walk the entire used list immediately after marking we
+ * move the marked used list onto the unswept list and sweep it on
+ * demand, IDIO_GC_SWEEP_LAZY objects at a time, from idio_gc_get()
+ * when the free list is empty.  The collector's pause is then just
+ * the mark phase and the cost of sweeping is spread across the
+ * mutator.
+ *
+ * Objects allocated after the mark phase go onto the used list
+ * (white, as usual) and are not at risk from the unswept list.
+ *
+ * Any outstanding unswept objects must be swept before the next mark
+ * phase, see idio_gc_sweep_finish().
+ */
+#define IDIO_GC_SWEEP_LAZY	1E3
+
+static size_t idio_gc_sweep_some (idio_gc_t *gc, size_t n)
+{
     size_t nobj = 0;
 #ifdef IDIO_GC_DEBUG
     size_t freed = 0;
 #endif
 
-    IDIO co = gc->used;
-    IDIO po = NULL;
-    IDIO no = NULL;
-    while (NULL != co) {
+    while (nobj < n &&
+	   NULL != gc->unswept) {
+	IDIO co = gc->unswept;
 	IDIO_ASSERT (co);
 	nobj++;
 	if (IDIO_GC_FLAG_FREE == co->free) {
@@ -1689,19 +2535,20 @@ size_t idio_gc_sweep (idio_gc_t *gc)
 	    fprintf (stderr, "\n");
 	}
 
-	no = co->next;
+	/*
+	 * Detach co before freeing it in case freeing it calls
+	 * idio_gc_get() and we recurse
+	 */
+	gc->unswept = co->next;
 
 	if ((IDIO_GC_FLAG_NOTSTICKY == co->sticky) &&
 	    (IDIO_GC_FLAG_GCC_WHITE == co->colour)) {
 	    gc->stats.nused[co->type]--;
-	    if (po) {
-		po->next = co->next;
-	    } else {
-		gc->used = co->next;
-	    }
 
 	    IDIO_C_ASSERT (IDIO_TYPE_NONE != co->type);
+	    long long nbytes0 = idio_gc->stats.nbytes;
 	    idio_gc_sweep_free_value (co);
+	    idio_gc_event.bytes_freed += nbytes0 - idio_gc->stats.nbytes + sizeof (idio_t);
 
 	    co->type = IDIO_TYPE_NONE;
 	    co->free = IDIO_GC_FLAG_FREE;
@@ -1712,34 +2559,108 @@ size_t idio_gc_sweep (idio_gc_t *gc)
 	    freed++;
 #endif
 	} else {
-	    po = co;
+	    co->next = gc->used;
+	    gc->used = co;
 	}
+    }
 
-	co = no;
+    /*
+     * The trigger set in idio_gc_sweep_start() was an over-estimate
+     * as it included the unswept garbage
+     */
+    if (nobj &&
+	NULL == gc->unswept) {
+	idio_gc_set_trigger (gc);
     }
 
-#ifdef IDIO_GC_DEBUG
-    pid_t pid = getpid ();
-    if (pid == idio_pid) {
-	fprintf (stderr, "[%" PRIdMAX "] gc-sweep #%d: saw %7zd obj; freed %6zd ", (intmax_t) pid, gc->gen, nobj, freed);
-	double freed100 = freed * 100.0;
-	if (nobj) {
-	    fprintf (stderr, "%5.1f%% ", freed100 / nobj);
-	} else {
-	    fprintf (stderr, "    0%% ");
+    if (gc == idio_gc &&
+	NULL == gc->unswept &&
+	idio_gc_event.sweeping) {
+	idio_gc_event.sweeping = 0;
+	idio_gc_event.bytes_after = idio_gc_event.bytes_before - idio_gc_event.bytes_freed;
+	if (0 == idio_gc_event.pausing) {
+	    idio_gc_event_complete ();
 	}
-	if (gc->stats.igets) {
-	    fprintf (stderr, "%5.1f%% ", freed100 / gc->stats.igets);
-	} else {
-	    fprintf (stderr, "    0%% ");
+    }
+
+#ifdef IDIO_GC_DEBUG
+    if (n > IDIO_GC_SWEEP_LAZY) {
+	pid_t pid = getpid ();
+	if (pid == idio_pid) {
+	    fprintf (stderr, "[%" PRIdMAX "] gc-sweep #%d: saw %7zd obj; freed %6zd ", (intmax_t) pid, gc->gen, nobj, freed);
+	    double freed100 = freed * 100.0;
+	    if (nobj) {
+		fprintf (stderr, "%5.1f%% ", freed100 / nobj);
+	    } else {
+		fprintf (stderr, "    0%% ");
+	    }
+	    if (gc->stats.igets) {
+		fprintf (stderr, "%5.1f%% ", freed100 / gc->stats.igets);
+	    } else {
+		fprintf (stderr, "    0%% ");
+	    }
+	    fprintf (stderr, "; %7zd obj rem\n", nobj - freed);
 	}
-	fprintf (stderr, "; %7zd obj rem\n", nobj - freed);
     }
 #endif
 
     return nobj;
 }
 
+/*
+ * idio_gc_sweep_start() is the tail of a collection: trim the free
+ * list and queue the marked used list for sweeping
+ */
+static void idio_gc_sweep_start (idio_gc_t *gc)
+{
+    while (gc->stats.nfree > IDIO_GC_ALLOC_MANY) {
+    	IDIO fo = gc->free;
+	gc->free = fo->next;
+	IDIO_GC_FREE (fo, sizeof (idio_t));
+	gc->stats.nfree--;
+    }
+
+    IDIO_C_ASSERT (NULL == gc->unswept);
+    gc->unswept = gc->used;
+    gc->used = NULL;
+
+    if (gc == idio_gc) {
+	idio_gc_event.sweeping = 1;
+	idio_gc_compile_pending = 0;
+    }
+
+    idio_gc_set_trigger (gc);
+}
+
+/*
+ * idio_gc_sweep_finish() sweeps anything outstanding from the last
+ * collection
+ */
+static size_t idio_gc_sweep_finish (idio_gc_t *gc)
+{
+    return idio_gc_sweep_some (gc, SIZE_MAX);
+}
+
+/*
+ * idio_gc_sweep_lazy() is called from idio_gc_get() when the free
+ * list is empty
+ */
+static void idio_gc_sweep_lazy (idio_gc_t *gc)
+{
+    while (NULL == gc->free &&
+	   NULL != gc->unswept) {
+	gc->stats.lazy_sweeps++;
+	idio_gc_sweep_some (gc, IDIO_GC_SWEEP_LAZY);
+    }
+}
+
+size_t idio_gc_sweep (idio_gc_t *gc)
+{
+    idio_gc_sweep_start (gc);
+
+    return idio_gc_sweep_finish (gc);
+}
+
 static FILE *idio_gc_stats_FILE = NULL;
 
 void idio_gc_stats ()
@@ -1836,6 +2757,10 @@ void idio_gc_stats ()
 		case IDIO_TYPE_THREAD:          size = sizeof (idio_thread_t);          break;
 		case IDIO_TYPE_CONTINUATION:    size = sizeof (idio_continuation_t);    break;
 		case IDIO_TYPE_BITSET:          size = sizeof (idio_bitset_t);          break;
+		case IDIO_TYPE_PMAP:            size = sizeof (idio_pmap_t);            break;
+		case IDIO_TYPE_OMAP:            size = sizeof (idio_omap_t);            break;
+		case IDIO_TYPE_TVECTOR:         size = sizeof (idio_tvector_t);         break;
+		case IDIO_TYPE_BYTEVECTOR:      size = sizeof (idio_bytevector_t);      break;
 		case IDIO_TYPE_C_CHAR:
 		case IDIO_TYPE_C_SCHAR:
 		case IDIO_TYPE_C_UCHAR:
@@ -1910,35 +2835,19 @@ void idio_gc_stats ()
 
 	fprintf (idio_gc_stats_FILE, "gc-stats: %4lld%cB current bytes referenced\n", count, scales[scale]);
 
-	int rc = 0;
-	idio_root_t *r = gc->roots;
-	while (NULL != r) {
-	    switch (r->object->type) {
-	    default:
-		rc++;
-		break;
-	    }
-	    r = r->next;
-	}
+	count = gc->stats.trigger;
+	scale = 0;
+	idio_hcount (&count, &scale);
 
-	count = rc;
+	fprintf (idio_gc_stats_FILE, "gc-stats: %4lld%cB collection trigger (factor %.2f, min %lld)\n", count, scales[scale], idio_gc_heap_factor, idio_gc_heap_min);
+
+	count = gc->roots.count;
 	scale = 0;
 	idio_hcount (&count, &scale);
 
 	fprintf (idio_gc_stats_FILE, "gc-stats: %4lld%c  roots\n", count, scales[scale]);
 
-	int ac = 0;
-	idio_root_t *a = gc->autos;
-	while (NULL != a) {
-	    switch (a->object->type) {
-	    default:
-		ac++;
-		break;
-	    }
-	    a = a->next;
-	}
-
-	count = ac;
+	count = gc->autos.count;
 	scale = 0;
 	idio_hcount (&count, &scale);
 
@@ -1984,6 +2893,43 @@ void idio_gc_stats ()
 
 	fprintf (idio_gc_stats_FILE, "gc-stats: %4lld%c  on used list\n", count, scales[scale]);
 
+	int sc = 0;
+	o = gc->unswept;
+	while (NULL != o) {
+	    sc++;
+	    o = o->next;
+	}
+
+	count = sc;
+	scale = 0;
+	idio_hcount (&count, &scale);
+
+	fprintf (idio_gc_stats_FILE, "gc-stats: %4lld%c  on unswept list\n", count, scales[scale]);
+
+	count = gc->stats.lazy_sweeps;
+	scale = 0;
+	idio_hcount (&count, &scale);
+
+	fprintf (idio_gc_stats_FILE, "gc-stats: %4lld%c  lazy sweeps\n", count, scales[scale]);
+
+	count = gc->stats.finalized;
+	scale = 0;
+	idio_hcount (&count, &scale);
+
+	fprintf (idio_gc_stats_FILE, "gc-stats: %4lld%c  finalizers run\n", count, scales[scale]);
+
+	count = gc->stats.compiles;
+	scale = 0;
+	idio_hcount (&count, &scale);
+
+	fprintf (idio_gc_stats_FILE, "gc-stats: %4lld%c  forms compiled", count, scales[scale]);
+
+	count = gc->stats.compile_bytes;
+	scale = 0;
+	idio_hcount (&count, &scale);
+
+	fprintf (idio_gc_stats_FILE, " requesting %4lld%cB (factor %.2f)\n", count, scales[scale], idio_gc_compile_factor);
+
 	struct rusage ru;
 	if (getrusage (RUSAGE_SELF, &ru) < 0) {
 	    perror ("gc-stats: getrusage");
@@ -2015,6 +2961,13 @@ void idio_gc_stats ()
 #endif
 	idio_hcount (&count, &scale);
 
+	fprintf (idio_gc_stats_FILE, "gc-stats: GC pauses p50/p90/p99/max %lldus/%lldus/%lldus/%lldus total %lldus\n",
+		 idio_gc_pause_percentile (50),
+		 idio_gc_pause_percentile (90),
+		 idio_gc_pause_percentile (99),
+		 idio_gc_pause_max,
+		 idio_gc_pause_total);
+
 	fprintf (idio_gc_stats_FILE, "gc-stats: GC time dur mark/sweep %ld.%03lds/%ld.%03lds ru u+s %6.3f; max RSS %lld%cB\n",
 		 (long) gc->stats.mark_dur.tv_sec, (long) gc->stats.mark_dur.tv_usec / 1000,
 		 (long) gc->stats.sweep_dur.tv_sec, (long) gc->stats.sweep_dur.tv_usec / 1000,
@@ -2042,8 +2995,8 @@ void idio_gc_possibly_collect ()
      * There's no good answer.
      *
      * We're normally here because IDIO_GC_FLAG_REQUEST has been set
-     * in idio_gc_get_alloc() because there's nothing left on the free
-     * list.
+     * in idio_gc_get() because the bytes in use have exceeded the
+     * trigger, see idio_gc_set_trigger().
      */
     if (idio_gc0->pause == 0 &&
 	((IDIO_GC_FLAGS (idio_gc0) & IDIO_GC_FLAG_REQUEST))) {
@@ -2062,6 +3015,50 @@ void idio_gc_possibly_collect ()
     }
 }
 
+/**
+ * idio_gc_heap_limit_condition() - check the hard heap limit
+ *
+ * Called from the VM's safe point after idio_gc_possibly_collect().
+ *
+ * Return:
+ * an ^rt-heap-limit-error condition if the bytes in use exceed the
+ * hard heap limit or ``#n``
+ */
+IDIO idio_gc_heap_limit_condition ()
+{
+    if (0 == idio_gc_heap_hard_limit ||
+	idio_gc_heap_limit_raised ||
+	idio_gc_inuse (idio_gc) <= idio_gc_heap_hard_limit) {
+	return idio_S_nil;
+    }
+
+    /*
+     * Any collection will have left its garbage on the unswept list
+     */
+    idio_gc_sweep_finish (idio_gc);
+
+    long long inuse = idio_gc_inuse (idio_gc);
+    if (inuse <= idio_gc_heap_hard_limit) {
+	return idio_S_nil;
+    }
+
+    idio_gc_heap_limit_raised = 1;
+
+    IDIO msh;
+    IDIO lsh;
+    IDIO dsh;
+    idio_error_init (&msh, &lsh, &dsh, IDIO_C_FUNC_LOCATION ());
+
+    idio_display_C ("hard heap limit exceeded", msh);
+
+    return idio_struct_instance (idio_condition_rt_heap_limit_error_type,
+				 IDIO_LIST5 (idio_get_output_string (msh),
+					     idio_get_output_string (lsh),
+					     idio_get_output_string (dsh),
+					     idio_integer (inuse),
+					     idio_integer (idio_gc_heap_hard_limit)));
+}
+
 void idio_gc_collect (idio_gc_t *gc, int gen, char const *caller)
 {
     /* idio_gc_stats ();   */
@@ -2073,6 +3070,27 @@ void idio_gc_collect (idio_gc_t *gc, int gen, char const *caller)
     gc->stats.collections++;
     IDIO_GC_FLAGS (idio_gc0) &= ~ IDIO_GC_FLAG_REQUEST;
 
+    struct timeval t_start;
+    if (gettimeofday (&t_start, NULL) < 0) {
+	perror ("gc-collect: gettimeofday");
+    }
+
+    /*
+     * Complete the previous collection before starting a new record
+     */
+    idio_gc_t *gcs = gc;
+    while (NULL != gcs) {
+	idio_gc_sweep_finish (gcs);
+
+	if (IDIO_GC_COLLECT_GEN == gen) {
+	    break;
+	}
+
+	gcs = gcs->next;
+    }
+
+    idio_gc_event_begin (gc, caller, &t_start);
+
     struct timeval t0;
     struct timeval t_mark;
     struct timeval t_sweep;
@@ -2120,16 +3138,27 @@ void idio_gc_collect (idio_gc_t *gc, int gen, char const *caller)
     }
     gc = gc0;
 
+    idio_gc_profile_survey ();
+
     while (NULL != gc) {
 	if (gettimeofday (&t0, NULL) < 0) {
 	    perror ("gc-collect: gettimeofday");
 	}
 
+	if (gc == idio_gc &&
+	    0 == (IDIO_GC_FLAGS (idio_gc0) & IDIO_GC_FLAG_FINISH)) {
+	    /*
+	     * The allocating generation is swept lazily by
+	     * idio_gc_get()
+	     */
+	    idio_gc_sweep_start (gc);
+	} else {
 #ifdef IDIO_GC_DEBUG
-	nobj += idio_gc_sweep (gc);
+	    nobj += idio_gc_sweep (gc);
 #else
-	idio_gc_sweep (gc);
+	    idio_gc_sweep (gc);
 #endif
+	}
 
 	if (gettimeofday (&t_sweep, NULL) < 0) {
 	    perror ("gc-collect: gettimeofday");
@@ -2156,6 +3185,11 @@ void idio_gc_collect (idio_gc_t *gc, int gen, char const *caller)
     }
     gc = gc0;
 
+    idio_gc_event_pause ();
+    if (0 == idio_gc_event.sweeping) {
+	idio_gc_event_complete ();
+    }
+
     struct rusage ru1;
     if (getrusage (RUSAGE_SELF, &ru1) < 0) {
 	perror ("gc-collect: getrusage");
@@ -2203,29 +3237,8 @@ void idio_gc_collect (idio_gc_t *gc, int gen, char const *caller)
 		 (long) s_mark, (long) us_mark / 1000,
 		 (long) s_sweep, (long) us_sweep / 1000);
 
-	int rc = 0;
-	idio_root_t *r = gc->roots;
-	while (NULL != r) {
-	    switch (r->object->type) {
-	    default:
-		rc++;
-		break;
-	    }
-	    r = r->next;
-	}
-	fprintf (stderr, " %2d roots ", rc);
-
-	int ac = 0;
-	idio_root_t *a = gc->autos;
-	while (NULL != a) {
-	    switch (a->object->type) {
-	    default:
-		ac++;
-		break;
-	    }
-	    a = a->next;
-	}
-	fprintf (stderr, " %6d autos", ac);
+	fprintf (stderr, " %2zu roots ", gc->roots.count);
+	fprintf (stderr, " %6zu autos", gc->autos.count);
 
 	if (us_mark) {
 	    fprintf (stderr, " %6zu in %6ldus = %5.1f", nobj, (long) us_mark, 1.0 * nobj / us_mark);
@@ -2266,6 +3279,11 @@ void idio_gc_collect (idio_gc_t *gc, int gen, char const *caller)
 	gc->stats.ru_stime.tv_sec += 1;
     }
     gc->stats.ru_stime.tv_sec += s;
+
+    /*
+     * The collection is over, run any finalizers that were queued
+     */
+    idio_gc_finalizer_run_pending ();
 }
 
 void idio_gc_collect_gen (char const *caller)
@@ -2356,6 +3374,8 @@ void idio_gc_obj_free ()
 
     idio_gc_t *gc = idio_gc0;
     while (NULL != gc) {
+	idio_gc_sweep_finish (gc);
+
 	size_t n = 0;
 	while (NULL != gc->free) {
 	    IDIO co = gc->free;
@@ -2377,6 +3397,10 @@ void idio_gc_obj_free ()
 	    fprintf (stderr, "gc-obj-free #%d: %zu remained in use\n", gc->gen, n);
 	}
 
+	if (NULL != gc->pairs.objects) {
+	    idio_free (gc->pairs.objects);
+	}
+
 	idio_gc_t *ngc = gc->next;
 	idio_free (gc);
 	gc = ngc;
@@ -2500,53 +3524,696 @@ invoke the garbage collector			\n\
     return idio_S_unspec;
 }
 
-void idio_gc_add_primitives ()
+IDIO_DEFINE_PRIMITIVE0V_DS ("gc/heap-factor", gc_heap_factor, (IDIO args), "[factor]", "\
+get or set the heap growth factor			\n\
+							\n\
+A collection is triggered when the bytes in use exceed	\n\
+the bytes in use after the previous collection		\n\
+multiplied by the heap growth factor.			\n\
+							\n\
+:param factor: new heap growth factor, defaults to no change	\n\
+:type factor: real >= 1.1, optional			\n\
+:return: the heap growth factor			\n\
+:rtype: real						\n\
+")
 {
-    IDIO_ADD_PRIMITIVE (gc_collect);
-}
+    IDIO_ASSERT (args);
 
-static void idio_gc_run_all_finalizers ()
-{
-    if (idio_S_nil == idio_gc_finalizer_hash) {
-	return;
-    }
+    /*
+     * Test Case: n/a
+     *
+     * args is the varargs parameter -- should always be a list
+     */
+    IDIO_USER_TYPE_ASSERT (list, args);
+
+    if (idio_isa_pair (args)) {
+	IDIO factor = IDIO_PAIR_H (args);
+
+	double C_factor = 0;
+	if (idio_isa_fixnum (factor)) {
+	    C_factor = IDIO_FIXNUM_VAL (factor);
+	} else if (idio_isa_bignum (factor)) {
+	    C_factor = idio_bignum_double_value (factor);
+	} else {
+	    /*
+	     * Test Case: gc-errors/gc-heap-factor-bad-type.idio
+	     *
+	     * gc/heap-factor #t
+	     */
+	    idio_error_param_type ("number", factor, IDIO_C_FUNC_LOCATION ());
+
+	    return idio_S_notreached;
+	}
 
-    IDIO keys = idio_hash_keys_to_list (idio_gc_finalizer_hash);
-    while (idio_S_nil != keys) {
-	IDIO k = IDIO_PAIR_H (keys);
+	if (C_factor < IDIO_GC_HEAP_FACTOR_MIN) {
+	    /*
+	     * Test Case: gc-errors/gc-heap-factor-too-small.idio
+	     *
+	     * gc/heap-factor 1
+	     */
+	    idio_error_param_value_msg ("gc/heap-factor", "factor", factor, "should be >= 1.1", IDIO_C_FUNC_LOCATION ());
 
-	if (IDIO_GC_FLAG_FINALIZER == k->finalizer) {
-	    /* apply the finalizer */
-	    IDIO C_p = idio_hash_ref (idio_gc_finalizer_hash, k);
-	    void (*func) (IDIO o) = IDIO_C_TYPE_POINTER_P (C_p);
-	    (*func) (k);
+	    return idio_S_notreached;
 	}
 
-	keys = IDIO_PAIR_T (keys);
+	idio_gc_heap_factor = C_factor;
+	idio_gc_set_trigger (idio_gc);
     }
 
-    idio_gc_remove_weak_object (idio_gc_finalizer_hash);
+    return idio_bignum_double (idio_gc_heap_factor);
 }
 
-void idio_final_gc ()
+IDIO_DEFINE_PRIMITIVE0V_DS ("gc/heap-min", gc_heap_min, (IDIO args), "[bytes]", "\
+get or set the minimum heap size			\n\
+							\n\
+No collection is triggered until at least this many	\n\
+bytes are in use.					\n\
+							\n\
+:param bytes: new minimum heap size, defaults to no change	\n\
+:type bytes: integer >= 1048576, optional		\n\
+:return: the minimum heap size				\n\
+:rtype: integer					\n\
+")
 {
-    if (idio_vm_reports) {
-	idio_gc_stats ();
-#ifdef IDIO_DEBUG
+    IDIO_ASSERT (args);
+
+    /*
+     * Test Case: n/a
+     *
+     * args is the varargs parameter -- should always be a list
+     */
+    IDIO_USER_TYPE_ASSERT (list, args);
+
+    if (idio_isa_pair (args)) {
+	IDIO bytes = IDIO_PAIR_H (args);
+
+	long long C_bytes = 0;
+	if (idio_isa_fixnum (bytes)) {
+	    C_bytes = IDIO_FIXNUM_VAL (bytes);
+	} else if (idio_isa_bignum (bytes) &&
+		   IDIO_BIGNUM_INTEGER_P (bytes)) {
+	    C_bytes = idio_bignum_int64_t_value (bytes);
+	} else {
+	    /*
+	     * Test Case: gc-errors/gc-heap-min-bad-type.idio
+	     *
+	     * gc/heap-min #t
+	     */
+	    idio_error_param_type ("integer", bytes, IDIO_C_FUNC_LOCATION ());
+
+	    return idio_S_notreached;
+	}
+
+	if (C_bytes < IDIO_GC_HEAP_MIN_MIN) {
+	    /*
+	     * Test Case: gc-errors/gc-heap-min-too-small.idio
+	     *
+	     * gc/heap-min 1
+	     */
+	    idio_error_param_value_msg ("gc/heap-min", "bytes", bytes, "should be >= 1048576", IDIO_C_FUNC_LOCATION ());
+
+	    return idio_S_notreached;
+	}
+
+	idio_gc_heap_min = C_bytes;
+	idio_gc_set_trigger (idio_gc);
+    }
+
+    return idio_integer (idio_gc_heap_min);
+}
+
+IDIO_DEFINE_PRIMITIVE0V_DS ("gc/compile-factor", gc_compile_factor, (IDIO args), "[factor]", "\
+get or set the compilation garbage factor		\n\
+							\n\
+A collection is requested when the bytes requested	\n\
+while compiling forms since the previous collection	\n\
+exceed the bytes in use after the previous collection	\n\
+multiplied by the compilation garbage factor.		\n\
+							\n\
+A factor of zero disables these requests.		\n\
+							\n\
+:param factor: new compilation garbage factor, defaults to no change	\n\
+:type factor: real >= 0, optional			\n\
+:return: the compilation garbage factor		\n\
+:rtype: real						\n\
+")
+{
+    IDIO_ASSERT (args);
+
+    /*
+     * Test Case: n/a
+     *
+     * args is the varargs parameter -- should always be a list
+     */
+    IDIO_USER_TYPE_ASSERT (list, args);
+
+    if (idio_isa_pair (args)) {
+	IDIO factor = IDIO_PAIR_H (args);
+
+	double C_factor = 0;
+	if (idio_isa_fixnum (factor)) {
+	    C_factor = IDIO_FIXNUM_VAL (factor);
+	} else if (idio_isa_bignum (factor)) {
+	    C_factor = idio_bignum_double_value (factor);
+	} else {
+	    /*
+	     * Test Case: gc-errors/gc-compile-factor-bad-type.idio
+	     *
+	     * gc/compile-factor #t
+	     */
+	    idio_error_param_type ("number", factor, IDIO_C_FUNC_LOCATION ());
+
+	    return idio_S_notreached;
+	}
+
+	if (C_factor < 0) {
+	    /*
+	     * Test Case: gc-errors/gc-compile-factor-negative.idio
+	     *
+	     * gc/compile-factor -1
+	     */
+	    idio_error_param_value_msg ("gc/compile-factor", "factor", factor, "should be >= 0", IDIO_C_FUNC_LOCATION ());
+
+	    return idio_S_notreached;
+	}
+
+	idio_gc_compile_factor = C_factor;
+    }
+
+    return idio_bignum_double (idio_gc_compile_factor);
+}
+
+static long long idio_gc_heap_limit_bytes (IDIO bytes, char const *func)
+{
+    IDIO_ASSERT (bytes);
+    IDIO_C_ASSERT (func);
+
+    long long C_bytes = 0;
+    if (idio_isa_fixnum (bytes)) {
+	C_bytes = IDIO_FIXNUM_VAL (bytes);
+    } else if (idio_isa_bignum (bytes) &&
+	       IDIO_BIGNUM_INTEGER_P (bytes)) {
+	C_bytes = idio_bignum_int64_t_value (bytes);
+    } else {
+	/*
+	 * Test Case: gc-errors/gc-heap-soft-limit-bad-type.idio
+	 * Test Case: gc-errors/gc-heap-hard-limit-bad-type.idio
+	 *
+	 * gc/heap-soft-limit #t
+	 */
+	idio_error_param_type ("integer", bytes, IDIO_C_FUNC_LOCATION_S (func));
+
+	/* notreached */
+	return -1;
+    }
+
+    if (C_bytes &&
+	C_bytes < IDIO_GC_HEAP_MIN_MIN) {
+	/*
+	 * Test Case: gc-errors/gc-heap-soft-limit-too-small.idio
+	 * Test Case: gc-errors/gc-heap-hard-limit-too-small.idio
+	 *
+	 * gc/heap-soft-limit 1
+	 */
+	idio_error_param_value_msg (func, "bytes", bytes, "should be 0 or >= 1048576", IDIO_C_FUNC_LOCATION_S (func));
+
+	/* notreached */
+	return -1;
+    }
+
+    return C_bytes;
+}
+
+IDIO_DEFINE_PRIMITIVE0V_DS ("gc/heap-soft-limit", gc_heap_soft_limit, (IDIO args), "[bytes]", "\
+get or set the soft heap limit				\n\
+							\n\
+A full collection is forced when the bytes in use	\n\
+cross the soft heap limit.				\n\
+							\n\
+:param bytes: new soft heap limit, defaults to no change	\n\
+:type bytes: integer, 0 or >= 1048576, optional		\n\
+:return: the soft heap limit, 0 means no limit		\n\
+:rtype: integer					\n\
+")
+{
+    IDIO_ASSERT (args);
+
+    /*
+     * Test Case: n/a
+     *
+     * args is the varargs parameter -- should always be a list
+     */
+    IDIO_USER_TYPE_ASSERT (list, args);
+
+    if (idio_isa_pair (args)) {
+	idio_gc_heap_soft_limit = idio_gc_heap_limit_bytes (IDIO_PAIR_H (args), "gc/heap-soft-limit");
+	idio_gc_set_trigger (idio_gc);
+    }
+
+    return idio_integer (idio_gc_heap_soft_limit);
+}
+
+IDIO_DEFINE_PRIMITIVE0V_DS ("gc/heap-hard-limit", gc_heap_hard_limit, (IDIO args), "[bytes]", "\
+get or set the hard heap limit				\n\
+							\n\
+If the bytes in use exceed the hard heap limit after	\n\
+a full collection then an ``^rt-heap-limit-error``	\n\
+condition is raised.					\n\
+							\n\
+The condition is not raised again until a collection	\n\
+brings the bytes in use back under the limit.		\n\
+							\n\
+:param bytes: new hard heap limit, defaults to no change	\n\
+:type bytes: integer, 0 or >= 1048576, optional		\n\
+:return: the hard heap limit, 0 means no limit		\n\
+:rtype: integer					\n\
+")
+{
+    IDIO_ASSERT (args);
+
+    /*
+     * Test Case: n/a
+     *
+     * args is the varargs parameter -- should always be a list
+     */
+    IDIO_USER_TYPE_ASSERT (list, args);
+
+    if (idio_isa_pair (args)) {
+	idio_gc_heap_hard_limit = idio_gc_heap_limit_bytes (IDIO_PAIR_H (args), "gc/heap-hard-limit");
+	idio_gc_heap_limit_raised = 0;
+	idio_gc_set_trigger (idio_gc);
+    }
+
+    return idio_integer (idio_gc_heap_hard_limit);
+}
+
+static IDIO idio_gc_event_instance ()
+{
+    IDIO survivors = idio_S_nil;
+    int i;
+    for (i = IDIO_TYPE_MAX - 1; i > 0; i--) {
+	if (idio_gc_event.survivors[i]) {
+	    char const *tn = idio_type_enum2string (i);
+	    survivors = idio_pair (idio_pair (idio_symbols_C_intern (tn, strlen (tn)),
+					      idio_integer (idio_gc_event.survivors[i])),
+				   survivors);
+	}
+    }
+
+    IDIO bytes_after = idio_S_false;
+    if (0 == idio_gc_event.sweeping) {
+	bytes_after = idio_integer (idio_gc_event.bytes_after);
+    }
+
+    return idio_struct_instance (idio_gc_event_type,
+				 idio_listv (IDIO_GC_EVENT_ST_SIZE,
+					     idio_integer (idio_gc_event.seq),
+					     idio_string_C (idio_gc_event.reason),
+					     idio_integer (idio_gc_event.start.tv_sec * 1000000LL + idio_gc_event.start.tv_usec),
+					     idio_integer (idio_gc_event.pause),
+					     idio_integer (idio_gc_event.objects_before),
+					     idio_integer (idio_gc_event.objects_after),
+					     idio_integer (idio_gc_event.bytes_before),
+					     bytes_after,
+					     survivors));
+}
+
+IDIO_DEFINE_PRIMITIVE0_DS ("gc/stats", gc_stats, (void), "", "\
+return the garbage collector statistics		\n\
+							\n\
+The result is a ``%idio-gc-stats`` struct instance	\n\
+with fields:						\n\
+							\n\
+* ``collections``					\n\
+* ``bytes``, the bytes in use				\n\
+* ``trigger``, the bytes in use to trigger a collection	\n\
+* ``total-bytes``, the bytes ever allocated		\n\
+* ``objects``, the objects in use			\n\
+* ``free``, the objects on the free list		\n\
+* ``finalized``, the finalizers run			\n\
+* ``pause-total``, ``pause-max``, ``pause-p50``,	\n\
+  ``pause-p90``, ``pause-p99`` in microseconds		\n\
+* ``last``, a ``%idio-gc-event`` struct instance	\n\
+  describing the last collection or ``#f``		\n\
+							\n\
+A ``%idio-gc-event`` has fields:			\n\
+							\n\
+* ``gc``, the collection number			\n\
+* ``reason``, a string					\n\
+* ``start``, in microseconds since the epoch		\n\
+* ``pause``, in microseconds				\n\
+* ``objects-before``, ``objects-after``		\n\
+* ``bytes-before``, ``bytes-after`` (``#f`` until the	\n\
+  sweep has completed)					\n\
+* ``survivors``, a list of (type . count)		\n\
+							\n\
+:return: garbage collector statistics			\n\
+:rtype: struct instance				\n\
+")
+{
+    long long nobj = 0;
+    int i;
+    for (i = 0; i < IDIO_TYPE_MAX; i++) {
+	nobj += idio_gc->stats.nused[i];
+    }
+
+    IDIO last = idio_S_false;
+    if (idio_gc0->stats.collections) {
+	last = idio_gc_event_instance ();
+    }
+
+    return idio_struct_instance (idio_gc_stats_type,
+				 idio_listv (IDIO_GC_STATS_ST_SIZE,
+					     idio_integer (idio_gc0->stats.collections),
+					     idio_integer (idio_gc_inuse (idio_gc)),
+					     idio_integer (idio_gc->stats.trigger),
+					     idio_integer (idio_gc->stats.tbytes),
+					     idio_integer (nobj),
+					     idio_integer (idio_gc->stats.nfree),
+					     idio_integer (idio_gc->stats.finalized),
+					     idio_integer (idio_gc_pause_total),
+					     idio_integer (idio_gc_pause_max),
+					     idio_integer (idio_gc_pause_percentile (50)),
+					     idio_integer (idio_gc_pause_percentile (90)),
+					     idio_integer (idio_gc_pause_percentile (99)),
+					     last));
+}
+
+IDIO_DEFINE_PRIMITIVE0V_DS ("gc/profile-start", gc_profile_start, (IDIO args), "[interval]", "\
+start sampling allocations				\n\
+							\n\
+Every `interval`'th allocation is attributed to the	\n\
+current source expression.  Any previous profile is	\n\
+discarded.						\n\
+							\n\
+:param interval: sampling interval, defaults to 1024	\n\
+:type interval: positive fixnum, optional		\n\
+:return: ``#<unspec>``					\n\
+							\n\
+See :ref:`gc/profile-report <gc/profile-report>`.	\n\
+")
+{
+    IDIO_ASSERT (args);
+
+    /*
+     * Test Case: n/a
+     *
+     * args is the varargs parameter -- should always be a list
+     */
+    IDIO_USER_TYPE_ASSERT (list, args);
+
+    size_t C_interval = IDIO_GC_PROFILE_INTERVAL;
+    if (idio_isa_pair (args)) {
+	IDIO interval = IDIO_PAIR_H (args);
+
+	if (! idio_isa_fixnum (interval)) {
+	    /*
+	     * Test Case: gc-errors/gc-profile-start-bad-type.idio
+	     *
+	     * gc/profile-start #t
+	     */
+	    idio_error_param_type ("fixnum", interval, IDIO_C_FUNC_LOCATION ());
+
+	    return idio_S_notreached;
+	}
+
+	if (IDIO_FIXNUM_VAL (interval) < 1) {
+	    /*
+	     * Test Case: gc-errors/gc-profile-start-too-small.idio
+	     *
+	     * gc/profile-start 0
+	     */
+	    idio_error_param_value_msg ("gc/profile-start", "interval", interval, "should be > 0", IDIO_C_FUNC_LOCATION ());
+
+	    return idio_S_notreached;
+	}
+
+	C_interval = IDIO_FIXNUM_VAL (interval);
+    }
+
+    idio_gc_profile_free ();
+
+    size_t size = IDIO_GC_PROFILE_SITES * sizeof (idio_gc_profile_site_t);
+    idio_gc_profile_sites = idio_alloc (size);
+    memset (idio_gc_profile_sites, 0, size);
+    idio_gc_profile_samples = idio_alloc (IDIO_GC_PROFILE_SAMPLES * sizeof (idio_gc_profile_sample_t));
+
+    idio_gc_profile_rate = C_interval;
+    idio_gc_profile_countdown = C_interval;
+    idio_gc_profile_interval = C_interval;
+
+    return idio_S_unspec;
+}
+
+IDIO_DEFINE_PRIMITIVE0_DS ("gc/profile-stop", gc_profile_stop, (void), "", "\
+stop sampling allocations				\n\
+							\n\
+The profile is kept for :ref:`gc/profile-report		\n\
+<gc/profile-report>` and retained values continue to be	\n\
+counted at each collection.				\n\
+							\n\
+:return: ``#<unspec>``					\n\
+")
+{
+    idio_gc_profile_interval = 0;
+
+    return idio_S_unspec;
+}
+
+static int idio_gc_profile_count_cmp (void const *p1, void const *p2)
+{
+    idio_gc_profile_site_t const *s1 = *(idio_gc_profile_site_t * const *) p1;
+    idio_gc_profile_site_t const *s2 = *(idio_gc_profile_site_t * const *) p2;
+
+    return (s1->count < s2->count) - (s1->count > s2->count);
+}
+
+static int idio_gc_profile_retained_cmp (void const *p1, void const *p2)
+{
+    idio_gc_profile_site_t const *s1 = *(idio_gc_profile_site_t * const *) p1;
+    idio_gc_profile_site_t const *s2 = *(idio_gc_profile_site_t * const *) p2;
+
+    return (s1->retained < s2->retained) - (s1->retained > s2->retained);
+}
+
+IDIO_DEFINE_PRIMITIVE0V_DS ("gc/profile-report", gc_profile_report, (IDIO args), "[limit [retained]]", "\
+return the top allocation sites			\n\
+							\n\
+Each site is a list of ``(location type count bytes)``	\n\
+where `count` and `bytes` are estimates, the number of	\n\
+samples multiplied by the sampling interval.		\n\
+							\n\
+If `retained` is true then sites are ranked by the	\n\
+number of their sampled values that survived the most	\n\
+recent collection and `bytes` counts only those values	\n\
+themselves, not any memory they refer to.		\n\
+							\n\
+:param limit: maximum number of sites, defaults to 20	\n\
+:type limit: positive fixnum, optional			\n\
+:param retained: report retained values, defaults to ``#f``	\n\
+:type retained: boolean, optional			\n\
+:return: list of sites					\n\
+:rtype: list						\n\
+")
+{
+    IDIO_ASSERT (args);
+
+    /*
+     * Test Case: n/a
+     *
+     * args is the varargs parameter -- should always be a list
+     */
+    IDIO_USER_TYPE_ASSERT (list, args);
+
+    idio_as_t limit = 20;
+    int retained = 0;
+    if (idio_isa_pair (args)) {
+	IDIO ilimit = IDIO_PAIR_H (args);
+
+	if (! idio_isa_fixnum (ilimit)) {
+	    /*
+	     * Test Case: gc-errors/gc-profile-report-bad-type.idio
+	     *
+	     * gc/profile-report #t
+	     */
+	    idio_error_param_type ("fixnum", ilimit, IDIO_C_FUNC_LOCATION ());
+
+	    return idio_S_notreached;
+	}
+
+	if (IDIO_FIXNUM_VAL (ilimit) < 1) {
+	    /*
+	     * Test Case: gc-errors/gc-profile-report-limit-too-small.idio
+	     *
+	     * gc/profile-report 0
+	     */
+	    idio_error_param_value_msg ("gc/profile-report", "limit", ilimit, "should be > 0", IDIO_C_FUNC_LOCATION ());
+
+	    return idio_S_notreached;
+	}
+
+	limit = IDIO_FIXNUM_VAL (ilimit);
+
+	args = IDIO_PAIR_T (args);
+	if (idio_isa_pair (args)) {
+	    retained = idio_S_false != IDIO_PAIR_H (args);
+	}
+    }
+
+    if (NULL == idio_gc_profile_sites ||
+	0 == idio_gc_profile_nsites) {
+	return idio_S_nil;
+    }
+
+    /*
+     * Take a copy of the interesting sites as creating the result
+     * may add more
+     */
+    idio_gc_profile_site_t **sites = idio_alloc (idio_gc_profile_nsites * sizeof (idio_gc_profile_site_t *));
+    size_t n = 0;
+    size_t i;
+    for (i = 0; i < IDIO_GC_PROFILE_SITES && n < idio_gc_profile_nsites; i++) {
+	idio_gc_profile_site_t *s = &idio_gc_profile_sites[i];
+	if (s->count &&
+	    (0 == retained ||
+	     s->retained)) {
+	    sites[n++] = s;
+	}
+    }
+
+    qsort (sites, n, sizeof (idio_gc_profile_site_t *), retained ? idio_gc_profile_retained_cmp : idio_gc_profile_count_cmp);
+
+    if ((size_t) limit < n) {
+	n = limit;
+    }
+
+    IDIO r = idio_S_nil;
+    while (n-- > 0) {
+	idio_gc_profile_site_t *s = sites[n];
+
+	IDIO loc;
+	if (idio_isa_fixnum (s->fsei)) {
+	    loc = idio_vm_src_location (s->xi, s->fsei);
+	} else {
+	    loc = idio_string_C ("<no source expression>");
+	}
+	char const *tn = idio_type_enum2string (s->type);
+
+	size_t count = retained ? s->retained : s->count;
+	size_t bytes = retained ? s->retained * sizeof (idio_t) : s->bytes;
+
+	r = idio_pair (IDIO_LIST4 (loc,
+				   idio_symbols_C_intern (tn, strlen (tn)),
+				   idio_integer (count * idio_gc_profile_rate),
+				   idio_integer (bytes * idio_gc_profile_rate)),
+		       r);
+    }
+
+    idio_free (sites);
+
+    return r;
+}
+
+void idio_gc_add_primitives ()
+{
+    IDIO sym = IDIO_SYMBOL ("%idio-gc-stats");
+    idio_gc_stats_type = idio_struct_type (sym,
+					   idio_S_nil,
+					   idio_listv (IDIO_GC_STATS_ST_SIZE,
+						       IDIO_SYMBOL ("collections"),
+						       IDIO_SYMBOL ("bytes"),
+						       IDIO_SYMBOL ("trigger"),
+						       IDIO_SYMBOL ("total-bytes"),
+						       IDIO_SYMBOL ("objects"),
+						       IDIO_SYMBOL ("free"),
+						       IDIO_SYMBOL ("finalized"),
+						       IDIO_SYMBOL ("pause-total"),
+						       IDIO_SYMBOL ("pause-max"),
+						       IDIO_SYMBOL ("pause-p50"),
+						       IDIO_SYMBOL ("pause-p90"),
+						       IDIO_SYMBOL ("pause-p99"),
+						       IDIO_SYMBOL ("last")));
+    idio_module_set_symbol_value (sym, idio_gc_stats_type, idio_Idio_module);
+
+    sym = IDIO_SYMBOL ("%idio-gc-event");
+    idio_gc_event_type = idio_struct_type (sym,
+					   idio_S_nil,
+					   idio_listv (IDIO_GC_EVENT_ST_SIZE,
+						       IDIO_SYMBOL ("gc"),
+						       IDIO_SYMBOL ("reason"),
+						       IDIO_SYMBOL ("start"),
+						       IDIO_SYMBOL ("pause"),
+						       IDIO_SYMBOL ("objects-before"),
+						       IDIO_SYMBOL ("objects-after"),
+						       IDIO_SYMBOL ("bytes-before"),
+						       IDIO_SYMBOL ("bytes-after"),
+						       IDIO_SYMBOL ("survivors")));
+    idio_module_set_symbol_value (sym, idio_gc_event_type, idio_Idio_module);
+
+    IDIO_ADD_PRIMITIVE (gc_collect);
+    IDIO_ADD_PRIMITIVE (gc_stats);
+    IDIO_ADD_PRIMITIVE (gc_heap_factor);
+    IDIO_ADD_PRIMITIVE (gc_heap_min);
+    IDIO_ADD_PRIMITIVE (gc_compile_factor);
+    IDIO_ADD_PRIMITIVE (gc_heap_soft_limit);
+    IDIO_ADD_PRIMITIVE (gc_heap_hard_limit);
+    IDIO_ADD_PRIMITIVE (gc_profile_start);
+    IDIO_ADD_PRIMITIVE (gc_profile_stop);
+    IDIO_ADD_PRIMITIVE (gc_profile_report);
+}
+
+static void idio_gc_run_all_finalizers ()
+{
+    idio_gc_finalizer_run_pending ();
+
+    /*
+     * Detach the table in case a finalizer (de)registers another
+     */
+    idio_gc_finalizer_t *fs = idio_gc_finalizers;
+    size_t size = idio_gc_finalizers_size;
+    idio_gc_finalizers = NULL;
+    idio_gc_finalizers_size = 0;
+    idio_gc_finalizers_count = 0;
+    idio_gc_finalizers_used = 0;
+
+    size_t i;
+    for (i = 0; i < size; i++) {
+	IDIO o = fs[i].o;
+	if (NULL != o &&
+	    IDIO_GC_FINALIZER_TOMBSTONE != o) {
+	    o->finalizer = IDIO_GC_FLAG_NOFINALIZER;
+	    (*fs[i].func) (o);
+	    idio_gc->stats.finalized++;
+	}
+    }
+
+    if (NULL != fs) {
+	idio_free (fs);
+    }
+
+    if (NULL != idio_gc_finalizers_pending) {
+	idio_free (idio_gc_finalizers_pending);
+	idio_gc_finalizers_pending = NULL;
+    }
+    idio_gc_finalizers_pending_size = 0;
+    idio_gc_finalizers_npending = 0;
+    idio_gc_finalizers_phead = 0;
+}
+
+void idio_final_gc ()
+{
+    if (idio_vm_reports) {
+	idio_gc_stats ();
 #ifdef IDIO_MALLOC
 	idio_malloc_stats ("final-gc");
-#endif
 #endif
     }
 
     IDIO_GC_FLAGS (idio_gc0) |= IDIO_GC_FLAG_FINISH;
 
-    idio_gc_run_all_finalizers ();
+    idio_gc_profile_free ();
 
-    /* unprotect the finalizer hash itself */
-    idio_gc_expose (idio_gc_finalizer_hash);
-    /*  prevent it being used */
-    idio_gc_finalizer_hash = idio_S_nil;
+    idio_gc_run_all_finalizers ();
 
     idio_gc_expose_autos ();
 
@@ -2557,26 +4224,159 @@ void idio_final_gc ()
     idio_gc_dump ();
 #endif
     idio_gc_obj_free ();
+
+    if (NULL != idio_gc_events_FILE) {
+	fclose (idio_gc_events_FILE);
+	idio_gc_events_FILE = NULL;
+    }
+}
+
+/*
+ * idio_gc_getenv_bytes() - parse a byte count with an optional K, M
+ * or G suffix
+ *
+ * Return:
+ * -1 on error
+ */
+static long long idio_gc_getenv_bytes (char const *s)
+{
+    char *end;
+    errno = 0;
+    long long r = strtoll (s, &end, 10);
+
+    if (errno ||
+	end == s ||
+	r < 0) {
+	return -1;
+    }
+
+    switch (*end) {
+    case '\0':
+	return r;
+    case 'k':
+    case 'K':
+	r *= 1024;
+	break;
+    case 'm':
+    case 'M':
+	r *= 1024 * 1024;
+	break;
+    case 'g':
+    case 'G':
+	r *= 1024 * 1024 * 1024;
+	break;
+    default:
+	return -1;
+    }
+
+    if ('\0' != end[1]) {
+	return -1;
+    }
+
+    return r;
+}
+
+static void idio_gc_getenv ()
+{
+    char *e = getenv ("IDIO_GC_HEAP_FACTOR");
+    if (NULL != e) {
+	char *end;
+	errno = 0;
+	double f = strtod (e, &end);
+	if (errno ||
+	    end == e ||
+	    '\0' != *end) {
+	    fprintf (stderr, "WARNING: IDIO_GC_HEAP_FACTOR=%s is not a number: ignored\n", e);
+	} else {
+	    if (f < IDIO_GC_HEAP_FACTOR_MIN) {
+		f = IDIO_GC_HEAP_FACTOR_MIN;
+	    }
+	    idio_gc_heap_factor = f;
+	}
+    }
+
+    e = getenv ("IDIO_GC_COMPILE_FACTOR");
+    if (NULL != e) {
+	char *end;
+	errno = 0;
+	double f = strtod (e, &end);
+	if (errno ||
+	    end == e ||
+	    '\0' != *end ||
+	    f < 0) {
+	    fprintf (stderr, "WARNING: IDIO_GC_COMPILE_FACTOR=%s is not a non-negative number: ignored\n", e);
+	} else {
+	    idio_gc_compile_factor = f;
+	}
+    }
+
+    e = getenv ("IDIO_GC_HEAP_MIN");
+    if (NULL != e) {
+	long long b = idio_gc_getenv_bytes (e);
+	if (b < 0) {
+	    fprintf (stderr, "WARNING: IDIO_GC_HEAP_MIN=%s is not a byte count: ignored\n", e);
+	} else {
+	    if (b < IDIO_GC_HEAP_MIN_MIN) {
+		b = IDIO_GC_HEAP_MIN_MIN;
+	    }
+	    idio_gc_heap_min = b;
+	}
+    }
+
+    e = getenv ("IDIO_GC_HEAP_SOFT_LIMIT");
+    if (NULL != e) {
+	long long b = idio_gc_getenv_bytes (e);
+	if (b < 0) {
+	    fprintf (stderr, "WARNING: IDIO_GC_HEAP_SOFT_LIMIT=%s is not a byte count: ignored\n", e);
+	} else {
+	    if (b &&
+		b < IDIO_GC_HEAP_MIN_MIN) {
+		b = IDIO_GC_HEAP_MIN_MIN;
+	    }
+	    idio_gc_heap_soft_limit = b;
+	}
+    }
+
+    e = getenv ("IDIO_GC_HEAP_HARD_LIMIT");
+    if (NULL != e) {
+	long long b = idio_gc_getenv_bytes (e);
+	if (b < 0) {
+	    fprintf (stderr, "WARNING: IDIO_GC_HEAP_HARD_LIMIT=%s is not a byte count: ignored\n", e);
+	} else {
+	    if (b &&
+		b < IDIO_GC_HEAP_MIN_MIN) {
+		b = IDIO_GC_HEAP_MIN_MIN;
+	    }
+	    idio_gc_heap_hard_limit = b;
+	}
+    }
 }
 
 void idio_init_gc ()
 {
     idio_module_table_register (idio_gc_add_primitives, idio_final_gc, NULL);
 
+    idio_gc_getenv ();
+
+    char *events = getenv ("IDIO_GC_EVENTS");
+    if (NULL != events) {
+	idio_gc_events_FILE = fopen (events, "a");
+	if (NULL == idio_gc_events_FILE) {
+	    perror ("fopen (IDIO_GC_EVENTS)");
+	} else {
+	    /*
+	     * Line buffered so that we don't have pending output
+	     * duplicated when we fork
+	     */
+	    setvbuf (idio_gc_events_FILE, NULL, _IOLBF, 0);
+	}
+    }
+
     idio_gc = idio_gc_obj_new ();
     idio_gc0 = idio_gc;
 
     idio_gc->verbose = 0;
 
-    /*
-     * Hmm, debugging something else I noticed that as file handles
-     * come and go, they actually go and are therefore deregistered
-     * quite early on which provokes a resize from 64 back down to
-     * 8...
-     */
-    idio_gc_finalizer_hash = IDIO_HASH_EQP (64);
-    idio_gc_protect (idio_gc_finalizer_hash);
-    idio_gc_add_weak_object (idio_gc_finalizer_hash);
 
 #ifdef IDIO_VM_PROF
     idio_gc_all_closure_t.tv_sec = 0;
@@ -171,23 +171,27 @@ typedef enum {
     IDIO_TYPE_THREAD,
     IDIO_TYPE_CONTINUATION,
     IDIO_TYPE_BITSET,
+    IDIO_TYPE_PMAP,
+    IDIO_TYPE_OMAP,
+    IDIO_TYPE_TVECTOR,
+    IDIO_TYPE_BYTEVECTOR,
 
     IDIO_TYPE_C_CHAR,
-    IDIO_TYPE_C_SCHAR,
+    IDIO_TYPE_C_SCHAR,		/* 30 */
     IDIO_TYPE_C_UCHAR,
     IDIO_TYPE_C_SHORT,
     IDIO_TYPE_C_USHORT,
-    IDIO_TYPE_C_INT,		/* 30 */
+    IDIO_TYPE_C_INT,
     IDIO_TYPE_C_UINT,
     IDIO_TYPE_C_LONG,
     IDIO_TYPE_C_ULONG,
     IDIO_TYPE_C_LONGLONG,
     IDIO_TYPE_C_ULONGLONG,
-    IDIO_TYPE_C_FLOAT,
+    IDIO_TYPE_C_FLOAT,		/* 40 */
     IDIO_TYPE_C_DOUBLE,
     IDIO_TYPE_C_LONGDOUBLE,
     IDIO_TYPE_C_POINTER,
-    IDIO_TYPE_C_VOID,		/* 40 */
+    IDIO_TYPE_C_VOID,
 
     IDIO_TYPE_MAX
 } idio_type_enum;
@@ -317,14 +321,30 @@ typedef struct idio_vtable_s idio_vtable_t;
 #define IDIO_STRING_FLAG_FD_PATHNAME	(1<<5)
 #define IDIO_STRING_FLAG_FIFO_PATHNAME	(1<<6)
 
+/*
+ * String lengths are 32-bit so that a string fits in the 16 bytes of
+ * the union in struct idio_s.  idio_string_check_blen() guards the
+ * constructors.
+ */
+#define IDIO_STRING_BLEN_MAX		UINT32_MAX
+
+/*
+ * Short strings are stored inline.  The code point length lives in
+ * the header's tlen, leaving the 12 bytes after @blen for the
+ * string's bytes and a trailing NUL.  Longer strings use @s, the
+ * last 8 of those bytes, to point at allocated storage.
+ *
+ * Whether a string is inline is decided by @blen alone which never
+ * changes once the string has been constructed.
+ */
 struct idio_string_s {
     /**
      * @blen: length in bytes
      *
      * The string is not expected to be NUL-terminated.
      */
-    size_t blen;		/* bytes */
-    size_t len;			/* code points */
+    uint32_t blen;		/* bytes */
+    char inline_s[4];		/* inline storage, overlays @s */
     /**
      * @s: the "string": BYTE, UCS2, UCS4
      */
@@ -345,12 +365,22 @@ typedef struct idio_string_s idio_string_t;
  * IDIO_STRING_LEN - accessor to @len in &struct idio_string_s
  * @S: the &struct idio_string_s
  */
-#define IDIO_STRING_LEN(S)	((S)->u.string.len)
+#define IDIO_STRING_LEN(S)	((S)->tlen)
 /**
- * IDIO_STRING_S - accessor to @s in &struct idio_string_s
+ * IDIO_STRING_INLINE_BLEN - the longest inline string in bytes
+ *
+ * The inline storage runs from @inline_s to the end of &struct
+ * idio_string_s, less one byte for the NUL.
+ */
+#define IDIO_STRING_INLINE_BLEN	(sizeof (idio_string_t) - offsetof (idio_string_t, inline_s) - 1)
+#define IDIO_STRING_INLINE_P(S)	(IDIO_STRING_BLEN (S) <= IDIO_STRING_INLINE_BLEN)
+/**
+ * IDIO_STRING_S - accessor to the bytes of &struct idio_string_s
  * @S: the &struct idio_string_s
+ *
+ * IDIO_STRING_S is not an lvalue, use idio_string_alloc_s()
  */
-#define IDIO_STRING_S(S)	((S)->u.string.s)
+#define IDIO_STRING_S(S)	(IDIO_STRING_INLINE_P (S) ? ((char *) &((S)->u.string)) + offsetof (idio_string_t, inline_s) : (S)->u.string.s)
 #define IDIO_STRING_FLAGS(S)	((S)->tflags)
 
 typedef struct idio_substring_s {
@@ -359,14 +389,17 @@ typedef struct idio_substring_s {
      * a simple string and can just mark it as seen directly
      */
     struct idio_s *parent;
-    size_t len;			/* code points */
-    char *s;			/* no allocation, just a pointer into
-				   parent's string */
+    uint32_t len;		/* code points */
+    uint32_t offset;		/* bytes into parent's string */
 } idio_substring_t;
 
 #define IDIO_SUBSTRING_LEN(S)	((S)->u.substring.len)
-#define IDIO_SUBSTRING_S(S)	((S)->u.substring.s)
+#define IDIO_SUBSTRING_OFFSET(S) ((S)->u.substring.offset)
 #define IDIO_SUBSTRING_PARENT(S) ((S)->u.substring.parent)
+/*
+ * IDIO_SUBSTRING_S is not an lvalue, set IDIO_SUBSTRING_OFFSET
+ */
+#define IDIO_SUBSTRING_S(S)	(IDIO_STRING_S (IDIO_SUBSTRING_PARENT (S)) + IDIO_SUBSTRING_OFFSET (S))
 
 #define IDIO_SYMBOL_FLAG_NONE		0
 #define IDIO_SYMBOL_FLAG_GENSYM		(1<<0)
@@ -398,13 +431,16 @@ typedef struct idio_keyword_s {
 #define IDIO_KEYWORD_BLEN(S)	((S)->u.keyword.blen)
 #define IDIO_KEYWORD_S(S)	((S)->u.keyword.s)
 
+/*
+ * Pairs are the most common value by far and do not carry a grey
+ * pointer.  The garbage collector pushes grey pairs onto a mark
+ * stack instead.
+ */
 typedef struct idio_pair_s {
-    struct idio_s *grey;
     struct idio_s *h;
     struct idio_s *t;
 } idio_pair_t;
 
-#define IDIO_PAIR_GREY(P)	((P)->u.pair.grey)
 #define IDIO_PAIR_H(P)		((P)->u.pair.h)
 #define IDIO_PAIR_T(P)		((P)->u.pair.t)
 
@@ -523,6 +559,15 @@ struct idio_array_s {
      * @dv: default value
      */
     struct idio_s *dv;
+    /**
+     * @head: unused slots before @ae
+     *
+     * idio_array_shift() advances @ae rather than moving the
+     * remaining elements down and idio_array_unshift() uses these
+     * slots, if any, before growing them.  The allocation is therefore
+     * @head + @asize elements from @ae - @head.
+     */
+    idio_as_t head;
     /**
      * @ae: array elements
      */
@@ -537,6 +582,7 @@ typedef struct idio_array_s idio_array_t;
 #define IDIO_ARRAY_GREY(A)	((A)->u.array->grey)
 #define IDIO_ARRAY_ASIZE(A)	((A)->u.array->asize)
 #define IDIO_ARRAY_USIZE(A)	((A)->u.array->usize)
+#define IDIO_ARRAY_HEAD(A)	((A)->u.array->head)
 #define IDIO_ARRAY_DV(A)	((A)->u.array->dv)
 #define IDIO_ARRAY_AE(A,i)	((A)->u.array->ae[i])
 #define IDIO_ARRAY_FLAGS(A)	((A)->tflags)
@@ -555,40 +601,69 @@ typedef struct idio_array_s idio_array_t;
  */
 typedef size_t idio_hi_t;
 
+/*
+ * Hash tables use open addressing: the entries live inline in a
+ * single C array and a key is found by linear probing from its hash
+ * index.
+ *
+ * An empty slot has a NULL key and terminates a probe.  A deleted
+ * slot leaves a tombstone, an idio_S_nil key (#n is not a legal
+ * key), which a probe steps over and an insertion can reuse.
+ *
+ * The key's full hash value is cached in the entry so that a resize
+ * need not rehash (possibly calling back into Idio) and a probe can
+ * skip keys with a different hash value without comparing them.
+ *
+ * A large table grows incrementally: the previous array is kept as
+ * ohe and a few of its slots are migrated into the new array with
+ * each change to the table.  A key is in one array or the other, so
+ * lookups probe both until the migration completes.
+ */
 typedef struct idio_hash_entry_s {
-    struct idio_hash_entry_s *next;
     struct idio_s *key;
     struct idio_s *value;
+    idio_hi_t hv;
 } idio_hash_entry_t;
 
-#define IDIO_HASH_HE_NEXT(HE)	((HE)->next)
 #define IDIO_HASH_HE_KEY(HE)	((HE)->key)
 #define IDIO_HASH_HE_VALUE(HE)	((HE)->value)
+#define IDIO_HASH_HE_HV(HE)	((HE)->hv)
+#define IDIO_HASH_HE_LIVE_P(HE)	(NULL != (HE)->key && idio_S_nil != (HE)->key)
 
 #define IDIO_HASH_FLAG_NONE		0
 #define IDIO_HASH_FLAG_STRING_KEYS	(1<<0)
+#define IDIO_HASH_FLAG_WEAK_KEYS	(1<<1)
+#define IDIO_HASH_FLAG_HASH_KEY		(1<<2)
 
 typedef struct idio_hash_s {
     struct idio_s *grey;
     idio_hi_t size;
     idio_hi_t mask;	      /* bitmask for easy modulo arithmetic */
     idio_hi_t count;	      /* (key) count */
+    idio_hi_t deleted;	      /* tombstone count */
     int (*comp_C) (void const *k1, void const *k2);	/* C equivalence function */
     idio_hi_t (*hash_C) (struct idio_s *h, void const *k); /* C hashing function */
     struct idio_s *comp;	/* user-supplied comparator */
     struct idio_s *hash;	/* user-supplied hashing function */
-    idio_hash_entry_t* *ha;	/* a C array */
+    idio_hash_entry_t *he;	/* a C array */
+    idio_hash_entry_t *ohe;	/* the previous C array while resizing, or NULL */
+    idio_hi_t osize;	      /* size of ohe */
+    idio_hi_t omig;	      /* next ohe slot to migrate */
 } idio_hash_t;
 
 #define IDIO_HASH_GREY(H)	((H)->u.hash->grey)
 #define IDIO_HASH_SIZE(H)	((H)->u.hash->size)
 #define IDIO_HASH_MASK(H)	((H)->u.hash->mask)
 #define IDIO_HASH_COUNT(H)	((H)->u.hash->count)
+#define IDIO_HASH_DELETED(H)	((H)->u.hash->deleted)
 #define IDIO_HASH_COMP_C(H)	((H)->u.hash->comp_C)
 #define IDIO_HASH_HASH_C(H)	((H)->u.hash->hash_C)
 #define IDIO_HASH_COMP(H)	((H)->u.hash->comp)
 #define IDIO_HASH_HASH(H)	((H)->u.hash->hash)
-#define IDIO_HASH_HA(H,i)	((H)->u.hash->ha[i])
+#define IDIO_HASH_HE(H,i)	(&((H)->u.hash->he[i]))
+#define IDIO_HASH_OHE(H,i)	(&((H)->u.hash->ohe[i]))
+#define IDIO_HASH_OSIZE(H)	((H)->u.hash->osize)
+#define IDIO_HASH_OMIG(H)	((H)->u.hash->omig)
 #define IDIO_HASH_FLAGS(H)	((H)->tflags)
 
 /**
@@ -835,6 +910,7 @@ typedef struct idio_handle_methods_s {
 #define IDIO_HANDLE_FLAG_FILE		(1<<3)
 #define IDIO_HANDLE_FLAG_PIPE		(1<<4)
 #define IDIO_HANDLE_FLAG_STRING		(1<<5)
+#define IDIO_HANDLE_FLAG_BYTEVECTOR	(1<<6)
 
 typedef struct idio_handle_s {
     struct idio_s *grey;
@@ -879,6 +955,7 @@ typedef struct idio_struct_type_s {
     struct idio_s *parent;	/* a struct-type */
     size_t size;		/* number of fields *including parents* */
     struct idio_s* *fields;	/* an array of symbols */
+    idio_vtable_t *vtable;	/* shared by instances */
 } idio_struct_type_t;
 
 #define IDIO_STRUCT_TYPE_GREY(ST)	((ST)->u.struct_type->grey)
@@ -886,6 +963,7 @@ typedef struct idio_struct_type_s {
 #define IDIO_STRUCT_TYPE_PARENT(ST)	((ST)->u.struct_type->parent)
 #define IDIO_STRUCT_TYPE_SIZE(ST)	((ST)->u.struct_type->size)
 #define IDIO_STRUCT_TYPE_FIELDS(ST,i)	((ST)->u.struct_type->fields[i])
+#define IDIO_STRUCT_TYPE_VTABLE(ST)	((ST)->u.struct_type->vtable)
 
 typedef struct idio_struct_instance_s {
     struct idio_s *grey;
@@ -1060,6 +1138,128 @@ typedef struct idio_bitset_s {
 #define IDIO_BITSET_SIZE(BS)	((BS)->u.bitset.size)
 #define IDIO_BITSET_WORDS(BS,i)	((BS)->u.bitset.words[i])
 
+/*
+ * A tvector, typed vector, is a contiguous C array of numbers all of
+ * one element type, the kind, held in the type-specific flags.  The
+ * elements are not Idio values so the garbage collector need not
+ * look at them.
+ */
+#define IDIO_TVECTOR_KIND_U8	0
+#define IDIO_TVECTOR_KIND_S32	1
+#define IDIO_TVECTOR_KIND_S64	2
+#define IDIO_TVECTOR_KIND_F32	3
+#define IDIO_TVECTOR_KIND_F64	4
+
+typedef struct idio_tvector_s {
+    size_t len;
+    void *data;
+} idio_tvector_t;
+
+#define IDIO_TVECTOR_LEN(TV)	((TV)->u.tvector.len)
+#define IDIO_TVECTOR_DATA(TV)	((TV)->u.tvector.data)
+#define IDIO_TVECTOR_KIND(TV)	((TV)->tflags)
+#define IDIO_TVECTOR_U8(TV)	((uint8_t *) IDIO_TVECTOR_DATA (TV))
+#define IDIO_TVECTOR_S32(TV)	((int32_t *) IDIO_TVECTOR_DATA (TV))
+#define IDIO_TVECTOR_S64(TV)	((int64_t *) IDIO_TVECTOR_DATA (TV))
+#define IDIO_TVECTOR_F32(TV)	((float *) IDIO_TVECTOR_DATA (TV))
+#define IDIO_TVECTOR_F64(TV)	((double *) IDIO_TVECTOR_DATA (TV))
+
+/*
+ * A bytevector is a run of bytes.  A slice of a bytevector is another
+ * bytevector whose data points into the bytes of the original, the
+ * parent, which it keeps alive.  Only a bytevector without a parent
+ * owns (and frees) its bytes.  Parents are always owners so the
+ * garbage collector can mark them directly, as for substrings.
+ *
+ * As with strings the length, in bytes, is held in tlen.
+ */
+typedef struct idio_bytevector_s {
+    struct idio_s *parent;
+    uint8_t *data;
+} idio_bytevector_t;
+
+#define IDIO_BYTEVECTOR_PARENT(BV)	((BV)->u.bytevector.parent)
+#define IDIO_BYTEVECTOR_DATA(BV)	((BV)->u.bytevector.data)
+#define IDIO_BYTEVECTOR_LEN(BV)		((BV)->tlen)
+
+/*
+ * A pmap is a persistent map: a Hash Array Mapped Trie whose nodes
+ * are never modified once built.
+ *
+ * Each node uses the next IDIO_PMAP_BITS bits of a key's (cached)
+ * hash value to choose one of 32 slots.  Only the populated slots
+ * are stored, in bitmap order, so the index of a slot is the
+ * population count of the bitmap below it.  An entry with a NULL key
+ * is a sub-node, held in the value.
+ *
+ * A collision node, flagged as such, holds two or more keys with the
+ * same full hash value and has no bitmap.
+ *
+ * Setting or deleting a key copies the nodes on the path from the
+ * root to the key and shares the rest with the original pmap.
+ *
+ * count is the number of keys in the node and its sub-nodes which
+ * makes the count of the root node the size of the pmap.
+ */
+typedef struct idio_pmap_s {
+    struct idio_s *grey;
+    idio_hi_t count;		/* (key) count */
+    uint32_t bitmap;		/* populated slots */
+    uint32_t n;			/* number of entries */
+    idio_hash_entry_t e[];	/* a C array */
+} idio_pmap_t;
+
+#define IDIO_PMAP_GREY(P)	((P)->u.pmap->grey)
+#define IDIO_PMAP_COUNT(P)	((P)->u.pmap->count)
+#define IDIO_PMAP_BITMAP(P)	((P)->u.pmap->bitmap)
+#define IDIO_PMAP_N(P)		((P)->u.pmap->n)
+#define IDIO_PMAP_E(P,i)	(&((P)->u.pmap->e[i]))
+#define IDIO_PMAP_FLAGS(P)	((P)->tflags)
+
+#define IDIO_PMAP_FLAG_NONE		0
+#define IDIO_PMAP_FLAG_COLLISION	(1<<0)
+
+/*
+ * An omap is an ordered map: a B-tree of keys and values kept in the
+ * order given by the omap's less-than function, less, or, if less is
+ * #n, by the default ordering of numbers, strings, symbols, keywords
+ * and unicode.
+ *
+ * The nodes are C structures owned by the omap.  Every node but the
+ * root has between IDIO_OMAP_ORDER - 1 and IDIO_OMAP_MAX keys and an
+ * internal node has one more child than it has keys.  A leaf is
+ * allocated without the child array.
+ *
+ * version is incremented by every change to the omap so that a walk
+ * which calls back into Idio can tell that the nodes it was
+ * traversing may have gone.
+ */
+#define IDIO_OMAP_ORDER		16
+#define IDIO_OMAP_MAX		(2 * IDIO_OMAP_ORDER - 1)
+
+typedef struct idio_omap_node_s {
+    unsigned int n;		/* number of keys */
+    unsigned int leaf;
+    struct idio_s *keys[IDIO_OMAP_MAX];
+    struct idio_s *values[IDIO_OMAP_MAX];
+    struct idio_omap_node_s *child[]; /* IDIO_OMAP_MAX + 1 */
+} idio_omap_node_t;
+
+typedef struct idio_omap_s {
+    struct idio_s *grey;
+    idio_omap_node_t *root;
+    size_t count;
+    size_t version;
+    struct idio_s *less;
+} idio_omap_t;
+
+#define IDIO_OMAP_GREY(O)	((O)->u.omap->grey)
+#define IDIO_OMAP_ROOT(O)	((O)->u.omap->root)
+#define IDIO_OMAP_COUNT(O)	((O)->u.omap->count)
+#define IDIO_OMAP_VERSION(O)	((O)->u.omap->version)
+#define IDIO_OMAP_LESS(O)	((O)->u.omap->less)
+#define IDIO_OMAP_FLAGS(O)	((O)->tflags)
+
 /*
  * Who called siglongjmp?
  */
@@ -1073,6 +1273,7 @@ typedef struct idio_bitset_s {
 typedef struct idio_C_pointer_s {
     void *p;
     struct idio_s *ptype;	/* for C_pointer: (name, ref) */
+    idio_vtable_t *vtable;	/* per ptype */
     char freep;
 } idio_C_pointer_t;
 
@@ -1118,6 +1319,7 @@ typedef struct idio_C_type_s {
 #define IDIO_C_TYPE_POINTER_PTYPE(C) ((C)->u.C_type.u.C_pointer->ptype)
 #define IDIO_C_TYPE_POINTER_P(C)     ((C)->u.C_type.u.C_pointer->p)
 #define IDIO_C_TYPE_POINTER_FREEP(C) ((C)->u.C_type.u.C_pointer->freep)
+#define IDIO_C_TYPE_POINTER_VTABLE(C) ((C)->u.C_type.u.C_pointer->vtable)
 
 typedef unsigned char IDIO_FLAGS_T;
 
@@ -1162,17 +1364,15 @@ typedef enum {
  */
 struct idio_s {
     struct idio_s *next;
-    idio_vtable_t *vtable;
 
     /*
-     * The union will be word-aligned (or larger, see below) so we
-     * have several bytes of room for "stuff".  (Once we use one
-     * bit/char/whatever for flags then we'll get the space for the
-     * full 4/8/16 byte alignment.)
+     * The header is the next pointer and a single word of state:
+     * the GC flags and generic flags in bitfields, the type-specific
+     * flags and the generation.
      *
-     * It doesn't *seem* to matter where in the structure these
-     * bitfields live (other than together) suggesting the compiler is
-     * quite good at deferencing the member fields.
+     * There is no per-value vtable pointer.  The vtable is derived
+     * from the type, see idio_value_vtable(), with struct types and
+     * C/pointers holding their own in their (allocated) structures.
      */
     idio_type_enum              type     :6; /* 40-ish types is < 64 */
     idio_gc_flag_gcc_enum       colour   :2;
@@ -1192,49 +1392,29 @@ struct idio_s {
      */
     unsigned char gen;
 
+    /*
+     * type-specific length (since we have room here): the code point
+     * length of strings
+     */
+    uint32_t tlen;
+
     /*
      * Rationale for union.  We need to decide whether the union
      * should embed the type-specific structure or have a pointer to
      * it.
      *
-     * Far and away the most commonly used type is a pair(*) which
-     * consists of three pointers (grey, head and tail).  If this
-     * union is a pointer to such an structure then we use a pointer
-     * here in the union and then two pointers from malloc(3) as well
-     * as the three pointers in the pair.
-     *
-     * (*) Unless you start using bignums (two pointers) in which case
-     * they may come to dominate.
-     *
-     * Of course, the moment we use the (three pointer) structure
-     * directly in the union then the original pointer from the union
-     * is shadowed by the three pointers of the pair directly here.
-     * We still save the two malloc(3) pointers and the cost of
-     * malloc(3)/free(3).
-     *
-     * Any other structure that is three pointers or less can then
-     * also be used directly in the union with no extra cost.
-     *
-     * ----
+     * Far and away the most commonly used type is a pair which
+     * consists of two pointers, head and tail.  The union is sized
+     * for a pair, two pointers, and anything else that fits -- strings
+     * and substrings use 32-bit lengths to do so -- is embedded
+     * directly saving a malloc(3)/free(3) and the pointer.
      *
-     * idio_C_type_t is the alignment culprit with long double being
-     * the forcing type, here for a couple of examples (YMMV):
+     * Larger types are allocated and the union holds a pointer.
+     * Those types carry a grey pointer for the garbage collector's
+     * grey list, pairs use a mark stack.
      *
-     * 32-bit - 8 byte alignment (along with long long etc.)
-     *
-     * 64-bit - 16 byte alignment
-     *
-     * The alignment is both before and after.  It appears to be an
-     * integer multiple of the largest element, so n*8 or n*16 >= max
-     * (sizeof (union members)).
-     *
-     * In particular, the union, targeting 3 * sizeof (pointer),
-     * actually becomes 2 * sizeof (long double), ie. 4 * sizeof
-     * (pointer).  In other words there's a pointer's worth of empty
-     * space at the end of the union.
-     *
-     * Maybe a struct-instance (three pointers and a size_t) could be
-     * promoted to fit in the union directly.
+     * On a 64-bit system that makes a value 32 bytes: two words of
+     * header and two words of union.
      */
     union idio_s_u {
 	idio_string_t           string;
@@ -1255,6 +1435,10 @@ struct idio_s {
 	idio_thread_t	       *thread;
 	idio_continuation_t    *continuation;
 	idio_bitset_t	        bitset;
+	idio_pmap_t	       *pmap;
+	idio_omap_t	       *omap;
+	idio_tvector_t	        tvector;
+	idio_bytevector_t       bytevector;
 	idio_C_type_t           C_type;
     } u;
 };
@@ -1280,23 +1464,62 @@ typedef struct idio_s idio_t;
 typedef idio_t*			IDIO;
 typedef idio_t* volatile	IDIO_v;
 
+/*
+ * The protected roots are an open addressed set of IDIO values so
+ * that both idio_gc_protect() and idio_gc_expose() are O(1).  Empty
+ * slots are NULL and exposed slots are left as a (non-pointer)
+ * tombstone until the set is next resized.
+ */
 typedef struct idio_root_s {
-    struct idio_root_s *next;
-    struct idio_s *object;
+    size_t size;		/* power of two */
+    size_t count;		/* live objects */
+    size_t used;		/* live objects + tombstones */
+    struct idio_s **objects;
 } idio_root_t;
 
+/*
+ * A root frame protects the C (automatic) variables of a function
+ * for as long as the frame is pushed:
+ *
+ *   IDIO a = ...;
+ *   IDIO b = idio_S_nil;
+ *   IDIO_GC_ROOT_FRAME (rf, &a, &b);
+ *   ... allocating or calling into Idio ...
+ *   idio_gc_root_frame_pop (&rf);
+ *
+ * Frames are popped in LIFO order.  Should a condition cause a
+ * siglongjmp() out of the function then idio_vm_run() will reset the
+ * frame stack to where it was when it started.
+ */
+typedef struct idio_root_frame_s {
+    struct idio_root_frame_s *prev;
+    size_t n;
+    struct idio_s ***vars;
+} idio_root_frame_t;
+
+#define IDIO_GC_ROOT_FRAME(f,...)					\
+    struct idio_s **f ## _vars[] = { __VA_ARGS__ };			\
+    idio_root_frame_t f = { NULL, sizeof (f ## _vars) / sizeof (f ## _vars[0]), f ## _vars }; \
+    idio_gc_root_frame_push (&f)
+
 #define IDIO_GC_FLAG_NONE	 0
 #define IDIO_GC_FLAG_REQUEST   (1<<0)
 #define IDIO_GC_FLAG_FINISH    (1<<1)
 
 typedef struct idio_gc_s {
     struct idio_gc_s *next;
-    idio_root_t *roots;
-    idio_root_t *autos;
+    idio_root_t roots;
+    idio_root_t autos;
     IDIO free;
     IDIO used;
+    IDIO unswept;		/* marked but not yet swept */
     IDIO grey;
-    IDIO weak;
+    struct {
+	size_t size;
+	size_t n;
+	struct idio_s **objects;
+    } pairs;			/* grey pairs */
+    IDIO weak;			/* weak hashes reached this mark */
     int pause;
     unsigned char verbose;
     unsigned char gen;
@@ -1310,9 +1533,15 @@ typedef struct idio_gc_s {
 	long long allocs; /* # allocations */
 	long long tbytes; /* # bytes ever allocated */
 	long long nbytes; /* # bytes currently allocated */
+	long long rbytes; /* # bytes ever requested, values and memory */
+	long long trigger; /* nbytes in use to trigger a collection */
 	long long nused[IDIO_TYPE_MAX]; /* per-type usage */
 	long long collections;	/* # times gc has been run */
 	long long bounces;
+	long long lazy_sweeps;	/* # incremental sweeps */
+	long long finalized;	/* # finalizers run */
+	long long compiles;	/* # forms compiled */
+	long long compile_bytes; /* # bytes requested compiling them */
 	struct timeval mark_dur;
 	struct timeval sweep_dur;
 	struct timeval ru_utime;
@@ -1322,6 +1551,56 @@ typedef struct idio_gc_s {
 
 #define IDIO_GC_FLAGS(F)	((F)->flags)
 
+/*
+ * A record of a collection for telemetry, see idio_gc_event_begin().
+ *
+ * bytes_after is only known once the (lazy) sweep has completed.
+ */
+typedef enum {
+    IDIO_GC_STATS_ST_COLLECTIONS,
+    IDIO_GC_STATS_ST_BYTES,
+    IDIO_GC_STATS_ST_TRIGGER,
+    IDIO_GC_STATS_ST_TOTAL_BYTES,
+    IDIO_GC_STATS_ST_OBJECTS,
+    IDIO_GC_STATS_ST_FREE,
+    IDIO_GC_STATS_ST_FINALIZED,
+    IDIO_GC_STATS_ST_PAUSE_TOTAL,
+    IDIO_GC_STATS_ST_PAUSE_MAX,
+    IDIO_GC_STATS_ST_PAUSE_P50,
+    IDIO_GC_STATS_ST_PAUSE_P90,
+    IDIO_GC_STATS_ST_PAUSE_P99,
+    IDIO_GC_STATS_ST_LAST,
+    IDIO_GC_STATS_ST_SIZE,
+} idio_gc_stats_st_enum;
+
+typedef enum {
+    IDIO_GC_EVENT_ST_GC,
+    IDIO_GC_EVENT_ST_REASON,
+    IDIO_GC_EVENT_ST_START,
+    IDIO_GC_EVENT_ST_PAUSE,
+    IDIO_GC_EVENT_ST_OBJECTS_BEFORE,
+    IDIO_GC_EVENT_ST_OBJECTS_AFTER,
+    IDIO_GC_EVENT_ST_BYTES_BEFORE,
+    IDIO_GC_EVENT_ST_BYTES_AFTER,
+    IDIO_GC_EVENT_ST_SURVIVORS,
+    IDIO_GC_EVENT_ST_SIZE,
+} idio_gc_event_st_enum;
+
+typedef struct idio_gc_event_s {
+    long long seq;		/* collection number */
+    char const *reason;		/* caller of idio_gc_collect() */
+    struct timeval start;
+    long long pause;		/* usec */
+    long long objects_before;
+    long long objects_after;
+    long long bytes_before;
+    long long bytes_after;
+    long long bytes_freed;
+    long long survivors[IDIO_TYPE_MAX];
+    unsigned int pausing:1;	/* in idio_gc_collect() */
+    unsigned int sweeping:1;	/* not yet fully swept */
+} idio_gc_event_t;
+
 /*
   the alignment of a structure field of type TYPE can be determined by
   looking at the offset of such a field in a structure where the first
@@ -1549,11 +1828,13 @@ void idio_gc_register_finalizer (IDIO o, void (*func) (IDIO o));
 void idio_gc_deregister_finalizer (IDIO o);
 void idio_run_finalizer (IDIO o);
 void *idio_alloc (size_t s);
+void *idio_calloc (size_t num, size_t s);
 void idio_free (void *p);
 void idio_gc_free (void *p, size_t size);
 void *idio_realloc (void *p, size_t s);
 IDIO idio_gc_get (idio_type_e type);
 void idio_gc_alloc (void **p, size_t size);
+void idio_gc_calloc (void **p, size_t num, size_t size);
 void *idio_gc_realloc (void *p, size_t size);
 
 /**
@@ -1566,6 +1847,7 @@ void *idio_gc_realloc (void *p, size_t size);
  * value.
  */
 #define IDIO_GC_ALLOC(p,s)	(idio_gc_alloc ((void **)&(p), s))
+#define IDIO_GC_CALLOC(p,n,s)	(idio_gc_calloc ((void **)&(p), n, s))
 #define IDIO_GC_REALLOC(p,s)	((p) = idio_gc_realloc ((void *)(p), s))
 #define IDIO_GC_FREE(p,s)	(idio_gc_free ((void *)(p), s))
 
@@ -1576,9 +1858,6 @@ void idio_gc_stats_free (size_t n);
 void idio_mark (IDIO o, unsigned colour);
 void idio_process_grey (unsigned colour);
 unsigned idio_bw (IDIO o);
-idio_root_t *idio_root_new ();
-void idio_root_dump (idio_root_t *root);
-void idio_root_mark (idio_root_t *root, unsigned colour);
 idio_gc_t *idio_gc_new ();
 #if IDIO_DEBUG > 2
 void IDIO_FPRINTF (FILE *stream, char const *format, ...);
@@ -1589,9 +1868,17 @@ void idio_gc_stats_inc (idio_type_e type);
 void idio_gc_protect (IDIO o);
 void idio_gc_protect_auto (IDIO o);
 void idio_gc_expose (IDIO o);
+void idio_gc_root_frame_push (idio_root_frame_t *frame);
+void idio_gc_root_frame_pop (idio_root_frame_t *frame);
+idio_root_frame_t *idio_gc_root_frame_top ();
+void idio_gc_root_frame_reset (idio_root_frame_t *frame);
 void idio_gc_add_weak_object (IDIO o);
 void idio_gc_remove_weak_object (IDIO o);
+long long idio_gc_inuse (idio_gc_t *gc);
 void idio_gc_possibly_collect ();
+IDIO idio_gc_heap_limit_condition ();
+long long idio_gc_compile_start ();
+void idio_gc_compile_finish (long long start);
 #define IDIO_GC_COLLECT_GEN	0
 #define IDIO_GC_COLLECT_ALL	1
 void idio_gc_collect (idio_gc_t *idio_gc, int gen, char const *caller);
@@ -239,7 +239,6 @@ static void idio_handle_method_error (char const *func, char const *msg, IDIO c_
 IDIO idio_handle ()
 {
     IDIO h = idio_gc_get (IDIO_TYPE_HANDLE);
-    h->vtable = idio_vtable (IDIO_TYPE_HANDLE);
 
     IDIO_GC_ALLOC (h->u.handle, sizeof (idio_handle_t));
 
@@ -2204,6 +2203,8 @@ IDIO idio_load_handle (IDIO h, IDIO (*reader) (IDIO h), IDIO (*evaluator) (IDIO
 	    perror ("gettimeofday");
 	}
 #endif
+	long long compile_start = idio_gc_compile_start ();
+
 	e = (*reader) (h);
 
 	if (idio_S_eof == e) {
@@ -2243,6 +2244,8 @@ IDIO idio_load_handle (IDIO h, IDIO (*reader) (IDIO h), IDIO (*evaluator) (IDIO
 
 	idio_pc_t pc = idio_codegen (thr, m, eenv);
 
+	idio_gc_compile_finish (compile_start);
+
 	/*
 	 * WARNING: if we've come in here from the primitive
 	 * load-handle (and possibly others) then, for the first
@@ -2460,6 +2463,8 @@ char *idio_handle_as_C_string (IDIO v, size_t *sizep, idio_unicode_t format, IDI
     }
     if (h_flags & IDIO_HANDLE_FLAG_STRING) {
 	IDIO_STRCAT (r, sizep, "S"); /* s? is for S_ISSOCK */
+    } else if (h_flags & IDIO_HANDLE_FLAG_BYTEVECTOR) {
+	IDIO_STRCAT (r, sizep, "B"); /* b? is for S_ISBLK */
     } else if (h_flags & IDIO_HANDLE_FLAG_FILE) {
 	IDIO_STRCAT (r, sizep, "f"); /* cf. f? */
     } else if (h_flags & IDIO_HANDLE_FLAG_PIPE) {
@@ -32,6 +32,7 @@
 #include <sys/resource.h>
 
 #include <assert.h>
+#include <fcntl.h>
 #include <limits.h>
 #include <setjmp.h>
 #include <stdarg.h>
@@ -47,7 +48,9 @@
 #include "gc.h"
 #include "idio.h"
 
+#include "array.h"
 #include "bignum.h"
+#include "bytevector.h"
 #include "closure.h"
 #include "condition.h"
 #include "error.h"
@@ -56,11 +59,15 @@
 #include "handle.h"
 #include "hash.h"
 #include "idio-string.h"
+#include "omap.h"
 #include "pair.h"
+#include "pmap.h"
 #include "string-handle.h"
 #include "struct.h"
 #include "symbol.h"
 #include "thread.h"
+#include "tvector.h"
+#include "usi.h"
 #include "util.h"
 #include "vm.h"
 #include "vtable.h"
@@ -154,17 +161,76 @@ static int idio_assign_hash_he (IDIO h, idio_hi_t size)
      */
     size = mask + 1;
 
-    IDIO_GC_ALLOC (h->u.hash->ha, size * sizeof (idio_hash_entry_t *));
+    /*
+     * An empty slot is all zeroes.  A large array comes zeroed from
+     * mmap(2) so its pages are touched as the table fills rather
+     * than all at once here.
+     */
+    IDIO_GC_CALLOC (h->u.hash->he, size, sizeof (idio_hash_entry_t));
 
     IDIO_HASH_MASK (h) = mask;
     IDIO_HASH_SIZE (h) = size;
+    IDIO_HASH_DELETED (h) = 0;
 
-    idio_hi_t i;
-    for (i = 0; i < size; i++) {
-	IDIO_HASH_HA (h, i) = NULL;
+    return 1;
+}
+
+/*
+ * idio_hash_delete_he() removes the entry in slot ``i``.
+ *
+ * Normally that leaves a tombstone so that probes for keys further
+ * along the run still find them.  However, if the next slot is empty
+ * then no probe runs through this slot and it, and any tombstones
+ * immediately before it, can revert to being empty.
+ *
+ * It does not resize the table as it is called by the GC to ditch
+ * dead weak keys.
+ */
+void idio_hash_delete_he (IDIO h, idio_hi_t i)
+{
+    IDIO_ASSERT (h);
+    IDIO_TYPE_ASSERT (hash, h);
+
+    idio_hi_t mask = IDIO_HASH_MASK (h);
+    idio_hash_entry_t *he = IDIO_HASH_HE (h, i);
+
+    if (NULL == IDIO_HASH_HE_KEY (IDIO_HASH_HE (h, (i + 1) & mask))) {
+	IDIO_HASH_HE_KEY (he) = NULL;
+	IDIO_HASH_HE_VALUE (he) = NULL;
+
+	for (i = (i - 1) & mask; ; i = (i - 1) & mask) {
+	    he = IDIO_HASH_HE (h, i);
+	    if (idio_S_nil != IDIO_HASH_HE_KEY (he)) {
+		break;
+	    }
+	    IDIO_HASH_HE_KEY (he) = NULL;
+	    IDIO_HASH_HE_VALUE (he) = NULL;
+	    IDIO_HASH_DELETED (h) -= 1;
+	}
+    } else {
+	IDIO_HASH_HE_KEY (he) = idio_S_nil;
+	IDIO_HASH_HE_VALUE (he) = idio_S_nil;
+	IDIO_HASH_DELETED (h) += 1;
     }
 
-    return 1;
+    IDIO_HASH_COUNT (h) -= 1;
+}
+
+/*
+ * idio_hash_delete_ohe() removes the entry in slot ``i`` of the
+ * previous array of a resizing table.  That array is only ever
+ * drained so we always leave a tombstone.
+ */
+void idio_hash_delete_ohe (IDIO h, idio_hi_t i)
+{
+    IDIO_ASSERT (h);
+    IDIO_TYPE_ASSERT (hash, h);
+
+    idio_hash_entry_t *he = IDIO_HASH_OHE (h, i);
+    IDIO_HASH_HE_KEY (he) = idio_S_nil;
+    IDIO_HASH_HE_VALUE (he) = idio_S_nil;
+
+    IDIO_HASH_COUNT (h) -= 1;
 }
 
 /*
@@ -230,7 +296,6 @@ IDIO idio_hash (idio_hi_t size, int (*comp_C) (void const *k1, void const *k2),
     }
 
     IDIO h = idio_gc_get (IDIO_TYPE_HASH);
-    h->vtable = idio_vtable (IDIO_TYPE_HASH);
     IDIO_GC_ALLOC (h->u.hash, sizeof (idio_hash_t));
     IDIO_HASH_GREY (h) = NULL;
     IDIO_HASH_COUNT (h) = 0;
@@ -239,6 +304,9 @@ IDIO idio_hash (idio_hi_t size, int (*comp_C) (void const *k1, void const *k2),
     IDIO_HASH_COMP (h) = comp;
     IDIO_HASH_HASH (h) = hash;
     IDIO_HASH_FLAGS (h) = IDIO_HASH_FLAG_NONE;
+    h->u.hash->ohe = NULL;
+    IDIO_HASH_OSIZE (h) = 0;
+    IDIO_HASH_OMIG (h) = 0;
 
     idio_assign_hash_he (h, size);
 
@@ -251,7 +319,6 @@ IDIO idio_copy_hash (IDIO orig, int depth)
     IDIO_TYPE_ASSERT (hash, orig);
 
     IDIO new = idio_gc_get (IDIO_TYPE_HASH);
-    new->vtable = idio_vtable (IDIO_TYPE_HASH);
     IDIO_GC_ALLOC (new->u.hash, sizeof (idio_hash_t));
     IDIO_HASH_GREY (new) = NULL;
     IDIO_HASH_COMP_C (new) = IDIO_HASH_COMP_C (orig);
@@ -259,6 +326,11 @@ IDIO idio_copy_hash (IDIO orig, int depth)
     IDIO_HASH_COMP (new) = IDIO_HASH_COMP (orig);
     IDIO_HASH_HASH (new) = IDIO_HASH_HASH (orig);
     IDIO_HASH_FLAGS (new) = IDIO_HASH_FLAGS (orig);
+    new->u.hash->ohe = NULL;
+    IDIO_HASH_OSIZE (new) = 0;
+    IDIO_HASH_OMIG (new) = 0;
+
+    idio_hash_migrate_all (orig);
 
     /*
      * Set the count to 0 as the act of idio_hash_put() in the old
@@ -275,29 +347,14 @@ IDIO idio_copy_hash (IDIO orig, int depth)
     idio_gc_protect (new);
     idio_hi_t i;
     for (i = 0; i < IDIO_HASH_SIZE (orig); i++) {
-	idio_hash_entry_t *he = IDIO_HASH_HA (orig, i);
-	for ( ; NULL != he; he = IDIO_HASH_HE_NEXT (he)) {
+	idio_hash_entry_t *he = IDIO_HASH_HE (orig, i);
+	if (IDIO_HASH_HE_LIVE_P (he)) {
 	    IDIO k = IDIO_HASH_HE_KEY (he);
-	    if (! k) {
-		/*
-		 * Test Case:
-		 *
-		 * Coding error ultimately.
-		 */
-		char em[BUFSIZ];
-		idio_snprintf (em, BUFSIZ, "copy-hash: key #%zd is NULL", i);
-
-		idio_hash_error (em, IDIO_C_FUNC_LOCATION ());
-
-		return idio_S_notreached;
-	    }
-	    if (idio_S_nil != k) {
-		IDIO v = IDIO_HASH_HE_VALUE (he);
-		if (IDIO_COPY_DEEP == depth) {
-		    v = idio_copy (v, depth);
-		}
-		idio_hash_put (new, k, v);
+	    IDIO v = IDIO_HASH_HE_VALUE (he);
+	    if (IDIO_COPY_DEEP == depth) {
+		v = idio_copy (v, depth);
 	    }
+	    idio_hash_put (new, k, v);
 	}
     }
     idio_gc_expose (new);
@@ -317,28 +374,13 @@ IDIO idio_merge_hash (IDIO ht1, IDIO ht2)
 
     IDIO_ASSERT_NOT_CONST (hash, ht1);
 
+    idio_hash_migrate_all (ht2);
+
     idio_hi_t i;
     for (i = 0; i < IDIO_HASH_SIZE (ht2); i++) {
-	idio_hash_entry_t *he = IDIO_HASH_HA (ht2, i);
-	for ( ; NULL != he; he = IDIO_HASH_HE_NEXT (he)) {
-	    IDIO k = IDIO_HASH_HE_KEY (he);
-	    if (! k) {
-		/*
-		 * Test Case:
-		 *
-		 * Coding error ultimately.
-		 */
-		char em[BUFSIZ];
-		idio_snprintf (em, BUFSIZ, "merge-hash: key #%zd is NULL", i);
-
-		idio_hash_error (em, IDIO_C_FUNC_LOCATION ());
-
-		return idio_S_notreached;
-	    }
-	    if (idio_S_nil != k) {
-		IDIO v = IDIO_HASH_HE_VALUE (he);
-		idio_hash_put (ht1, k, v);
-	    }
+	idio_hash_entry_t *he = IDIO_HASH_HE (ht2, i);
+	if (IDIO_HASH_HE_LIVE_P (he)) {
+	    idio_hash_put (ht1, IDIO_HASH_HE_KEY (he), IDIO_HASH_HE_VALUE (he));
 	}
     }
 
@@ -379,28 +421,172 @@ void idio_free_hash (IDIO h)
     if (IDIO_HASH_FLAGS (h) & IDIO_HASH_FLAG_STRING_KEYS) {
 	idio_hi_t i;
 	for (i = 0; i < IDIO_HASH_SIZE (h); i++) {
-	    idio_hash_entry_t *he = IDIO_HASH_HA (h, i);
-	    for ( ; NULL != he; he = IDIO_HASH_HE_NEXT (he)) {
-		void *kv = IDIO_HASH_HE_KEY (he);
-		if (idio_S_nil != kv) {
-		    idio_free (kv);
-		}
+	    idio_hash_entry_t *he = IDIO_HASH_HE (h, i);
+	    if (IDIO_HASH_HE_LIVE_P (he)) {
+		idio_free (IDIO_HASH_HE_KEY (he));
 	    }
 	}
+	for (i = IDIO_HASH_OMIG (h); i < IDIO_HASH_OSIZE (h); i++) {
+	    idio_hash_entry_t *he = IDIO_HASH_OHE (h, i);
+	    if (IDIO_HASH_HE_LIVE_P (he)) {
+		idio_free (IDIO_HASH_HE_KEY (he));
+	    }
+	}
+    }
+
+    if (NULL != h->u.hash->ohe) {
+	IDIO_GC_FREE (h->u.hash->ohe, IDIO_HASH_OSIZE (h) * sizeof (idio_hash_entry_t));
     }
+    IDIO_GC_FREE (h->u.hash->he, IDIO_HASH_SIZE (h) * sizeof (idio_hash_entry_t));
+    IDIO_GC_FREE (h->u.hash, sizeof (idio_hash_t));
+}
 
+/*
+ * idio_hash_insert_he() puts a key we know is not in the table into
+ * the first empty slot along its probe.  It is used to repopulate a
+ * freshly allocated table which has no tombstones.
+ *
+ * ``hv`` is the key's cached hash value so no hashing is required.
+ *
+ * The key is only moving so IDIO_HASH_COUNT (h) is unchanged.
+ */
+static void idio_hash_insert_he (IDIO h, void *kv, IDIO v, idio_hi_t hv)
+{
+    IDIO_ASSERT (h);
+    IDIO_TYPE_ASSERT (hash, h);
+
+    idio_hi_t mask = IDIO_HASH_MASK (h);
+    idio_hi_t i = hv & mask;
+
+    idio_hash_entry_t *he = IDIO_HASH_HE (h, i);
+    while (NULL != IDIO_HASH_HE_KEY (he)) {
+	i = (i + 1) & mask;
+	he = IDIO_HASH_HE (h, i);
+    }
+
+    IDIO_HASH_HE_KEY (he) = kv;
+    IDIO_HASH_HE_VALUE (he) = v;
+    IDIO_HASH_HE_HV (he) = hv;
+}
+
+/*
+ * idio_hash_migrate() moves the entries in the next ``n`` slots of
+ * the previous array of a resizing table into the current array.
+ * The previous array is freed when it has been drained.
+ *
+ * There is no hashing or key comparison, just copying, so this is
+ * safe to call anywhere.
+ */
+static void idio_hash_migrate (IDIO h, idio_hi_t n)
+{
+    IDIO_ASSERT (h);
+    IDIO_TYPE_ASSERT (hash, h);
+
+    idio_hi_t osize = IDIO_HASH_OSIZE (h);
+    idio_hi_t i = IDIO_HASH_OMIG (h);
+    idio_hi_t end = osize;
+    if (n < (osize - i)) {
+	end = i + n;
+    }
+
+    for (; i < end; i++) {
+	idio_hash_entry_t *he = IDIO_HASH_OHE (h, i);
+	if (IDIO_HASH_HE_LIVE_P (he)) {
+	    idio_hash_insert_he (h, IDIO_HASH_HE_KEY (he), IDIO_HASH_HE_VALUE (he), IDIO_HASH_HE_HV (he));
+
+	    /*
+	     * Leave a tombstone, not a stale key, as the key might be
+	     * deleted from the current array
+	     */
+	    IDIO_HASH_HE_KEY (he) = idio_S_nil;
+	    IDIO_HASH_HE_VALUE (he) = idio_S_nil;
+	}
+    }
+
+    if (i == osize) {
+	IDIO_GC_FREE (h->u.hash->ohe, osize * sizeof (idio_hash_entry_t));
+	h->u.hash->ohe = NULL;
+	IDIO_HASH_OSIZE (h) = 0;
+	IDIO_HASH_OMIG (h) = 0;
+    } else {
+	IDIO_HASH_OMIG (h) = i;
+    }
+}
+
+/*
+ * idio_hash_migrate_all() completes any resize in progress.  Anything
+ * walking the whole table, other than the GC, should call it first.
+ */
+void idio_hash_migrate_all (IDIO h)
+{
+    IDIO_ASSERT (h);
+    IDIO_TYPE_ASSERT (hash, h);
+
+    if (NULL != h->u.hash->ohe) {
+	idio_hash_migrate (h, IDIO_HASH_OSIZE (h));
+    }
+}
+
+/*
+ * idio_hash_rehash() moves the entries into a new array of (at
+ * least) ``nsize`` slots.
+ *
+ * Small tables are rehashed immediately.  Otherwise the old array is
+ * retained and migrated IDIO_HASH_MIGRATE_STEP slots at a time by
+ * subsequent changes to the table.  When a table grows, the new
+ * array is at least twice the size of the old and the table next
+ * grows when it has been filled from 37.5% to 75% which is at least
+ * a quarter of the new array's slots or half of the old array's
+ * slots.  A step of two would suffice, we are comfortably ahead with
+ * eight.
+ */
+#define IDIO_HASH_INCREMENTAL_SIZE	1024
+#define IDIO_HASH_MIGRATE_STEP		8
+
+static void idio_hash_rehash (IDIO h, idio_hi_t nsize)
+{
+    IDIO_ASSERT (h);
+    IDIO_TYPE_ASSERT (hash, h);
+
+    idio_hash_migrate_all (h);
+
+    idio_hi_t ohsize = IDIO_HASH_SIZE (h);
+    idio_hash_entry_t *ohe = h->u.hash->he;
+
+    idio_assign_hash_he (h, nsize);
+
+    if (ohsize >= IDIO_HASH_INCREMENTAL_SIZE) {
+	h->u.hash->ohe = ohe;
+	IDIO_HASH_OSIZE (h) = ohsize;
+	IDIO_HASH_OMIG (h) = 0;
+
+	idio_hash_migrate (h, IDIO_HASH_MIGRATE_STEP);
+
+	return;
+    }
+
+    idio_hi_t hcount = 0;
     idio_hi_t i;
-    for (i = 0; i < IDIO_HASH_SIZE (h); i++) {
-	idio_hash_entry_t *he = IDIO_HASH_HA (h, i);
-	while (NULL != he) {
-	    idio_hash_entry_t *che = he;
-	    he = IDIO_HASH_HE_NEXT (he);
-	    IDIO_GC_FREE (che, sizeof (idio_hash_entry_t));
+    for (i = 0 ; i < ohsize; i++) {
+	idio_hash_entry_t *he = &ohe[i];
+	if (IDIO_HASH_HE_LIVE_P (he)) {
+	    idio_hash_insert_he (h, IDIO_HASH_HE_KEY (he), IDIO_HASH_HE_VALUE (he), IDIO_HASH_HE_HV (he));
+	    hcount++;
 	}
     }
 
-    IDIO_GC_FREE (h->u.hash->ha, IDIO_HASH_SIZE (h) * sizeof (idio_hash_entry_t));
-    IDIO_GC_FREE (h->u.hash, sizeof (idio_hash_t));
+    if (hcount != IDIO_HASH_COUNT (h)) {
+	/*
+	 * Code coverage:
+	 *
+	 * Coding error.
+	 */
+	fprintf (stderr, "LOST HASH ENTRIES (count): %3zu != %3zu\n", IDIO_HASH_COUNT (h), hcount);
+	idio_dump (h, 2);
+	exit (3);
+    }
+
+    IDIO_GC_FREE (ohe, ohsize * sizeof (idio_hash_entry_t));
 }
 
 void idio_hash_resize (IDIO h, int larger)
@@ -410,8 +596,7 @@ void idio_hash_resize (IDIO h, int larger)
 
     IDIO_ASSERT_NOT_CONST (hash, h);
 
-    idio_hi_t ohsize = IDIO_HASH_SIZE (h);
-    idio_hash_entry_t* *oha = h->u.hash->ha;
+    idio_hash_migrate_all (h);
 
     idio_hi_t osize = IDIO_HASH_MASK (h) + 1;
 
@@ -420,15 +605,20 @@ void idio_hash_resize (IDIO h, int larger)
     idio_hi_t nsize = osize;
 
     /*
-     * We need to figure out the "loading factor" versus the size.  We
-     * can have a really small size and very long lists per bucket.
+     * We need to figure out the "loading factor" versus the size.
+     * With open addressing, long probe runs are the cost of a high
+     * load.
      */
     if (larger) {
 	/*
-	 * high is 75%
+	 * We are called when live keys and tombstones exceed 75%.  If
+	 * more than half are live keys then grow, otherwise rehash at
+	 * the same size.  Either way there's at least a quarter of the
+	 * table to fill before we're called again which is plenty of
+	 * time for an incremental migration to complete.
 	 */
-	idio_hi_t load_high = (osize / 2) + (osize / 4);
-	if (hcount > load_high) {
+	idio_hi_t load_mid = osize / 2;
+	if (hcount > load_mid) {
 	    while (nsize <= hcount) {
 		nsize *= 2;
 	    }
@@ -462,7 +652,12 @@ void idio_hash_resize (IDIO h, int larger)
 	}
     }
 
-    if (nsize == osize) {
+    /*
+     * If the table is merely clogged with tombstones then we rehash
+     * at the same size to clear them out.
+     */
+    if (nsize == osize &&
+	0 == IDIO_HASH_DELETED (h)) {
 	/*
 	 * Code coverage:
 	 *
@@ -473,32 +668,27 @@ void idio_hash_resize (IDIO h, int larger)
 
 #ifdef IDIO_HASH_DEBUG
     /*
-     * See if any hashing functions are particularly bad
+     * See if any hashing functions are particularly bad by looking
+     * for the longest run of occupied slots
      */
+    idio_hi_t ohsize = IDIO_HASH_SIZE (h);
+    idio_hash_entry_t *ohe = h->u.hash->he;
     idio_hi_t i;
     idio_hi_t m = 0;
+    idio_hi_t c = 0;
     for (i = 0 ; i < ohsize; i++) {
-	idio_hash_entry_t *he = oha[i];
-	idio_hi_t c = 0;
-	for ( ; NULL != he; he = IDIO_HASH_HE_NEXT (he)) {
-	    if (idio_S_nil != IDIO_HASH_HE_KEY (he)) {
-		c++;
-	    } else {
-		/*
-		 * Code coverage:
-		 *
-		 * Coding error?
-		 */
-		fprintf (stderr, "hash-resize: #n key?\n");
+	if (NULL == IDIO_HASH_HE_KEY (&ohe[i])) {
+	    c = 0;
+	} else {
+	    c++;
+	    if (c > m) {
+		m = c;
 	    }
 	}
-	if (c > m) {
-	    m = c;
-	}
     }
 
     if (m > 10) {
-	fprintf (stderr, "h %p %d hc %6zu os %6zu md %4zu -> ns %6zu ", h, larger, hcount, osize, m, nsize);
+	fprintf (stderr, "h %p %d hc %6zu os %6zu mr %4zu -> ns %6zu ", h, larger, hcount, osize, m, nsize);
 	if (h == idio_vm_ch) {
 	    fprintf (stderr, "vm-constants");
 	}
@@ -506,64 +696,7 @@ void idio_hash_resize (IDIO h, int larger)
     }
 #endif
 
-    idio_assign_hash_he (h, nsize);
-
-    /*
-     * The re-insertion by each idio_hash_put is going to increment
-     * IDIO_HASH_COUNT(h) -- we don't want to double count.
-     */
-    IDIO_HASH_COUNT (h) = 0;
-    idio_hi_t i;
-    idio_hi_t c = 0;
-    for (i = 0 ; i < ohsize; i++) {
-	idio_hash_entry_t *he = oha[i];
-	for ( ; NULL != he; he = IDIO_HASH_HE_NEXT (he)) {
-	    if (idio_S_nil != IDIO_HASH_HE_KEY (he)) {
-		c++;
-		idio_hash_put (h, IDIO_HASH_HE_KEY (he), IDIO_HASH_HE_VALUE (he));
-	    } else {
-		/*
-		 * Code coverage:
-		 *
-		 * Coding error?
-		 */
-		fprintf (stderr, "hash-resize: #n key?\n");
-	    }
-	}
-    }
-
-    if (hcount != c) {
-	/*
-	 * Code coverage:
-	 *
-	 * Coding error.
-	 */
-	fprintf (stderr, "LOST HASH ENTRIES (c): %3zu != %3zu\n", IDIO_HASH_COUNT (h), hcount);
-	idio_dump (h, 2);
-	exit (2);
-    }
-
-    if (hcount != IDIO_HASH_COUNT (h)) {
-	/*
-	 * Code coverage:
-	 *
-	 * Coding error.
-	 */
-	fprintf (stderr, "LOST HASH ENTRIES (count): %3zu != %3zu\n", IDIO_HASH_COUNT (h), hcount);
-	idio_dump (h, 2);
-	exit (3);
-    }
-
-    for (i = 0; i < ohsize; i++) {
-	idio_hash_entry_t *he = oha[i];
-	while (NULL != he) {
-	    idio_hash_entry_t *che = he;
-	    he = IDIO_HASH_HE_NEXT (he);
-	    IDIO_GC_FREE (che, sizeof (idio_hash_entry_t));
-	}
-    }
-
-    IDIO_GC_FREE (oha, ohsize * sizeof (idio_hash_entry_t *));
+    idio_hash_rehash (h, nsize);
 }
 
 /*
@@ -629,39 +762,290 @@ idio_hi_t idio_hash_default_hash_C_string_C_MurmurOAAT_32 (char const *s_C)
     return hv;
 }
 
+/*
+ * The string hashes are a cut-down wyhash,
+ * https://github.com/wangyi-fudan/wyhash, which folds the input into
+ * the running hash sixteen bytes at a time with a 64x64 => 128 bit
+ * multiply whose two halves are XOR'd together.
+ *
+ * idio_hash_seed is set once per process, before any hash table is
+ * created, so that the string hash values cannot be predicted by
+ * anyone trying to provoke long probe sequences.
+ */
+static uint64_t idio_hash_seed = 0;
+
+#define IDIO_HASH_P0	UINT64_C (0xa0761d6478bd642f)
+#define IDIO_HASH_P1	UINT64_C (0xe7037ed1a0b428db)
+
+static inline uint64_t idio_hash_mum (uint64_t a, uint64_t b)
+{
+#ifdef __SIZEOF_INT128__
+    __uint128_t r = (__uint128_t) a * b;
+
+    return (uint64_t) r ^ (uint64_t) (r >> 64);
+#else
+    uint64_t ha = a >> 32;
+    uint64_t hb = b >> 32;
+    uint64_t la = (uint32_t) a;
+    uint64_t lb = (uint32_t) b;
+
+    uint64_t rh = ha * hb;
+    uint64_t rm0 = ha * lb;
+    uint64_t rm1 = hb * la;
+    uint64_t rl = la * lb;
+
+    uint64_t t = rl + (rm0 << 32);
+    uint64_t c = t < rl;
+    uint64_t lo = t + (rm1 << 32);
+    c += lo < t;
+    uint64_t hi = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+
+    return lo ^ hi;
+#endif
+}
+
+/*
+ * Read up to eight bytes as a word.  memcpy() avoids any alignment
+ * issues and the compiler will reduce it to a load.
+ */
+static inline uint64_t idio_hash_read_bytes (uint8_t const *p, size_t const n)
+{
+    uint64_t w = 0;
+    memcpy (&w, p, n);
+
+    return w;
+}
+
+/*
+ * idio_hash_default_hash_C_string_C() hashes the ``blen`` bytes of
+ * ``s_C`` which need not be NUL-terminated.
+ */
 idio_hi_t idio_hash_default_hash_C_string_C (idio_hi_t blen, char const *s_C)
 {
     IDIO_C_ASSERT (s_C);
 
-    idio_hi_t hv = idio_hash_default_hash_C_uintmax_t (blen);
+    uint8_t const *p = (uint8_t const *) s_C;
+    uint64_t seed = idio_hash_seed ^ IDIO_HASH_P0;
+
+    size_t i = blen;
+    for (; i > 16; i -= 16, p += 16) {
+	seed = idio_hash_mum (idio_hash_read_bytes (p, 8) ^ IDIO_HASH_P1,
+			      idio_hash_read_bytes (p + 8, 8) ^ seed);
+    }
+
+    uint64_t a = 0;
+    uint64_t b = 0;
+    if (i > 8) {
+	a = idio_hash_read_bytes (p, 8);
+	b = idio_hash_read_bytes (p + 8, i - 8);
+    } else {
+	a = idio_hash_read_bytes (p, i);
+    }
+
+    return idio_hash_mum (IDIO_HASH_P1 ^ blen,
+			  idio_hash_mum (a ^ IDIO_HASH_P1, b ^ seed));
+}
+
+/*
+ * idio_hash_default_hash_C_string() hashes the code points of an
+ * Idio string or substring.
+ *
+ * Strings of different widths can be equal? so we hash the same
+ * thing whatever the width, namely four code points, each in a
+ * 32-bit lane, per sixteen byte block.  The string's own storage is
+ * read directly, there is no conversion to UTF-8.
+ */
+#define IDIO_HASH_CP2(p,i)	((uint64_t) (p)[i] | ((uint64_t) (p)[(i)+1] << 32))
+
+static char const *idio_hash_string_storage (IDIO s, size_t *lenp)
+{
+    if (idio_isa_substring (s)) {
+	*lenp = IDIO_SUBSTRING_LEN (s);
+	return IDIO_SUBSTRING_S (s);
+    } else {
+	*lenp = IDIO_STRING_LEN (s);
+	return IDIO_STRING_S (s);
+    }
+}
+
+static inline idio_unicode_t idio_hash_string_ref (char const *s_C, size_t width, size_t i)
+{
+    switch (width) {
+    case 1:
+	return ((uint8_t const *) s_C)[i];
+    case 2:
+	return ((uint16_t const *) s_C)[i];
+    default:
+	return ((uint32_t const *) s_C)[i];
+    }
+}
+
+idio_hi_t idio_hash_default_hash_C_string (IDIO s)
+{
+    IDIO_ASSERT (s);
+
+    size_t width = idio_string_storage_size (s);
+
+    size_t len;
+    char const *s_C = idio_hash_string_storage (s, &len);
+
+    uint8_t const *s8 = (uint8_t const *) s_C;
+    uint16_t const *s16 = (uint16_t const *) s_C;
+    uint32_t const *s32 = (uint32_t const *) s_C;
+
+    uint64_t seed = idio_hash_seed ^ IDIO_HASH_P0;
+
+    size_t i = 0;
+    switch (width) {
+    case 1:
+	for (; i + 4 < len; i += 4) {
+	    seed = idio_hash_mum (IDIO_HASH_CP2 (s8, i) ^ IDIO_HASH_P1,
+				  IDIO_HASH_CP2 (s8, i + 2) ^ seed);
+	}
+	break;
+    case 2:
+	for (; i + 4 < len; i += 4) {
+	    seed = idio_hash_mum (IDIO_HASH_CP2 (s16, i) ^ IDIO_HASH_P1,
+				  IDIO_HASH_CP2 (s16, i + 2) ^ seed);
+	}
+	break;
+    case 4:
+	for (; i + 4 < len; i += 4) {
+	    seed = idio_hash_mum (IDIO_HASH_CP2 (s32, i) ^ IDIO_HASH_P1,
+				  IDIO_HASH_CP2 (s32, i + 2) ^ seed);
+	}
+	break;
+    }
 
     /*
-     * We could hash every character in the string.  However, a
-     * hashing function's goal is to get an evenly distributed hash
-     * value not necessarily to require every character be used.
-     *
-     * The trick here is to say that using 32 characters should be
-     * sufficient to "sample" the uniqueness of the string.  If it
-     * isn't (and examples are trivial) then we fall back to linking
-     * within the hash table bucket and the use of eq?/strncmp to
-     * differentitate between strings.
-     *
-     * Note that there are always pathological examples for whatever
-     * hashing algorithm you choose such that we rely on eq?/strncmp
-     * to differentiate between keys.
+     * The last one to four code points
      */
+    uint64_t cp[4] = { 0, 0, 0, 0 };
+    size_t j;
+    for (j = 0; i < len; i++, j++) {
+	switch (width) {
+	case 1:
+	    cp[j] = s8[i];
+	    break;
+	case 2:
+	    cp[j] = s16[i];
+	    break;
+	case 4:
+	    cp[j] = s32[i];
+	    break;
+	}
+    }
+
+    uint64_t a = cp[0] | (cp[1] << 32);
+    uint64_t b = cp[2] | (cp[3] << 32);
+
+    return idio_hash_mum (IDIO_HASH_P1 ^ len,
+			  idio_hash_mum (a ^ IDIO_HASH_P1, b ^ seed));
+}
+
+/*
+ * idio_hash_string_ci() is idio_hash_default_hash_C_string() for
+ * the code points' Simple_Lowercase_Mapping, the same mapping as
+ * ->Lowercase.
+ */
+static inline idio_unicode_t idio_hash_fold (idio_unicode_t cp)
+{
+    return cp + idio_USI_codepoint (cp)->cases[IDIO_USI_LOWERCASE_OFFSET];
+}
+
+#define IDIO_HASH_FOLD2(s,w,i)	((uint64_t) idio_hash_fold (idio_hash_string_ref (s, w, i)) | \
+				 ((uint64_t) idio_hash_fold (idio_hash_string_ref (s, w, (i)+1)) << 32))
+
+static idio_hi_t idio_hash_string_ci (IDIO s)
+{
+    IDIO_ASSERT (s);
+
+    size_t width = idio_string_storage_size (s);
+
+    size_t len;
+    char const *s_C = idio_hash_string_storage (s, &len);
+
+    uint64_t seed = idio_hash_seed ^ IDIO_HASH_P0;
+
+    size_t i = 0;
+    for (; i + 4 < len; i += 4) {
+	seed = idio_hash_mum (IDIO_HASH_FOLD2 (s_C, width, i) ^ IDIO_HASH_P1,
+			      IDIO_HASH_FOLD2 (s_C, width, i + 2) ^ seed);
+    }
+
+    uint64_t cp[4] = { 0, 0, 0, 0 };
+    size_t j;
+    for (j = 0; i < len; i++, j++) {
+	cp[j] = idio_hash_fold (idio_hash_string_ref (s_C, width, i));
+    }
+
+    uint64_t a = cp[0] | (cp[1] << 32);
+    uint64_t b = cp[2] | (cp[3] << 32);
+
+    return idio_hash_mum (IDIO_HASH_P1 ^ len,
+			  idio_hash_mum (a ^ IDIO_HASH_P1, b ^ seed));
+}
+
+static int idio_hash_string_ci_equal (IDIO s1, IDIO s2)
+{
+    size_t len1;
+    char const *s1_C = idio_hash_string_storage (s1, &len1);
+    size_t len2;
+    char const *s2_C = idio_hash_string_storage (s2, &len2);
+
+    if (len1 != len2) {
+	return 0;
+    }
+
+    size_t w1 = idio_string_storage_size (s1);
+    size_t w2 = idio_string_storage_size (s2);
+
+    size_t i;
+    for (i = 0; i < len1; i++) {
+	idio_unicode_t cp1 = idio_hash_string_ref (s1_C, w1, i);
+	idio_unicode_t cp2 = idio_hash_string_ref (s2_C, w2, i);
+	if (cp1 != cp2 &&
+	    idio_hash_fold (cp1) != idio_hash_fold (cp2)) {
+	    return 0;
+	}
+    }
+
+    return 1;
+}
 
-    idio_hi_t skip = blen >> 5;
-    if (0 == skip) {
-	skip++;
+/*
+ * idio_init_hash_seed() must be called before any hash table is
+ * created.
+ *
+ * As with RANDOM's seed in vars.c we try /dev/urandom and fall back
+ * to something to do with the time.
+ *
+ * IDIO_HASH_SEED in the environment can fix the seed to reproduce a
+ * particular table layout.
+ */
+void idio_init_hash_seed ()
+{
+    char *e = getenv ("IDIO_HASH_SEED");
+    if (NULL != e) {
+	idio_hash_seed = strtoull (e, NULL, 0);
+	return;
     }
 
-    idio_hi_t i;
-    for (i = 0; i < blen ; i+=skip) {
-	hv ^= (unsigned)(s_C[i]);
+    int seeded = 0;
+    int fd = open ("/dev/urandom", O_RDONLY | O_NONBLOCK);
+    if (fd >= 0) {
+	if (read (fd, (void *) &idio_hash_seed, sizeof (idio_hash_seed)) == sizeof (idio_hash_seed)) {
+	    seeded = 1;
+	}
+	close (fd);
     }
 
-    return hv;
+    if (! seeded) {
+	struct timeval tv;
+	gettimeofday (&tv, NULL);
+	idio_hash_seed = idio_hash_mum (((uint64_t) tv.tv_sec << 20) ^ tv.tv_usec ^ IDIO_HASH_P0,
+					(uint64_t) getpid () ^ (uintptr_t) &tv ^ IDIO_HASH_P1);
+    }
 }
 
 idio_hi_t idio_hash_default_hash_C_symbol (IDIO h)
@@ -765,10 +1149,9 @@ idio_hi_t idio_hash_default_hash_C_bitset (IDIO h)
 
 /*
  * idio_hash_default_hash_C() is the default hashing function and
- * basically calls one of the above.  It will return an index into the
- * hash table ``ht`` for the key ``kv``.
- *
- * This is, the result will be modulo IDIO_HASH_MASK (ht) + 1.
+ * basically calls one of the above.  It will return the full hash
+ * value for the key ``kv`` which idio_hash_value()'s callers will
+ * reduce to an index into the hash table ``ht``.
  *
  * What is the hash of a compound value, ie. an array, list etc.?
  *
@@ -784,15 +1167,25 @@ idio_hi_t idio_hash_default_hash_C (IDIO h, void const *kv)
 {
     IDIO_ASSERT (h);
 
-    IDIO k = (IDIO) kv;
-    IDIO_ASSERT (k);
-
     int deep = 0;
     if ((idio_eqp != IDIO_HASH_COMP_C (h)) &&
 	(idio_eqvp != IDIO_HASH_COMP_C (h))) {
 	deep = 1;
     }
 
+    return idio_hash_default_hash_C_deep ((IDIO) kv, deep);
+}
+
+/*
+ * idio_hash_default_hash_C_deep() is the body of
+ * idio_hash_default_hash_C() for callers without a hash table to
+ * hand, a pmap, say, where ``deep`` says whether compound values are
+ * hashed by their elements.
+ */
+idio_hi_t idio_hash_default_hash_C_deep (IDIO k, int deep)
+{
+    IDIO_ASSERT (k);
+
     idio_hi_t hv = 0;
     idio_type_e type = idio_type (k);
 
@@ -821,27 +1214,13 @@ idio_hi_t idio_hash_default_hash_C (IDIO h, void const *kv)
     case IDIO_TYPE_CONSTANT_TOKEN:
     case IDIO_TYPE_CONSTANT_I_CODE:
     case IDIO_TYPE_CONSTANT_UNICODE:
-    return (idio_hash_default_hash_C_uintmax_t ((uintptr_t) k) & IDIO_HASH_MASK (h));
+    return idio_hash_default_hash_C_uintmax_t ((uintptr_t) k);
     }
 
     switch (type) {
     case IDIO_TYPE_STRING:
-	{
-	    size_t size = 0;
-	    char *sk = idio_string_as_C (k, &size);
-	    hv = idio_hash_default_hash_C_string_C_MurmurOAAT_32 (sk);
-
-	    IDIO_GC_FREE (sk, size);
-	}
-	break;
     case IDIO_TYPE_SUBSTRING:
-	{
-	    size_t size = 0;
-	    char *sk = idio_string_as_C (k, &size);
-	    hv = idio_hash_default_hash_C_string_C_MurmurOAAT_32 (sk);
-
-	    IDIO_GC_FREE (sk, size);
-	}
+	hv = idio_hash_default_hash_C_string (k);
 	break;
     case IDIO_TYPE_SYMBOL:
 	hv = idio_hash_default_hash_C_symbol (k);
@@ -854,8 +1233,8 @@ idio_hi_t idio_hash_default_hash_C (IDIO h, void const *kv)
 	    /*
 	     * XXX Recursion issue pending...
 	     */
-	    hv ^= idio_hash_default_hash_C (h, IDIO_PAIR_H (k));
-	    hv ^= idio_hash_default_hash_C (h, IDIO_PAIR_T (k));
+	    hv ^= idio_hash_default_hash_C_deep (IDIO_PAIR_H (k), deep);
+	    hv ^= idio_hash_default_hash_C_deep (IDIO_PAIR_T (k), deep);
 	} else {
 	    hv = idio_hash_default_hash_C_pair (k);
 	}
@@ -865,7 +1244,7 @@ idio_hi_t idio_hash_default_hash_C (IDIO h, void const *kv)
 	    idio_as_t al = IDIO_ARRAY_USIZE (k);
 	    idio_as_t ai = 0;
 	    for (; ai < al; ai++) {
-		hv ^= idio_hash_default_hash_C (h, IDIO_ARRAY_AE (k, ai));
+		hv ^= idio_hash_default_hash_C_deep (IDIO_ARRAY_AE (k, ai), deep);
 	    }
 	} else {
 	    hv = idio_hash_default_hash_C_array (k);
@@ -873,23 +1252,15 @@ idio_hi_t idio_hash_default_hash_C (IDIO h, void const *kv)
 	break;
     case IDIO_TYPE_HASH:
 	if (deep) {
+	    idio_hash_migrate_all (k);
+
 	    idio_hi_t khsize = IDIO_HASH_SIZE (k);
-	    idio_hash_entry_t* *kha = k->u.hash->ha;
 	    idio_hi_t hi;
 	    for (hi = 0 ; hi < khsize; hi++) {
-		idio_hash_entry_t *he = kha[hi];
-		for ( ; NULL != he; he = IDIO_HASH_HE_NEXT (he)) {
-		    if (idio_S_nil != IDIO_HASH_HE_KEY (he)) {
-			hv ^= idio_hash_default_hash_C (h, IDIO_HASH_HE_KEY (he));
-			hv ^= idio_hash_default_hash_C (h, IDIO_HASH_HE_VALUE (he));
-		    } else {
-			/*
-			 * Code coverage:
-			 *
-			 * Coding error?
-			 */
-			fprintf (stderr, "hash-default-hash: #n key?\n");
-		    }
+		idio_hash_entry_t *he = IDIO_HASH_HE (k, hi);
+		if (IDIO_HASH_HE_LIVE_P (he)) {
+		    hv ^= idio_hash_default_hash_C_deep (IDIO_HASH_HE_KEY (he), deep);
+		    hv ^= idio_hash_default_hash_C_deep (IDIO_HASH_HE_VALUE (he), deep);
 		}
 	    }
 	} else {
@@ -923,6 +1294,34 @@ idio_hi_t idio_hash_default_hash_C (IDIO h, void const *kv)
     case IDIO_TYPE_BITSET:
 	hv = idio_hash_default_hash_C_bitset (k);
 	break;
+    case IDIO_TYPE_PMAP:
+	if (deep) {
+	    hv = idio_pmap_hash_C (k);
+	} else {
+	    hv = idio_hash_default_hash_C_void (k->u.pmap);
+	}
+	break;
+    case IDIO_TYPE_OMAP:
+	if (deep) {
+	    hv = idio_omap_hash_C (k);
+	} else {
+	    hv = idio_hash_default_hash_C_void (k->u.omap);
+	}
+	break;
+    case IDIO_TYPE_TVECTOR:
+	if (deep) {
+	    hv = idio_tvector_hash_C (k);
+	} else {
+	    hv = idio_hash_default_hash_C_void (k->u.tvector.data);
+	}
+	break;
+    case IDIO_TYPE_BYTEVECTOR:
+	if (deep) {
+	    hv = idio_bytevector_hash_C (k);
+	} else {
+	    hv = idio_hash_default_hash_C_void (k->u.bytevector.data);
+	}
+	break;
     case IDIO_TYPE_C_CHAR:
 	hv = idio_hash_default_hash_C_uintmax_t ((uintmax_t) IDIO_C_TYPE_char (k));
 	break;
@@ -986,23 +1385,217 @@ idio_hi_t idio_hash_default_hash_C (IDIO h, void const *kv)
 	break;
     }
 
-    hv = hv & IDIO_HASH_MASK (h);
+    return hv;
+}
+
+/*
+ * Hash keys
+ *
+ * A hash table with a user-supplied equivalence or hashing function
+ * has to call back into the VM, through idio_vm_invoke_C(), for
+ * every hash and every probe.  Most such tables are keyed on some
+ * part of a struct instance, an array or a string in some other
+ * case, all of which we can do in C.
+ *
+ * A hash-key is a struct instance describing the key:
+ *
+ *   kind	one of struct-fields, string-ci or array-elements
+ *
+ *   type	the struct type for struct-fields, otherwise #n
+ *
+ *   indices	the list of field or element indices to use
+ *
+ * The fields or elements are themselves hashed and compared as for
+ * an equal? table.
+ *
+ * Passing a hash-key as the equiv-func to make-hash sets both the
+ * equivalence and hashing functions.
+ */
+static IDIO idio_hash_key_type;
+static IDIO idio_hash_key_S_struct_fields;
+static IDIO idio_hash_key_S_string_ci;
+static IDIO idio_hash_key_S_array_elements;
+
+#define IDIO_HASH_KEY_KIND(k)		IDIO_STRUCT_INSTANCE_FIELDS (k, 0)
+#define IDIO_HASH_KEY_TYPE(k)		IDIO_STRUCT_INSTANCE_FIELDS (k, 1)
+#define IDIO_HASH_KEY_INDICES(k)	IDIO_STRUCT_INSTANCE_FIELDS (k, 2)
+
+int idio_isa_hash_key (IDIO o)
+{
+    IDIO_ASSERT (o);
+
+    return (idio_isa_struct_instance (o) &&
+	    idio_struct_instance_isa (o, idio_hash_key_type));
+}
+
+static inline idio_hi_t idio_hash_key_combine (idio_hi_t hv, idio_hi_t ehv)
+{
+    return hv ^ (ehv + 0x9e3779b9 + (hv << 6) + (hv >> 2));
+}
+
+idio_hi_t idio_hash_key_hash_C (IDIO h, void const *kv)
+{
+    IDIO_ASSERT (h);
+    IDIO_TYPE_ASSERT (hash, h);
+
+    IDIO hk = IDIO_HASH_COMP (h);
+    IDIO k = (IDIO) kv;
+    IDIO kind = IDIO_HASH_KEY_KIND (hk);
+
+    if (idio_hash_key_S_string_ci == kind) {
+	if (! idio_isa_string (k)) {
+	    /*
+	     * Test Case: hash-errors/hash-key-string-ci-bad-key.idio
+	     *
+	     * ht := make-hash (hash-key-string-ci)
+	     * hash-set! ht #t 1
+	     */
+	    idio_error_param_type ("string", k, IDIO_C_FUNC_LOCATION ());
+
+	    /* notreached */
+	    return -1;
+	}
+
+	return idio_hash_string_ci (k);
+    }
+
+    idio_hi_t hv = IDIO_HASH_P0;
+    IDIO indices = IDIO_HASH_KEY_INDICES (hk);
+
+    if (idio_hash_key_S_struct_fields == kind) {
+	if (! (idio_isa_struct_instance (k) &&
+	       idio_struct_instance_isa (k, IDIO_HASH_KEY_TYPE (hk)))) {
+	    /*
+	     * Test Case: hash-errors/hash-key-struct-fields-bad-key.idio
+	     *
+	     * define-struct point x y
+	     * ht := make-hash (hash-key-struct-fields point 'x)
+	     * hash-set! ht #t 1
+	     */
+	    idio_error_param_value_msg ("hash-key-struct-fields", "key", k, "should be an instance of the hash-key's struct type", IDIO_C_FUNC_LOCATION ());
+
+	    /* notreached */
+	    return -1;
+	}
+
+	while (idio_S_nil != indices) {
+	    IDIO e = IDIO_STRUCT_INSTANCE_FIELDS (k, IDIO_FIXNUM_VAL (IDIO_PAIR_H (indices)));
+	    hv = idio_hash_key_combine (hv, idio_hash_default_hash_C (h, e));
+	    indices = IDIO_PAIR_T (indices);
+	}
+    } else {
+	if (! idio_isa_array (k)) {
+	    /*
+	     * Test Case: hash-errors/hash-key-array-elements-bad-key.idio
+	     *
+	     * ht := make-hash (hash-key-array-elements 0)
+	     * hash-set! ht #t 1
+	     */
+	    idio_error_param_type ("array", k, IDIO_C_FUNC_LOCATION ());
+
+	    /* notreached */
+	    return -1;
+	}
+
+	while (idio_S_nil != indices) {
+	    idio_as_t i = IDIO_FIXNUM_VAL (IDIO_PAIR_H (indices));
+	    if (i >= IDIO_ARRAY_USIZE (k)) {
+		/*
+		 * Test Case: hash-errors/hash-key-array-elements-short-key.idio
+		 *
+		 * ht := make-hash (hash-key-array-elements 0 3)
+		 * hash-set! ht #[ 1 2 ] 1
+		 */
+		idio_error_param_value_msg ("hash-key-array-elements", "key", k, "is too short for the hash-key's indices", IDIO_C_FUNC_LOCATION ());
+
+		/* notreached */
+		return -1;
+	    }
+	    hv = idio_hash_key_combine (hv, idio_hash_default_hash_C (h, IDIO_ARRAY_AE (k, i)));
+	    indices = IDIO_PAIR_T (indices);
+	}
+    }
 
     return hv;
 }
 
 /*
- * idio_hash_index() will return an integer index into the hash table
- * ``ht`` for the key ``kv``.
+ * idio_hash_key_equal() is only called for keys with the same hash
+ * value, which idio_hash_key_hash_C() has type-checked -- except
+ * that a key being looked up has not been checked so we are
+ * defensive.
+ */
+static int idio_hash_key_equal (IDIO hk, IDIO k1, IDIO k2)
+{
+    IDIO_ASSERT (hk);
+    IDIO_ASSERT (k1);
+    IDIO_ASSERT (k2);
+
+    if (k1 == k2) {
+	return 1;
+    }
+
+    IDIO kind = IDIO_HASH_KEY_KIND (hk);
+
+    if (idio_hash_key_S_string_ci == kind) {
+	return (idio_isa_string (k1) &&
+		idio_isa_string (k2) &&
+		idio_hash_string_ci_equal (k1, k2));
+    }
+
+    IDIO indices = IDIO_HASH_KEY_INDICES (hk);
+
+    if (idio_hash_key_S_struct_fields == kind) {
+	IDIO st = IDIO_HASH_KEY_TYPE (hk);
+	if (! (idio_isa_struct_instance (k1) &&
+	       idio_struct_instance_isa (k1, st) &&
+	       idio_isa_struct_instance (k2) &&
+	       idio_struct_instance_isa (k2, st))) {
+	    return 0;
+	}
+
+	while (idio_S_nil != indices) {
+	    idio_as_t i = IDIO_FIXNUM_VAL (IDIO_PAIR_H (indices));
+	    if (! idio_equalp (IDIO_STRUCT_INSTANCE_FIELDS (k1, i),
+			       IDIO_STRUCT_INSTANCE_FIELDS (k2, i))) {
+		return 0;
+	    }
+	    indices = IDIO_PAIR_T (indices);
+	}
+    } else {
+	if (! (idio_isa_array (k1) &&
+	       idio_isa_array (k2))) {
+	    return 0;
+	}
+
+	while (idio_S_nil != indices) {
+	    idio_as_t i = IDIO_FIXNUM_VAL (IDIO_PAIR_H (indices));
+	    if (i >= IDIO_ARRAY_USIZE (k1) ||
+		i >= IDIO_ARRAY_USIZE (k2) ||
+		! idio_equalp (IDIO_ARRAY_AE (k1, i),
+			       IDIO_ARRAY_AE (k2, i))) {
+		return 0;
+	    }
+	    indices = IDIO_PAIR_T (indices);
+	}
+    }
+
+    return 1;
+}
+
+/*
+ * idio_hash_value() will return the full hash value of the key
+ * ``kv`` for the hash table ``ht``.
  *
- * This is, the result will be modulo IDIO_HASH_MASK (ht).
+ * The index into the table is the hash value masked with
+ * IDIO_HASH_MASK (ht).
  *
  * It will call the C hashing function, if set, otherwise the Idio
  * hashing function.
  *
  * ``kv`` is a generic "key value" as we can have C strings as keys.
  */
-idio_hi_t idio_hash_index (IDIO ht, void const *kv)
+idio_hi_t idio_hash_value (IDIO ht, void const *kv)
 {
     IDIO_ASSERT (ht);
     IDIO_TYPE_ASSERT (hash, ht);
@@ -1065,7 +1658,7 @@ idio_hi_t idio_hash_index (IDIO ht, void const *kv)
 	    return -1;
 	}
 
-	return (hvi & IDIO_HASH_MASK (ht));
+	return hvi;
     }
 
     /* notreached */
@@ -1089,6 +1682,8 @@ int idio_hash_equal (IDIO ht, void const *kv1, void const *kv2)
 
     if (IDIO_HASH_COMP_C (ht) != NULL) {
 	return IDIO_HASH_COMP_C (ht) (kv1, kv2);
+    } else if (IDIO_HASH_FLAGS (ht) & IDIO_HASH_FLAG_HASH_KEY) {
+	return idio_hash_key_equal (IDIO_HASH_COMP (ht), (IDIO) kv1, (IDIO) kv2);
     } else {
 	IDIO r = idio_vm_invoke_C (IDIO_LIST3 (IDIO_HASH_COMP (ht), (IDIO) kv1, (IDIO) kv2));
 	if (idio_S_false == r) {
@@ -1099,6 +1694,26 @@ int idio_hash_equal (IDIO ht, void const *kv1, void const *kv2)
     }
 }
 
+/*
+ * idio_hash_probe() looks for the key ``kv``, with hash value ``hv``,
+ * in the array ``hes`` of ``mask + 1`` slots.
+ */
+static idio_hash_entry_t *idio_hash_probe (IDIO h, idio_hash_entry_t *hes, idio_hi_t mask, void const *kv, idio_hi_t hv)
+{
+    idio_hi_t i = hv & mask;
+
+    idio_hash_entry_t *he = &hes[i];
+    for (; NULL != IDIO_HASH_HE_KEY (he); i = (i + 1) & mask, he = &hes[i]) {
+	if (hv == IDIO_HASH_HE_HV (he) &&
+	    idio_S_nil != IDIO_HASH_HE_KEY (he) &&
+	    idio_hash_equal (h, kv, IDIO_HASH_HE_KEY (he))) {
+	    return he;
+	}
+    }
+
+    return NULL;
+}
+
 IDIO idio_hash_put (IDIO h, void *kv, IDIO v)
 {
     IDIO_ASSERT (h);
@@ -1117,33 +1732,62 @@ IDIO idio_hash_put (IDIO h, void *kv, IDIO v)
 	return idio_S_notreached;
     }
 
-    idio_hi_t hv = idio_hash_index (h, kv);
+    idio_hi_t hv = idio_hash_value (h, kv);
+
+    if (NULL != h->u.hash->ohe) {
+	idio_hash_migrate (h, IDIO_HASH_MIGRATE_STEP);
+    }
+
+    idio_hi_t mask = IDIO_HASH_MASK (h);
+    idio_hi_t i = hv & mask;
 
-    idio_hash_entry_t *he = IDIO_HASH_HA (h, hv);
-    int found = 0;
-    for (; NULL != he; he = IDIO_HASH_HE_NEXT (he)) {
-	if (idio_hash_equal (h, kv, IDIO_HASH_HE_KEY (he))) {
-	    found = 1;
+    /*
+     * Probe until we find the key or an empty slot noting the first
+     * tombstone we pass as somewhere to put a new key.  Only keys
+     * with the same hash value need comparing.
+     */
+    idio_hash_entry_t *tomb = NULL;
+    idio_hash_entry_t *he = IDIO_HASH_HE (h, i);
+    for (; NULL != IDIO_HASH_HE_KEY (he); i = (i + 1) & mask, he = IDIO_HASH_HE (h, i)) {
+	if (idio_S_nil == IDIO_HASH_HE_KEY (he)) {
+	    if (NULL == tomb) {
+		tomb = he;
+	    }
+	} else if (hv == IDIO_HASH_HE_HV (he) &&
+		   idio_hash_equal (h, kv, IDIO_HASH_HE_KEY (he))) {
 	    IDIO_HASH_HE_VALUE (he) = v;
-	    break;
+	    return kv;
 	}
     }
 
-    if (! found) {
-	idio_hash_entry_t *new;
-	IDIO_GC_ALLOC (new, sizeof (idio_hash_entry_t));
-	IDIO_HASH_HE_NEXT (new) = IDIO_HASH_HA (h, hv);
-	IDIO_HASH_HE_KEY (new) = kv;
-	IDIO_HASH_HE_VALUE (new) = v;
-	IDIO_HASH_HA (h, hv) = new;
+    /*
+     * The key may not have been migrated yet
+     */
+    if (NULL != h->u.hash->ohe) {
+	idio_hash_entry_t *ohe = idio_hash_probe (h, h->u.hash->ohe, IDIO_HASH_OSIZE (h) - 1, kv, hv);
+	if (NULL != ohe) {
+	    IDIO_HASH_HE_VALUE (ohe) = v;
+	    return kv;
+	}
+    }
 
-	IDIO_HASH_COUNT (h) += 1;
+    if (NULL != tomb) {
+	he = tomb;
+	IDIO_HASH_DELETED (h) -= 1;
     }
 
+    IDIO_HASH_HE_KEY (he) = kv;
+    IDIO_HASH_HE_VALUE (he) = v;
+    IDIO_HASH_HE_HV (he) = hv;
+    IDIO_HASH_COUNT (h) += 1;
+
+    /*
+     * Tombstones lengthen probes as much as live keys do
+     */
     idio_hi_t hsize = IDIO_HASH_SIZE (h);
 
     idio_hi_t load_high = (hsize / 2) + (hsize / 4); /* 75% */
-    if (IDIO_HASH_COUNT (h) > load_high) {
+    if ((IDIO_HASH_COUNT (h) + IDIO_HASH_DELETED (h)) > load_high) {
 	idio_hash_resize (h, 1);
     }
 
@@ -1221,16 +1865,16 @@ idio_hash_entry_t *idio_hash_he (IDIO h, void const *kv)
 	return NULL;
     }
 
-    idio_hi_t hv = idio_hash_index (h, kv);
+    idio_hi_t hv = idio_hash_value (h, kv);
 
-    idio_hash_entry_t *he = IDIO_HASH_HA (h, hv);
-    for (; NULL != he; he = IDIO_HASH_HE_NEXT (he)) {
-	if (idio_hash_equal (h, kv, IDIO_HASH_HE_KEY (he))) {
-	    return he;
-	}
+    idio_hash_entry_t *he = idio_hash_probe (h, h->u.hash->he, IDIO_HASH_MASK (h), kv, hv);
+
+    if (NULL == he &&
+	NULL != h->u.hash->ohe) {
+	he = idio_hash_probe (h, h->u.hash->ohe, IDIO_HASH_OSIZE (h) - 1, kv, hv);
     }
 
-    return NULL;
+    return he;
 }
 
 int idio_hash_exists_key (IDIO h, void *kv)
@@ -1433,40 +2077,23 @@ int idio_hash_delete (IDIO h, void *kv)
 	return 0;
     }
 
-    idio_hi_t hv = idio_hash_index (h, kv);
+    idio_hi_t hv = idio_hash_value (h, kv);
 
-    idio_hash_entry_t *hel = IDIO_HASH_HA (h, hv);
-    if (NULL == hel) {
-	return 0;
+    if (NULL != h->u.hash->ohe) {
+	idio_hash_migrate (h, IDIO_HASH_MIGRATE_STEP);
     }
 
-    idio_hash_entry_t *he = hel;
+    idio_hash_entry_t *he = idio_hash_probe (h, h->u.hash->he, IDIO_HASH_MASK (h), kv, hv);
 
-    if (idio_hash_equal (h, kv, IDIO_HASH_HE_KEY (he))) {
-	IDIO_HASH_HA (h, hv) = IDIO_HASH_HE_NEXT (he);
+    if (NULL != he) {
+	idio_hash_delete_he (h, he - h->u.hash->he);
+    } else if (NULL != h->u.hash->ohe &&
+	       NULL != (he = idio_hash_probe (h, h->u.hash->ohe, IDIO_HASH_OSIZE (h) - 1, kv, hv))) {
+	idio_hash_delete_ohe (h, he - h->u.hash->ohe);
     } else {
-	while (NULL != hel &&
-	       NULL != IDIO_HASH_HE_NEXT (hel)) {
-	    if (idio_hash_equal (h, kv, IDIO_HASH_HE_KEY (IDIO_HASH_HE_NEXT (hel)))) {
-		break;
-	    }
-	    hel = IDIO_HASH_HE_NEXT (hel);
-	}
-	he = IDIO_HASH_HE_NEXT (hel);
-	if (NULL == he) {
-	    IDIO_HASH_HE_NEXT (hel) = NULL;
-	} else {
-	    IDIO_HASH_HE_NEXT (hel) = IDIO_HASH_HE_NEXT (he);
-	}
-    }
-
-    if (NULL == he) {
 	return 0;
     }
 
-    IDIO_GC_FREE (he, sizeof (idio_hash_entry_t));
-    IDIO_HASH_COUNT (h) -= 1;
-
     idio_hi_t hsize = IDIO_HASH_SIZE (h);
 
     idio_hi_t load_low = (hsize / 16);
@@ -1511,38 +2138,25 @@ IDIO idio_hash_keys_to_list (IDIO h)
     IDIO_ASSERT (h);
     IDIO_TYPE_ASSERT (hash, h);
 
+    idio_hash_migrate_all (h);
+
     IDIO r = idio_S_nil;
 
     idio_hi_t i;
     for (i = 0; i < IDIO_HASH_SIZE (h); i++) {
-	idio_hash_entry_t *he = IDIO_HASH_HA (h, i);
-	for ( ; NULL != he; he = IDIO_HASH_HE_NEXT (he)) {
+	idio_hash_entry_t *he = IDIO_HASH_HE (h, i);
+	if (IDIO_HASH_HE_LIVE_P (he)) {
 	    IDIO k = IDIO_HASH_HE_KEY (he);
-	    if (! k) {
+	    if (IDIO_HASH_FLAGS (h) & IDIO_HASH_FLAG_STRING_KEYS) {
 		/*
-		 * Test Case: ??
+		 * Code coverage:
 		 *
-		 * Coding error ultimately.
+		 * (symbols)
 		 */
-		char em[BUFSIZ];
-		idio_snprintf (em, BUFSIZ, "key #%zd is NULL", i);
-
-		idio_hash_error (em, IDIO_C_FUNC_LOCATION ());
-
-		return idio_S_notreached;
-	    }
-	    if (idio_S_nil != k) {
-		if (IDIO_HASH_FLAGS (h) & IDIO_HASH_FLAG_STRING_KEYS) {
-		    /*
-		     * Code coverage:
-		     *
-		     * (symbols)
-		     */
-		    r = idio_pair (idio_string_C ((char *) k), r);
-		} else {
-		    IDIO_ASSERT (k);
-		    r = idio_pair (k, r);
-		}
+		r = idio_pair (idio_string_C ((char *) k), r);
+	    } else {
+		IDIO_ASSERT (k);
+		r = idio_pair (k, r);
 	    }
 	}
     }
@@ -1578,29 +2192,15 @@ IDIO idio_hash_values_to_list (IDIO h)
     IDIO_ASSERT (h);
     IDIO_TYPE_ASSERT (hash, h);
 
+    idio_hash_migrate_all (h);
+
     IDIO r = idio_S_nil;
 
     idio_hi_t i;
     for (i = 0; i < IDIO_HASH_SIZE (h); i++) {
-	idio_hash_entry_t *he = IDIO_HASH_HA (h, i);
-	for ( ; NULL != he; he = IDIO_HASH_HE_NEXT (he)) {
-	    IDIO k = IDIO_HASH_HE_KEY (he);
-	    if (! k) {
-		/*
-		 * Test Case: ??
-		 *
-		 * Coding error ultimately.
-		 */
-		char em[BUFSIZ];
-		idio_snprintf (em, BUFSIZ, "hash-values-to-list: key #%zd is NULL", i);
-
-		idio_hash_error (em, IDIO_C_FUNC_LOCATION ());
-
-		return idio_S_notreached;
-	    }
-	    if (idio_S_nil != k) {
-		r = idio_pair (IDIO_HASH_HE_VALUE (he), r);
-	    }
+	idio_hash_entry_t *he = IDIO_HASH_HE (h, i);
+	if (IDIO_HASH_HE_LIVE_P (he)) {
+	    r = idio_pair (IDIO_HASH_HE_VALUE (he), r);
 	}
     }
 
@@ -1675,6 +2275,8 @@ IDIO idio_hash_make_hash (IDIO args)
 	    } else if (idio_S_equalp == comp) {
 		equal = idio_equalp;
 		comp = idio_S_nil;
+	    } else if (idio_isa_hash_key (comp)) {
+		hash_C = idio_hash_key_hash_C;
 	    }
 	}
 
@@ -1685,6 +2287,20 @@ IDIO idio_hash_make_hash (IDIO args)
 	hash = IDIO_PAIR_H (args);
 
 	if (idio_S_nil != hash) {
+	    if (idio_hash_key_hash_C == hash_C) {
+		/*
+		 * Test Case: hash-errors/make-hash-hash-key-hash-func.idio
+		 *
+		 * make-hash (hash-key-string-ci) #t
+		 *
+		 * A hash-key is both the equivalence and hashing
+		 * function.
+		 */
+		idio_error_param_value_msg ("make-hash", "hash-func", hash, "should be #n with a hash-key equiv-func", IDIO_C_FUNC_LOCATION ());
+
+		return idio_S_notreached;
+	    }
+
 	    hash_C = NULL;
 	}
 
@@ -1716,6 +2332,10 @@ IDIO idio_hash_make_hash (IDIO args)
 
     IDIO ht = idio_hash (size, equal, hash_C, comp, hash);
 
+    if (idio_hash_key_hash_C == hash_C) {
+	IDIO_HASH_FLAGS (ht) |= IDIO_HASH_FLAG_HASH_KEY;
+    }
+
     return ht;
 }
 
@@ -1737,6 +2357,43 @@ use the default.					\n\
 As an accelerator if `equiv-comp` is one of the		\n\
 symbols ``'eq?``, ``'eqv?`` or ``'equal?`` then use the	\n\
 underlying C function.					\n\
+							\n\
+If `equiv-func` is a hash-key, see			\n\
+:ref:`hash-key-struct-fields <hash-key-struct-fields>`,	\n\
+then it is both the equivalence and hashing function	\n\
+and `hash-func` should be ``#n``.			\n\
+")
+{
+    IDIO_ASSERT (args);
+
+    /*
+     * Test Case: n/a
+     *
+     * args is the varargs parameter -- should always be a list
+     */
+    IDIO_USER_TYPE_ASSERT (list, args);
+
+    return idio_hash_make_hash (args);
+}
+
+IDIO_DEFINE_PRIMITIVE0V_DS ("make-weak-hash", make_weak_hash, (IDIO args), "[ equiv-func [ hash-func [size]]]", "\
+create a hash table with weak keys			\n\
+							\n\
+:param equiv-func: defaults to ``eq?``			\n\
+:type equiv-func: function or symbol, optional		\n\
+:param hash-func: defaults to ``hash-table-hash``	\n\
+:type hash-func: function, optional			\n\
+:param size: defaults to 32				\n\
+:type size: fixnum, optional				\n\
+:return: hash table					\n\
+:rtype: hash table					\n\
+							\n\
+An entry in a weak hash table does not keep its key	\n\
+alive and is removed by the garbage collector when the	\n\
+key is not otherwise reachable.  The entry's value is	\n\
+only kept alive while the key is.			\n\
+							\n\
+.. seealso:: :ref:`make-hash <make-hash>`		\n\
 ")
 {
     IDIO_ASSERT (args);
@@ -1748,7 +2405,34 @@ underlying C function.					\n\
      */
     IDIO_USER_TYPE_ASSERT (list, args);
 
-    return idio_hash_make_hash (args);
+    if (idio_S_nil == args) {
+	args = IDIO_LIST1 (idio_S_eqp);
+    }
+
+    IDIO ht = idio_hash_make_hash (args);
+    idio_gc_add_weak_object (ht);
+
+    return ht;
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("weak-hash?", weak_hash_p, (IDIO o), "o", "\
+test if `o` is a hash table with weak keys		\n\
+							\n\
+:param o: object to test				\n\
+:return: ``#t`` if `o` is a weak hash, ``#f`` otherwise	\n\
+:rtype: boolean						\n\
+")
+{
+    IDIO_ASSERT (o);
+
+    IDIO r = idio_S_false;
+
+    if (idio_isa_hash (o) &&
+	IDIO_HASH_FLAGS (o) & IDIO_HASH_FLAG_WEAK_KEYS) {
+	r = idio_S_true;
+    }
+
+    return r;
 }
 
 IDIO idio_hash_alist_to_hash (IDIO alist, IDIO args)
@@ -1827,13 +2511,154 @@ equivalence function and the default hashing function	\n\
     return idio_hash_alist_to_hash (alist, args);
 }
 
+IDIO_DEFINE_PRIMITIVE2V_DS ("hash-key-struct-fields", hash_key_struct_fields, (IDIO st, IDIO field, IDIO args), "st field [field ...]", "\
+return a hash-key for instances of `st` using	\n\
+the fields `field` ...				\n\
+						\n\
+:param st: struct type				\n\
+:type st: struct type				\n\
+:param field: field name			\n\
+:type field: symbol				\n\
+:return: hash-key				\n\
+						\n\
+The fields are compared with ``equal?``.	\n\
+						\n\
+Use the hash-key as the `equiv-func` of		\n\
+:ref:`make-hash <make-hash>`.			\n\
+")
+{
+    IDIO_ASSERT (st);
+    IDIO_ASSERT (field);
+    IDIO_ASSERT (args);
+
+    /*
+     * Test Case: hash-errors/hash-key-struct-fields-bad-type.idio
+     *
+     * hash-key-struct-fields #t 'x
+     */
+    IDIO_USER_TYPE_ASSERT (struct_type, st);
+
+    IDIO indices = idio_S_nil;
+    IDIO fields = idio_pair (field, args);
+    while (idio_S_nil != fields) {
+	IDIO f = IDIO_PAIR_H (fields);
+
+	if (! idio_isa_symbol (f)) {
+	    /*
+	     * Test Case: hash-errors/hash-key-struct-fields-bad-field-type.idio
+	     *
+	     * define-struct point x y
+	     * hash-key-struct-fields point #t
+	     */
+	    idio_error_param_type ("symbol", f, IDIO_C_FUNC_LOCATION ());
+
+	    return idio_S_notreached;
+	}
+
+	ssize_t i = idio_struct_type_find_eqp (st, f, 0);
+	if (-1 == i) {
+	    /*
+	     * Test Case: hash-errors/hash-key-struct-fields-bad-field.idio
+	     *
+	     * define-struct point x y
+	     * hash-key-struct-fields point 'z
+	     */
+	    idio_error_param_value_msg ("hash-key-struct-fields", "field", f, "should be a field of st", IDIO_C_FUNC_LOCATION ());
+
+	    return idio_S_notreached;
+	}
+
+	indices = idio_pair (idio_fixnum (i), indices);
+	fields = IDIO_PAIR_T (fields);
+    }
+
+    return idio_struct_instance (idio_hash_key_type,
+				 IDIO_LIST3 (idio_hash_key_S_struct_fields,
+					     st,
+					     idio_list_reverse (indices)));
+}
+
+IDIO_DEFINE_PRIMITIVE0_DS ("hash-key-string-ci", hash_key_string_ci, (void), "", "\
+return a hash-key for strings compared		\n\
+case-insensitively				\n\
+						\n\
+:return: hash-key				\n\
+						\n\
+Case-insensitivity uses the Unicode		\n\
+``Simple_Lowercase_Mapping``, see		\n\
+:ref:`->Lowercase <->Lowercase>`.		\n\
+						\n\
+Use the hash-key as the `equiv-func` of		\n\
+:ref:`make-hash <make-hash>`.			\n\
+")
+{
+    return idio_struct_instance (idio_hash_key_type,
+				 IDIO_LIST3 (idio_hash_key_S_string_ci,
+					     idio_S_nil,
+					     idio_S_nil));
+}
+
+IDIO_DEFINE_PRIMITIVE1V_DS ("hash-key-array-elements", hash_key_array_elements, (IDIO index, IDIO args), "index [index ...]", "\
+return a hash-key for arrays using the elements	\n\
+at `index` ...					\n\
+						\n\
+:param index: element index			\n\
+:type index: non-negative fixnum		\n\
+:return: hash-key				\n\
+						\n\
+The elements are compared with ``equal?``.	\n\
+						\n\
+Use the hash-key as the `equiv-func` of		\n\
+:ref:`make-hash <make-hash>`.			\n\
+")
+{
+    IDIO_ASSERT (index);
+    IDIO_ASSERT (args);
+
+    IDIO indices = idio_S_nil;
+    IDIO ixs = idio_pair (index, args);
+    while (idio_S_nil != ixs) {
+	IDIO ix = IDIO_PAIR_H (ixs);
+
+	if (! idio_isa_fixnum (ix)) {
+	    /*
+	     * Test Case: hash-errors/hash-key-array-elements-bad-type.idio
+	     *
+	     * hash-key-array-elements #t
+	     */
+	    idio_error_param_type ("fixnum", ix, IDIO_C_FUNC_LOCATION ());
+
+	    return idio_S_notreached;
+	}
+
+	if (IDIO_FIXNUM_VAL (ix) < 0) {
+	    /*
+	     * Test Case: hash-errors/hash-key-array-elements-negative.idio
+	     *
+	     * hash-key-array-elements -1
+	     */
+	    idio_error_param_value_msg ("hash-key-array-elements", "index", ix, "should be >= 0", IDIO_C_FUNC_LOCATION ());
+
+	    return idio_S_notreached;
+	}
+
+	indices = idio_pair (ix, indices);
+	ixs = IDIO_PAIR_T (ixs);
+    }
+
+    return idio_struct_instance (idio_hash_key_type,
+				 IDIO_LIST3 (idio_hash_key_S_array_elements,
+					     idio_S_nil,
+					     idio_list_reverse (indices)));
+}
+
 IDIO_DEFINE_PRIMITIVE1_DS ("hash-equivalence-function", hash_equivalence_function, (IDIO ht), "h", "\
 return the `equiv-func` of `h`				\n\
 							\n\
 :param h: hash table					\n\
 :type h: hash table					\n\
 :return: equivalence function				\n\
-:rtype: function or symbol (``eq?``, ``eqv?`` or ``equal?``)	\n\
+:rtype: function, hash-key or symbol (``eq?``, ``eqv?`` or ``equal?``)	\n\
 ")
 {
     IDIO_ASSERT (ht);
@@ -1868,7 +2693,7 @@ return the `hash-func` of `h`				\n\
 :param h: hash table					\n\
 :type h: hash table					\n\
 :return: hashing function				\n\
-:rtype: function or ``#n`` if using the default		\n\
+:rtype: function, hash-key or ``#n`` if using the default	\n\
 ")
 {
     IDIO_ASSERT (ht);
@@ -1885,6 +2710,8 @@ return the `hash-func` of `h`				\n\
     if (IDIO_HASH_HASH_C (ht) != NULL) {
 	if (IDIO_HASH_HASH_C (ht) == idio_hash_default_hash_C) {
 	    r = idio_S_nil;
+	} else if (IDIO_HASH_HASH_C (ht) == idio_hash_key_hash_C) {
+	    r = IDIO_HASH_COMP (ht);
 	}
     } else {
 	r = IDIO_HASH_HASH (ht);
@@ -1921,6 +2748,89 @@ return the key count of `h`				\n\
     return idio_integer (IDIO_HASH_COUNT (ht));
 }
 
+/*
+ * idio_hash_reserve() grows ``h`` so that it can hold ``n`` keys
+ * without resizing.
+ */
+void idio_hash_reserve (IDIO h, idio_hi_t n)
+{
+    IDIO_ASSERT (h);
+    IDIO_TYPE_ASSERT (hash, h);
+
+    IDIO_ASSERT_NOT_CONST (hash, h);
+
+    idio_hi_t nsize = IDIO_HASH_SIZE (h);
+    while (((nsize / 2) + (nsize / 4)) < n) { /* 75% */
+	nsize *= 2;
+    }
+
+    if (nsize > IDIO_HASH_SIZE (h)) {
+	idio_hash_rehash (h, nsize);
+    }
+}
+
+IDIO_DEFINE_PRIMITIVE2_DS ("hash-reserve!", hash_reserve, (IDIO ht, IDIO n), "ht n", "\
+make room in hash table `ht` for `n` keys		\n\
+							\n\
+:param ht: hash table					\n\
+:type ht: hash table					\n\
+:param n: number of keys				\n\
+:type n: non-negative fixnum				\n\
+:return: ``#<unspec>``					\n\
+							\n\
+`ht` will not need to grow until it holds more than	\n\
+`n` keys.  It is never shrunk.				\n\
+")
+{
+    IDIO_ASSERT (ht);
+    IDIO_ASSERT (n);
+
+    /*
+     * Test Case: hash-errors/hash-reserve-bad-type.idio
+     *
+     * hash-reserve! #t 10
+     */
+    IDIO_USER_TYPE_ASSERT (hash, ht);
+
+    /*
+     * Test Case: hash-errors/hash-reserve-bad-n-type.idio
+     *
+     * hash-reserve! (make-hash) #t
+     */
+    IDIO_USER_TYPE_ASSERT (fixnum, n);
+
+    idio_ai_t n_C = IDIO_FIXNUM_VAL (n);
+
+    if (n_C < 0) {
+	/*
+	 * Test Case: hash-errors/hash-reserve-negative.idio
+	 *
+	 * hash-reserve! (make-hash) -1
+	 */
+	idio_error_param_value_msg ("hash-reserve!", "n", n, "should be >= 0", IDIO_C_FUNC_LOCATION ());
+
+	return idio_S_notreached;
+    }
+
+    /*
+     * Twice n slots need to be allocatable
+     */
+    if ((size_t) n_C > (SIZE_MAX / sizeof (idio_hash_entry_t)) / 2) {
+	/*
+	 * Test Case: hash-errors/hash-reserve-too-large.idio
+	 *
+	 * hash-reserve! (make-hash) 1000000000000000000
+	 */
+	idio_error_param_value_msg ("hash-reserve!", "n", n, "is too large", IDIO_C_FUNC_LOCATION ());
+
+	return idio_S_notreached;
+    }
+
+    idio_hash_reserve (ht, n_C);
+
+    return idio_S_unspec;
+}
+
 /*
  * SRFI 69:
  *
@@ -2026,8 +2936,7 @@ call `func` for each `key` in hash table `ht`			\n\
      * from the GC.
      */
     IDIO keys = idio_hash_keys_to_list (ht);
-    IDIO safe_keys = idio_pair (keys, idio_S_nil);
-    idio_gc_protect (safe_keys);
+    IDIO_GC_ROOT_FRAME (rf, &keys);
 
     while (idio_S_nil != keys) {
 	IDIO k = IDIO_PAIR_H (keys);
@@ -2037,7 +2946,7 @@ call `func` for each `key` in hash table `ht`			\n\
 	keys = IDIO_PAIR_T (keys);
     }
 
-    idio_gc_expose (safe_keys);
+    idio_gc_root_frame_pop (&rf);
 
     return idio_S_unspec;
 }
@@ -2086,8 +2995,7 @@ The final value of `val` is returned				\n\
      * from the GC.
      */
     IDIO keys = idio_hash_keys_to_list (ht);
-    IDIO safe_keys = idio_pair (keys, idio_S_nil);
-    idio_gc_protect (safe_keys);
+    IDIO_GC_ROOT_FRAME (rf, &keys);
 
     while (idio_S_nil != keys) {
 	IDIO k = IDIO_PAIR_H (keys);
@@ -2097,7 +3005,7 @@ The final value of `val` is returned				\n\
 	keys = IDIO_PAIR_T (keys);
     }
 
-    idio_gc_expose (safe_keys);
+    idio_gc_root_frame_pop (&rf);
 
     return val;
 }
@@ -2199,60 +3107,60 @@ char *idio_hash_report_string (IDIO v, size_t *sizep, idio_unicode_t format, IDI
 
     char *r = NULL;
 
+    idio_hash_migrate_all (v);
+
     seen = idio_pair (v, seen);
     *sizep = idio_asprintf (&r, "#{", IDIO_HASH_COUNT (v));
 
 #ifdef IDIO_DEBUG
     int printed = 0;
     for (idio_hi_t i = 0; i < IDIO_HASH_SIZE (v); i++) {
-	idio_hash_entry_t *he = IDIO_HASH_HA (v, i);
-	for (; NULL != he; he = IDIO_HASH_HE_NEXT (he)) {
-	    if (idio_S_nil != IDIO_HASH_HE_KEY (he)) {
+	idio_hash_entry_t *he = IDIO_HASH_HE (v, i);
+	if (IDIO_HASH_HE_LIVE_P (he)) {
+	    /*
+	     * We're looking to generate:
+	     *
+	     * (k & v)
+	     *
+	     */
+	    IDIO_STRCAT (r, sizep, " (");
+
+	    size_t t_size = 0;
+	    char *t;
+	    if (IDIO_HASH_FLAGS (v) & IDIO_HASH_FLAG_STRING_KEYS) {
 		/*
-		 * We're looking to generate:
-		 *
-		 * (k & v)
+		 * Code coverage:
 		 *
+		 * No user-facing string keys
+		 * tables.
 		 */
-		IDIO_STRCAT (r, sizep, " (");
-
-		size_t t_size = 0;
-		char *t;
-		if (IDIO_HASH_FLAGS (v) & IDIO_HASH_FLAG_STRING_KEYS) {
-		    /*
-		     * Code coverage:
-		     *
-		     * No user-facing string keys
-		     * tables.
-		     */
-		    t_size = idio_asprintf (&t, "%s", (char *) IDIO_HASH_HE_KEY (he));
-		    t = (char *) IDIO_HASH_HE_KEY (he);
-		} else {
-		    t = idio_report_string (IDIO_HASH_HE_KEY (he), &t_size, depth - 1, seen, 0);
-		}
-		IDIO_STRCAT_FREE (r, sizep, t, t_size);
+		t_size = idio_asprintf (&t, "%s", (char *) IDIO_HASH_HE_KEY (he));
+		t = (char *) IDIO_HASH_HE_KEY (he);
+	    } else {
+		t = idio_report_string (IDIO_HASH_HE_KEY (he), &t_size, depth - 1, seen, 0);
+	    }
+	    IDIO_STRCAT_FREE (r, sizep, t, t_size);
 
-		char *hes;
-		size_t hes_size = idio_asprintf (&hes, " %c ", IDIO_PAIR_SEPARATOR);
-		IDIO_STRCAT_FREE (r, sizep, hes, hes_size);
+	    char *hes;
+	    size_t hes_size = idio_asprintf (&hes, " %c ", IDIO_PAIR_SEPARATOR);
+	    IDIO_STRCAT_FREE (r, sizep, hes, hes_size);
 
-		if (IDIO_HASH_HE_VALUE (he)) {
-		    t_size = 0;
-		    t = idio_report_string (IDIO_HASH_HE_VALUE (he), &t_size, depth - 1, seen, 0);
-		    IDIO_STRCAT_FREE (r, sizep, t, t_size);
-		} else {
-		    /*
-		     * Code coverage:
-		     *
-		     * Probably shouldn't happen.  It
-		     * requires we have a NULL for
-		     * IDIO_HASH_KEY_VALUE().
-		     */
-		    IDIO_STRCAT (r, sizep, "-");
-		}
-		IDIO_STRCAT (r, sizep, ")");
-		printed = 1;
+	    if (IDIO_HASH_HE_VALUE (he)) {
+		t_size = 0;
+		t = idio_report_string (IDIO_HASH_HE_VALUE (he), &t_size, depth - 1, seen, 0);
+		IDIO_STRCAT_FREE (r, sizep, t, t_size);
+	    } else {
+		/*
+		 * Code coverage:
+		 *
+		 * Probably shouldn't happen.  It
+		 * requires we have a NULL for
+		 * IDIO_HASH_KEY_VALUE().
+		 */
+		IDIO_STRCAT (r, sizep, "-");
 	    }
+	    IDIO_STRCAT (r, sizep, ")");
+	    printed = 1;
 	}
     }
     if (printed) {
@@ -2278,58 +3186,58 @@ char *idio_hash_as_C_string (IDIO v, size_t *sizep, idio_unicode_t format, IDIO
 
     char *r = NULL;
 
+    idio_hash_migrate_all (v);
+
     seen = idio_pair (v, seen);
     *sizep = idio_asprintf (&r, "#{ ");
 
     if (depth > 0) {
 	for (idio_hi_t i = 0; i < IDIO_HASH_SIZE (v); i++) {
-	    idio_hash_entry_t *he = IDIO_HASH_HA (v, i);
-	    for (; NULL != he; he = IDIO_HASH_HE_NEXT (he)) {
-		if (idio_S_nil != IDIO_HASH_HE_KEY (he)) {
+	    idio_hash_entry_t *he = IDIO_HASH_HE (v, i);
+	    if (IDIO_HASH_HE_LIVE_P (he)) {
+		/*
+		 * We're looking to generate:
+		 *
+		 * (k & v)
+		 *
+		 */
+		IDIO_STRCAT (r, sizep, "(");
+
+		size_t t_size = 0;
+		char *t;
+		if (IDIO_HASH_FLAGS (v) & IDIO_HASH_FLAG_STRING_KEYS) {
 		    /*
-		     * We're looking to generate:
-		     *
-		     * (k & v)
+		     * Code coverage:
 		     *
+		     * No user-facing string keys
+		     * tables.
 		     */
-		    IDIO_STRCAT (r, sizep, "(");
-
-		    size_t t_size = 0;
-		    char *t;
-		    if (IDIO_HASH_FLAGS (v) & IDIO_HASH_FLAG_STRING_KEYS) {
-			/*
-			 * Code coverage:
-			 *
-			 * No user-facing string keys
-			 * tables.
-			 */
-			t_size = idio_asprintf (&t, "%s", (char *) IDIO_HASH_HE_KEY (he));
-			t = (char *) IDIO_HASH_HE_KEY (he);
-		    } else {
-			t = idio_as_string (IDIO_HASH_HE_KEY (he), &t_size, depth - 1, seen, 0);
-		    }
-		    IDIO_STRCAT_FREE (r, sizep, t, t_size);
+		    t_size = idio_asprintf (&t, "%s", (char *) IDIO_HASH_HE_KEY (he));
+		    t = (char *) IDIO_HASH_HE_KEY (he);
+		} else {
+		    t = idio_as_string (IDIO_HASH_HE_KEY (he), &t_size, depth - 1, seen, 0);
+		}
+		IDIO_STRCAT_FREE (r, sizep, t, t_size);
+
+		char *hes;
+		size_t hes_size = idio_asprintf (&hes, " %c ", IDIO_PAIR_SEPARATOR);
+		IDIO_STRCAT_FREE (r, sizep, hes, hes_size);
 
-		    char *hes;
-		    size_t hes_size = idio_asprintf (&hes, " %c ", IDIO_PAIR_SEPARATOR);
-		    IDIO_STRCAT_FREE (r, sizep, hes, hes_size);
-
-		    if (IDIO_HASH_HE_VALUE (he)) {
-			t_size = 0;
-			t = idio_as_string (IDIO_HASH_HE_VALUE (he), &t_size, depth - 1, seen, 0);
-			IDIO_STRCAT_FREE (r, sizep, t, t_size);
-		    } else {
-			/*
-			 * Code coverage:
-			 *
-			 * Probably shouldn't happen.  It
-			 * requires we have a NULL for
-			 * IDIO_HASH_KEY_VALUE().
-			 */
-			IDIO_STRCAT (r, sizep, "-");
-		    }
-		    IDIO_STRCAT (r, sizep, ")");
+		if (IDIO_HASH_HE_VALUE (he)) {
+		    t_size = 0;
+		    t = idio_as_string (IDIO_HASH_HE_VALUE (he), &t_size, depth - 1, seen, 0);
+		    IDIO_STRCAT_FREE (r, sizep, t, t_size);
+		} else {
+		    /*
+		     * Code coverage:
+		     *
+		     * Probably shouldn't happen.  It
+		     * requires we have a NULL for
+		     * IDIO_HASH_KEY_VALUE().
+		     */
+		    IDIO_STRCAT (r, sizep, "-");
 		}
+		IDIO_STRCAT (r, sizep, ")");
 	    }
 	}
     } else {
@@ -2521,16 +3429,143 @@ Perform some hash unit tests				\n\
 
     return idio_S_unspec;
 }
+
+/*
+ * A micro-benchmark of the string hashes: the original byte at a
+ * time MurmurOAAT against the block-oriented hashes.  For Idio
+ * strings the original route was to convert to UTF-8 with
+ * idio_string_as_C() first.
+ */
+void idio_unit_test_hash_string (void)
+{
+    /*
+     * 1, 2 and 4 byte wide code points in UTF-8
+     */
+    char const *cps[] = { "a", "\xc4\xa7", "\xf0\x9f\x98\x80" };
+    size_t const lens[] = { 8, 32, 128, 1024 };
+    size_t const total = 1 << 26;
+    volatile idio_hi_t sum = 0;
+
+    fprintf (stderr, "%%unit-test-hash-string: %zu code points per test\n", total);
+    fprintf (stderr, "%8s %5s %12s %12s\n", "len", "width", "OAAT", "block");
+
+    size_t li;
+    for (li = 0; li < sizeof (lens) / sizeof (lens[0]); li++) {
+	size_t len = lens[li];
+	size_t reps = total / len;
+
+	size_t w;
+	for (w = 0; w < 3; w++) {
+	    /*
+	     * alternate ASCII and the wider code point
+	     */
+	    size_t cplen = strlen (cps[w]);
+	    char *buf = idio_alloc (len * cplen + 1);
+	    size_t blen = 0;
+	    size_t i;
+	    for (i = 0; i < len; i++) {
+		if (i & 1) {
+		    memcpy (buf + blen, cps[w], cplen);
+		    blen += cplen;
+		} else {
+		    buf[blen++] = 'a' + (i % 26);
+		}
+	    }
+	    buf[blen] = '\0';
+
+	    IDIO str = idio_string_C_len (buf, blen);
+	    idio_gc_protect (str);
+
+	    double t0 = cputime ();
+	    size_t r;
+	    for (r = 0; r < reps; r++) {
+		if (0 == w) {
+		    sum += idio_hash_default_hash_C_string_C_MurmurOAAT_32 (buf);
+		} else {
+		    size_t size = 0;
+		    char *sk = idio_string_as_C (str, &size);
+		    sum += idio_hash_default_hash_C_string_C_MurmurOAAT_32 (sk);
+		    IDIO_GC_FREE (sk, size);
+		}
+	    }
+	    double t_oaat = cputime () - t0;
+
+	    t0 = cputime ();
+	    for (r = 0; r < reps; r++) {
+		if (0 == w) {
+		    sum += idio_hash_default_hash_C_string_C (blen, buf);
+		} else {
+		    sum += idio_hash_default_hash_C_string (str);
+		}
+	    }
+	    double t_block = cputime () - t0;
+
+	    fprintf (stderr, "%8zu %5s %11.3fs %11.3fs\n", len, 0 == w ? "C" : 1 == w ? "2" : "4", t_oaat, t_block);
+
+	    idio_gc_expose (str);
+	    idio_free (buf);
+	}
+
+	/*
+	 * A 1-byte wide Idio string
+	 */
+	char *buf = idio_alloc (len + 1);
+	size_t i;
+	for (i = 0; i < len; i++) {
+	    buf[i] = 'a' + (i % 26);
+	}
+	buf[len] = '\0';
+
+	IDIO str = idio_string_C_len (buf, len);
+	idio_gc_protect (str);
+
+	double t0 = cputime ();
+	size_t r;
+	for (r = 0; r < reps; r++) {
+	    size_t size = 0;
+	    char *sk = idio_string_as_C (str, &size);
+	    sum += idio_hash_default_hash_C_string_C_MurmurOAAT_32 (sk);
+	    IDIO_GC_FREE (sk, size);
+	}
+	double t_oaat = cputime () - t0;
+
+	t0 = cputime ();
+	for (r = 0; r < reps; r++) {
+	    sum += idio_hash_default_hash_C_string (str);
+	}
+	double t_block = cputime () - t0;
+
+	fprintf (stderr, "%8zu %5s %11.3fs %11.3fs\n", len, "1", t_oaat, t_block);
+
+	idio_gc_expose (str);
+	idio_free (buf);
+    }
+}
+
+IDIO_DEFINE_PRIMITIVE0_DS ("%%unit-test-hash-string", unit_test_hash_string, (void), "", "\
+Benchmark the string hashing functions			\n\
+")
+{
+    idio_unit_test_hash_string ();
+
+    return idio_S_unspec;
+}
 #endif
 
 void idio_hash_add_primitives ()
 {
     IDIO_ADD_PRIMITIVE (hash_p);
     IDIO_ADD_PRIMITIVE (make_hash);
+    IDIO_ADD_PRIMITIVE (make_weak_hash);
+    IDIO_ADD_PRIMITIVE (weak_hash_p);
     IDIO_ADD_PRIMITIVE (alist2hash);
     IDIO_ADD_PRIMITIVE (hash_size);
+    IDIO_ADD_PRIMITIVE (hash_reserve);
     IDIO_ADD_PRIMITIVE (hash_equivalence_function);
     IDIO_ADD_PRIMITIVE (hash_hash_function);
+    IDIO_ADD_PRIMITIVE (hash_key_struct_fields);
+    IDIO_ADD_PRIMITIVE (hash_key_string_ci);
+    IDIO_ADD_PRIMITIVE (hash_key_array_elements);
 
     IDIO ref = IDIO_ADD_PRIMITIVE (hash_ref);
     idio_vtable_t *h_vt = idio_vtable (IDIO_TYPE_HASH);
@@ -2556,6 +3591,7 @@ void idio_hash_add_primitives ()
     IDIO_ADD_PRIMITIVE (merge_hash);
 #ifdef IDIO_HASH_TEST
     IDIO_ADD_PRIMITIVE (unit_test_hash);
+    IDIO_ADD_PRIMITIVE (unit_test_hash_string);
 #endif
 }
 
@@ -2563,6 +3599,17 @@ void idio_init_hash ()
 {
     idio_module_table_register (idio_hash_add_primitives, NULL, NULL);
 
+    idio_hash_key_S_struct_fields = IDIO_SYMBOL ("struct-fields");
+    idio_hash_key_S_string_ci = IDIO_SYMBOL ("string-ci");
+    idio_hash_key_S_array_elements = IDIO_SYMBOL ("array-elements");
+
+    idio_hash_key_type = idio_struct_type (IDIO_SYMBOL ("hash-key"),
+					   idio_S_nil,
+					   IDIO_LIST3 (IDIO_SYMBOL ("kind"),
+						       IDIO_SYMBOL ("type"),
+						       IDIO_SYMBOL ("indices")));
+    idio_gc_protect_auto (idio_hash_key_type);
+
     idio_vtable_t *h_vt = idio_vtable (IDIO_TYPE_HASH);
 
     idio_vtable_add_method (h_vt,
@@ -28,22 +28,32 @@
 #define IDIO_HASH_EQVP(s)	(IDIO_HASH ((s), idio_eqvp, idio_hash_default_hash_C, idio_S_nil, idio_S_nil))
 #define IDIO_HASH_EQUALP(s)	(IDIO_HASH ((s), idio_equalp, idio_hash_default_hash_C, idio_S_nil, idio_S_nil))
 
+void idio_hash_key_not_found_error (IDIO key, IDIO c_location);
+
 IDIO idio_hash (idio_hi_t const size, int (*equal) (void const *k1, void const *k2), idio_hi_t (*hash_C) (IDIO h, void const *k), IDIO comp, IDIO hash);
 IDIO idio_copy_hash (IDIO orig, int depth);
 IDIO idio_hash_alist_to_hash (IDIO alist, IDIO args);
 int idio_isa_hash (IDIO h);
 void idio_free_hash (IDIO h);
+void idio_hash_delete_he (IDIO h, idio_hi_t i);
+void idio_hash_delete_ohe (IDIO h, idio_hi_t i);
+void idio_hash_migrate_all (IDIO h);
 void idio_hash_resize (IDIO h, int larger);
+void idio_hash_reserve (IDIO h, idio_hi_t n);
 idio_hi_t idio_hash_default_hash_C_uintmax_t (uintmax_t i);
 idio_hi_t idio_hash_default_hash_C_string_C_MurmurOAAT_32 (char const *s_C);
-idio_hi_t idio_hash_default_hash_C_string_C (size_t blen, char const *s_C);
+idio_hi_t idio_hash_default_hash_C_string_C (idio_hi_t blen, char const *s_C);
 idio_hi_t idio_hash_default_hash_C_string (IDIO s);
+int idio_isa_hash_key (IDIO o);
+idio_hi_t idio_hash_key_hash_C (IDIO h, void const *kv);
 idio_hi_t idio_hash_default_hash_C_symbol (IDIO s);
 idio_hi_t idio_hash_default_hash_C_void (void *p);
 idio_hi_t idio_hash_default_hash_C_pair (IDIO h);
 idio_hi_t idio_hash_default_hash_C_array (IDIO h);
 idio_hi_t idio_hash_default_hash_C_hash (IDIO h);
 idio_hi_t idio_hash_default_hash_C (IDIO h, void const *k);
+idio_hi_t idio_hash_default_hash_C_deep (IDIO k, int deep);
+idio_hi_t idio_hash_value (IDIO ht, void const *kv);
 IDIO idio_hash_put (IDIO h, void *k, IDIO v);
 int idio_hash_exists_key (IDIO h, void *kv);
 IDIO idio_hash_ref (IDIO h, void const *k);
@@ -56,6 +66,7 @@ IDIO idio_hash_set (IDIO ht, IDIO key, IDIO v);
 char *idio_hash_report_string (IDIO v, size_t *sizep, idio_unicode_t format, IDIO seen, int depth);
 char *idio_hash_as_C_string (IDIO v, size_t *sizep, idio_unicode_t format, IDIO seen, int depth);
 
+void idio_init_hash_seed ();
 void idio_init_hash ();
 
 #endif
@@ -0,0 +1,40 @@
+/*
+ * generated by gen-idio-config on Sun Oct 18 08:53:13 UTC 2026
+ */
+
+/*
+ * idio-config.h
+ *
+ */
+
+#ifndef IDIO_CONFIG_H
+#define IDIO_CONFIG_H
+
+#define IDIO_HAVE_STRNLEN              1
+#define IDIO_HAVE_MEMRCHR              1
+#define IDIO_HAVE_PTSNAME_R            1
+#undef  IDIO_NO_POLL_DEVICE
+#undef  IDIO_POLLHUP_OCCLUDES_POLLIN
+#undef  IDIO_NO_CLOCK_GETTIME
+#undef  IDIO_NO_REG_STARTEND
+#undef  IDIO_NO_TERMIOS_SPEEDS
+#undef  IDIO_NO_SET_SAVED_IDS
+#undef  IDIO_NO_FUTIMES
+#undef  IDIO_NO_FUTIMESAT
+#undef  IDIO_NO_FACCESSAT
+#undef  IDIO_NO_FCHMODAT
+#undef  IDIO_NO_FCHOWNAT
+#undef  IDIO_NO_FSTATAT
+#undef  IDIO_NO_LINKAT
+#undef  IDIO_NO_MKDIRAT
+#undef  IDIO_NO_OPENAT
+#undef  IDIO_NO_READLINKAT
+#undef  IDIO_NO_RENAMEAT
+#undef  IDIO_NO_SYMLINKAT
+#undef  IDIO_NO_UNLINKAT
+#undef  IDIO_NO_SQLITE3_OPEN_V2
+#undef  IDIO_NO_SQLITE3_CLOSE_V2
+#undef  IDIO_NO_SQLITE3_BIND_BLOB64
+#undef  IDIO_NO_SQLITE3_BIND_TEXT64
+
+#endif
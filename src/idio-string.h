@@ -36,6 +36,8 @@
 #define IDIO_STRING(s)		idio_string_C_len ((s), sizeof (s) - 1)
 
 void idio_string_error_C (char const *msg, IDIO detail, IDIO c_location);
+void idio_string_check_blen (size_t const blen);
+void idio_string_alloc_s (IDIO so, size_t const blen);
 size_t idio_string_storage_size (IDIO s);
 int idio_assign_string_C (IDIO so, char const *s_C);
 IDIO idio_string_C_len (char const *s_C, size_t blen);
@@ -45,6 +47,7 @@ IDIO idio_octet_string_C (char const *s_C);
 IDIO idio_string_C_array_lens (size_t ns, char const *a_C[], size_t const lens[]);
 IDIO idio_string_C_array (size_t ns, char const *a_C[]);
 IDIO idio_copy_string (IDIO s);
+IDIO idio_append_string (IDIO args);
 void idio_free_string (IDIO so);
 int idio_isa_string (IDIO so);
 int idio_isa_octet_string (IDIO so);
@@ -57,6 +60,8 @@ IDIO idio_string_ref_C (IDIO s, ssize_t i);
 IDIO idio_string_ref (IDIO s, IDIO index);
 IDIO idio_string_set (IDIO s, IDIO index, IDIO c);
 int idio_string_equal (IDIO s1, IDIO s2);
+int idio_string_cmp (IDIO s1, IDIO s2);
+int idio_string_prefixp (IDIO s, IDIO prefix);
 
 char *idio_string_as_C_string (IDIO v, size_t *sizep, idio_unicode_t format, IDIO seen, int depth);
 
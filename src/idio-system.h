@@ -0,0 +1,24 @@
+/*
+ * generated by gen-idio-system on Sun Oct 18 13:14:54 UTC 2026
+ */
+
+/*
+ * idio-system.h
+ *
+ */
+
+#ifndef IDIO_SYSTEM_H
+#define IDIO_SYSTEM_H
+
+#define IDIO_SYSTEM_VERSION		"0.3.b.7"
+#define IDIO_SYSTEM_VERSION_MM		"0.3"
+#define IDIO_SYSTEM_BUILD_DATE		"2026-10-18"
+#define IDIO_SYSTEM_BUILD_TIMESTAMP	"2026-10-18T13:14:54Z+0000"
+#define IDIO_SYSTEM_LIBDIR		"/usr/lib/x86_64-linux-gnu/idio"
+#define IDIO_SYSTEM_ARCH		"x86_64-linux-gnu"
+#define IDIO_BUILD_COMMIT		"41a9220"
+#define IDIO_BUILD_ASM_COMMIT		"17e4c9f"
+#define IDIO_BUILD_COMPILER_COMMIT	"17e4c9f"
+#define IDIO_BUILD_DESCRIBE		""
+
+#endif
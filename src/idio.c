@@ -50,6 +50,8 @@
 #include "array.h"
 #include "bignum.h"
 #include "bitset.h"
+#include "bytevector.h"
+#include "bytevector-handle.h"
 #include "c-type.h"
 #include "closure.h"
 #include "codegen.h"
@@ -73,16 +75,20 @@
 #include "libc-wrap.h"
 #include "module.h"
 #include "object.h"
+#include "omap.h"
 #include "pair.h"
 #include "path.h"
+#include "pmap.h"
 #include "posix-regex.h"
 #include "primitive.h"
 #include "read.h"
 #include "rfc6234.h"
+#include "string-builder.h"
 #include "string-handle.h"
 #include "struct.h"
 #include "symbol.h"
 #include "thread.h"
+#include "tvector.h"
 #include "unicode.h"
 #include "usi-wrap.h"
 #include "util.h"
@@ -254,6 +260,11 @@ void idio_init (void)
 
     idio_pid = getpid ();
 
+    /*
+     * The hash seed must be set before any hash table is created
+     */
+    idio_init_hash_seed ();
+
     /*
      * idio_init_gc() calls idio_pair() which means the idio_vtables
      * array must exist first.
@@ -278,6 +289,7 @@ void idio_init (void)
     idio_init_pair ();
     idio_init_handle ();
     idio_init_string_handle ();
+    idio_init_bytevector_handle ();
     idio_init_file_handle ();
     idio_init_c_type ();
     idio_init_frame ();
@@ -285,11 +297,16 @@ void idio_init (void)
     idio_init_primitive ();
     idio_init_unicode ();
     idio_init_string ();
+    idio_init_string_builder ();
     idio_init_array ();
     idio_init_hash ();
     idio_init_fixnum ();
     idio_init_bignum ();
     idio_init_bitset ();
+    idio_init_pmap ();
+    idio_init_omap ();
+    idio_init_tvector ();
+    idio_init_bytevector ();
     idio_init_closure ();
     idio_init_error ();
     idio_init_keyword ();
@@ -676,6 +693,13 @@ int main (int argc, char **argv, char **envp)
     IDIO thr = idio_thread_current_thread ();
     IDIO_v v_thr = thr;
 
+    /*
+     * Any root frames pushed by C functions we siglongjmp out of
+     * are no longer valid.  idio_vm_run() resets them for its own
+     * sigsetjmp but we need to do the same for ours.
+     */
+    idio_root_frame_t * volatile v_root_frame = idio_gc_root_frame_top ();
+
     /*
      * Conditions raised during the bootstrap will need a sigsetjmp in
      * place.  As the only place we can siglongjmp back to is here
@@ -696,12 +720,14 @@ int main (int argc, char **argv, char **envp)
     case 0:
 	break;
     case IDIO_VM_SIGLONGJMP_EXIT:
+	idio_gc_root_frame_reset (v_root_frame);
 	fprintf (stderr, "NOTICE: bootstrap/exit (%d) for PID %" PRIdMAX "\n", idio_exit_status, (intmax_t) getpid ());
 	idio_free (sargv);
 	idio_final ();
 	exit (idio_exit_status);
 	break;
     default:
+	idio_gc_root_frame_reset (v_root_frame);
 	fprintf (stderr, "sigsetjmp: bootstrap failed: exit (%d)\n", idio_exit_status);
 	idio_free (sargv);
 #ifdef IDIO_DEBUG
@@ -779,6 +805,7 @@ int main (int argc, char **argv, char **envp)
     case 0:
 	break;
     case IDIO_VM_SIGLONGJMP_EXIT:
+	idio_gc_root_frame_reset (v_root_frame);
 #ifdef IDIO_DEBUG
 	if (idio_exit_status) {
 	    fprintf (stderr, "NOTICE: script/exit (%d) for PID %" PRIdMAX "\n", idio_exit_status, (intmax_t) getpid ());
@@ -789,6 +816,7 @@ int main (int argc, char **argv, char **envp)
 	exit (idio_exit_status);
 	break;
     default:
+	idio_gc_root_frame_reset (v_root_frame);
 	fprintf (stderr, "sigsetjmp: script failed: exit (%d)\n", idio_exit_status);
 	idio_free (sargv);
 	idio_final ();
@@ -870,16 +898,19 @@ int main (int argc, char **argv, char **envp)
 			    idio_vm_invoke_C (IDIO_LIST2 (load, filename));
 			    break;
 			case IDIO_VM_SIGLONGJMP_CONTINUATION:
+			    idio_gc_root_frame_reset (v_root_frame);
 			    fprintf (stderr, "load %s: continuation was invoked => pending exit (1)\n", argv[i]);
 			    idio_exit_status = 1;
 			    break;
 			case IDIO_VM_SIGLONGJMP_EXIT:
+			    idio_gc_root_frame_reset (v_root_frame);
 			    fprintf (stderr, "load %s/exit (%d)\n", argv[i], idio_exit_status);
 			    idio_free (sargv);
 			    idio_final ();
 			    exit (idio_exit_status);
 			    break;
 			default:
+			    idio_gc_root_frame_reset (v_root_frame);
 			    fprintf (stderr, "sigsetjmp: load %s: failed\n", argv[i]);
 			    idio_free (sargv);
 			    idio_final ();
@@ -1013,16 +1044,19 @@ int main (int argc, char **argv, char **envp)
 	    idio_vm_invoke_C (IDIO_LIST2 (load, filename));
 	    break;
 	case IDIO_VM_SIGLONGJMP_CONTINUATION:
+	    idio_gc_root_frame_reset (v_root_frame);
 	    fprintf (stderr, "load %s: continuation was invoked => pending exit (1)\n", sargv[0]);
 	    idio_exit_status = 1;
 	    break;
 	case IDIO_VM_SIGLONGJMP_EXIT:
+	    idio_gc_root_frame_reset (v_root_frame);
 	    fprintf (stderr, "load/exit (%d)\n", idio_exit_status);
 	    idio_free (sargv);
 	    idio_final ();
 	    exit (idio_exit_status);
 	    break;
 	default:
+	    idio_gc_root_frame_reset (v_root_frame);
 	    fprintf (stderr, "sigsetjmp: load %s: failed\n", sargv[0]);
 	    idio_free (sargv);
 	    idio_final ();
@@ -1063,23 +1097,29 @@ int main (int argc, char **argv, char **envp)
 	case 0:
 	    break;
 	case IDIO_VM_SIGLONGJMP_CONDITION:
+	    idio_gc_root_frame_reset (v_root_frame);
 	    idio_gc_reset ("REPL/condition", gc_pause);
 	    break;
 	case IDIO_VM_SIGLONGJMP_CONTINUATION:
+	    idio_gc_root_frame_reset (v_root_frame);
 	    idio_gc_reset ("REPL/continuation", gc_pause);
 	    break;
 	case IDIO_VM_SIGLONGJMP_CALLCC:
+	    idio_gc_root_frame_reset (v_root_frame);
 	    idio_gc_reset ("REPL/callcc", gc_pause);
 	    break;
 	case IDIO_VM_SIGLONGJMP_EVENT:
+	    idio_gc_root_frame_reset (v_root_frame);
 	    idio_gc_reset ("REPL/event", gc_pause);
 	    break;
 	case IDIO_VM_SIGLONGJMP_EXIT:
+	    idio_gc_root_frame_reset (v_root_frame);
 	    idio_gc_reset ("REPL/exit", gc_pause);
 	    idio_free (sargv);
 	    idio_final ();
 	    exit (idio_exit_status);
 	default:
+	    idio_gc_root_frame_reset (v_root_frame);
 	    fprintf (stderr, "sigsetjmp: repl failed\n");
 	    idio_free (sargv);
 	    exit (1);
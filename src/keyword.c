@@ -133,10 +133,10 @@ idio_hi_t idio_keyword_C_hash (IDIO h, const void *s)
     size_t hvalue = (uintptr_t) s;
 
     if (idio_S_nil != s) {
-	hvalue = idio_hash_default_hash_C_string_C_MurmurOAAT_32 (s);
+	hvalue = idio_hash_default_hash_C_string_C (strlen (s), s);
     }
 
-    return (hvalue & IDIO_HASH_MASK (h));
+    return hvalue;
 }
 
 IDIO idio_keyword_C_len (char const *s_C, size_t const blen)
@@ -144,7 +144,6 @@ IDIO idio_keyword_C_len (char const *s_C, size_t const blen)
     IDIO_C_ASSERT (s_C);
 
     IDIO o = idio_gc_get (IDIO_TYPE_KEYWORD);
-    o->vtable = idio_vtable (IDIO_TYPE_KEYWORD);
 
     IDIO_GC_ALLOC (IDIO_KEYWORD_S (o), blen + 1);
 
@@ -18,45 +18,47 @@
 /*
  * malloc.c
  *
- * This is a variation on Chris Kingsley's 1982 malloc.c of which
- * there are numerous descendents including FreeBSD's
- * libexec/rtld-elf/malloc.c and the (Emacs then) Bash derived
- * lib/malloc/malloc.c.
+ * This used to be a variation on Chris Kingsley's 1982 malloc.c, by
+ * way of Bash's lib/malloc/malloc.c, with power-of-two buckets.  Each
+ * block carried 16 bytes of overhead, including the range checking
+ * magic, which meant the most common allocation, a 32 byte ``IDIO``
+ * value, used a 64 byte bucket.
  *
- * There's a suggestion it might have some unique fragmentation
- * behaviour for which Doug Lea's
- * http://gee.cs.oswego.edu/dl/html/malloc.html allocator's algorithms
- * might help.
+ * This is a size-class allocator:
  *
- * Unfortunately, I can't unearth a reference to the original Kingsley
- * code.
+ * Memory is mmap()'d in arenas of IDIO_MALLOC_ARENA_SIZE bytes
+ * aligned to their size.  The first page of an arena holds the arena
+ * header including a descriptor for each of the remaining pages.
  *
- * In the meanwhile there's some unwritten nuance.  Before calling any
- * of the original code we're meant to pre-allocate some memory and
- * initialise idio_malloc_pagepool_start/end to it.  The Bash code is
- * more dynamic and uses a pagealign() function to 1) grab *some*
- * memory, up to a page boundary and then 2) create a shortened pool
- * in that.
+ * A page is dedicated to a single size class at a time and we can
+ * find the page descriptor of any small allocation by masking the
+ * pointer down to the arena and indexing by the page number.  There
+ * is no per-allocation overhead.
  *
- * The Bash code continues to work with the idio_malloc_bucket_sizes[]
- * bins meaning the pagepool_start/end references can go.
+ * Size classes are every 16 bytes up to 128 bytes, covering the
+ * common idio_*_t payloads, then four classes per power of two up to
+ * IDIO_MALLOC_SMALL_MAX.  The worst case waste is 25%, rather than
+ * 50%, and usually much less.
  *
- * This code only uses mmap() and so the Bash sbrk()/pagealign() code
- * can go.
+ * Each size class has a list of partially used pages.  A page hands
+ * out objects from its free list or by bumping through its
+ * never-used space so that we only touch (and make resident) memory
+ * as it is needed.
  *
- * The code should figure out whether 32-bit or 64-bit allocations are
- * appropriate.
- */
-
-/*
- * malloc.c (Caltech) 2/21/82
- * Chris Kingsley, kingsley@cit-20.
+ * When a page becomes empty it is returned to the free page pool.  We
+ * keep up to IDIO_MALLOC_DIRTY_MAX of those as they are, to be
+ * reused cheaply, beyond which we madvise(2) the kernel that it can
+ * reclaim the memory.
+ *
+ * Large allocations are mmap()'d individually, aligned in the same
+ * way so that their (minimal) header can be found, and munmap()'d
+ * when freed.
  *
- * This is a very fast storage allocator.  It allocates blocks of a small
- * number of different sizes, and keeps free lists of each size.  Blocks that
- * don't exactly fit are passed up to the next larger size.  In this
- * implementation, the available sizes are 2^n-4 (or 2^n-10) bytes long.
- * This is designed for use in a virtual memory environment.
+ * If the environment variable IDIO_MALLOC_THP is set to a non-zero
+ * value the arenas are madvise(2)'d to use transparent huge pages.
+ *
+ * Per-size-class statistics are reported to idio-malloc-stats by
+ * idio_malloc_stats().
  */
 
 #define _GNU_SOURCE
@@ -66,12 +68,14 @@
 #include <sys/time.h>
 
 #include <assert.h>
+#include <errno.h>
 #include <inttypes.h>
 #include <setjmp.h>
 #include <stdarg.h>
 #include <stddef.h>
 #include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <strings.h>
 #include <unistd.h>
@@ -80,245 +84,354 @@
 #include "idio.h"
 #include "malloc.h"
 
-/*
- * The Emacs/Bash code suggests IDIO_MALLOC_NBUCKETS is SIZEOF_LONG * 4 - 2,
- * usable bins from 1..IDIO_MALLOC_NBUCKETS-1
- */
+#define IDIO_MALLOC_PAGE_SHIFT		16
+#define IDIO_MALLOC_PAGE_SIZE		((size_t) 1 << IDIO_MALLOC_PAGE_SHIFT)
+#define IDIO_MALLOC_ARENA_SHIFT		21
+#define IDIO_MALLOC_ARENA_SIZE		((size_t) 1 << IDIO_MALLOC_ARENA_SHIFT)
+#define IDIO_MALLOC_ARENA_MASK		(IDIO_MALLOC_ARENA_SIZE - 1)
+#define IDIO_MALLOC_ARENA_PAGES		(IDIO_MALLOC_ARENA_SIZE >> IDIO_MALLOC_PAGE_SHIFT)
 
 /*
- * We can toggle between 32-bit and 64-bit accounting, here.  The
- * knock-on effects are the size of the first bucket (2^3 or 2^4
- * bytes) and some stats-oriented stuff which uses the same Power-of-2
- * bit-shifting in IDIO_MALLOC_FIRST_Po2.
- *
- * NB IDIO_MALLOC_MAX_SZ is signed (because an idio_alloc_t is
- * signed).
+ * Allocations are IDIO_MALLOC_QUANTUM aligned
  */
+#define IDIO_MALLOC_QUANTUM_SHIFT	4
+#define IDIO_MALLOC_QUANTUM		((size_t) 1 << IDIO_MALLOC_QUANTUM_SHIFT)
+#define IDIO_MALLOC_ROUND(n,r)		(((n) + (r) - 1) & ~ ((r) - 1))
 
-#if PTRDIFF_MAX == 2147483647L
-typedef int32_t				idio_alloc_t;
-#define IDIO_PRIa			PRIu32
-#define IDIO_MALLOC_NBUCKETS		30
-#define IDIO_MALLOC_FIRST_Po2		3
-#define IDIO_MALLOC_MAX_SZ		0x40000000 /* 1 << 30 */
-#else
-typedef int64_t				idio_alloc_t;
-#define IDIO_PRIa			PRIu64
-#define IDIO_MALLOC_NBUCKETS		62
-#define IDIO_MALLOC_FIRST_Po2		4
-#define IDIO_MALLOC_MAX_SZ		0x4000000000000000 /* 1 << 62 */
-#endif
+#define IDIO_MALLOC_SMALL_MAX		32768
+#define IDIO_MALLOC_NCLASSES		40
 
 /*
- * idio_bi_t is a bucket index -- we'll use around 19 for the test
- * suite
+ * Empty pages we keep without madvise(2)'ing them away: 4MB
  */
-typedef uint8_t idio_bi_t;
+#define IDIO_MALLOC_DIRTY_MAX		64
+
+#define IDIO_MALLOC_ARENA_MAGIC		0x4172656e	/* Aren */
+#define IDIO_MALLOC_LARGE_MAGIC		0x4c617267	/* Larg */
+
+#define IDIO_MALLOC_PAGE_META		0xfe
+#define IDIO_MALLOC_PAGE_FREE		0xff
+
+typedef struct idio_malloc_page_s {
+    struct idio_malloc_page_s *next;
+    struct idio_malloc_page_s *prev;
+    char *base;			/* the page's memory */
+    void *free;			/* free objects */
+    char *bump;			/* never-used space */
+    uint16_t nused;
+    uint8_t sc;			/* size class */
+    uint8_t dirty;		/* free page still resident */
+} idio_malloc_page_t;
+
+typedef struct idio_malloc_arena_s {
+    uint32_t magic;
+    size_t size;		/* of the mapping */
+    size_t nbytes;		/* large: requested */
+    struct idio_malloc_arena_s *next;
+    idio_malloc_page_t pages[IDIO_MALLOC_ARENA_PAGES];
+} idio_malloc_arena_t;
 
 /*
- * The overhead on a block is at least 8 bytes using the ov_align
- * field.
- *
- * When in use, the first byte is set to IDIO_MALLOC_MAGIC_ALLOC (or
- * _FREE), and the second byte is the bucket index.
- *
- * Range checking is always enabled and there's a idio_alloc_t holding
- * the size of the requested block.
+ * A large allocation starts after the arena header's common fields
  */
-union idio_malloc_overhead_u {
+#define IDIO_MALLOC_LARGE_OFFSET	IDIO_MALLOC_ROUND (offsetof (idio_malloc_arena_t, pages), IDIO_MALLOC_QUANTUM)
+
+#define IDIO_MALLOC_ARENA(p)		((idio_malloc_arena_t *) ((uintptr_t) (p) & ~ (uintptr_t) IDIO_MALLOC_ARENA_MASK))
+#define IDIO_MALLOC_PAGE(a,p)		(&((a)->pages[((char *) (p) - (char *) (a)) >> IDIO_MALLOC_PAGE_SHIFT]))
+
+typedef struct idio_malloc_class_stats_s {
+    uint64_t nmalloc;
+    uint64_t nfree;
+    uint64_t peak;		/* in use */
+    uint64_t npages;
+    uint64_t peak_pages;
+} idio_malloc_class_stats_t;
+
+static size_t idio_malloc_class_size[IDIO_MALLOC_NCLASSES];
+static uint16_t idio_malloc_class_nobj[IDIO_MALLOC_NCLASSES];
+static uint8_t idio_malloc_size_class[(IDIO_MALLOC_SMALL_MAX >> IDIO_MALLOC_QUANTUM_SHIFT) + 1];
+static idio_malloc_page_t *idio_malloc_partial[IDIO_MALLOC_NCLASSES];
+static idio_malloc_class_stats_t idio_malloc_class_stats[IDIO_MALLOC_NCLASSES];
+
+static idio_malloc_arena_t *idio_malloc_arenas = NULL;
+static idio_malloc_page_t *idio_malloc_free_pages = NULL;
+static size_t idio_malloc_ndirty = 0;
+
+static long idio_malloc_pagesz = 0;		/* page size - result from sysconf() */
+static int idio_malloc_thp = 0;
+
+static struct {
+    uint64_t arenas;
+    uint64_t madvises;
+    uint64_t large_nmalloc;
+    uint64_t large_nfree;
+    uint64_t large_bytes;
+    uint64_t large_peak;
+} idio_malloc_counts;
+
+static void idio_malloc_init ()
+{
+    idio_malloc_pagesz = sysconf (_SC_PAGESIZE);
+    if (idio_malloc_pagesz < 1024) {
+	fprintf (stderr, "im-init: small pagesize() %lx\n", idio_malloc_pagesz);
+	idio_malloc_pagesz = 1024;
+    }
+
     /*
-     * Check o_align matches IDIO_MALLOC_ALIGN_SIZE
+     * 16, 32, ... 128 then four classes per power of two
      */
-    uint64_t o_align;		/* 					8 bytes */
-    struct {
-	uint8_t      ovu_magic;  /* magic number			1 */
-	idio_bi_t    ovu_bucket; /* bucket #				1 */
-	uint16_t     ovu_rmagic; /* range magic number			2 */
-	idio_alloc_t ovu_size;   /* actual block size			4/8 */
-    } ovu;
-#define ov_magic	ovu.ovu_magic
-#define ov_bucket	ovu.ovu_bucket
-#define ov_rmagic	ovu.ovu_rmagic
-#define ov_size		ovu.ovu_size
-};
-
-/*
- * Instead of a single MAGIC number, Bash uses an ISFREE/ISALLOC pair
- */
-#define IDIO_MALLOC_MAGIC_FREE	0xbf		/* f for free */
-#define IDIO_MALLOC_MAGIC_ALLOC	0xbb		/* b for ... blob */
-#define IDIO_MALLOC_LMAGIC	0x5555		/* magic # on range info */
-#define IDIO_MALLOC_RMAGIC	0xeeee		/* magic # on range info */
+    int sc = 0;
+    size_t sz;
+    for (sz = IDIO_MALLOC_QUANTUM; sz <= 128; sz += IDIO_MALLOC_QUANTUM) {
+	idio_malloc_class_size[sc++] = sz;
+    }
+    size_t po2;
+    for (po2 = 128; po2 < IDIO_MALLOC_SMALL_MAX; po2 <<= 1) {
+	int i;
+	for (i = 5; i <= 8; i++) {
+	    idio_malloc_class_size[sc++] = po2 * i / 4;
+	}
+    }
+    IDIO_C_ASSERT (IDIO_MALLOC_NCLASSES == sc);
 
-/*
- * There's one ovu_rmagic field in the header and this will give us
- * room for one after the allocated block
- */
-#define IDIO_MALLOC_RSLOP		sizeof (uint16_t)
+    size_t q = 0;
+    for (sc = 0; sc < IDIO_MALLOC_NCLASSES; sc++) {
+	idio_malloc_class_nobj[sc] = IDIO_MALLOC_PAGE_SIZE / idio_malloc_class_size[sc];
+	for (; q <= (idio_malloc_class_size[sc] >> IDIO_MALLOC_QUANTUM_SHIFT); q++) {
+	    idio_malloc_size_class[q] = sc;
+	}
+    }
 
-/*
- * IDIO_MALLOC_ALIGN_SIZE should match the o_align size in
- * idio_malloc_overhead_u
- */
-#define IDIO_MALLOC_ALIGN_SIZE	8
-#define IDIO_MALLOC_ALIGN_MASK	(IDIO_MALLOC_ALIGN_SIZE - 1)
-#define IDIO_MALLOC_ALIGN(n)	((n + IDIO_MALLOC_ALIGN_MASK) & ~ IDIO_MALLOC_ALIGN_MASK)
-#define IDIO_MALLOC_SIZE(n)	IDIO_MALLOC_ALIGN(sizeof (union idio_malloc_overhead_u) + n + IDIO_MALLOC_RSLOP)
+    char *e = getenv ("IDIO_MALLOC_THP");
+    if (NULL != e) {
+	idio_malloc_thp = atoi (e);
+    }
+}
 
 /*
- * Bash enhancement:
- *
- * Access free-list pointer of a block. It is stored at block + sizeof
- * (char *). This is not a field in the ovu structure member of union
- * idio_malloc_overhead_u because we want sizeof (union
- * idio_malloc_overhead_u) to describe the overhead for when the block
- * is in use, and we do not want the free-list pointer to count in
- * that.
+ * idio_malloc_mmap() - mmap(2) {size} bytes aligned to
+ * IDIO_MALLOC_ARENA_SIZE
  *
- * I don't understand why the CHAIN doesn't use the user-portion of
- * the bucket all the time.  So, I've made it use the user-portion all
- * the time!
+ * We over-allocate and trim the ends.
  */
+static void *idio_malloc_mmap (size_t const size)
+{
+    size_t const msize = size + IDIO_MALLOC_ARENA_SIZE;
+    char *m = mmap (0, msize, PROT_READ|PROT_WRITE, MAP_ANON|MAP_PRIVATE, -1, 0);
+    if (MAP_FAILED == m) {
+	perror ("mmap");
+	fprintf (stderr, "im-mmap: mmap (%zu) => -1\n", msize);
+#ifdef RLIMIT_VMEM
+	if (ENOMEM == errno) {
+	    struct rlimit rlim;
 
-#define IDIO_MALLOC_OVERHEAD_CHAIN(p)	(*(union idio_malloc_overhead_u **) ((char *) (p + 1)))
+	    if (getrlimit (RLIMIT_VMEM, &rlim) == -1) {
+		idio_error_system_errno ("getrlimit", idio_S_nil, IDIO_C_FUNC_LOCATION ());
+	    }
 
-#define IDIO_MALLOC_BUCKET_RANGE(sz,b)	(((sz) > idio_malloc_bucket_sizes[(b)-1]) && ((sz) <= idio_malloc_bucket_sizes[(b)]))
+	    fprintf (stderr, "im-mmap: ENOMEM: rlimit.RLIMIT_VMEM.rlim_cur = %zu\n", (size_t) rlim.rlim_cur);
+	}
+#endif
+	return NULL;
+    }
 
-static void idio_malloc_morecore (idio_bi_t bucket);
+    char *a = (char *) IDIO_MALLOC_ROUND ((uintptr_t) m, IDIO_MALLOC_ARENA_SIZE);
+    if (a > m) {
+	munmap (m, a - m);
+    }
+    char *ae = a + size;
+    char *me = m + msize;
+    if (me > ae) {
+	munmap (ae, me - ae);
+    }
 
-static idio_alloc_t idio_malloc_bucket_sizes[IDIO_MALLOC_NBUCKETS] = {
-    0
-};
+    return a;
+}
 
-/*
- * idio_malloc_nextf[i] is the pointer to the next free block of size
- * 2^(i+IDIO_MALLOC_FIRST_Po2).  The smallest allocatable block is
- * 2^IDIO_MALLOC_FIRST_Po2 bytes.  The idio_malloc_overhead_u
- * information precedes the data area returned to the user.
- */
-static union idio_malloc_overhead_u *idio_malloc_nextf[IDIO_MALLOC_NBUCKETS];
+static int idio_malloc_arena_new ()
+{
+    idio_malloc_arena_t *a = (idio_malloc_arena_t *) idio_malloc_mmap (IDIO_MALLOC_ARENA_SIZE);
+    if (NULL == a) {
+	return 0;
+    }
 
-static long idio_malloc_pagesz;			/* page size - result from sysconf() */
-static idio_bi_t idio_malloc_pagesz_bucket;	/* the page size bucket */
+#ifdef MADV_HUGEPAGE
+    if (idio_malloc_thp) {
+	madvise (a, IDIO_MALLOC_ARENA_SIZE, MADV_HUGEPAGE);
+    }
+#endif
+
+    a->magic = IDIO_MALLOC_ARENA_MAGIC;
+    a->size = IDIO_MALLOC_ARENA_SIZE;
+    a->next = idio_malloc_arenas;
+    idio_malloc_arenas = a;
+    idio_malloc_counts.arenas++;
+
+    /*
+     * The first page is us
+     */
+    a->pages[0].sc = IDIO_MALLOC_PAGE_META;
+
+    size_t i;
+    for (i = IDIO_MALLOC_ARENA_PAGES - 1; i > 0; i--) {
+	idio_malloc_page_t *pg = &(a->pages[i]);
+	pg->base = (char *) a + (i << IDIO_MALLOC_PAGE_SHIFT);
+	pg->sc = IDIO_MALLOC_PAGE_FREE;
+	pg->next = idio_malloc_free_pages;
+	idio_malloc_free_pages = pg;
+    }
+
+    return 1;
+}
+
+static void idio_malloc_partial_push (idio_malloc_page_t *pg)
+{
+    idio_malloc_page_t *head = idio_malloc_partial[pg->sc];
+
+    pg->prev = NULL;
+    pg->next = head;
+    if (NULL != head) {
+	head->prev = pg;
+    }
+    idio_malloc_partial[pg->sc] = pg;
+}
+
+static void idio_malloc_partial_remove (idio_malloc_page_t *pg)
+{
+    if (NULL == pg->prev) {
+	idio_malloc_partial[pg->sc] = pg->next;
+    } else {
+	pg->prev->next = pg->next;
+    }
+    if (NULL != pg->next) {
+	pg->next->prev = pg->prev;
+    }
+    pg->next = NULL;
+    pg->prev = NULL;
+}
+
+static idio_malloc_page_t *idio_malloc_page_get (uint8_t sc)
+{
+    if (NULL == idio_malloc_free_pages &&
+	0 == idio_malloc_arena_new ()) {
+	return NULL;
+    }
+
+    idio_malloc_page_t *pg = idio_malloc_free_pages;
+    idio_malloc_free_pages = pg->next;
+
+    if (pg->dirty) {
+	pg->dirty = 0;
+	idio_malloc_ndirty--;
+    }
+
+    pg->sc = sc;
+    pg->free = NULL;
+    pg->bump = pg->base;
+    pg->nused = 0;
+    idio_malloc_partial_push (pg);
+
+    idio_malloc_class_stats_t *cs = &(idio_malloc_class_stats[sc]);
+    cs->npages++;
+    if (cs->npages > cs->peak_pages) {
+	cs->peak_pages = cs->npages;
+    }
+
+    return pg;
+}
 
-#ifdef IDIO_DEBUG
 /*
- * idio_malloc_stats_num[i] is the difference between the number of
- * mallocs and frees for a given block size.
+ * idio_malloc_page_put() - return the empty page {pg} to the free
+ * page pool
  */
-static uint64_t idio_malloc_stats_num[IDIO_MALLOC_NBUCKETS];
-static uint64_t idio_malloc_stats_peak[IDIO_MALLOC_NBUCKETS];
-static uint64_t idio_malloc_stats_mmaps[IDIO_MALLOC_NBUCKETS];
-static uint64_t idio_malloc_stats_munmaps[IDIO_MALLOC_NBUCKETS];
+static void idio_malloc_page_put (idio_malloc_page_t *pg)
+{
+    idio_malloc_partial_remove (pg);
+    idio_malloc_class_stats[pg->sc].npages--;
+
+    pg->sc = IDIO_MALLOC_PAGE_FREE;
+    pg->free = NULL;
+
+    if (idio_malloc_ndirty < IDIO_MALLOC_DIRTY_MAX) {
+	pg->dirty = 1;
+	idio_malloc_ndirty++;
+    } else {
+#ifdef MADV_DONTNEED
+	madvise (pg->base, IDIO_MALLOC_PAGE_SIZE, MADV_DONTNEED);
+	idio_malloc_counts.madvises++;
 #endif
+    }
 
-static void idio_malloc_init ()
+    pg->next = idio_malloc_free_pages;
+    idio_malloc_free_pages = pg;
+}
+
+static void *idio_malloc_large (size_t const size)
 {
-    idio_malloc_pagesz = sysconf (_SC_PAGESIZE);
-    if (idio_malloc_pagesz < 1024) {
-	fprintf (stderr, "im-pagealign: small pagesize() %lx\n", idio_malloc_pagesz);
-	idio_malloc_pagesz = 1024;
+    size_t const msize = IDIO_MALLOC_ROUND (IDIO_MALLOC_LARGE_OFFSET + size, (size_t) idio_malloc_pagesz);
+
+    idio_malloc_arena_t *a = (idio_malloc_arena_t *) idio_malloc_mmap (msize);
+    if (NULL == a) {
+	return NULL;
     }
 
-    register idio_bi_t nblks;
+    a->magic = IDIO_MALLOC_LARGE_MAGIC;
+    a->size = msize;
+    a->nbytes = size;
 
-    /*
-     * Starting bucket size wants to be 2^IDIO_MALLOC_FIRST_Po2
-     */
-    register idio_alloc_t sz = 1 << IDIO_MALLOC_FIRST_Po2;
-    for (nblks = 0; nblks < IDIO_MALLOC_NBUCKETS; nblks++) {
-	idio_malloc_bucket_sizes[nblks] = sz;
-	if (IDIO_MALLOC_MAX_SZ == sz) {
-	    break;
-	} else {
-	    sz <<= 1;
-	}
+    idio_malloc_counts.large_nmalloc++;
+    idio_malloc_counts.large_bytes += msize;
+    if (idio_malloc_counts.large_bytes > idio_malloc_counts.large_peak) {
+	idio_malloc_counts.large_peak = idio_malloc_counts.large_bytes;
     }
 
-    for (nblks = 7; nblks < IDIO_MALLOC_NBUCKETS; nblks++) {
-	if (idio_malloc_pagesz <= idio_malloc_bucket_sizes[nblks]) {
-	    break;
-	}
-    }
-    idio_malloc_pagesz_bucket = nblks;
+    return (char *) a + IDIO_MALLOC_LARGE_OFFSET;
 }
 
 void *idio_malloc_malloc (size_t size)
 {
     /*
-     * First time malloc is called, setup page size and bucket sizes
+     * First time malloc is called, setup page size and size classes
      */
-    if (idio_malloc_pagesz == 0) {
+    if (0 == idio_malloc_pagesz) {
 	idio_malloc_init ();
     }
 
-    /*
-     * Convert amount of memory requested into closest block size
-     * stored in hash buckets which satisfies request.  Account for
-     * space used per block for accounting.
-     */
-    register idio_alloc_t reqd_size = IDIO_MALLOC_SIZE (size);
-    register idio_bi_t bucket;
-
-    /*
-     * We can do a tiny speed increase as rather than always searching
-     * from bucket #1 start at bucket #n if request is > pagesize
-     */
-    if (reqd_size <= ((idio_alloc_t) idio_malloc_pagesz >> 1)) {
-	bucket = 1;
-    } else {
-	bucket = idio_malloc_pagesz_bucket;
+    if (size > IDIO_MALLOC_SMALL_MAX) {
+	return idio_malloc_large (size);
     }
 
-    for (; bucket < IDIO_MALLOC_NBUCKETS; bucket++) {
-	if (reqd_size <= idio_malloc_bucket_sizes[bucket]) {
-	    break;
-	}
-    }
+    uint8_t sc = idio_malloc_size_class[(size + IDIO_MALLOC_QUANTUM - 1) >> IDIO_MALLOC_QUANTUM_SHIFT];
 
-    /*
-     * If nothing in hash bucket right now, request more memory from
-     * the system.
-     */
-    register union idio_malloc_overhead_u *op;
-    if ((op = idio_malloc_nextf[bucket]) == NULL) {
-	idio_malloc_morecore (bucket);
-	if ((op = idio_malloc_nextf[bucket]) == NULL) {
-	    fprintf (stderr, "im-malloc: morecore failed\n");
-	    return (NULL);
+    idio_malloc_page_t *pg = idio_malloc_partial[sc];
+    if (NULL == pg) {
+	pg = idio_malloc_page_get (sc);
+	if (NULL == pg) {
+	    fprintf (stderr, "im-malloc: no more pages\n");
+	    return NULL;
 	}
     }
 
-    /*
-     * This is a historical check when the "next" pointer in the union
-     * overlaid the structure's ovu_rmagic field
-     */
-    if ((intptr_t) idio_malloc_nextf[bucket] & 0x3) {
-	fprintf (stderr, "im-malloc: nextf[%2d] %8p is not a pointer\n", bucket, op);
-	assert (0);
+    void *p = pg->free;
+    if (NULL != p) {
+	pg->free = *(void **) p;
+    } else {
+	p = pg->bump;
+	pg->bump += idio_malloc_class_size[sc];
     }
 
-    /* remove from linked list */
-    idio_malloc_nextf[bucket] = IDIO_MALLOC_OVERHEAD_CHAIN (op);
-    op->ov_magic = IDIO_MALLOC_MAGIC_ALLOC;
-    op->ov_bucket = bucket;
-#ifdef IDIO_DEBUG
-    idio_malloc_stats_num[bucket]++;
-    if (idio_malloc_stats_num[bucket] > idio_malloc_stats_peak[bucket]) {
-	idio_malloc_stats_peak[bucket] = idio_malloc_stats_num[bucket];
+    pg->nused++;
+    if (idio_malloc_class_nobj[sc] == pg->nused) {
+	idio_malloc_partial_remove (pg);
     }
-#endif
 
-    /*
-     * Record allocated size of block and bound space with magic
-     * numbers.
-     */
-    op->ov_rmagic = IDIO_MALLOC_LMAGIC;
-    op->ov_size = size;
-    int16_t *rmagic = (int16_t *) ((char *) op + reqd_size - IDIO_MALLOC_RSLOP);
-    *rmagic = IDIO_MALLOC_RMAGIC;
+    idio_malloc_class_stats_t *cs = &(idio_malloc_class_stats[sc]);
+    cs->nmalloc++;
+    if ((cs->nmalloc - cs->nfree) > cs->peak) {
+	cs->peak = cs->nmalloc - cs->nfree;
+    }
 
-    return ((char *)(op + 1));
+    return p;
 }
 
 void *idio_malloc_calloc (size_t num, size_t size)
@@ -328,96 +441,23 @@ void *idio_malloc_calloc (size_t num, size_t size)
 	return (NULL);
     }
 
-    void *ret;
-
-    if ((ret = idio_malloc_malloc(num * size)) != NULL)
-	memset(ret, 0, num * size);
-
-    return (ret);
-}
-
-/*
- * Allocate more memory to the indicated bucket.
- */
-static void idio_malloc_morecore (idio_bi_t bucket)
-{
-    IDIO_C_ASSERT (bucket < IDIO_MALLOC_NBUCKETS);
-    register idio_alloc_t sz = idio_malloc_bucket_sizes[bucket];
-
-    if (-1 == sz) {
-	fprintf (stderr, "im-morecore: pagesizes[%d] = %" IDIO_PRIa " is too large\n", bucket, sz);
-	return;
-    }
-
     /*
-     * We want to allocate a rounded pagesize amount of memory
+     * Large allocations are fresh from mmap(2) and therefore zero
      */
-    idio_alloc_t amt;
-    int nblks;
-    if (sz < idio_malloc_pagesz) {
-	amt = idio_malloc_pagesz;
-	nblks = amt / sz;
-    } else {
-	/*
-	 * The Bash algorithm checks alignment
-	 */
-	amt = sz & (idio_malloc_pagesz - 1);
-	if (0 == amt) {
-	    amt = sz;
-	} else {
-	    amt = sz + idio_malloc_pagesz - amt;
+    if ((num * size) > IDIO_MALLOC_SMALL_MAX) {
+	if (0 == idio_malloc_pagesz) {
+	    idio_malloc_init ();
 	}
-	nblks = 1;
-    }
 
-    if (bucket > 1 &&
-	bucket < 6) {
-	amt = 1 * idio_malloc_pagesz;
-	nblks = amt / sz;
-#ifdef IDIO_DEBUG
-	idio_malloc_stats_mmaps[bucket] += 1;
-#endif
-    } else {
-#ifdef IDIO_DEBUG
-	idio_malloc_stats_mmaps[bucket]++;
-#endif
+	return idio_malloc_large (num * size);
     }
 
-    register union idio_malloc_overhead_u *op;
-    op = (union idio_malloc_overhead_u *) mmap (0, amt, PROT_READ|PROT_WRITE, MAP_ANON|MAP_PRIVATE, -1, 0);
-    if ((void *) op != (void *) -1) {
-	idio_malloc_nextf[bucket] = op;
-
-	while (1) {
-	    op->ov_magic = IDIO_MALLOC_MAGIC_FREE;
-	    op->ov_bucket = bucket;
-	    nblks--;
-	    if (nblks <= 0) {
-		break;
-	    }
-	    register union idio_malloc_overhead_u *next = (union idio_malloc_overhead_u *) ((char *) op + sz);
-	    IDIO_MALLOC_OVERHEAD_CHAIN (op) = next;
-	    op = next;
-	}
-	IDIO_MALLOC_OVERHEAD_CHAIN (op) = NULL;
-    } else {
-	perror ("mmap");
-	fprintf (stderr, "im-morecore: mmap (%" IDIO_PRIa ") => -1\n", amt);
-#ifdef RLIMIT_VMEM
-	if (ENOMEM == errno) {
-	    struct rlimit rlim;
+    void *ret;
 
-	    if (getrlimit (RLIMIT_VMEM, &rlim) == -1) {
-		idio_error_system_errno ("getrlimit", idio_S_nil, IDIO_C_FUNC_LOCATION ());
-	    }
+    if ((ret = idio_malloc_malloc(num * size)) != NULL)
+	memset(ret, 0, num * size);
 
-	    fprintf (stderr, "im-morecore: ENOMEM: rlimit.RLIMIT_VMEM.rlim_cur = %zu\n", (size_t) rlim.rlim_cur);
-	}
-#endif
-#ifdef IDIO_DEBUG
-	idio_malloc_stats ("im-morecore: mmap fail");
-#endif
-    }
+    return (ret);
 }
 
 void idio_malloc_free (void *cp)
@@ -426,72 +466,61 @@ void idio_malloc_free (void *cp)
 	return;
     }
 
-    register union idio_malloc_overhead_u *op;
-    op = (union idio_malloc_overhead_u *)((caddr_t)cp - sizeof (union idio_malloc_overhead_u));
+    idio_malloc_arena_t *a = IDIO_MALLOC_ARENA (cp);
+
+    if (IDIO_MALLOC_LARGE_MAGIC == a->magic) {
+	IDIO_C_ASSERT ((char *) a + IDIO_MALLOC_LARGE_OFFSET == cp);
 
-    if (op->ov_magic != IDIO_MALLOC_MAGIC_ALLOC) {
-	fprintf (stderr, "im-free: !ALLOC: cp %8p op %8p: magic %#x index %d\n", cp, op, op->ov_magic, op->ov_bucket);
-	if (op->ov_magic == IDIO_MALLOC_MAGIC_FREE) {
-	    fprintf (stderr, "im-free: already freed??\n");
-	} else {
-	    fprintf (stderr, "im-free: magic %#x != %#x\n", op->ov_magic, IDIO_MALLOC_MAGIC_ALLOC);
+	idio_malloc_counts.large_nfree++;
+	idio_malloc_counts.large_bytes -= a->size;
+
+	if (munmap (a, a->size) < 0) {
+	    perror ("munmap");
 	}
-	assert (op->ov_magic == IDIO_MALLOC_MAGIC_ALLOC);
+	return;
     }
 
-    IDIO_C_ASSERT(IDIO_MALLOC_LMAGIC == op->ov_rmagic);
+    if (IDIO_MALLOC_ARENA_MAGIC != a->magic) {
+	fprintf (stderr, "im-free: cp %8p arena %8p: magic %#x\n", cp, a, a->magic);
+	assert (IDIO_MALLOC_ARENA_MAGIC == a->magic);
+    }
 
-    register idio_bi_t bucket = op->ov_bucket;
+    idio_malloc_page_t *pg = IDIO_MALLOC_PAGE (a, cp);
+    uint8_t sc = pg->sc;
 
-    IDIO_C_ASSERT (bucket < IDIO_MALLOC_NBUCKETS);
+    if (sc >= IDIO_MALLOC_NCLASSES ||
+	0 == pg->nused) {
+	fprintf (stderr, "im-free: cp %8p page %8p: class %d used %d: already freed??\n", cp, pg->base, sc, pg->nused);
+	assert (sc < IDIO_MALLOC_NCLASSES);
+    }
 
+#if IDIO_DEBUG
     /*
-     * If someone ran cp[-1] = RMAGIC then we don't know what else
-     * they've done.  Not that there's *that* much we can do as any of
-     * the values could have been trampled on.
+     * memset to something not all-zeroes and not all-ones to try to
+     * catch assumptions about default memory bugs
+     *
+     * Also be different to idio_gc_alloc() which uses A
+     *
+     * F for free
      */
-    IDIO_C_ASSERT (op->ov_size >= 0);
-    register idio_alloc_t reqd_size = IDIO_MALLOC_SIZE (op->ov_size);
-    if (reqd_size > idio_malloc_bucket_sizes[bucket]) {
-	fprintf (stderr, "[%" PRIdMAX "]im-free: %p rq %" IDIO_PRIa " (sz %" IDIO_PRIa ") > bucket[%2d] == %" IDIO_PRIa "\n", (intmax_t) getpid (), op, reqd_size, op->ov_size, bucket, idio_malloc_bucket_sizes[bucket]);
-	IDIO_C_ASSERT (reqd_size <= idio_malloc_bucket_sizes[bucket]);
+    memset (cp, 0x46, idio_malloc_class_size[sc]);
+#endif
+
+    if (idio_malloc_class_nobj[sc] == pg->nused) {
+	idio_malloc_partial_push (pg);
     }
 
-    IDIO_C_ASSERT(IDIO_MALLOC_RMAGIC == (uint16_t) *(uint16_t *) ((char *) op + reqd_size - IDIO_MALLOC_RSLOP));
+    *(void **) cp = pg->free;
+    pg->free = cp;
+    pg->nused--;
 
-    if (bucket >= idio_malloc_pagesz_bucket) {
-	if (munmap ((caddr_t) op, idio_malloc_bucket_sizes[bucket]) < 0) {
-	    perror ("munmap");
-	}
-#ifdef IDIO_DEBUG
-	idio_malloc_stats_munmaps[bucket]++;
-#endif
-    } else {
-#if IDIO_DEBUG
-	/*
-	 * memset to something not all-zeroes and not all-ones to try to
-	 * catch assumptions about default memory bugs
-	 *
-	 * Also be different to idio_gc_alloc() which uses A
-	 *
-	 * F for free
-	 */
-	memset (cp, 0x46, op->ov_size);
-#endif
+    idio_malloc_class_stats[sc].nfree++;
 
-	op->ov_magic = IDIO_MALLOC_MAGIC_FREE;
-	IDIO_MALLOC_OVERHEAD_CHAIN (op) = idio_malloc_nextf[bucket];	/* also clobbers ov_magic */
-	idio_malloc_nextf[bucket] = op;
+    if (0 == pg->nused) {
+	idio_malloc_page_put (pg);
     }
-#ifdef IDIO_DEBUG
-    idio_malloc_stats_num[bucket]--;
-#endif
 }
 
-/*
- * The Bash algorithm seems more succint
- */
-
 void * idio_malloc_realloc (void *cp, size_t size)
 {
     if (0 == size) {
@@ -503,178 +532,114 @@ void * idio_malloc_realloc (void *cp, size_t size)
 	return idio_malloc_malloc (size);
     }
 
-    union idio_malloc_overhead_u *op;
-    op = (union idio_malloc_overhead_u *) ((caddr_t) cp - sizeof (union idio_malloc_overhead_u));
+    idio_malloc_arena_t *a = IDIO_MALLOC_ARENA (cp);
+    size_t count;
 
-    if (op->ov_magic != IDIO_MALLOC_MAGIC_ALLOC) {
-	fprintf (stderr, "im-realloc: !ALLOC: cp %8p op %8p: magic %#x index %d\n", cp, op, op->ov_magic, op->ov_bucket);
-	if (op->ov_magic == IDIO_MALLOC_MAGIC_FREE) {
-	    fprintf (stderr, "im-realloc: already freed??\n");
-	} else {
-	    fprintf (stderr, "im-realloc: magic %#x != %#x\n", op->ov_magic, IDIO_MALLOC_MAGIC_ALLOC);
+    if (IDIO_MALLOC_LARGE_MAGIC == a->magic) {
+	/*
+	 * Stay put if we still fit and are not giving most of it back
+	 */
+	if (size > IDIO_MALLOC_SMALL_MAX &&
+	    (IDIO_MALLOC_LARGE_OFFSET + size) <= a->size &&
+	    (IDIO_MALLOC_LARGE_OFFSET + size) > a->size / 2) {
+	    a->nbytes = size;
+	    return cp;
 	}
-	assert (op->ov_magic == IDIO_MALLOC_MAGIC_ALLOC);
-    }
-
-    IDIO_C_ASSERT (IDIO_MALLOC_LMAGIC == op->ov_rmagic);
-
-    register idio_bi_t bucket = op->ov_bucket;
-
-    IDIO_C_ASSERT (bucket < IDIO_MALLOC_NBUCKETS);
-
-    /*
-     * If someone ran cp[-1] = RMAGIC then we don't know what else
-     * they've done.  Not that there's *that* much we can do as any of
-     * the values could have been trampled on.
-     */
-    IDIO_C_ASSERT (op->ov_size >= 0);
-    register idio_alloc_t reqd_size = IDIO_MALLOC_SIZE (op->ov_size);
-    if (reqd_size > idio_malloc_bucket_sizes[bucket]) {
-	fprintf (stderr, "[%" PRIdMAX "]im-realloc: %p rq %" IDIO_PRIa " (sz %" IDIO_PRIa ") > bucket[%2d] == %" IDIO_PRIa "\n", (intmax_t) getpid (), op, reqd_size, op->ov_size, bucket, idio_malloc_bucket_sizes[bucket]);
-	IDIO_C_ASSERT (reqd_size <= idio_malloc_bucket_sizes[bucket]);
-    }
-
-    int16_t *rmagic = (int16_t *) ((char *) op + reqd_size - IDIO_MALLOC_RSLOP);
-    if (IDIO_MALLOC_RMAGIC != (uint16_t) *rmagic) {
-	fprintf (stderr, "[%" PRIdMAX "]im-realloc: %p + %" IDIO_PRIa " - %4d: %x != %x\n", (intmax_t) getpid (), op, reqd_size, (int) IDIO_MALLOC_RSLOP, IDIO_MALLOC_RMAGIC, (uint16_t) *rmagic);
-	IDIO_C_ASSERT(IDIO_MALLOC_RMAGIC == (uint16_t) *rmagic);
-    }
-
-    if (size == (size_t) op->ov_size) {
-	return cp;
-    }
-
-    if (0 == bucket) {
-	fprintf (stderr, "im-realloc: BUCKET_RANGE (%" IDIO_PRIa ", %d)?\n", reqd_size, bucket);
-    }
-    /*
-     * Rework with the (actual) requested size -- do we fit in this
-     * bucket anyway and can we get away with just rejigging the
-     * allocation's ov_size?
-     */
-    reqd_size = IDIO_MALLOC_SIZE (size);
-    if ((bucket > 0 &&
-	 IDIO_MALLOC_BUCKET_RANGE (reqd_size, bucket)) ||
-	(bucket > 1 &&
-	 IDIO_MALLOC_BUCKET_RANGE (reqd_size, bucket - 1))) {
-	op->ov_size = size;
+	count = a->nbytes;
+    } else {
+	IDIO_C_ASSERT (IDIO_MALLOC_ARENA_MAGIC == a->magic);
 
-	rmagic = (int16_t *) ((char *) op + reqd_size - IDIO_MALLOC_RSLOP);
-	*rmagic = IDIO_MALLOC_RMAGIC;
+	idio_malloc_page_t *pg = IDIO_MALLOC_PAGE (a, cp);
+	IDIO_C_ASSERT (pg->sc < IDIO_MALLOC_NCLASSES);
 
-	return cp;
+	if (size <= IDIO_MALLOC_SMALL_MAX &&
+	    idio_malloc_size_class[(size + IDIO_MALLOC_QUANTUM - 1) >> IDIO_MALLOC_QUANTUM_SHIFT] == pg->sc) {
+	    return cp;
+	}
+	count = idio_malloc_class_size[pg->sc];
     }
 
-    register idio_alloc_t count = op->ov_size;
-    if (reqd_size < count) {
-	count = reqd_size;
+    if (size < count) {
+	count = size;
     }
 
-    register char *res;
-    if ((res = idio_malloc_malloc (size)) == NULL) {
+    void *res = idio_malloc_malloc (size);
+    if (NULL == res) {
 	return NULL;
     }
 
-    bcopy(cp, res, count);
-
-    /*
-     * {res} is the consumer result, we want the underlying union to
-     * (correctly) set the ramge magic mark.
-     */
-    union idio_malloc_overhead_u *rp = (union idio_malloc_overhead_u *) ((caddr_t) res - sizeof (union idio_malloc_overhead_u));
-    rmagic = (int16_t *) ((char *) rp + reqd_size - IDIO_MALLOC_RSLOP);
-    *rmagic = IDIO_MALLOC_RMAGIC;
+    memcpy (res, cp, count);
 
     idio_malloc_free (cp);
 
     return res;
 }
 
-#ifdef IDIO_DEBUG
 /*
- * mstats - print out statistics about malloc
+ * idio_malloc_stats - print out statistics about malloc
  *
- * Prints two lines of numbers, one showing the length of the free list
- * for each size category, the second showing the number of mallocs -
- * frees for each size category.
+ * For each size class in use: the number of mallocs and frees, the
+ * number in use and its peak and the number of pages and its peak.
  */
 void idio_malloc_stats (char const *s)
 {
     FILE *fh = fopen ("idio-malloc-stats", "w");
 
-    unsigned long long i, j, k;
-    register union idio_malloc_overhead_u *p;
-    unsigned long totfree = 0;
-    unsigned long totused = 0;
-    unsigned long nfree = 0;
-    unsigned long nused = 0;
-    unsigned long mmaps = 0;
-    unsigned long munmaps = 0;
-
-    for (i = 0; i < IDIO_MALLOC_NBUCKETS; i++) {
-	if (idio_malloc_stats_num[i] ||
-	    idio_malloc_stats_peak[i]) {
-	    k = i;
-	}
+    if (NULL == fh) {
+	perror ("fopen idio-malloc-stats");
+	return;
     }
-    k++;
 
     char scales[] = " KMGT";
-    int scale;
-
-    fprintf(fh, "Memory allocation statistics %s\nbucket:\t", s);
-    for (i = 0; i < k; i++) {
-	fprintf(fh, " %6" IDIO_PRIa "%c", idio_malloc_bucket_sizes[i], (idio_malloc_pagesz_bucket == i) ? '*' : ' ');
-    }
-    fprintf (fh, "\nfree:\t");
-    for (i = 0; i < k; i++) {
-	for (j = 0, p = idio_malloc_nextf[i]; p; p = IDIO_MALLOC_OVERHEAD_CHAIN (p), j++)
-	    ;
-	nfree += j;
-	totfree += j * (1 << (i + IDIO_MALLOC_FIRST_Po2));
-	scale = 0;
-	idio_hcount (&j, &scale);
-	fprintf(fh, " %6lld%c", j, scales[scale]);
-    }
-    fprintf(fh, "\nused:\t");
-    for (i = 0; i < k; i++) {
-	j = idio_malloc_stats_num[i];
-	nused += j;
-	totused += j * (1 << (i + IDIO_MALLOC_FIRST_Po2));
-	scale = 0;
-	idio_hcount (&j, &scale);
-	fprintf(fh, " %6lld%c", j, scales[scale]);
-    }
-    fprintf(fh, "\npeak:\t");
-    for (i = 0; i < k; i++) {
-	j = idio_malloc_stats_peak[i];
-	scale = 0;
-	idio_hcount (&j, &scale);
-	fprintf(fh, " %6lld%c", j, scales[scale]);
-    }
-    fprintf(fh, "\nmmap:\t");
-    for (i = 0; i < k; i++) {
-	j = idio_malloc_stats_mmaps[i];
-	mmaps += j;
-	scale = 0;
-	idio_hcount (&j, &scale);
-	fprintf(fh, " %6lld%c", j, scales[scale]);
-    }
-    fprintf(fh, "\nmunmap:\t");
-    for (i = 0; i < k; i++) {
-	j = idio_malloc_stats_munmaps[i];
-	munmaps += j;
-	scale = 0;
-	idio_hcount (&j, &scale);
-	fprintf(fh, " %6lld%c", j, scales[scale]);
-    }
-    fprintf(fh, "\n\tTotal in use: %lu for %lu, total free: %lu for %lu\n",
-	    nused, totused, nfree, totfree);
-    fprintf (fh, "\t %5lu mmaps, %5lu munmaps\n", mmaps, munmaps);
+
+    fprintf (fh, "Memory allocation statistics %s\n", s);
+    fprintf (fh, "%6s %7s %7s %7s %7s %7s %7s\n", "class", "malloc", "free", "used", "peak", "pages", "peak");
+
+    unsigned long long tused = 0;
+    unsigned long long tpages = 0;
+    int sc;
+    for (sc = 0; sc < IDIO_MALLOC_NCLASSES; sc++) {
+	idio_malloc_class_stats_t *cs = &(idio_malloc_class_stats[sc]);
+	if (0 == cs->nmalloc) {
+	    continue;
+	}
+
+	unsigned long long n[6] = {
+	    cs->nmalloc,
+	    cs->nfree,
+	    cs->nmalloc - cs->nfree,
+	    cs->peak,
+	    cs->npages,
+	    cs->peak_pages,
+	};
+	tused += (cs->nmalloc - cs->nfree) * idio_malloc_class_size[sc];
+	tpages += cs->npages;
+
+	fprintf (fh, "%6zu", idio_malloc_class_size[sc]);
+	int i;
+	for (i = 0; i < 6; i++) {
+	    int scale = 0;
+	    idio_hcount (&n[i], &scale);
+	    fprintf (fh, " %6llu%c", n[i], scales[scale]);
+	}
+	fprintf (fh, "\n");
+    }
+
+    fprintf (fh, "\tsmall: %llu bytes in use in %llu %zuKB pages\n", tused, tpages, IDIO_MALLOC_PAGE_SIZE >> 10);
+    fprintf (fh, "\tlarge: %" PRIu64 " mallocs, %" PRIu64 " frees, %" PRIu64 " bytes mapped, %" PRIu64 " peak\n",
+	     idio_malloc_counts.large_nmalloc,
+	     idio_malloc_counts.large_nfree,
+	     idio_malloc_counts.large_bytes,
+	     idio_malloc_counts.large_peak);
+    fprintf (fh, "\t%" PRIu64 " %zuMB arenas, %zu dirty free pages, %" PRIu64 " pages madvise'd%s\n",
+	     idio_malloc_counts.arenas,
+	     IDIO_MALLOC_ARENA_SIZE >> 20,
+	     idio_malloc_ndirty,
+	     idio_malloc_counts.madvises,
+	     idio_malloc_thp ? ", THP" : "");
 
     fclose (fh);
 }
-#endif
 
 /*
  * http://stackoverflow.com/questions/3774417/sprintf-with-automatic-memory-allocation
@@ -205,7 +205,6 @@ IDIO idio_module (IDIO name)
     }
 
     IDIO mo = idio_gc_get (IDIO_TYPE_MODULE);
-    mo->vtable = idio_vtable (IDIO_TYPE_MODULE);
 
     IDIO_GC_ALLOC (mo->u.module, sizeof (idio_module_t));
 
@@ -2227,7 +2226,7 @@ void idio_init_module ()
 
     /*
      * XXX Create the module vtable before creating any modules,
-     * eg. Idio, otherwise the Idio->vtable will be NULL.
+     * eg. Idio.
      */
     idio_vtable_t *m_vt = idio_vtable (IDIO_TYPE_MODULE);
 
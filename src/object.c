@@ -160,6 +160,10 @@ IDIO idio_struct_instance_inst;
 IDIO idio_thread_inst;
 IDIO idio_continuation_inst;
 IDIO idio_bitset_inst;
+IDIO idio_pmap_inst;
+IDIO idio_omap_inst;
+IDIO idio_tvector_inst;
+IDIO idio_bytevector_inst;
 
 static IDIO idio_object_invoke_instance_in_error;
 static IDIO idio_object_invoke_entity_in_error;
@@ -611,6 +615,10 @@ IDIO idio_object_class_of (IDIO o)
     case IDIO_TYPE_THREAD:		return idio_thread_inst;
     case IDIO_TYPE_CONTINUATION:	return idio_continuation_inst;
     case IDIO_TYPE_BITSET:		return idio_bitset_inst;
+    case IDIO_TYPE_PMAP:		return idio_pmap_inst;
+    case IDIO_TYPE_OMAP:		return idio_omap_inst;
+    case IDIO_TYPE_TVECTOR:		return idio_tvector_inst;
+    case IDIO_TYPE_BYTEVECTOR:		return idio_bytevector_inst;
 
     case IDIO_TYPE_C_CHAR:		return idio_C_char_inst;
     case IDIO_TYPE_C_SCHAR:		return idio_C_schar_inst;
@@ -1857,11 +1865,11 @@ void idio_object_add_primitives ()
      * Careful, though, IOS instances are recursive by design so we
      * need printers that are aware of that.
      */
-    idio_vtable_add_method (idio_class_struct_type->vtable,
+    idio_vtable_add_method (IDIO_STRUCT_TYPE_VTABLE (idio_class_struct_type),
 			    idio_S_2string,
 			    idio_vtable_create_method_simple (idio_class_struct_type_method_2string));
 
-    idio_vtable_add_method (idio_class_struct_type->vtable,
+    idio_vtable_add_method (IDIO_STRUCT_TYPE_VTABLE (idio_class_struct_type),
 			    idio_S_struct_instance_2string,
 			    idio_vtable_create_method_simple (idio_instance_method_2string));
 
@@ -2009,6 +2017,10 @@ void idio_object_add_primitives ()
     IDIO_EXPORT_PRIMITIVE_CLASS (idio_thread_inst,          "<thread>");
     IDIO_EXPORT_PRIMITIVE_CLASS (idio_continuation_inst,    "<continuation>");
     IDIO_EXPORT_PRIMITIVE_CLASS (idio_bitset_inst,          "<bitset>");
+    IDIO_EXPORT_PRIMITIVE_CLASS (idio_pmap_inst,            "<pmap>");
+    IDIO_EXPORT_PRIMITIVE_CLASS (idio_omap_inst,            "<omap>");
+    IDIO_EXPORT_PRIMITIVE_CLASS (idio_tvector_inst,         "<tvector>");
+    IDIO_EXPORT_PRIMITIVE_CLASS (idio_bytevector_inst,      "<bytevector>");
 
 #define IDIO_EXPORT_PROCEDURE_CLASS(v,cname)				\
     class_sym = IDIO_SYMBOL (cname);				\
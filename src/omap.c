@@ -0,0 +1,1838 @@
+/*
+ * Copyright (c) 2020-2022 Ian Fitchet <idf(at)idio-lang.org>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License.  You
+ * may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/*
+ * omap.c
+ *
+ * Ordered maps: a B-tree, as described in Cormen, Leiserson, Rivest
+ * and Stein, "Introduction to Algorithms," chapter 18.
+ *
+ * Keys are ordered by a less-than function.  Two keys, a and b, are
+ * the same key if neither (less a b) nor (less b a).  Without a
+ * user-supplied function keys are ordered by idio_omap_default_less()
+ * which handles numbers, strings, symbols, keywords and unicode --
+ * but only one of those in any given omap.
+ *
+ * Insertion splits full nodes and deletion tops up minimal nodes on
+ * the way down so that neither ever has to come back up the tree.
+ *
+ * Range and prefix walks use an explicit stack of (node, index)
+ * pairs rather than building a list of keys first.
+ */
+
+#define _GNU_SOURCE
+
+#include <sys/types.h>
+
+#include <assert.h>
+#include <limits.h>
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "idio-config.h"
+
+#include "gc.h"
+#include "idio.h"
+
+#include "bignum.h"
+#include "closure.h"
+#include "error.h"
+#include "evaluate.h"
+#include "fixnum.h"
+#include "handle.h"
+#include "hash.h"
+#include "idio-string.h"
+#include "keyword.h"
+#include "omap.h"
+#include "pair.h"
+#include "symbol.h"
+#include "unicode.h"
+#include "util.h"
+#include "vm.h"
+#include "vtable.h"
+
+#define IDIO_OMAP_KEY_NONE	0
+#define IDIO_OMAP_KEY_NUMBER	1
+#define IDIO_OMAP_KEY_STRING	2
+#define IDIO_OMAP_KEY_SYMBOL	3
+#define IDIO_OMAP_KEY_KEYWORD	4
+#define IDIO_OMAP_KEY_UNICODE	5
+
+typedef void (*idio_omap_walk_func_t) (IDIO k, IDIO v, void *data);
+
+static size_t idio_omap_node_size (int leaf)
+{
+    size_t size = sizeof (idio_omap_node_t);
+
+    if (! leaf) {
+	size += (IDIO_OMAP_MAX + 1) * sizeof (idio_omap_node_t *);
+    }
+
+    return size;
+}
+
+static idio_omap_node_t *idio_omap_node (int leaf)
+{
+    idio_omap_node_t *node;
+    IDIO_GC_ALLOC (node, idio_omap_node_size (leaf));
+    node->n = 0;
+    node->leaf = leaf;
+
+    return node;
+}
+
+static void idio_omap_free_node (idio_omap_node_t *node)
+{
+    IDIO_GC_FREE (node, idio_omap_node_size (node->leaf));
+}
+
+static void idio_omap_free_tree (idio_omap_node_t *node)
+{
+    if (! node->leaf) {
+	unsigned int i;
+	for (i = 0; i <= node->n; i++) {
+	    idio_omap_free_tree (node->child[i]);
+	}
+    }
+
+    idio_omap_free_node (node);
+}
+
+IDIO idio_omap (IDIO less)
+{
+    IDIO_ASSERT (less);
+
+    IDIO om = idio_gc_get (IDIO_TYPE_OMAP);
+    IDIO_GC_ALLOC (om->u.omap, sizeof (idio_omap_t));
+    IDIO_OMAP_GREY (om) = NULL;
+    IDIO_OMAP_ROOT (om) = NULL;
+    IDIO_OMAP_COUNT (om) = 0;
+    IDIO_OMAP_VERSION (om) = 0;
+    IDIO_OMAP_LESS (om) = less;
+    IDIO_OMAP_FLAGS (om) = IDIO_FLAG_NONE;
+
+    return om;
+}
+
+int idio_isa_omap (IDIO o)
+{
+    IDIO_ASSERT (o);
+
+    return idio_isa (o, IDIO_TYPE_OMAP);
+}
+
+void idio_free_omap (IDIO om)
+{
+    IDIO_ASSERT (om);
+    IDIO_TYPE_ASSERT (omap, om);
+
+    if (NULL != IDIO_OMAP_ROOT (om)) {
+	idio_omap_free_tree (IDIO_OMAP_ROOT (om));
+    }
+
+    IDIO_GC_FREE (om->u.omap, sizeof (idio_omap_t));
+}
+
+static idio_omap_node_t *idio_omap_copy_node (idio_omap_node_t *node)
+{
+    idio_omap_node_t *c = idio_omap_node (node->leaf);
+    c->n = node->n;
+    memcpy (c->keys, node->keys, node->n * sizeof (IDIO));
+    memcpy (c->values, node->values, node->n * sizeof (IDIO));
+
+    if (! node->leaf) {
+	unsigned int i;
+	for (i = 0; i <= node->n; i++) {
+	    c->child[i] = idio_omap_copy_node (node->child[i]);
+	}
+    }
+
+    return c;
+}
+
+static void idio_omap_copy_values (idio_omap_node_t *node, int depth)
+{
+    unsigned int i;
+    for (i = 0; i < node->n; i++) {
+	node->values[i] = idio_copy (node->values[i], depth);
+    }
+
+    if (! node->leaf) {
+	for (i = 0; i <= node->n; i++) {
+	    idio_omap_copy_values (node->child[i], depth);
+	}
+    }
+}
+
+IDIO idio_copy_omap (IDIO om, int depth)
+{
+    IDIO_ASSERT (om);
+    IDIO_TYPE_ASSERT (omap, om);
+
+    IDIO new = idio_omap (IDIO_OMAP_LESS (om));
+
+    if (NULL != IDIO_OMAP_ROOT (om)) {
+	IDIO_OMAP_ROOT (new) = idio_omap_copy_node (IDIO_OMAP_ROOT (om));
+	IDIO_OMAP_COUNT (new) = IDIO_OMAP_COUNT (om);
+
+	if (IDIO_COPY_DEEP == depth) {
+	    /*
+	     * idio_copy() can invoke idio_vm_run() which can invoke
+	     * the GC so we need to protect {new}
+	     */
+	    idio_gc_protect (new);
+	    idio_omap_copy_values (IDIO_OMAP_ROOT (new), depth);
+	    idio_gc_expose (new);
+	}
+    }
+
+    return new;
+}
+
+static int idio_omap_key_kind (IDIO k)
+{
+    if (idio_isa_fixnum (k) ||
+	idio_isa_bignum (k)) {
+	return IDIO_OMAP_KEY_NUMBER;
+    } else if (idio_isa_string (k)) {
+	return IDIO_OMAP_KEY_STRING;
+    } else if (idio_isa_symbol (k)) {
+	return IDIO_OMAP_KEY_SYMBOL;
+    } else if (idio_isa_keyword (k)) {
+	return IDIO_OMAP_KEY_KEYWORD;
+    } else if (idio_isa_unicode (k)) {
+	return IDIO_OMAP_KEY_UNICODE;
+    }
+
+    return IDIO_OMAP_KEY_NONE;
+}
+
+/*
+ * idio_omap_default_less() assumes a and b are of the same kind, see
+ * idio_omap_key_assert()
+ */
+static int idio_omap_default_less (IDIO a, IDIO b)
+{
+    switch (idio_omap_key_kind (a)) {
+    case IDIO_OMAP_KEY_NUMBER:
+	if (IDIO_TYPE_FIXNUMP (a) &&
+	    IDIO_TYPE_FIXNUMP (b)) {
+	    return (IDIO_FIXNUM_VAL (a) < IDIO_FIXNUM_VAL (b));
+	}
+
+	if (IDIO_TYPE_FIXNUMP (a)) {
+	    a = idio_bignum_integer_intmax_t (IDIO_FIXNUM_VAL (a));
+	}
+	if (IDIO_TYPE_FIXNUMP (b)) {
+	    b = idio_bignum_integer_intmax_t (IDIO_FIXNUM_VAL (b));
+	}
+
+	return idio_bignum_real_lt_p (a, b);
+    case IDIO_OMAP_KEY_STRING:
+	return (idio_string_cmp (a, b) < 0);
+    case IDIO_OMAP_KEY_SYMBOL:
+	return (strcmp (IDIO_SYMBOL_S (a), IDIO_SYMBOL_S (b)) < 0);
+    case IDIO_OMAP_KEY_KEYWORD:
+	return (strcmp (IDIO_KEYWORD_S (a), IDIO_KEYWORD_S (b)) < 0);
+    case IDIO_OMAP_KEY_UNICODE:
+	return (IDIO_UNICODE_VAL (a) < IDIO_UNICODE_VAL (b));
+    }
+
+    /*
+     * Test Case: n/a
+     *
+     * The key was vetted by idio_omap_key_assert()
+     */
+    idio_coding_error_C ("unexpected key", a, IDIO_C_FUNC_LOCATION ());
+
+    /* notreached */
+    return 0;
+}
+
+/*
+ * idio_omap_less() calls the omap's less-than function.
+ *
+ * A user-supplied function can do anything, including modifying the
+ * omap whose nodes we are part way through.  version is the omap's
+ * version when we started.
+ */
+static int idio_omap_less (IDIO om, IDIO a, IDIO b, size_t version)
+{
+    IDIO less = IDIO_OMAP_LESS (om);
+
+    if (idio_S_nil == less) {
+	return idio_omap_default_less (a, b);
+    }
+
+    IDIO r = idio_vm_invoke_C (IDIO_LIST3 (less, a, b));
+
+    if (IDIO_OMAP_VERSION (om) != version) {
+	/*
+	 * Test Case: omap-errors/omap-less-modifies-omap.idio
+	 *
+	 * modify := #f
+	 * om := make-omap (function (a b) {
+	 *   if modify {
+	 *     modify = #f
+	 *     omap-delete! om a
+	 *   }
+	 *   lt a b
+	 * })
+	 * omap-set! om 1 #t
+	 * modify = #t
+	 * omap-set! om 2 #t
+	 */
+	idio_error_param_value_msg_only ("omap", "less", "modified the omap", IDIO_C_FUNC_LOCATION ());
+
+	/* notreached */
+	return 0;
+    }
+
+    return (idio_S_false != r);
+}
+
+/*
+ * idio_omap_comparablep() returns 0 if key cannot be compared with
+ * the keys in om by the default ordering.  Anything goes for a
+ * user-supplied less-than function.
+ */
+static int idio_omap_comparablep (IDIO om, IDIO key)
+{
+    if (idio_S_nil != IDIO_OMAP_LESS (om)) {
+	return 1;
+    }
+
+    int kind = idio_omap_key_kind (key);
+
+    if (IDIO_OMAP_KEY_NONE == kind) {
+	return 0;
+    }
+
+    if (NULL == IDIO_OMAP_ROOT (om)) {
+	return 1;
+    }
+
+    return (idio_omap_key_kind (IDIO_OMAP_ROOT (om)->keys[0]) == kind);
+}
+
+static void idio_omap_key_assert (IDIO om, IDIO key, char const *func, char const *param)
+{
+    if (idio_omap_comparablep (om, key)) {
+	return;
+    }
+
+    if (IDIO_OMAP_KEY_NONE == idio_omap_key_kind (key)) {
+	/*
+	 * Test Case: omap-errors/omap-set-bad-key-type.idio
+	 *
+	 * omap-set! (make-omap) #t #t
+	 */
+	idio_error_param_value_msg (func, param, key, "not an ordered type", IDIO_C_FUNC_LOCATION ());
+    } else {
+	/*
+	 * Test Case: omap-errors/omap-set-mixed-key-types.idio
+	 *
+	 * om := (make-omap)
+	 * omap-set! om 1 #t
+	 * omap-set! om "a" #t
+	 */
+	idio_error_param_value_msg (func, param, key, "not comparable with the omap's keys", IDIO_C_FUNC_LOCATION ());
+    }
+}
+
+/*
+ * idio_omap_search() returns the index of the first key in node that
+ * is not less than key or, if strict, that is greater than key
+ */
+static unsigned int idio_omap_search (IDIO om, idio_omap_node_t *node, IDIO key, int strict, size_t version)
+{
+    unsigned int lo = 0;
+    unsigned int hi = node->n;
+
+    while (lo < hi) {
+	unsigned int mid = lo + (hi - lo) / 2;
+	int before;
+
+	if (strict) {
+	    before = ! idio_omap_less (om, key, node->keys[mid], version);
+	} else {
+	    before = idio_omap_less (om, node->keys[mid], key, version);
+	}
+
+	if (before) {
+	    lo = mid + 1;
+	} else {
+	    hi = mid;
+	}
+    }
+
+    return lo;
+}
+
+static int idio_omap_find (IDIO om, IDIO key, idio_omap_node_t **nodep, unsigned int *ip)
+{
+    size_t version = IDIO_OMAP_VERSION (om);
+    idio_omap_node_t *x = IDIO_OMAP_ROOT (om);
+
+    while (NULL != x) {
+	unsigned int i = idio_omap_search (om, x, key, 0, version);
+
+	if (i < x->n &&
+	    ! idio_omap_less (om, key, x->keys[i], version)) {
+	    *nodep = x;
+	    *ip = i;
+	    return 1;
+	}
+
+	if (x->leaf) {
+	    break;
+	}
+
+	x = x->child[i];
+    }
+
+    return 0;
+}
+
+int idio_omap_exists_key (IDIO om, IDIO key)
+{
+    IDIO_ASSERT (om);
+    IDIO_ASSERT (key);
+
+    IDIO_TYPE_ASSERT (omap, om);
+
+    if (! idio_omap_comparablep (om, key)) {
+	return 0;
+    }
+
+    idio_omap_node_t *node;
+    unsigned int i;
+
+    return idio_omap_find (om, key, &node, &i);
+}
+
+/*
+ * idio_omap_ref() returns #<unspec> if key is not present, like
+ * idio_hash_ref()
+ */
+IDIO idio_omap_ref (IDIO om, IDIO key)
+{
+    IDIO_ASSERT (om);
+    IDIO_ASSERT (key);
+
+    IDIO_TYPE_ASSERT (omap, om);
+
+    if (! idio_omap_comparablep (om, key)) {
+	return idio_S_unspec;
+    }
+
+    idio_omap_node_t *node;
+    unsigned int i;
+
+    if (idio_omap_find (om, key, &node, &i)) {
+	return node->values[i];
+    }
+
+    return idio_S_unspec;
+}
+
+/*
+ * idio_omap_split_child() splits the full i-th child of x into two
+ * and moves the median key up into x
+ */
+static void idio_omap_split_child (idio_omap_node_t *x, unsigned int i)
+{
+    unsigned int t = IDIO_OMAP_ORDER;
+    idio_omap_node_t *y = x->child[i];
+    idio_omap_node_t *z = idio_omap_node (y->leaf);
+
+    z->n = t - 1;
+    memcpy (z->keys, y->keys + t, (t - 1) * sizeof (IDIO));
+    memcpy (z->values, y->values + t, (t - 1) * sizeof (IDIO));
+    if (! y->leaf) {
+	memcpy (z->child, y->child + t, t * sizeof (idio_omap_node_t *));
+    }
+    y->n = t - 1;
+
+    memmove (x->keys + i + 1, x->keys + i, (x->n - i) * sizeof (IDIO));
+    memmove (x->values + i + 1, x->values + i, (x->n - i) * sizeof (IDIO));
+    memmove (x->child + i + 2, x->child + i + 1, (x->n - i) * sizeof (idio_omap_node_t *));
+    x->keys[i] = y->keys[t - 1];
+    x->values[i] = y->values[t - 1];
+    x->child[i + 1] = z;
+    x->n++;
+}
+
+/*
+ * idio_omap_set() returns 1 if key was added and 0 if an existing
+ * key's value was replaced
+ */
+int idio_omap_set (IDIO om, IDIO key, IDIO v)
+{
+    IDIO_ASSERT (om);
+    IDIO_ASSERT (key);
+    IDIO_ASSERT (v);
+
+    IDIO_TYPE_ASSERT (omap, om);
+
+    size_t version = ++IDIO_OMAP_VERSION (om);
+    idio_omap_node_t *x = IDIO_OMAP_ROOT (om);
+
+    if (NULL == x) {
+	x = idio_omap_node (1);
+	x->n = 1;
+	x->keys[0] = key;
+	x->values[0] = v;
+	IDIO_OMAP_ROOT (om) = x;
+	IDIO_OMAP_COUNT (om) = 1;
+
+	return 1;
+    }
+
+    if (IDIO_OMAP_MAX == x->n) {
+	idio_omap_node_t *s = idio_omap_node (0);
+	s->child[0] = x;
+	idio_omap_split_child (s, 0);
+	IDIO_OMAP_ROOT (om) = s;
+	x = s;
+    }
+
+    for (;;) {
+	unsigned int i = idio_omap_search (om, x, key, 0, version);
+
+	if (i < x->n &&
+	    ! idio_omap_less (om, key, x->keys[i], version)) {
+	    x->values[i] = v;
+	    return 0;
+	}
+
+	if (x->leaf) {
+	    memmove (x->keys + i + 1, x->keys + i, (x->n - i) * sizeof (IDIO));
+	    memmove (x->values + i + 1, x->values + i, (x->n - i) * sizeof (IDIO));
+	    x->keys[i] = key;
+	    x->values[i] = v;
+	    x->n++;
+	    IDIO_OMAP_COUNT (om)++;
+
+	    return 1;
+	}
+
+	if (IDIO_OMAP_MAX == x->child[i]->n) {
+	    idio_omap_split_child (x, i);
+
+	    if (idio_omap_less (om, x->keys[i], key, version)) {
+		i++;
+	    } else if (! idio_omap_less (om, key, x->keys[i], version)) {
+		x->values[i] = v;
+		return 0;
+	    }
+	}
+
+	x = x->child[i];
+    }
+}
+
+static void idio_omap_borrow_left (idio_omap_node_t *x, unsigned int i)
+{
+    idio_omap_node_t *c = x->child[i];
+    idio_omap_node_t *l = x->child[i - 1];
+
+    memmove (c->keys + 1, c->keys, c->n * sizeof (IDIO));
+    memmove (c->values + 1, c->values, c->n * sizeof (IDIO));
+    if (! c->leaf) {
+	memmove (c->child + 1, c->child, (c->n + 1) * sizeof (idio_omap_node_t *));
+	c->child[0] = l->child[l->n];
+    }
+    c->keys[0] = x->keys[i - 1];
+    c->values[0] = x->values[i - 1];
+    c->n++;
+
+    x->keys[i - 1] = l->keys[l->n - 1];
+    x->values[i - 1] = l->values[l->n - 1];
+    l->n--;
+}
+
+static void idio_omap_borrow_right (idio_omap_node_t *x, unsigned int i)
+{
+    idio_omap_node_t *c = x->child[i];
+    idio_omap_node_t *r = x->child[i + 1];
+
+    c->keys[c->n] = x->keys[i];
+    c->values[c->n] = x->values[i];
+    if (! c->leaf) {
+	c->child[c->n + 1] = r->child[0];
+	memmove (r->child, r->child + 1, r->n * sizeof (idio_omap_node_t *));
+    }
+    c->n++;
+
+    x->keys[i] = r->keys[0];
+    x->values[i] = r->values[0];
+    memmove (r->keys, r->keys + 1, (r->n - 1) * sizeof (IDIO));
+    memmove (r->values, r->values + 1, (r->n - 1) * sizeof (IDIO));
+    r->n--;
+}
+
+/*
+ * idio_omap_merge() merges the i-th and i+1-th children of x, both
+ * minimal, around the i-th key of x
+ */
+static void idio_omap_merge (idio_omap_node_t *x, unsigned int i)
+{
+    idio_omap_node_t *y = x->child[i];
+    idio_omap_node_t *z = x->child[i + 1];
+
+    y->keys[y->n] = x->keys[i];
+    y->values[y->n] = x->values[i];
+    memcpy (y->keys + y->n + 1, z->keys, z->n * sizeof (IDIO));
+    memcpy (y->values + y->n + 1, z->values, z->n * sizeof (IDIO));
+    if (! y->leaf) {
+	memcpy (y->child + y->n + 1, z->child, (z->n + 1) * sizeof (idio_omap_node_t *));
+    }
+    y->n += z->n + 1;
+
+    memmove (x->keys + i, x->keys + i + 1, (x->n - i - 1) * sizeof (IDIO));
+    memmove (x->values + i, x->values + i + 1, (x->n - i - 1) * sizeof (IDIO));
+    memmove (x->child + i + 1, x->child + i + 2, (x->n - i - 1) * sizeof (idio_omap_node_t *));
+    x->n--;
+
+    idio_omap_free_node (z);
+}
+
+/*
+ * idio_omap_descend() returns the i-th child of x having first
+ * ensured that it has more than the minimum number of keys.
+ *
+ * Only the root can be left with no keys, in which case the child
+ * becomes the root.
+ */
+static idio_omap_node_t *idio_omap_descend (IDIO om, idio_omap_node_t *x, unsigned int i)
+{
+    if (x->child[i]->n < IDIO_OMAP_ORDER) {
+	if (i > 0 &&
+	    x->child[i - 1]->n >= IDIO_OMAP_ORDER) {
+	    idio_omap_borrow_left (x, i);
+	} else if (i < x->n &&
+		   x->child[i + 1]->n >= IDIO_OMAP_ORDER) {
+	    idio_omap_borrow_right (x, i);
+	} else {
+	    if (i == x->n) {
+		i--;
+	    }
+	    idio_omap_merge (x, i);
+	}
+    }
+
+    idio_omap_node_t *c = x->child[i];
+
+    if (0 == x->n) {
+	IDIO_OMAP_ROOT (om) = c;
+	idio_omap_free_node (x);
+    }
+
+    return c;
+}
+
+static void idio_omap_remove_max (IDIO om, idio_omap_node_t *x, IDIO *kp, IDIO *vp)
+{
+    while (! x->leaf) {
+	x = idio_omap_descend (om, x, x->n);
+    }
+
+    x->n--;
+    *kp = x->keys[x->n];
+    *vp = x->values[x->n];
+}
+
+static void idio_omap_remove_min (IDIO om, idio_omap_node_t *x, IDIO *kp, IDIO *vp)
+{
+    while (! x->leaf) {
+	x = idio_omap_descend (om, x, 0);
+    }
+
+    *kp = x->keys[0];
+    *vp = x->values[0];
+    x->n--;
+    memmove (x->keys, x->keys + 1, x->n * sizeof (IDIO));
+    memmove (x->values, x->values + 1, x->n * sizeof (IDIO));
+}
+
+/*
+ * idio_omap_delete() returns 1 if key was removed
+ */
+int idio_omap_delete (IDIO om, IDIO key)
+{
+    IDIO_ASSERT (om);
+    IDIO_ASSERT (key);
+
+    IDIO_TYPE_ASSERT (omap, om);
+
+    if (! idio_omap_comparablep (om, key)) {
+	return 0;
+    }
+
+    /*
+     * We may rearrange the tree on the way down even if key is not
+     * present
+     */
+    size_t version = ++IDIO_OMAP_VERSION (om);
+    idio_omap_node_t *x = IDIO_OMAP_ROOT (om);
+
+    while (NULL != x) {
+	unsigned int i = idio_omap_search (om, x, key, 0, version);
+
+	if (i < x->n &&
+	    ! idio_omap_less (om, key, x->keys[i], version)) {
+	    if (x->leaf) {
+		x->n--;
+		memmove (x->keys + i, x->keys + i + 1, (x->n - i) * sizeof (IDIO));
+		memmove (x->values + i, x->values + i + 1, (x->n - i) * sizeof (IDIO));
+
+		if (0 == x->n) {
+		    /*
+		     * Only the root can be emptied
+		     */
+		    idio_omap_free_node (x);
+		    IDIO_OMAP_ROOT (om) = NULL;
+		}
+	    } else if (x->child[i]->n >= IDIO_OMAP_ORDER) {
+		idio_omap_remove_max (om, x->child[i], &x->keys[i], &x->values[i]);
+	    } else if (x->child[i + 1]->n >= IDIO_OMAP_ORDER) {
+		idio_omap_remove_min (om, x->child[i + 1], &x->keys[i], &x->values[i]);
+	    } else {
+		/*
+		 * key moves down into the merged child and we go
+		 * round again
+		 */
+		idio_omap_merge (x, i);
+
+		idio_omap_node_t *y = x->child[i];
+		if (0 == x->n) {
+		    IDIO_OMAP_ROOT (om) = y;
+		    idio_omap_free_node (x);
+		}
+		x = y;
+
+		continue;
+	    }
+
+	    IDIO_OMAP_COUNT (om)--;
+	    return 1;
+	}
+
+	if (x->leaf) {
+	    break;
+	}
+
+	x = idio_omap_descend (om, x, i);
+    }
+
+    return 0;
+}
+
+/*
+ * idio_omap_bound() finds the greatest key not greater than key, if
+ * floor, or the least key not less than key
+ */
+static int idio_omap_bound (IDIO om, IDIO key, int floor, idio_omap_node_t **nodep, unsigned int *ip)
+{
+    size_t version = IDIO_OMAP_VERSION (om);
+    idio_omap_node_t *x = IDIO_OMAP_ROOT (om);
+    int found = 0;
+
+    while (NULL != x) {
+	unsigned int i;
+
+	if (floor) {
+	    i = idio_omap_search (om, x, key, 1, version);
+	    if (i > 0) {
+		*nodep = x;
+		*ip = i - 1;
+		found = 1;
+	    }
+	} else {
+	    i = idio_omap_search (om, x, key, 0, version);
+	    if (i < x->n) {
+		*nodep = x;
+		*ip = i;
+		found = 1;
+	    }
+	}
+
+	if (x->leaf) {
+	    break;
+	}
+
+	x = x->child[i];
+    }
+
+    return found;
+}
+
+/*
+ * An iterator is the path from the root to the current key: for each
+ * node, the index of the key we are at or, for the nodes above it,
+ * the index of the key we will come back to.
+ */
+typedef struct idio_omap_iter_s {
+    IDIO om;
+    size_t version;
+    int sp;
+    idio_omap_node_t *node[IDIO_OMAP_MAX_DEPTH];
+    unsigned int i[IDIO_OMAP_MAX_DEPTH];
+} idio_omap_iter_t;
+
+static void idio_omap_iter_push (idio_omap_iter_t *it, idio_omap_node_t *x, unsigned int i)
+{
+    it->sp++;
+    IDIO_C_ASSERT (it->sp < IDIO_OMAP_MAX_DEPTH);
+    it->node[it->sp] = x;
+    it->i[it->sp] = i;
+}
+
+/*
+ * Pop any nodes we have finished with.  An empty stack is the end.
+ */
+static void idio_omap_iter_settle (idio_omap_iter_t *it)
+{
+    while (it->sp >= 0 &&
+	   it->i[it->sp] == it->node[it->sp]->n) {
+	it->sp--;
+    }
+}
+
+/*
+ * idio_omap_iter_seek() positions it at the first key not less than
+ * key or, if strict, greater than key.  A NULL key means the first
+ * key.
+ */
+static void idio_omap_iter_seek (idio_omap_iter_t *it, IDIO key, int strict)
+{
+    it->sp = -1;
+    it->version = IDIO_OMAP_VERSION (it->om);
+
+    idio_omap_node_t *x = IDIO_OMAP_ROOT (it->om);
+    while (NULL != x) {
+	unsigned int i = 0;
+	if (NULL != key) {
+	    i = idio_omap_search (it->om, x, key, strict, it->version);
+	}
+
+	idio_omap_iter_push (it, x, i);
+
+	x = x->leaf ? NULL : x->child[i];
+    }
+
+    idio_omap_iter_settle (it);
+}
+
+static void idio_omap_iter_next (idio_omap_iter_t *it)
+{
+    idio_omap_node_t *x = it->node[it->sp];
+    it->i[it->sp]++;
+
+    if (! x->leaf) {
+	x = x->child[it->i[it->sp]];
+	while (NULL != x) {
+	    idio_omap_iter_push (it, x, 0);
+	    x = x->leaf ? NULL : x->child[0];
+	}
+    }
+
+    idio_omap_iter_settle (it);
+}
+
+#define IDIO_OMAP_ITER_KEY(it)		((it)->node[(it)->sp]->keys[(it)->i[(it)->sp]])
+#define IDIO_OMAP_ITER_VALUE(it)	((it)->node[(it)->sp]->values[(it)->i[(it)->sp]])
+
+/*
+ * idio_omap_walk_range_C() calls func for each key in om from lo
+ * (inclusive) to hi (exclusive), either of which can be NULL for no
+ * bound.  If prefix is not NULL the walk stops at the first key that
+ * is not a string starting with prefix.
+ *
+ * func can re-enter the VM and modify om in which case we seek again
+ * from the last key we visited.
+ */
+static void idio_omap_walk_range_C (IDIO om, IDIO lo, IDIO hi, IDIO prefix, idio_omap_walk_func_t func, void *data)
+{
+    idio_omap_iter_t it;
+    it.om = om;
+
+    IDIO k = idio_S_nil;
+    IDIO_GC_ROOT_FRAME (rf, &k);
+
+    idio_omap_iter_seek (&it, lo, 0);
+
+    while (it.sp >= 0) {
+	k = IDIO_OMAP_ITER_KEY (&it);
+	IDIO v = IDIO_OMAP_ITER_VALUE (&it);
+
+	if (NULL != hi &&
+	    ! idio_omap_less (om, k, hi, it.version)) {
+	    break;
+	}
+
+	if (NULL != prefix &&
+	    ! (idio_isa_string (k) &&
+	       idio_string_prefixp (k, prefix))) {
+	    break;
+	}
+
+	func (k, v, data);
+
+	if (IDIO_OMAP_VERSION (om) != it.version) {
+	    idio_omap_iter_seek (&it, k, 1);
+	} else {
+	    idio_omap_iter_next (&it);
+	}
+    }
+
+    idio_gc_root_frame_pop (&rf);
+}
+
+/*
+ * idio_omap_node_walk_C() calls func for each key in order.  func
+ * must not re-enter the VM.
+ */
+static void idio_omap_node_walk_C (idio_omap_node_t *node, idio_omap_walk_func_t func, void *data)
+{
+    unsigned int i;
+    for (i = 0; i < node->n; i++) {
+	if (! node->leaf) {
+	    idio_omap_node_walk_C (node->child[i], func, data);
+	}
+	func (node->keys[i], node->values[i], data);
+    }
+
+    if (! node->leaf) {
+	idio_omap_node_walk_C (node->child[node->n], func, data);
+    }
+}
+
+/*
+ * idio_omap_node_rwalk_C() calls func for each key in reverse order
+ * which is handy for building lists
+ */
+static void idio_omap_node_rwalk_C (idio_omap_node_t *node, idio_omap_walk_func_t func, void *data)
+{
+    if (! node->leaf) {
+	idio_omap_node_rwalk_C (node->child[node->n], func, data);
+    }
+
+    unsigned int i = node->n;
+    while (i-- > 0) {
+	func (node->keys[i], node->values[i], data);
+	if (! node->leaf) {
+	    idio_omap_node_rwalk_C (node->child[i], func, data);
+	}
+    }
+}
+
+static void idio_omap_key_to_list (IDIO k, IDIO v, void *data)
+{
+    IDIO *rp = (IDIO *) data;
+
+    *rp = idio_pair (k, *rp);
+}
+
+IDIO idio_omap_keys_to_list (IDIO om)
+{
+    IDIO_ASSERT (om);
+    IDIO_TYPE_ASSERT (omap, om);
+
+    IDIO r = idio_S_nil;
+
+    if (NULL != IDIO_OMAP_ROOT (om)) {
+	idio_omap_node_rwalk_C (IDIO_OMAP_ROOT (om), idio_omap_key_to_list, &r);
+    }
+
+    return r;
+}
+
+static void idio_omap_value_to_list (IDIO k, IDIO v, void *data)
+{
+    IDIO *rp = (IDIO *) data;
+
+    *rp = idio_pair (v, *rp);
+}
+
+IDIO idio_omap_values_to_list (IDIO om)
+{
+    IDIO_ASSERT (om);
+    IDIO_TYPE_ASSERT (omap, om);
+
+    IDIO r = idio_S_nil;
+
+    if (NULL != IDIO_OMAP_ROOT (om)) {
+	idio_omap_node_rwalk_C (IDIO_OMAP_ROOT (om), idio_omap_value_to_list, &r);
+    }
+
+    return r;
+}
+
+static void idio_omap_entry_to_list (IDIO k, IDIO v, void *data)
+{
+    IDIO *rp = (IDIO *) data;
+
+    *rp = idio_pair (idio_pair (k, v), *rp);
+}
+
+static void idio_omap_entry_hash_C (IDIO k, IDIO v, void *data)
+{
+    idio_hi_t *hvp = (idio_hi_t *) data;
+
+    *hvp = *hvp * 31 + idio_hash_default_hash_C_deep (k, 1);
+    *hvp = *hvp * 31 + idio_hash_default_hash_C_deep (v, 1);
+}
+
+idio_hi_t idio_omap_hash_C (IDIO om)
+{
+    IDIO_ASSERT (om);
+    IDIO_TYPE_ASSERT (omap, om);
+
+    idio_hi_t hv = IDIO_OMAP_COUNT (om);
+
+    if (NULL != IDIO_OMAP_ROOT (om)) {
+	idio_omap_node_walk_C (IDIO_OMAP_ROOT (om), idio_omap_entry_hash_C, &hv);
+    }
+
+    return hv;
+}
+
+/*
+ * Two omaps with the same keys can have differently shaped trees
+ * depending on the order the keys were added in so we walk both in
+ * step.
+ */
+int idio_omap_equal (IDIO om1, IDIO om2, int eqp)
+{
+    IDIO_ASSERT (om1);
+    IDIO_ASSERT (om2);
+
+    IDIO_TYPE_ASSERT (omap, om1);
+    IDIO_TYPE_ASSERT (omap, om2);
+
+    if (IDIO_OMAP_COUNT (om1) != IDIO_OMAP_COUNT (om2)) {
+	return 0;
+    }
+
+    idio_omap_iter_t it1;
+    it1.om = om1;
+    idio_omap_iter_seek (&it1, NULL, 0);
+
+    idio_omap_iter_t it2;
+    it2.om = om2;
+    idio_omap_iter_seek (&it2, NULL, 0);
+
+    while (it1.sp >= 0) {
+	if (! idio_equal (IDIO_OMAP_ITER_KEY (&it1), IDIO_OMAP_ITER_KEY (&it2), eqp) ||
+	    ! idio_equal (IDIO_OMAP_ITER_VALUE (&it1), IDIO_OMAP_ITER_VALUE (&it2), eqp)) {
+	    return 0;
+	}
+
+	idio_omap_iter_next (&it1);
+	idio_omap_iter_next (&it2);
+    }
+
+    return 1;
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("omap?", omap_p, (IDIO o), "o", "\
+test if `o` is an omap				\n\
+						\n\
+:param o: object to test			\n\
+:return: ``#t`` if `o` is an omap, ``#f`` otherwise	\n\
+")
+{
+    IDIO_ASSERT (o);
+
+    IDIO r = idio_S_false;
+
+    if (idio_isa_omap (o)) {
+	r = idio_S_true;
+    }
+
+    return r;
+}
+
+IDIO_DEFINE_PRIMITIVE0V_DS ("make-omap", make_omap, (IDIO args), "[less]", "\
+create an empty omap					\n\
+							\n\
+An omap is an ordered map: keys are kept in the order	\n\
+given by `less` and can be walked in that order from	\n\
+any key.						\n\
+							\n\
+Two keys, `a` and `b`, are the same key if neither	\n\
+``(less a b)`` nor ``(less b a)``.			\n\
+							\n\
+If `less` is not supplied or is ``#n`` the keys must	\n\
+all be numbers, strings (compared by code point),	\n\
+symbols, keywords or unicode.				\n\
+							\n\
+:param less: less-than function, defaults to ``#n``	\n\
+:type less: 2-ary function, optional			\n\
+:return: omap						\n\
+:rtype: omap						\n\
+")
+{
+    IDIO_ASSERT (args);
+
+    /*
+     * Test Case: n/a
+     *
+     * args is the varargs parameter -- should always be a list
+     */
+    IDIO_USER_TYPE_ASSERT (list, args);
+
+    IDIO less = idio_S_nil;
+
+    if (idio_isa_pair (args)) {
+	less = IDIO_PAIR_H (args);
+
+	if (idio_S_nil != less) {
+	    /*
+	     * Test Case: omap-errors/make-omap-bad-less-type.idio
+	     *
+	     * make-omap #t
+	     */
+	    IDIO_USER_TYPE_ASSERT (function, less);
+	}
+    }
+
+    return idio_omap (less);
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("omap-size", omap_size, (IDIO om), "om", "\
+return the number of keys in omap `om`		\n\
+						\n\
+:param om: omap					\n\
+:type om: omap					\n\
+:return: number of keys				\n\
+:rtype: integer					\n\
+")
+{
+    IDIO_ASSERT (om);
+
+    /*
+     * Test Case: omap-errors/omap-size-bad-type.idio
+     *
+     * omap-size #t
+     */
+    IDIO_USER_TYPE_ASSERT (omap, om);
+
+    return idio_integer (IDIO_OMAP_COUNT (om));
+}
+
+IDIO_DEFINE_PRIMITIVE2_DS ("omap-exists?", omap_existsp, (IDIO om, IDIO key), "om key", "\
+test if `key` exists in omap `om`			\n\
+							\n\
+:param om: omap						\n\
+:type om: omap						\n\
+:param key: key						\n\
+:type key: any						\n\
+:return: ``#t`` if `key` exists in `om`, ``#f`` otherwise	\n\
+")
+{
+    IDIO_ASSERT (om);
+    IDIO_ASSERT (key);
+
+    /*
+     * Test Case: omap-errors/omap-exists-bad-type.idio
+     *
+     * omap-exists? #t #t
+     */
+    IDIO_USER_TYPE_ASSERT (omap, om);
+
+    IDIO r = idio_S_false;
+
+    if (idio_omap_exists_key (om, key)) {
+	r = idio_S_true;
+    }
+
+    return r;
+}
+
+IDIO_DEFINE_PRIMITIVE2V_DS ("omap-ref", omap_ref, (IDIO om, IDIO key, IDIO args), "om key [default]", "\
+return the value indexed by `key` in omap `om`		\n\
+							\n\
+:param om: omap						\n\
+:type om: omap						\n\
+:param key: key						\n\
+:type key: any						\n\
+:param default: a default value if `key` not found	\n\
+:type default: a thunk or a simple value, optional	\n\
+:return: value						\n\
+:rtype: any						\n\
+:raises ^rt-hash-key-not-found-error: if `key` not found	\n\
+	and no `default` supplied			\n\
+")
+{
+    IDIO_ASSERT (om);
+    IDIO_ASSERT (key);
+    IDIO_ASSERT (args);
+
+    /*
+     * Test Case: omap-errors/omap-ref-bad-type.idio
+     *
+     * omap-ref #t #t
+     */
+    IDIO_USER_TYPE_ASSERT (omap, om);
+    /*
+     * Test Case: n/a
+     *
+     * args is the varargs parameter -- should always be a list
+     */
+    IDIO_USER_TYPE_ASSERT (list, args);
+
+    if (idio_omap_comparablep (om, key)) {
+	idio_omap_node_t *node;
+	unsigned int i;
+
+	if (idio_omap_find (om, key, &node, &i)) {
+	    return node->values[i];
+	}
+    }
+
+    if (idio_isa_pair (args)) {
+	IDIO dv = IDIO_PAIR_H (args);
+	if (idio_isa_function (dv)) {
+	    return idio_vm_invoke_C (dv);
+	} else {
+	    return dv;
+	}
+    }
+
+    /*
+     * Test Case: omap-errors/omap-ref-non-existent-key.idio
+     *
+     * omap-ref (make-omap) 1
+     */
+    idio_hash_key_not_found_error (key, IDIO_C_FUNC_LOCATION ());
+
+    return idio_S_notreached;
+}
+
+IDIO_DEFINE_PRIMITIVE3_DS ("omap-set!", omap_set, (IDIO om, IDIO key, IDIO v), "om key v", "\
+set the value indexed by `key` in omap `om` to `v`	\n\
+							\n\
+:param om: omap						\n\
+:type om: omap						\n\
+:param key: key						\n\
+:type key: any						\n\
+:param v: value						\n\
+:type v: any						\n\
+:return: ``#<unspec>``					\n\
+")
+{
+    IDIO_ASSERT (om);
+    IDIO_ASSERT (key);
+    IDIO_ASSERT (v);
+
+    /*
+     * Test Case: omap-errors/omap-set-bad-type.idio
+     *
+     * omap-set! #t #t #t
+     */
+    IDIO_USER_TYPE_ASSERT (omap, om);
+
+    idio_omap_key_assert (om, key, "omap-set!", "key");
+
+    idio_omap_set (om, key, v);
+
+    return idio_S_unspec;
+}
+
+IDIO_DEFINE_PRIMITIVE2_DS ("omap-delete!", omap_delete, (IDIO om, IDIO key), "om key", "\
+remove `key` from omap `om`				\n\
+							\n\
+:param om: omap						\n\
+:type om: omap						\n\
+:param key: key						\n\
+:type key: any						\n\
+:return: ``#<unspec>``					\n\
+")
+{
+    IDIO_ASSERT (om);
+    IDIO_ASSERT (key);
+
+    /*
+     * Test Case: omap-errors/omap-delete-bad-type.idio
+     *
+     * omap-delete! #t #t
+     */
+    IDIO_USER_TYPE_ASSERT (omap, om);
+
+    idio_omap_delete (om, key);
+
+    return idio_S_unspec;
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("omap-keys", omap_keys, (IDIO om), "om", "\
+return a list of the keys of omap `om` in order		\n\
+							\n\
+:param om: omap						\n\
+:type om: omap						\n\
+:return: list of keys					\n\
+:rtype: list						\n\
+")
+{
+    IDIO_ASSERT (om);
+
+    /*
+     * Test Case: omap-errors/omap-keys-bad-type.idio
+     *
+     * omap-keys #t
+     */
+    IDIO_USER_TYPE_ASSERT (omap, om);
+
+    return idio_omap_keys_to_list (om);
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("omap-values", omap_values, (IDIO om), "om", "\
+return a list of the values of omap `om` in key order	\n\
+							\n\
+:param om: omap						\n\
+:type om: omap						\n\
+:return: list of values					\n\
+:rtype: list						\n\
+")
+{
+    IDIO_ASSERT (om);
+
+    /*
+     * Test Case: omap-errors/omap-values-bad-type.idio
+     *
+     * omap-values #t
+     */
+    IDIO_USER_TYPE_ASSERT (omap, om);
+
+    return idio_omap_values_to_list (om);
+}
+
+/*
+ * idio_omap_bound_primitive() is the body of omap-floor and
+ * omap-ceiling
+ */
+static IDIO idio_omap_bound_primitive (IDIO om, IDIO key, int floor)
+{
+    if (! idio_omap_comparablep (om, key)) {
+	return idio_S_false;
+    }
+
+    idio_omap_node_t *node;
+    unsigned int i;
+
+    if (idio_omap_bound (om, key, floor, &node, &i)) {
+	return idio_pair (node->keys[i], node->values[i]);
+    }
+
+    return idio_S_false;
+}
+
+IDIO_DEFINE_PRIMITIVE2_DS ("omap-floor", omap_floor, (IDIO om, IDIO key), "om key", "\
+return the greatest key in omap `om` not greater than	\n\
+`key` and its value					\n\
+							\n\
+:param om: omap						\n\
+:type om: omap						\n\
+:param key: key						\n\
+:type key: any						\n\
+:return: ``(k & v)`` or ``#f`` if there is no such key	\n\
+:rtype: pair or ``#f``					\n\
+")
+{
+    IDIO_ASSERT (om);
+    IDIO_ASSERT (key);
+
+    /*
+     * Test Case: omap-errors/omap-floor-bad-type.idio
+     *
+     * omap-floor #t #t
+     */
+    IDIO_USER_TYPE_ASSERT (omap, om);
+
+    return idio_omap_bound_primitive (om, key, 1);
+}
+
+IDIO_DEFINE_PRIMITIVE2_DS ("omap-ceiling", omap_ceiling, (IDIO om, IDIO key), "om key", "\
+return the least key in omap `om` not less than `key`	\n\
+and its value						\n\
+							\n\
+:param om: omap						\n\
+:type om: omap						\n\
+:param key: key						\n\
+:type key: any						\n\
+:return: ``(k & v)`` or ``#f`` if there is no such key	\n\
+:rtype: pair or ``#f``					\n\
+")
+{
+    IDIO_ASSERT (om);
+    IDIO_ASSERT (key);
+
+    /*
+     * Test Case: omap-errors/omap-ceiling-bad-type.idio
+     *
+     * omap-ceiling #t #t
+     */
+    IDIO_USER_TYPE_ASSERT (omap, om);
+
+    return idio_omap_bound_primitive (om, key, 0);
+}
+
+static void idio_omap_walk_invoke (IDIO k, IDIO v, void *data)
+{
+    IDIO func = (IDIO) data;
+
+    idio_vm_invoke_C (IDIO_LIST3 (func, k, v));
+}
+
+IDIO_DEFINE_PRIMITIVE2_DS ("omap-walk", omap_walk, (IDIO om, IDIO func), "om func", "\
+call `func` for each `key` in omap `om` in order		\n\
+								\n\
+:param om: omap							\n\
+:type om: omap							\n\
+:param func: func to be called with each key, value pair	\n\
+:type func: 2-ary function					\n\
+:return: ``#<unspec>``						\n\
+								\n\
+`func` may modify `om`, the walk continues from the next key	\n\
+after the current one.						\n\
+")
+{
+    IDIO_ASSERT (om);
+    IDIO_ASSERT (func);
+
+    /*
+     * Test Case: omap-errors/omap-walk-bad-omap-type.idio
+     *
+     * omap-walk #t #t
+     */
+    IDIO_USER_TYPE_ASSERT (omap, om);
+    /*
+     * Test Case: omap-errors/omap-walk-bad-func-type.idio
+     *
+     * omap-walk (make-omap) #t
+     */
+    IDIO_USER_TYPE_ASSERT (function, func);
+
+    idio_omap_walk_range_C (om, NULL, NULL, NULL, idio_omap_walk_invoke, func);
+
+    return idio_S_unspec;
+}
+
+typedef struct idio_omap_fold_s {
+    IDIO func;
+    IDIO val;
+} idio_omap_fold_t;
+
+static void idio_omap_fold_invoke (IDIO k, IDIO v, void *data)
+{
+    idio_omap_fold_t *fp = (idio_omap_fold_t *) data;
+
+    fp->val = idio_vm_invoke_C (IDIO_LIST4 (fp->func, k, v, fp->val));
+}
+
+IDIO_DEFINE_PRIMITIVE3_DS ("fold-omap", fold_omap, (IDIO om, IDIO func, IDIO val), "om func val", "\
+call `func` for each `key` in omap `om` in order with		\n\
+arguments: `key`, the value indexed by `key` and `val`		\n\
+								\n\
+`val` is updated to the value returned by `func`		\n\
+								\n\
+The final value of `val` is returned				\n\
+								\n\
+:param om: omap							\n\
+:type om: omap							\n\
+:param func: func to be called with each key, value, val tuple	\n\
+:type func: 3-ary function					\n\
+:param val: initial value for `val`				\n\
+:type val: any							\n\
+:return: final value of `val`					\n\
+:rtype: any							\n\
+")
+{
+    IDIO_ASSERT (om);
+    IDIO_ASSERT (func);
+    IDIO_ASSERT (val);
+
+    /*
+     * Test Case: omap-errors/fold-omap-bad-omap-type.idio
+     *
+     * fold-omap #t #t #t
+     */
+    IDIO_USER_TYPE_ASSERT (omap, om);
+    /*
+     * Test Case: omap-errors/fold-omap-bad-func-type.idio
+     *
+     * fold-omap (make-omap) #t #t
+     */
+    IDIO_USER_TYPE_ASSERT (function, func);
+
+    idio_omap_fold_t f = { func, val };
+    IDIO_GC_ROOT_FRAME (rf, &f.val);
+
+    idio_omap_walk_range_C (om, NULL, NULL, NULL, idio_omap_fold_invoke, &f);
+
+    idio_gc_root_frame_pop (&rf);
+
+    return f.val;
+}
+
+/*
+ * idio_omap_range_bound() vets a range bound where #n means no bound
+ */
+static IDIO idio_omap_range_bound (IDIO om, IDIO b, char const *func, char const *param)
+{
+    if (idio_S_nil == b) {
+	return NULL;
+    }
+
+    idio_omap_key_assert (om, b, func, param);
+
+    return b;
+}
+
+IDIO_DEFINE_PRIMITIVE4_DS ("omap-range-walk", omap_range_walk, (IDIO om, IDIO lo, IDIO hi, IDIO func), "om lo hi func", "\
+call `func` for each `key` in omap `om` not less than `lo`	\n\
+and less than `hi` in order					\n\
+								\n\
+:param om: omap							\n\
+:type om: omap							\n\
+:param lo: lower bound, ``#n`` for none				\n\
+:type lo: any							\n\
+:param hi: upper bound (exclusive), ``#n`` for none		\n\
+:type hi: any							\n\
+:param func: func to be called with each key, value pair	\n\
+:type func: 2-ary function					\n\
+:return: ``#<unspec>``						\n\
+")
+{
+    IDIO_ASSERT (om);
+    IDIO_ASSERT (lo);
+    IDIO_ASSERT (hi);
+    IDIO_ASSERT (func);
+
+    /*
+     * Test Case: omap-errors/omap-range-walk-bad-omap-type.idio
+     *
+     * omap-range-walk #t #t #t #t
+     */
+    IDIO_USER_TYPE_ASSERT (omap, om);
+    /*
+     * Test Case: omap-errors/omap-range-walk-bad-func-type.idio
+     *
+     * omap-range-walk (make-omap) #n #n #t
+     */
+    IDIO_USER_TYPE_ASSERT (function, func);
+
+    IDIO C_lo = idio_omap_range_bound (om, lo, "omap-range-walk", "lo");
+    IDIO C_hi = idio_omap_range_bound (om, hi, "omap-range-walk", "hi");
+
+    idio_omap_walk_range_C (om, C_lo, C_hi, NULL, idio_omap_walk_invoke, func);
+
+    return idio_S_unspec;
+}
+
+IDIO_DEFINE_PRIMITIVE5_DS ("fold-omap-range", fold_omap_range, (IDIO om, IDIO lo, IDIO hi, IDIO func, IDIO val), "om lo hi func val", "\
+call `func` for each `key` in omap `om` not less than `lo`	\n\
+and less than `hi` in order with arguments: `key`, the value	\n\
+indexed by `key` and `val`					\n\
+								\n\
+`val` is updated to the value returned by `func`		\n\
+								\n\
+The final value of `val` is returned				\n\
+								\n\
+:param om: omap							\n\
+:type om: omap							\n\
+:param lo: lower bound, ``#n`` for none				\n\
+:type lo: any							\n\
+:param hi: upper bound (exclusive), ``#n`` for none		\n\
+:type hi: any							\n\
+:param func: func to be called with each key, value, val tuple	\n\
+:type func: 3-ary function					\n\
+:param val: initial value for `val`				\n\
+:type val: any							\n\
+:return: final value of `val`					\n\
+:rtype: any							\n\
+")
+{
+    IDIO_ASSERT (om);
+    IDIO_ASSERT (lo);
+    IDIO_ASSERT (hi);
+    IDIO_ASSERT (func);
+    IDIO_ASSERT (val);
+
+    /*
+     * Test Case: omap-errors/fold-omap-range-bad-omap-type.idio
+     *
+     * fold-omap-range #t #t #t #t #t
+     */
+    IDIO_USER_TYPE_ASSERT (omap, om);
+    /*
+     * Test Case: omap-errors/fold-omap-range-bad-func-type.idio
+     *
+     * fold-omap-range (make-omap) #n #n #t #t
+     */
+    IDIO_USER_TYPE_ASSERT (function, func);
+
+    IDIO C_lo = idio_omap_range_bound (om, lo, "fold-omap-range", "lo");
+    IDIO C_hi = idio_omap_range_bound (om, hi, "fold-omap-range", "hi");
+
+    idio_omap_fold_t f = { func, val };
+    IDIO_GC_ROOT_FRAME (rf, &f.val);
+
+    idio_omap_walk_range_C (om, C_lo, C_hi, NULL, idio_omap_fold_invoke, &f);
+
+    idio_gc_root_frame_pop (&rf);
+
+    return f.val;
+}
+
+IDIO_DEFINE_PRIMITIVE3_DS ("omap-prefix-walk", omap_prefix_walk, (IDIO om, IDIO prefix, IDIO func), "om prefix func", "\
+call `func` for each string `key` in omap `om` that starts	\n\
+with `prefix` in order						\n\
+								\n\
+:param om: omap							\n\
+:type om: omap							\n\
+:param prefix: prefix						\n\
+:type prefix: string						\n\
+:param func: func to be called with each key, value pair	\n\
+:type func: 2-ary function					\n\
+:return: ``#<unspec>``						\n\
+								\n\
+The walk starts at `prefix` and stops at the first key that	\n\
+does not start with `prefix` which assumes, as for the		\n\
+default ordering, that such keys are contiguous.		\n\
+")
+{
+    IDIO_ASSERT (om);
+    IDIO_ASSERT (prefix);
+    IDIO_ASSERT (func);
+
+    /*
+     * Test Case: omap-errors/omap-prefix-walk-bad-omap-type.idio
+     *
+     * omap-prefix-walk #t #t #t
+     */
+    IDIO_USER_TYPE_ASSERT (omap, om);
+    /*
+     * Test Case: omap-errors/omap-prefix-walk-bad-prefix-type.idio
+     *
+     * omap-prefix-walk (make-omap) #t #t
+     */
+    IDIO_USER_TYPE_ASSERT (string, prefix);
+    /*
+     * Test Case: omap-errors/omap-prefix-walk-bad-func-type.idio
+     *
+     * omap-prefix-walk (make-omap) "a" #t
+     */
+    IDIO_USER_TYPE_ASSERT (function, func);
+
+    if (idio_omap_comparablep (om, prefix)) {
+	idio_omap_walk_range_C (om, prefix, NULL, prefix, idio_omap_walk_invoke, func);
+    }
+
+    return idio_S_unspec;
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("omap->alist", omap2alist, (IDIO om), "om", "\
+convert omap `om` into an association list in key order	\n\
+							\n\
+:param om: omap						\n\
+:type om: omap						\n\
+:return: association list				\n\
+:rtype: list						\n\
+")
+{
+    IDIO_ASSERT (om);
+
+    /*
+     * Test Case: omap-errors/omap2alist-bad-type.idio
+     *
+     * omap->alist #t
+     */
+    IDIO_USER_TYPE_ASSERT (omap, om);
+
+    IDIO r = idio_S_nil;
+
+    if (NULL != IDIO_OMAP_ROOT (om)) {
+	idio_omap_node_rwalk_C (IDIO_OMAP_ROOT (om), idio_omap_entry_to_list, &r);
+    }
+
+    return r;
+}
+
+char *idio_omap_report_string (IDIO v, size_t *sizep, idio_unicode_t format, IDIO seen, int depth)
+{
+    IDIO_ASSERT (v);
+    IDIO_ASSERT (seen);
+
+    IDIO_TYPE_ASSERT (omap, v);
+
+    char *r = NULL;
+
+    *sizep = idio_asprintf (&r, "#<OMAP /%zu>", IDIO_OMAP_COUNT (v));
+
+    return r;
+}
+
+typedef struct idio_omap_as_C_string_s {
+    char *r;
+    size_t *sizep;
+    IDIO seen;
+    int depth;
+} idio_omap_as_C_string_t;
+
+static void idio_omap_entry_as_C_string (IDIO k, IDIO v, void *data)
+{
+    idio_omap_as_C_string_t *sp = (idio_omap_as_C_string_t *) data;
+
+    /*
+     * We're looking to generate:
+     *
+     * (k & v)
+     *
+     */
+    IDIO_STRCAT (sp->r, sp->sizep, " (");
+
+    size_t t_size = 0;
+    char *t = idio_as_string (k, &t_size, sp->depth - 1, sp->seen, 0);
+    IDIO_STRCAT_FREE (sp->r, sp->sizep, t, t_size);
+
+    char *hes;
+    size_t hes_size = idio_asprintf (&hes, " %c ", IDIO_PAIR_SEPARATOR);
+    IDIO_STRCAT_FREE (sp->r, sp->sizep, hes, hes_size);
+
+    t_size = 0;
+    t = idio_as_string (v, &t_size, sp->depth - 1, sp->seen, 0);
+    IDIO_STRCAT_FREE (sp->r, sp->sizep, t, t_size);
+
+    IDIO_STRCAT (sp->r, sp->sizep, ")");
+}
+
+char *idio_omap_as_C_string (IDIO v, size_t *sizep, idio_unicode_t format, IDIO seen, int depth)
+{
+    IDIO_ASSERT (v);
+    IDIO_ASSERT (seen);
+
+    IDIO_TYPE_ASSERT (omap, v);
+
+    char *r = NULL;
+
+    seen = idio_pair (v, seen);
+    *sizep = idio_asprintf (&r, "#<OMAP");
+
+    if (depth > 0) {
+	if (NULL != IDIO_OMAP_ROOT (v)) {
+	    idio_omap_as_C_string_t s = { r, sizep, seen, depth };
+	    idio_omap_node_walk_C (IDIO_OMAP_ROOT (v), idio_omap_entry_as_C_string, &s);
+	    r = s.r;
+	}
+    } else {
+	/*
+	 * Code coverage:
+	 *
+	 * Complicated structures are contracted.
+	 */
+	IDIO_STRCAT (r, sizep, " ..");
+    }
+    IDIO_STRCAT (r, sizep, ">");
+
+    return r;
+}
+
+IDIO idio_omap_method_2string (idio_vtable_method_t *m, IDIO v, ...)
+{
+    IDIO_C_ASSERT (m);
+    IDIO_ASSERT (v);
+
+    va_list ap;
+    va_start (ap, v);
+    size_t *sizep = va_arg (ap, size_t *);
+    IDIO seen = va_arg (ap, IDIO);
+    int depth = va_arg (ap, int);
+    va_end (ap);
+
+    IDIO_ASSERT (seen);
+
+    char *C_r = idio_omap_as_C_string (v, sizep, 0, seen, depth);
+
+    IDIO r = idio_string_C_len (C_r, *sizep);
+
+    IDIO_GC_FREE (C_r, *sizep);
+
+    return r;
+}
+
+void idio_omap_add_primitives ()
+{
+    IDIO_ADD_PRIMITIVE (omap_p);
+    IDIO_ADD_PRIMITIVE (make_omap);
+    IDIO_ADD_PRIMITIVE (omap_size);
+    IDIO_ADD_PRIMITIVE (omap_existsp);
+
+    idio_vtable_t *om_vt = idio_vtable (IDIO_TYPE_OMAP);
+
+    IDIO ref = IDIO_ADD_PRIMITIVE (omap_ref);
+    idio_vtable_add_method (om_vt,
+			    idio_S_value_index,
+			    idio_vtable_create_method_value (idio_util_method_value_index,
+							     idio_vm_default_values_ref (IDIO_FIXNUM_VAL (ref))));
+
+    IDIO set = IDIO_ADD_PRIMITIVE (omap_set);
+    idio_vtable_add_method (om_vt,
+			    idio_S_set_value_index,
+			    idio_vtable_create_method_value (idio_util_method_set_value_index,
+							     idio_vm_default_values_ref (IDIO_FIXNUM_VAL (set))));
+
+    IDIO_ADD_PRIMITIVE (omap_delete);
+    IDIO_ADD_PRIMITIVE (omap_keys);
+    IDIO_ADD_PRIMITIVE (omap_values);
+    IDIO_ADD_PRIMITIVE (omap_floor);
+    IDIO_ADD_PRIMITIVE (omap_ceiling);
+    IDIO_ADD_PRIMITIVE (omap_walk);
+    IDIO_ADD_PRIMITIVE (fold_omap);
+    IDIO_ADD_PRIMITIVE (omap_range_walk);
+    IDIO_ADD_PRIMITIVE (fold_omap_range);
+    IDIO_ADD_PRIMITIVE (omap_prefix_walk);
+    IDIO_ADD_PRIMITIVE (omap2alist);
+}
+
+void idio_init_omap ()
+{
+    idio_module_table_register (idio_omap_add_primitives, NULL, NULL);
+
+    idio_vtable_t *om_vt = idio_vtable (IDIO_TYPE_OMAP);
+
+    idio_vtable_add_method (om_vt,
+			    idio_S_typename,
+			    idio_vtable_create_method_value (idio_util_method_typename,
+							     idio_S_omap));
+
+    idio_vtable_add_method (om_vt,
+			    idio_S_2string,
+			    idio_vtable_create_method_simple (idio_omap_method_2string));
+}
+
+/* Local Variables: */
+/* mode: C */
+/* coding: utf-8-unix */
+/* End: */
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2020-2022 Ian Fitchet <idf(at)idio-lang.org>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License.  You
+ * may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/*
+ * omap.h
+ *
+ */
+
+#ifndef OMAP_H
+#define OMAP_H
+
+/*
+ * The height of a B-tree of minimum degree IDIO_OMAP_ORDER holding
+ * n keys is at most 1 + log16 ((n + 1) / 2)
+ */
+#define IDIO_OMAP_MAX_DEPTH	16
+
+IDIO idio_omap (IDIO less);
+int idio_isa_omap (IDIO o);
+void idio_free_omap (IDIO om);
+IDIO idio_copy_omap (IDIO om, int depth);
+
+int idio_omap_exists_key (IDIO om, IDIO key);
+IDIO idio_omap_ref (IDIO om, IDIO key);
+int idio_omap_set (IDIO om, IDIO key, IDIO v);
+int idio_omap_delete (IDIO om, IDIO key);
+IDIO idio_omap_keys_to_list (IDIO om);
+IDIO idio_omap_values_to_list (IDIO om);
+idio_hi_t idio_omap_hash_C (IDIO om);
+int idio_omap_equal (IDIO om1, IDIO om2, int eqp);
+
+char *idio_omap_report_string (IDIO v, size_t *sizep, idio_unicode_t format, IDIO seen, int depth);
+char *idio_omap_as_C_string (IDIO v, size_t *sizep, idio_unicode_t format, IDIO seen, int depth);
+
+void idio_init_omap ();
+
+#endif
+
+/* Local Variables: */
+/* mode: C */
+/* coding: utf-8-unix */
+/* End: */
@@ -63,9 +63,7 @@ IDIO idio_pair (IDIO h, IDIO t)
     IDIO_ASSERT (t);
 
     IDIO p = idio_gc_get (IDIO_TYPE_PAIR);
-    p->vtable = idio_vtable (IDIO_TYPE_PAIR);
 
-    IDIO_PAIR_GREY (p) = NULL;
     IDIO_PAIR_H (p) = h;
     IDIO_PAIR_T (p) = t;
 
@@ -143,11 +143,11 @@ IDIO idio_pathname_C_len (char const *s_C, size_t const blen)
 {
     IDIO_C_ASSERT (s_C);
 
+    idio_string_check_blen (blen);
+
     IDIO so = idio_gc_get (IDIO_TYPE_STRING);
-    so->vtable = idio_vtable (IDIO_TYPE_STRING);
 
-    IDIO_GC_ALLOC (IDIO_STRING_S (so), blen + 1);
-    IDIO_STRING_BLEN (so) = blen;
+    idio_string_alloc_s (so, blen);
 
     uint8_t *us8 = (uint8_t *) IDIO_STRING_S (so);
 
@@ -0,0 +1,1293 @@
+/*
+ * Copyright (c) 2020-2022 Ian Fitchet <idf(at)idio-lang.org>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License.  You
+ * may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/*
+ * pmap.c
+ *
+ * Persistent maps: Phil Bagwell's Hash Array Mapped Tries, see
+ * "Ideal Hash Trees" (2001), without the mutation.
+ *
+ * pmap-set and pmap-delete return a new pmap which shares all but
+ * the O(log32 n) nodes on the path to the key with the original so
+ * that old versions remain valid and cheap to keep.
+ *
+ * Keys are compared with equal? and hashed as for an equal? hash
+ * table.
+ *
+ * The trie is kept in a canonical form: a slot holds a sub-node only
+ * if two or more keys with different hash values share the slot's
+ * prefix, a collision node only if two or more keys share a hash
+ * value and otherwise the (single) key itself.  Deleting a key
+ * collapses any sub-node left with a single key (or a single
+ * collision node) back into its parent.  Two pmaps with the same
+ * keys therefore have the same shape and can be compared node by
+ * node.
+ */
+
+#define _GNU_SOURCE
+
+#include <sys/types.h>
+
+#include <assert.h>
+#include <limits.h>
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "idio-config.h"
+
+#include "gc.h"
+#include "idio.h"
+
+#include "closure.h"
+#include "error.h"
+#include "evaluate.h"
+#include "fixnum.h"
+#include "handle.h"
+#include "hash.h"
+#include "idio-string.h"
+#include "pair.h"
+#include "pmap.h"
+#include "symbol.h"
+#include "util.h"
+#include "vm.h"
+#include "vtable.h"
+
+static IDIO idio_pmap_node (int flags, uint32_t bitmap, uint32_t n, idio_hi_t count)
+{
+    IDIO p = idio_gc_get (IDIO_TYPE_PMAP);
+    IDIO_GC_ALLOC (p->u.pmap, sizeof (idio_pmap_t) + n * sizeof (idio_hash_entry_t));
+    IDIO_PMAP_GREY (p) = NULL;
+    IDIO_PMAP_COUNT (p) = count;
+    IDIO_PMAP_BITMAP (p) = bitmap;
+    IDIO_PMAP_N (p) = n;
+    IDIO_PMAP_FLAGS (p) = flags;
+
+    return p;
+}
+
+IDIO idio_pmap ()
+{
+    return idio_pmap_node (IDIO_PMAP_FLAG_NONE, 0, 0, 0);
+}
+
+int idio_isa_pmap (IDIO o)
+{
+    IDIO_ASSERT (o);
+
+    return idio_isa (o, IDIO_TYPE_PMAP);
+}
+
+void idio_free_pmap (IDIO p)
+{
+    IDIO_ASSERT (p);
+    IDIO_TYPE_ASSERT (pmap, p);
+
+    IDIO_GC_FREE (p->u.pmap, sizeof (idio_pmap_t) + IDIO_PMAP_N (p) * sizeof (idio_hash_entry_t));
+}
+
+static idio_hi_t idio_pmap_hash_key (IDIO key)
+{
+    return idio_hash_default_hash_C_deep (key, 1);
+}
+
+static uint32_t idio_pmap_bit (idio_hi_t hv, unsigned shift)
+{
+    return 1U << ((hv >> shift) & IDIO_PMAP_MASK);
+}
+
+static uint32_t idio_pmap_index (uint32_t bitmap, uint32_t bit)
+{
+    return __builtin_popcount (bitmap & (bit - 1));
+}
+
+/*
+ * The nodes on the path to a key are copied with an entry replaced,
+ * inserted or removed.  The caller fixes up the count.
+ */
+static IDIO idio_pmap_copy_node (IDIO p)
+{
+    uint32_t n = IDIO_PMAP_N (p);
+    IDIO np = idio_pmap_node (IDIO_PMAP_FLAGS (p), IDIO_PMAP_BITMAP (p), n, IDIO_PMAP_COUNT (p));
+    memcpy (IDIO_PMAP_E (np, 0), IDIO_PMAP_E (p, 0), n * sizeof (idio_hash_entry_t));
+
+    return np;
+}
+
+static IDIO idio_pmap_insert_entry (IDIO p, uint32_t bit, uint32_t i, idio_hash_entry_t *he)
+{
+    uint32_t n = IDIO_PMAP_N (p);
+    IDIO np = idio_pmap_node (IDIO_PMAP_FLAGS (p), IDIO_PMAP_BITMAP (p) | bit, n + 1, IDIO_PMAP_COUNT (p) + 1);
+    memcpy (IDIO_PMAP_E (np, 0), IDIO_PMAP_E (p, 0), i * sizeof (idio_hash_entry_t));
+    *IDIO_PMAP_E (np, i) = *he;
+    memcpy (IDIO_PMAP_E (np, i + 1), IDIO_PMAP_E (p, i), (n - i) * sizeof (idio_hash_entry_t));
+
+    return np;
+}
+
+static IDIO idio_pmap_remove_entry (IDIO p, uint32_t bit, uint32_t i)
+{
+    uint32_t n = IDIO_PMAP_N (p);
+    IDIO np = idio_pmap_node (IDIO_PMAP_FLAGS (p), IDIO_PMAP_BITMAP (p) & ~bit, n - 1, IDIO_PMAP_COUNT (p) - 1);
+    memcpy (IDIO_PMAP_E (np, 0), IDIO_PMAP_E (p, 0), i * sizeof (idio_hash_entry_t));
+    memcpy (IDIO_PMAP_E (np, i), IDIO_PMAP_E (p, i + 1), (n - i - 1) * sizeof (idio_hash_entry_t));
+
+    return np;
+}
+
+static idio_hash_entry_t *idio_pmap_he (IDIO p, IDIO key, idio_hi_t hv)
+{
+    unsigned shift = 0;
+
+    for (;;) {
+	if (IDIO_PMAP_FLAGS (p) & IDIO_PMAP_FLAG_COLLISION) {
+	    uint32_t i;
+	    for (i = 0; i < IDIO_PMAP_N (p); i++) {
+		idio_hash_entry_t *he = IDIO_PMAP_E (p, i);
+		if (hv == IDIO_HASH_HE_HV (he) &&
+		    idio_equalp (key, IDIO_HASH_HE_KEY (he))) {
+		    return he;
+		}
+	    }
+
+	    return NULL;
+	}
+
+	uint32_t bit = idio_pmap_bit (hv, shift);
+	if (0 == (IDIO_PMAP_BITMAP (p) & bit)) {
+	    return NULL;
+	}
+
+	idio_hash_entry_t *he = IDIO_PMAP_E (p, idio_pmap_index (IDIO_PMAP_BITMAP (p), bit));
+	if (NULL == IDIO_HASH_HE_KEY (he)) {
+	    p = IDIO_HASH_HE_VALUE (he);
+	    shift += IDIO_PMAP_BITS;
+	    continue;
+	}
+
+	if (hv == IDIO_HASH_HE_HV (he) &&
+	    idio_equalp (key, IDIO_HASH_HE_KEY (he))) {
+	    return he;
+	}
+
+	return NULL;
+    }
+}
+
+/*
+ * idio_pmap_join() creates the sub-node at shift for the entry he1,
+ * either a key or a collision node of count1 keys, and the key he2
+ * which have different hash values or are both keys.
+ */
+static IDIO idio_pmap_join (unsigned shift, idio_hash_entry_t *he1, idio_hi_t count1, idio_hash_entry_t *he2)
+{
+    idio_hi_t hv1 = IDIO_HASH_HE_HV (he1);
+    idio_hi_t hv2 = IDIO_HASH_HE_HV (he2);
+
+    if (hv1 == hv2) {
+	IDIO np = idio_pmap_node (IDIO_PMAP_FLAG_COLLISION, 0, 2, 2);
+	*IDIO_PMAP_E (np, 0) = *he1;
+	*IDIO_PMAP_E (np, 1) = *he2;
+
+	return np;
+    }
+
+    uint32_t bit1 = idio_pmap_bit (hv1, shift);
+    uint32_t bit2 = idio_pmap_bit (hv2, shift);
+
+    if (bit1 == bit2) {
+	IDIO np = idio_pmap_node (IDIO_PMAP_FLAG_NONE, bit1, 1, count1 + 1);
+	idio_hash_entry_t *he = IDIO_PMAP_E (np, 0);
+	IDIO_HASH_HE_KEY (he) = NULL;
+	IDIO_HASH_HE_VALUE (he) = idio_pmap_join (shift + IDIO_PMAP_BITS, he1, count1, he2);
+	IDIO_HASH_HE_HV (he) = hv1;
+
+	return np;
+    }
+
+    IDIO np = idio_pmap_node (IDIO_PMAP_FLAG_NONE, bit1 | bit2, 2, count1 + 1);
+    if (bit1 < bit2) {
+	*IDIO_PMAP_E (np, 0) = *he1;
+	*IDIO_PMAP_E (np, 1) = *he2;
+    } else {
+	*IDIO_PMAP_E (np, 0) = *he2;
+	*IDIO_PMAP_E (np, 1) = *he1;
+    }
+
+    return np;
+}
+
+/*
+ * idio_pmap_assoc() returns a node with key set to v, or p itself if
+ * key is already set to v.  *addedp is set if key is new.
+ */
+static IDIO idio_pmap_assoc (IDIO p, unsigned shift, IDIO key, IDIO v, idio_hi_t hv, int *addedp)
+{
+    idio_hash_entry_t nhe = { key, v, hv };
+
+    if (IDIO_PMAP_FLAGS (p) & IDIO_PMAP_FLAG_COLLISION) {
+	idio_hi_t chv = IDIO_HASH_HE_HV (IDIO_PMAP_E (p, 0));
+
+	if (hv != chv) {
+	    /*
+	     * The collision node moves down to make room for key
+	     */
+	    idio_hash_entry_t che = { NULL, p, chv };
+	    *addedp = 1;
+
+	    return idio_pmap_join (shift, &che, IDIO_PMAP_COUNT (p), &nhe);
+	}
+
+	uint32_t n = IDIO_PMAP_N (p);
+	uint32_t i;
+	for (i = 0; i < n; i++) {
+	    idio_hash_entry_t *he = IDIO_PMAP_E (p, i);
+	    if (idio_equalp (key, IDIO_HASH_HE_KEY (he))) {
+		if (v == IDIO_HASH_HE_VALUE (he)) {
+		    return p;
+		}
+
+		IDIO np = idio_pmap_copy_node (p);
+		IDIO_HASH_HE_VALUE (IDIO_PMAP_E (np, i)) = v;
+
+		return np;
+	    }
+	}
+
+	*addedp = 1;
+
+	return idio_pmap_insert_entry (p, 0, n, &nhe);
+    }
+
+    uint32_t bit = idio_pmap_bit (hv, shift);
+    uint32_t i = idio_pmap_index (IDIO_PMAP_BITMAP (p), bit);
+
+    if (0 == (IDIO_PMAP_BITMAP (p) & bit)) {
+	*addedp = 1;
+
+	return idio_pmap_insert_entry (p, bit, i, &nhe);
+    }
+
+    idio_hash_entry_t *he = IDIO_PMAP_E (p, i);
+
+    if (NULL == IDIO_HASH_HE_KEY (he)) {
+	IDIO sub = IDIO_HASH_HE_VALUE (he);
+	IDIO nsub = idio_pmap_assoc (sub, shift + IDIO_PMAP_BITS, key, v, hv, addedp);
+
+	if (nsub == sub) {
+	    return p;
+	}
+
+	IDIO np = idio_pmap_copy_node (p);
+	IDIO_HASH_HE_VALUE (IDIO_PMAP_E (np, i)) = nsub;
+	IDIO_PMAP_COUNT (np) += *addedp;
+
+	return np;
+    }
+
+    if (hv == IDIO_HASH_HE_HV (he) &&
+	idio_equalp (key, IDIO_HASH_HE_KEY (he))) {
+	if (v == IDIO_HASH_HE_VALUE (he)) {
+	    return p;
+	}
+
+	IDIO np = idio_pmap_copy_node (p);
+	IDIO_HASH_HE_VALUE (IDIO_PMAP_E (np, i)) = v;
+
+	return np;
+    }
+
+    /*
+     * Another key has this slot: both move down into a sub-node
+     */
+    IDIO np = idio_pmap_copy_node (p);
+    idio_hash_entry_t *nphe = IDIO_PMAP_E (np, i);
+    IDIO_HASH_HE_VALUE (nphe) = idio_pmap_join (shift + IDIO_PMAP_BITS, he, 1, &nhe);
+    IDIO_HASH_HE_KEY (nphe) = NULL;
+    IDIO_PMAP_COUNT (np)++;
+    *addedp = 1;
+
+    return np;
+}
+
+/*
+ * idio_pmap_dissoc() returns a node without key, or p itself if key
+ * is not present.
+ */
+static IDIO idio_pmap_dissoc (IDIO p, unsigned shift, IDIO key, idio_hi_t hv)
+{
+    if (IDIO_PMAP_FLAGS (p) & IDIO_PMAP_FLAG_COLLISION) {
+	uint32_t i;
+	for (i = 0; i < IDIO_PMAP_N (p); i++) {
+	    idio_hash_entry_t *he = IDIO_PMAP_E (p, i);
+	    if (hv == IDIO_HASH_HE_HV (he) &&
+		idio_equalp (key, IDIO_HASH_HE_KEY (he))) {
+		return idio_pmap_remove_entry (p, 0, i);
+	    }
+	}
+
+	return p;
+    }
+
+    uint32_t bit = idio_pmap_bit (hv, shift);
+    if (0 == (IDIO_PMAP_BITMAP (p) & bit)) {
+	return p;
+    }
+
+    uint32_t i = idio_pmap_index (IDIO_PMAP_BITMAP (p), bit);
+    idio_hash_entry_t *he = IDIO_PMAP_E (p, i);
+
+    if (NULL == IDIO_HASH_HE_KEY (he)) {
+	IDIO sub = IDIO_HASH_HE_VALUE (he);
+	IDIO nsub = idio_pmap_dissoc (sub, shift + IDIO_PMAP_BITS, key, hv);
+
+	if (nsub == sub) {
+	    return p;
+	}
+
+	IDIO np = idio_pmap_copy_node (p);
+	idio_hash_entry_t *nphe = IDIO_PMAP_E (np, i);
+	IDIO_PMAP_COUNT (np)--;
+
+	/*
+	 * A sub-node always has two or more keys.  If nsub is down to
+	 * one then that key comes up into this slot.  If nsub is a
+	 * single collision node then that comes up instead.
+	 */
+	if (1 == IDIO_PMAP_COUNT (nsub)) {
+	    *nphe = *IDIO_PMAP_E (nsub, 0);
+	} else if (1 == IDIO_PMAP_N (nsub) &&
+		   0 == (IDIO_PMAP_FLAGS (nsub) & IDIO_PMAP_FLAG_COLLISION)) {
+	    idio_hash_entry_t *she = IDIO_PMAP_E (nsub, 0);
+	    IDIO ssub = IDIO_HASH_HE_VALUE (she);
+	    if (IDIO_PMAP_FLAGS (ssub) & IDIO_PMAP_FLAG_COLLISION) {
+		IDIO_HASH_HE_VALUE (nphe) = ssub;
+	    } else {
+		IDIO_HASH_HE_VALUE (nphe) = nsub;
+	    }
+	} else {
+	    IDIO_HASH_HE_VALUE (nphe) = nsub;
+	}
+
+	return np;
+    }
+
+    if (hv == IDIO_HASH_HE_HV (he) &&
+	idio_equalp (key, IDIO_HASH_HE_KEY (he))) {
+	return idio_pmap_remove_entry (p, bit, i);
+    }
+
+    return p;
+}
+
+int idio_pmap_exists_key (IDIO p, IDIO key)
+{
+    IDIO_ASSERT (p);
+    IDIO_ASSERT (key);
+
+    IDIO_TYPE_ASSERT (pmap, p);
+
+    return (NULL != idio_pmap_he (p, key, idio_pmap_hash_key (key)));
+}
+
+/*
+ * idio_pmap_ref() returns #<unspec> if key is not present, like
+ * idio_hash_ref()
+ */
+IDIO idio_pmap_ref (IDIO p, IDIO key)
+{
+    IDIO_ASSERT (p);
+    IDIO_ASSERT (key);
+
+    IDIO_TYPE_ASSERT (pmap, p);
+
+    idio_hash_entry_t *he = idio_pmap_he (p, key, idio_pmap_hash_key (key));
+
+    if (NULL == he) {
+	return idio_S_unspec;
+    }
+
+    return IDIO_HASH_HE_VALUE (he);
+}
+
+IDIO idio_pmap_set (IDIO p, IDIO key, IDIO v)
+{
+    IDIO_ASSERT (p);
+    IDIO_ASSERT (key);
+    IDIO_ASSERT (v);
+
+    IDIO_TYPE_ASSERT (pmap, p);
+
+    int added = 0;
+    return idio_pmap_assoc (p, 0, key, v, idio_pmap_hash_key (key), &added);
+}
+
+IDIO idio_pmap_delete (IDIO p, IDIO key)
+{
+    IDIO_ASSERT (p);
+    IDIO_ASSERT (key);
+
+    IDIO_TYPE_ASSERT (pmap, p);
+
+    return idio_pmap_dissoc (p, 0, key, idio_pmap_hash_key (key));
+}
+
+/*
+ * idio_pmap_walk_C() calls func for each key in p in trie order.
+ *
+ * It is safe for func to re-enter the VM as the nodes are never
+ * modified.
+ */
+static void idio_pmap_walk_C (IDIO p, void (*func) (idio_hash_entry_t *he, void *data), void *data)
+{
+    uint32_t i;
+    for (i = 0; i < IDIO_PMAP_N (p); i++) {
+	idio_hash_entry_t *he = IDIO_PMAP_E (p, i);
+	if (NULL == IDIO_HASH_HE_KEY (he)) {
+	    idio_pmap_walk_C (IDIO_HASH_HE_VALUE (he), func, data);
+	} else {
+	    func (he, data);
+	}
+    }
+}
+
+static void idio_pmap_key_to_list (idio_hash_entry_t *he, void *data)
+{
+    IDIO *rp = (IDIO *) data;
+
+    *rp = idio_pair (IDIO_HASH_HE_KEY (he), *rp);
+}
+
+IDIO idio_pmap_keys_to_list (IDIO p)
+{
+    IDIO_ASSERT (p);
+    IDIO_TYPE_ASSERT (pmap, p);
+
+    IDIO r = idio_S_nil;
+
+    idio_pmap_walk_C (p, idio_pmap_key_to_list, &r);
+
+    return r;
+}
+
+static void idio_pmap_value_to_list (idio_hash_entry_t *he, void *data)
+{
+    IDIO *rp = (IDIO *) data;
+
+    *rp = idio_pair (IDIO_HASH_HE_VALUE (he), *rp);
+}
+
+IDIO idio_pmap_values_to_list (IDIO p)
+{
+    IDIO_ASSERT (p);
+    IDIO_TYPE_ASSERT (pmap, p);
+
+    IDIO r = idio_S_nil;
+
+    idio_pmap_walk_C (p, idio_pmap_value_to_list, &r);
+
+    return r;
+}
+
+static void idio_pmap_entry_to_list (idio_hash_entry_t *he, void *data)
+{
+    IDIO *rp = (IDIO *) data;
+
+    *rp = idio_pair (idio_pair (IDIO_HASH_HE_KEY (he), IDIO_HASH_HE_VALUE (he)), *rp);
+}
+
+static void idio_pmap_entry_hash_C (idio_hash_entry_t *he, void *data)
+{
+    idio_hi_t *hvp = (idio_hi_t *) data;
+
+    /*
+     * XOR the entries together so that the hash value doesn't depend
+     * on the order they are visited in
+     */
+    *hvp ^= IDIO_HASH_HE_HV (he) * 31 + idio_hash_default_hash_C_deep (IDIO_HASH_HE_VALUE (he), 1);
+}
+
+idio_hi_t idio_pmap_hash_C (IDIO p)
+{
+    IDIO_ASSERT (p);
+    IDIO_TYPE_ASSERT (pmap, p);
+
+    idio_hi_t hv = IDIO_PMAP_COUNT (p);
+
+    idio_pmap_walk_C (p, idio_pmap_entry_hash_C, &hv);
+
+    return hv;
+}
+
+/*
+ * As the trie is canonical we can walk both pmaps in step and skip
+ * any sub-tries they share.
+ */
+static int idio_pmap_equal_node (IDIO p1, IDIO p2, int eqp)
+{
+    if (p1 == p2) {
+	return 1;
+    }
+
+    if (IDIO_PMAP_COUNT (p1) != IDIO_PMAP_COUNT (p2) ||
+	IDIO_PMAP_N (p1) != IDIO_PMAP_N (p2) ||
+	IDIO_PMAP_BITMAP (p1) != IDIO_PMAP_BITMAP (p2) ||
+	IDIO_PMAP_FLAGS (p1) != IDIO_PMAP_FLAGS (p2)) {
+	return 0;
+    }
+
+    uint32_t i;
+
+    if (IDIO_PMAP_FLAGS (p1) & IDIO_PMAP_FLAG_COLLISION) {
+	/*
+	 * The keys of a collision node are in insertion order
+	 */
+	for (i = 0; i < IDIO_PMAP_N (p1); i++) {
+	    idio_hash_entry_t *he1 = IDIO_PMAP_E (p1, i);
+	    idio_hash_entry_t *he2 = idio_pmap_he (p2, IDIO_HASH_HE_KEY (he1), IDIO_HASH_HE_HV (he1));
+	    if (NULL == he2 ||
+		! idio_equal (IDIO_HASH_HE_VALUE (he1), IDIO_HASH_HE_VALUE (he2), eqp)) {
+		return 0;
+	    }
+	}
+
+	return 1;
+    }
+
+    for (i = 0; i < IDIO_PMAP_N (p1); i++) {
+	idio_hash_entry_t *he1 = IDIO_PMAP_E (p1, i);
+	idio_hash_entry_t *he2 = IDIO_PMAP_E (p2, i);
+
+	if (NULL == IDIO_HASH_HE_KEY (he1) ||
+	    NULL == IDIO_HASH_HE_KEY (he2)) {
+	    if (IDIO_HASH_HE_KEY (he1) != IDIO_HASH_HE_KEY (he2) ||
+		! idio_pmap_equal_node (IDIO_HASH_HE_VALUE (he1), IDIO_HASH_HE_VALUE (he2), eqp)) {
+		return 0;
+	    }
+	} else if (IDIO_HASH_HE_HV (he1) != IDIO_HASH_HE_HV (he2) ||
+		   ! idio_equalp (IDIO_HASH_HE_KEY (he1), IDIO_HASH_HE_KEY (he2)) ||
+		   ! idio_equal (IDIO_HASH_HE_VALUE (he1), IDIO_HASH_HE_VALUE (he2), eqp)) {
+	    return 0;
+	}
+    }
+
+    return 1;
+}
+
+int idio_pmap_equal (IDIO p1, IDIO p2, int eqp)
+{
+    IDIO_ASSERT (p1);
+    IDIO_ASSERT (p2);
+
+    IDIO_TYPE_ASSERT (pmap, p1);
+    IDIO_TYPE_ASSERT (pmap, p2);
+
+    return idio_pmap_equal_node (p1, p2, eqp);
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("pmap?", pmap_p, (IDIO o), "o", "\
+test if `o` is a pmap				\n\
+						\n\
+:param o: object to test			\n\
+:return: ``#t`` if `o` is a pmap, ``#f`` otherwise	\n\
+")
+{
+    IDIO_ASSERT (o);
+
+    IDIO r = idio_S_false;
+
+    if (idio_isa_pmap (o)) {
+	r = idio_S_true;
+    }
+
+    return r;
+}
+
+IDIO_DEFINE_PRIMITIVE0_DS ("make-pmap", make_pmap, (void), "", "\
+create an empty pmap					\n\
+							\n\
+A pmap is a persistent map: ``pmap-set`` and		\n\
+``pmap-delete`` return a new pmap leaving the original	\n\
+unchanged.  Keys are compared with :ref:`equal? <equal?>`\n\
+							\n\
+:return: pmap						\n\
+:rtype: pmap						\n\
+")
+{
+    return idio_pmap ();
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("pmap-size", pmap_size, (IDIO pm), "pm", "\
+return the number of keys in pmap `pm`		\n\
+						\n\
+:param pm: pmap					\n\
+:type pm: pmap					\n\
+:return: number of keys				\n\
+:rtype: integer					\n\
+")
+{
+    IDIO_ASSERT (pm);
+
+    /*
+     * Test Case: pmap-errors/pmap-size-bad-type.idio
+     *
+     * pmap-size #t
+     */
+    IDIO_USER_TYPE_ASSERT (pmap, pm);
+
+    return idio_integer (IDIO_PMAP_COUNT (pm));
+}
+
+IDIO_DEFINE_PRIMITIVE2_DS ("pmap-exists?", pmap_existsp, (IDIO pm, IDIO key), "pm key", "\
+test if `key` exists in pmap `pm`			\n\
+							\n\
+:param pm: pmap						\n\
+:type pm: pmap						\n\
+:param key: key						\n\
+:type key: any						\n\
+:return: ``#t`` if `key` exists in `pm`, ``#f`` otherwise	\n\
+")
+{
+    IDIO_ASSERT (pm);
+    IDIO_ASSERT (key);
+
+    /*
+     * Test Case: pmap-errors/pmap-exists-bad-type.idio
+     *
+     * pmap-exists? #t #t
+     */
+    IDIO_USER_TYPE_ASSERT (pmap, pm);
+
+    IDIO r = idio_S_false;
+
+    if (idio_pmap_exists_key (pm, key)) {
+	r = idio_S_true;
+    }
+
+    return r;
+}
+
+static IDIO idio_pmap_reference (IDIO pm, IDIO key, IDIO args)
+{
+    IDIO_ASSERT (pm);
+    IDIO_ASSERT (key);
+    IDIO_ASSERT (args);
+
+    idio_hash_entry_t *he = idio_pmap_he (pm, key, idio_pmap_hash_key (key));
+
+    if (NULL != he) {
+	return IDIO_HASH_HE_VALUE (he);
+    }
+
+    if (idio_isa_pair (args)) {
+	IDIO dv = IDIO_PAIR_H (args);
+	if (idio_isa_function (dv)) {
+	    return idio_vm_invoke_C (dv);
+	} else {
+	    return dv;
+	}
+    }
+
+    /*
+     * Test Case: pmap-errors/pmap-ref-non-existent-key.idio
+     *
+     * pmap-ref (make-pmap) 1
+     */
+    idio_hash_key_not_found_error (key, IDIO_C_FUNC_LOCATION ());
+
+    return idio_S_notreached;
+}
+
+IDIO_DEFINE_PRIMITIVE2V_DS ("pmap-ref", pmap_ref, (IDIO pm, IDIO key, IDIO args), "pm key [default]", "\
+return the value indexed by `key` in pmap `pm`		\n\
+							\n\
+:param pm: pmap						\n\
+:type pm: pmap						\n\
+:param key: key						\n\
+:type key: any						\n\
+:param default: a default value if `key` not found	\n\
+:type default: a thunk or a simple value, optional	\n\
+:return: value						\n\
+:rtype: any						\n\
+:raises ^rt-hash-key-not-found-error: if `key` not found	\n\
+	and no `default` supplied			\n\
+")
+{
+    IDIO_ASSERT (pm);
+    IDIO_ASSERT (key);
+    IDIO_ASSERT (args);
+
+    /*
+     * Test Case: pmap-errors/pmap-ref-bad-type.idio
+     *
+     * pmap-ref #t #t
+     */
+    IDIO_USER_TYPE_ASSERT (pmap, pm);
+    /*
+     * Test Case: n/a
+     *
+     * args is the varargs parameter -- should always be a list
+     */
+    IDIO_USER_TYPE_ASSERT (list, args);
+
+    return idio_pmap_reference (pm, key, args);
+}
+
+IDIO_DEFINE_PRIMITIVE3_DS ("pmap-set", pmap_set, (IDIO pm, IDIO key, IDIO v), "pm key v", "\
+return a pmap like `pm` with `key` set to `v`		\n\
+							\n\
+`pm` is unchanged					\n\
+							\n\
+:param pm: pmap						\n\
+:type pm: pmap						\n\
+:param key: key						\n\
+:type key: any						\n\
+:param v: value						\n\
+:type v: any						\n\
+:return: pmap						\n\
+:rtype: pmap						\n\
+")
+{
+    IDIO_ASSERT (pm);
+    IDIO_ASSERT (key);
+    IDIO_ASSERT (v);
+
+    /*
+     * Test Case: pmap-errors/pmap-set-bad-type.idio
+     *
+     * pmap-set #t #t #t
+     */
+    IDIO_USER_TYPE_ASSERT (pmap, pm);
+
+    return idio_pmap_set (pm, key, v);
+}
+
+IDIO_DEFINE_PRIMITIVE2_DS ("pmap-delete", pmap_delete, (IDIO pm, IDIO key), "pm key", "\
+return a pmap like `pm` without `key`			\n\
+							\n\
+`pm` is unchanged					\n\
+							\n\
+:param pm: pmap						\n\
+:type pm: pmap						\n\
+:param key: key						\n\
+:type key: any						\n\
+:return: pmap						\n\
+:rtype: pmap						\n\
+							\n\
+If `key` does not exist in `pm` then `pm` is returned	\n\
+")
+{
+    IDIO_ASSERT (pm);
+    IDIO_ASSERT (key);
+
+    /*
+     * Test Case: pmap-errors/pmap-delete-bad-type.idio
+     *
+     * pmap-delete #t #t
+     */
+    IDIO_USER_TYPE_ASSERT (pmap, pm);
+
+    return idio_pmap_delete (pm, key);
+}
+
+IDIO_DEFINE_PRIMITIVE3V_DS ("pmap-update", pmap_update, (IDIO pm, IDIO key, IDIO func, IDIO args), "pm key func [default]", "\
+return a pmap like `pm` with the value indexed by `key`	\n\
+replaced by the result of calling `func` on it		\n\
+							\n\
+.. code-block:: idio					\n\
+							\n\
+   pmap-set pm key (func (pmap-ref pm key [default]))	\n\
+							\n\
+:param pm: pmap						\n\
+:type pm: pmap						\n\
+:param key: key						\n\
+:type key: any						\n\
+:param func: func to generate replacement value		\n\
+:type func: 1-ary function				\n\
+:param default: see ``pmap-ref``			\n\
+:type default: see ``pmap-ref``				\n\
+:return: pmap						\n\
+:rtype: pmap						\n\
+							\n\
+.. seealso:: :ref:`pmap-ref <pmap-ref>`			\n\
+")
+{
+    IDIO_ASSERT (pm);
+    IDIO_ASSERT (key);
+    IDIO_ASSERT (func);
+    IDIO_ASSERT (args);
+
+    /*
+     * Test Case: pmap-errors/pmap-update-bad-type.idio
+     *
+     * pmap-update #t #t #t
+     */
+    IDIO_USER_TYPE_ASSERT (pmap, pm);
+    /*
+     * Test Case: pmap-errors/pmap-update-bad-func-type.idio
+     *
+     * pmap-update (make-pmap) #t #t
+     */
+    IDIO_USER_TYPE_ASSERT (function, func);
+    /*
+     * Test Case: n/a
+     *
+     * args is the varargs parameter -- should always be a list
+     */
+    IDIO_USER_TYPE_ASSERT (list, args);
+
+    IDIO cv = idio_pmap_reference (pm, key, args);
+
+    IDIO nv = idio_vm_invoke_C (IDIO_LIST2 (func, cv));
+
+    return idio_pmap_set (pm, key, nv);
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("pmap-keys", pmap_keys, (IDIO pm), "pm", "\
+return a list of the keys of pmap `pm`			\n\
+							\n\
+no order can be presumed				\n\
+							\n\
+:param pm: pmap						\n\
+:type pm: pmap						\n\
+:return: list of keys					\n\
+:rtype: list						\n\
+")
+{
+    IDIO_ASSERT (pm);
+
+    /*
+     * Test Case: pmap-errors/pmap-keys-bad-type.idio
+     *
+     * pmap-keys #t
+     */
+    IDIO_USER_TYPE_ASSERT (pmap, pm);
+
+    return idio_pmap_keys_to_list (pm);
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("pmap-values", pmap_values, (IDIO pm), "pm", "\
+return a list of the values of pmap `pm`		\n\
+							\n\
+no order can be presumed				\n\
+							\n\
+:param pm: pmap						\n\
+:type pm: pmap						\n\
+:return: list of values					\n\
+:rtype: list						\n\
+")
+{
+    IDIO_ASSERT (pm);
+
+    /*
+     * Test Case: pmap-errors/pmap-values-bad-type.idio
+     *
+     * pmap-values #t
+     */
+    IDIO_USER_TYPE_ASSERT (pmap, pm);
+
+    return idio_pmap_values_to_list (pm);
+}
+
+static void idio_pmap_walk_invoke (idio_hash_entry_t *he, void *data)
+{
+    IDIO func = (IDIO) data;
+
+    idio_vm_invoke_C (IDIO_LIST3 (func, IDIO_HASH_HE_KEY (he), IDIO_HASH_HE_VALUE (he)));
+}
+
+IDIO_DEFINE_PRIMITIVE2_DS ("pmap-walk", pmap_walk, (IDIO pm, IDIO func), "pm func", "\
+call `func` for each `key` in pmap `pm`				\n\
+								\n\
+:param pm: pmap							\n\
+:type pm: pmap							\n\
+:param func: func to be called with each key, value pair	\n\
+:type func: 2-ary function					\n\
+:return: ``#<unspec>``						\n\
+")
+{
+    IDIO_ASSERT (pm);
+    IDIO_ASSERT (func);
+
+    /*
+     * Test Case: pmap-errors/pmap-walk-bad-pmap-type.idio
+     *
+     * pmap-walk #t #t
+     */
+    IDIO_USER_TYPE_ASSERT (pmap, pm);
+    /*
+     * Test Case: pmap-errors/pmap-walk-bad-func-type.idio
+     *
+     * pmap-walk (make-pmap) #t
+     */
+    IDIO_USER_TYPE_ASSERT (function, func);
+
+    /*
+     * Unlike hash-walk we needn't take a copy of the keys: pm cannot
+     * be changed by func.
+     */
+    idio_pmap_walk_C (pm, idio_pmap_walk_invoke, func);
+
+    return idio_S_unspec;
+}
+
+typedef struct idio_pmap_fold_s {
+    IDIO func;
+    IDIO val;
+} idio_pmap_fold_t;
+
+static void idio_pmap_fold_invoke (idio_hash_entry_t *he, void *data)
+{
+    idio_pmap_fold_t *fp = (idio_pmap_fold_t *) data;
+
+    fp->val = idio_vm_invoke_C (IDIO_LIST4 (fp->func, IDIO_HASH_HE_KEY (he), IDIO_HASH_HE_VALUE (he), fp->val));
+}
+
+IDIO_DEFINE_PRIMITIVE3_DS ("fold-pmap", fold_pmap, (IDIO pm, IDIO func, IDIO val), "pm func val", "\
+call `func` for each `key` in pmap `pm` with			\n\
+arguments: `key`, the value indexed by `key` and `val`		\n\
+								\n\
+`val` is updated to the value returned by `func`		\n\
+								\n\
+The final value of `val` is returned				\n\
+								\n\
+:param pm: pmap							\n\
+:type pm: pmap							\n\
+:param func: func to be called with each key, value, val tuple	\n\
+:type func: 3-ary function					\n\
+:param val: initial value for `val`				\n\
+:type val: any							\n\
+:return: final value of `val`					\n\
+:rtype: any							\n\
+")
+{
+    IDIO_ASSERT (pm);
+    IDIO_ASSERT (func);
+    IDIO_ASSERT (val);
+
+    /*
+     * Test Case: pmap-errors/fold-pmap-bad-pmap-type.idio
+     *
+     * fold-pmap #t #t #t
+     */
+    IDIO_USER_TYPE_ASSERT (pmap, pm);
+    /*
+     * Test Case: pmap-errors/fold-pmap-bad-func-type.idio
+     *
+     * fold-pmap (make-pmap) #t #t
+     */
+    IDIO_USER_TYPE_ASSERT (function, func);
+
+    idio_pmap_fold_t f = { func, val };
+    IDIO_GC_ROOT_FRAME (rf, &f.val);
+
+    idio_pmap_walk_C (pm, idio_pmap_fold_invoke, &f);
+
+    idio_gc_root_frame_pop (&rf);
+
+    return f.val;
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("alist->pmap", alist2pmap, (IDIO al), "al", "\
+convert association list `al` into a pmap		\n\
+							\n\
+:param al: association list				\n\
+:type al: association list				\n\
+:return: pmap						\n\
+:rtype: pmap						\n\
+							\n\
+If some key occurs multiple times in `al` the value in	\n\
+the first association takes precedence, as for		\n\
+:ref:`alist->hash <alist->hash>`			\n\
+")
+{
+    IDIO_ASSERT (al);
+
+    /*
+     * Test Case: pmap-errors/alist2pmap-bad-type.idio
+     *
+     * alist->pmap #t
+     */
+    IDIO_USER_TYPE_ASSERT (list, al);
+
+    IDIO pm = idio_pmap ();
+
+    while (idio_S_nil != al) {
+	IDIO p = IDIO_PAIR_H (al);
+
+	if (idio_isa_pair (p)) {
+	    IDIO k = IDIO_PAIR_H (p);
+
+	    if (! idio_pmap_exists_key (pm, k)) {
+		pm = idio_pmap_set (pm, k, IDIO_PAIR_T (p));
+	    }
+	} else {
+	    /*
+	     * Test Case: pmap-errors/alist2pmap-bad-alist.idio
+	     *
+	     * alist->pmap '((#\a "apple") #\b)
+	     */
+	    idio_error_param_type ("not a pair in alist", p, IDIO_C_FUNC_LOCATION ());
+
+	    return idio_S_notreached;
+	}
+
+	al = IDIO_PAIR_T (al);
+    }
+
+    return pm;
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("pmap->alist", pmap2alist, (IDIO pm), "pm", "\
+convert pmap `pm` into an association list		\n\
+							\n\
+no order can be presumed				\n\
+							\n\
+:param pm: pmap						\n\
+:type pm: pmap						\n\
+:return: association list				\n\
+:rtype: list						\n\
+")
+{
+    IDIO_ASSERT (pm);
+
+    /*
+     * Test Case: pmap-errors/pmap2alist-bad-type.idio
+     *
+     * pmap->alist #t
+     */
+    IDIO_USER_TYPE_ASSERT (pmap, pm);
+
+    IDIO r = idio_S_nil;
+
+    idio_pmap_walk_C (pm, idio_pmap_entry_to_list, &r);
+
+    return r;
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("hash->pmap", hash2pmap, (IDIO ht), "ht", "\
+convert hash table `ht` into a pmap			\n\
+							\n\
+:param ht: hash table					\n\
+:type ht: hash table					\n\
+:return: pmap						\n\
+:rtype: pmap						\n\
+							\n\
+The pmap uses :ref:`equal? <equal?>` whatever the	\n\
+equivalence function of `ht`				\n\
+")
+{
+    IDIO_ASSERT (ht);
+
+    /*
+     * Test Case: pmap-errors/hash2pmap-bad-type.idio
+     *
+     * hash->pmap #t
+     */
+    IDIO_USER_TYPE_ASSERT (hash, ht);
+
+    IDIO pm = idio_pmap ();
+
+    IDIO keys = idio_hash_keys_to_list (ht);
+    while (idio_S_nil != keys) {
+	IDIO k = IDIO_PAIR_H (keys);
+	pm = idio_pmap_set (pm, k, idio_hash_ref (ht, k));
+
+	keys = IDIO_PAIR_T (keys);
+    }
+
+    return pm;
+}
+
+static void idio_pmap_entry_to_hash (idio_hash_entry_t *he, void *data)
+{
+    IDIO ht = (IDIO) data;
+
+    idio_hash_put (ht, IDIO_HASH_HE_KEY (he), IDIO_HASH_HE_VALUE (he));
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("pmap->hash", pmap2hash, (IDIO pm), "pm", "\
+convert pmap `pm` into an equal? hash table		\n\
+							\n\
+:param pm: pmap						\n\
+:type pm: pmap						\n\
+:return: hash table					\n\
+:rtype: hash table					\n\
+")
+{
+    IDIO_ASSERT (pm);
+
+    /*
+     * Test Case: pmap-errors/pmap2hash-bad-type.idio
+     *
+     * pmap->hash #t
+     */
+    IDIO_USER_TYPE_ASSERT (pmap, pm);
+
+    IDIO ht = IDIO_HASH_EQUALP (IDIO_PMAP_COUNT (pm));
+
+    idio_pmap_walk_C (pm, idio_pmap_entry_to_hash, ht);
+
+    return ht;
+}
+
+char *idio_pmap_report_string (IDIO v, size_t *sizep, idio_unicode_t format, IDIO seen, int depth)
+{
+    IDIO_ASSERT (v);
+    IDIO_ASSERT (seen);
+
+    IDIO_TYPE_ASSERT (pmap, v);
+
+    char *r = NULL;
+
+    *sizep = idio_asprintf (&r, "#<PMAP /%zu>", IDIO_PMAP_COUNT (v));
+
+    return r;
+}
+
+typedef struct idio_pmap_as_C_string_s {
+    char *r;
+    size_t *sizep;
+    IDIO seen;
+    int depth;
+} idio_pmap_as_C_string_t;
+
+static void idio_pmap_entry_as_C_string (idio_hash_entry_t *he, void *data)
+{
+    idio_pmap_as_C_string_t *sp = (idio_pmap_as_C_string_t *) data;
+
+    /*
+     * We're looking to generate:
+     *
+     * (k & v)
+     *
+     */
+    IDIO_STRCAT (sp->r, sp->sizep, " (");
+
+    size_t t_size = 0;
+    char *t = idio_as_string (IDIO_HASH_HE_KEY (he), &t_size, sp->depth - 1, sp->seen, 0);
+    IDIO_STRCAT_FREE (sp->r, sp->sizep, t, t_size);
+
+    char *hes;
+    size_t hes_size = idio_asprintf (&hes, " %c ", IDIO_PAIR_SEPARATOR);
+    IDIO_STRCAT_FREE (sp->r, sp->sizep, hes, hes_size);
+
+    t_size = 0;
+    t = idio_as_string (IDIO_HASH_HE_VALUE (he), &t_size, sp->depth - 1, sp->seen, 0);
+    IDIO_STRCAT_FREE (sp->r, sp->sizep, t, t_size);
+
+    IDIO_STRCAT (sp->r, sp->sizep, ")");
+}
+
+char *idio_pmap_as_C_string (IDIO v, size_t *sizep, idio_unicode_t format, IDIO seen, int depth)
+{
+    IDIO_ASSERT (v);
+    IDIO_ASSERT (seen);
+
+    IDIO_TYPE_ASSERT (pmap, v);
+
+    char *r = NULL;
+
+    seen = idio_pair (v, seen);
+    *sizep = idio_asprintf (&r, "#<PMAP");
+
+    if (depth > 0) {
+	idio_pmap_as_C_string_t s = { r, sizep, seen, depth };
+	idio_pmap_walk_C (v, idio_pmap_entry_as_C_string, &s);
+	r = s.r;
+    } else {
+	/*
+	 * Code coverage:
+	 *
+	 * Complicated structures are contracted.
+	 */
+	IDIO_STRCAT (r, sizep, " ..");
+    }
+    IDIO_STRCAT (r, sizep, ">");
+
+    return r;
+}
+
+IDIO idio_pmap_method_2string (idio_vtable_method_t *m, IDIO v, ...)
+{
+    IDIO_C_ASSERT (m);
+    IDIO_ASSERT (v);
+
+    va_list ap;
+    va_start (ap, v);
+    size_t *sizep = va_arg (ap, size_t *);
+    IDIO seen = va_arg (ap, IDIO);
+    int depth = va_arg (ap, int);
+    va_end (ap);
+
+    IDIO_ASSERT (seen);
+
+    char *C_r = idio_pmap_as_C_string (v, sizep, 0, seen, depth);
+
+    IDIO r = idio_string_C_len (C_r, *sizep);
+
+    IDIO_GC_FREE (C_r, *sizep);
+
+    return r;
+}
+
+void idio_pmap_add_primitives ()
+{
+    IDIO_ADD_PRIMITIVE (pmap_p);
+    IDIO_ADD_PRIMITIVE (make_pmap);
+    IDIO_ADD_PRIMITIVE (pmap_size);
+    IDIO_ADD_PRIMITIVE (pmap_existsp);
+
+    IDIO ref = IDIO_ADD_PRIMITIVE (pmap_ref);
+    idio_vtable_t *p_vt = idio_vtable (IDIO_TYPE_PMAP);
+    idio_vtable_add_method (p_vt,
+			    idio_S_value_index,
+			    idio_vtable_create_method_value (idio_util_method_value_index,
+							     idio_vm_default_values_ref (IDIO_FIXNUM_VAL (ref))));
+
+    IDIO_ADD_PRIMITIVE (pmap_set);
+    IDIO_ADD_PRIMITIVE (pmap_delete);
+    IDIO_ADD_PRIMITIVE (pmap_update);
+    IDIO_ADD_PRIMITIVE (pmap_keys);
+    IDIO_ADD_PRIMITIVE (pmap_values);
+    IDIO_ADD_PRIMITIVE (pmap_walk);
+    IDIO_ADD_PRIMITIVE (fold_pmap);
+    IDIO_ADD_PRIMITIVE (alist2pmap);
+    IDIO_ADD_PRIMITIVE (pmap2alist);
+    IDIO_ADD_PRIMITIVE (hash2pmap);
+    IDIO_ADD_PRIMITIVE (pmap2hash);
+}
+
+void idio_init_pmap ()
+{
+    idio_module_table_register (idio_pmap_add_primitives, NULL, NULL);
+
+    idio_vtable_t *p_vt = idio_vtable (IDIO_TYPE_PMAP);
+
+    idio_vtable_add_method (p_vt,
+			    idio_S_typename,
+			    idio_vtable_create_method_value (idio_util_method_typename,
+							     idio_S_pmap));
+
+    idio_vtable_add_method (p_vt,
+			    idio_S_2string,
+			    idio_vtable_create_method_simple (idio_pmap_method_2string));
+}
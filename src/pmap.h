@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2020-2022 Ian Fitchet <idf(at)idio-lang.org>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License.  You
+ * may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/*
+ * pmap.h
+ *
+ */
+
+#ifndef PMAP_H
+#define PMAP_H
+
+#define IDIO_PMAP_BITS		5
+#define IDIO_PMAP_MASK		((1U << IDIO_PMAP_BITS) - 1)
+
+IDIO idio_pmap ();
+int idio_isa_pmap (IDIO o);
+void idio_free_pmap (IDIO p);
+
+int idio_pmap_exists_key (IDIO p, IDIO key);
+IDIO idio_pmap_ref (IDIO p, IDIO key);
+IDIO idio_pmap_set (IDIO p, IDIO key, IDIO v);
+IDIO idio_pmap_delete (IDIO p, IDIO key);
+IDIO idio_pmap_keys_to_list (IDIO p);
+IDIO idio_pmap_values_to_list (IDIO p);
+idio_hi_t idio_pmap_hash_C (IDIO p);
+int idio_pmap_equal (IDIO p1, IDIO p2, int eqp);
+
+char *idio_pmap_report_string (IDIO v, size_t *sizep, idio_unicode_t format, IDIO seen, int depth);
+char *idio_pmap_as_C_string (IDIO v, size_t *sizep, idio_unicode_t format, IDIO seen, int depth);
+
+void idio_init_pmap ();
+
+#endif
+
+/* Local Variables: */
+/* mode: C */
+/* coding: utf-8-unix */
+/* End: */
@@ -65,7 +65,6 @@ IDIO idio_primitive (IDIO (*func) (IDIO args), char const *name_C, size_t const
     IDIO_C_ASSERT (name_C);
 
     IDIO o = idio_gc_get (IDIO_TYPE_PRIMITIVE);
-    o->vtable = idio_vtable (IDIO_TYPE_PRIMITIVE);
 
     IDIO_GC_ALLOC (o->u.primitive, sizeof (idio_primitive_t));
 
@@ -108,7 +107,6 @@ IDIO idio_primitive_data (idio_primitive_desc_t *desc)
     IDIO_C_ASSERT (desc);
 
     IDIO o = idio_gc_get (IDIO_TYPE_PRIMITIVE);
-    o->vtable = idio_vtable (IDIO_TYPE_PRIMITIVE);
 
     IDIO_GC_ALLOC (o->u.primitive, sizeof (idio_primitive_t));
 
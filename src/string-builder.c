@@ -0,0 +1,573 @@
+/*
+ * Copyright (c) 2020-2022 Ian Fitchet <idf(at)idio-lang.org>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License.  You
+ * may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/*
+ * string-builder.c
+ *
+ * A string-builder accumulates strings for a single flattening at the
+ * end.  append-string copies both operands every time so building a
+ * large string piece by piece is quadratic.
+ *
+ * A string-builder is a struct instance holding an array of the parts
+ * appended so far and their total length in code points.  Appending
+ * is an array push.  string-builder->string flattens the parts and
+ * write-string-builder writes each part to a handle in turn without
+ * flattening them at all.
+ *
+ * The parts are private copies so that subsequently modifying an
+ * appended string doesn't modify the builder.
+ *
+ * However, being a struct instance, Idio code can assign the fields
+ * so we check them, with idio_string_builder_verify(), before we use
+ * them.
+ */
+
+#define _GNU_SOURCE
+
+#include <sys/types.h>
+
+#include <assert.h>
+#include <inttypes.h>
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "idio-config.h"
+
+#include "gc.h"
+#include "idio.h"
+
+#include "array.h"
+#include "error.h"
+#include "evaluate.h"
+#include "fixnum.h"
+#include "handle.h"
+#include "idio-string.h"
+#include "pair.h"
+#include "string-builder.h"
+#include "struct.h"
+#include "symbol.h"
+#include "unicode.h"
+#include "util.h"
+#include "vm.h"
+#include "vtable.h"
+
+static IDIO idio_string_builder_type;
+
+#define IDIO_STRING_BUILDER_PARTS(sb)	IDIO_STRUCT_INSTANCE_FIELDS (sb, 0)
+#define IDIO_STRING_BUILDER_LENGTH(sb)	IDIO_STRUCT_INSTANCE_FIELDS (sb, 1)
+
+/*
+ * idio_append_string() uses per-argument C arrays on the stack so we
+ * flatten at most this many parts at a time
+ */
+#define IDIO_STRING_BUILDER_FANOUT	256
+
+IDIO idio_string_builder ()
+{
+    return idio_struct_instance (idio_string_builder_type,
+				 IDIO_LIST2 (idio_array (0),
+					     idio_fixnum (0)));
+}
+
+int idio_isa_string_builder (IDIO o)
+{
+    IDIO_ASSERT (o);
+
+    return (idio_isa_struct_instance (o) &&
+	    idio_struct_instance_isa (o, idio_string_builder_type));
+}
+
+/*
+ * idio_string_builder_verify() checks that the fields of sb haven't
+ * been assigned something unexpected
+ */
+static void idio_string_builder_verify (IDIO sb)
+{
+    IDIO_ASSERT (sb);
+
+    /*
+     * Test Case: string-builder-errors/string-builder-append-bad-parts.idio
+     *
+     * sb := make-string-builder "abc"
+     * sb.parts = #t
+     * string-builder-append! sb "x"
+     */
+    IDIO_USER_TYPE_ASSERT (array, IDIO_STRING_BUILDER_PARTS (sb));
+    /*
+     * Test Case: string-builder-errors/string-builder-append-bad-length.idio
+     *
+     * sb := make-string-builder "abc"
+     * sb.'length = #t
+     * string-builder-append! sb "x"
+     */
+    IDIO_USER_TYPE_ASSERT (fixnum, IDIO_STRING_BUILDER_LENGTH (sb));
+}
+
+/*
+ * idio_string_builder_check_length() checks that the recorded length
+ * of sb is len, the length of its parts, as Idio code can assign the
+ * parts without updating the length
+ */
+static void idio_string_builder_check_length (IDIO sb, size_t const len, char const *func)
+{
+    IDIO_ASSERT (sb);
+    IDIO_C_ASSERT (func);
+
+    if ((size_t) IDIO_FIXNUM_VAL (IDIO_STRING_BUILDER_LENGTH (sb)) != len) {
+	/*
+	 * Test Case: string-builder-errors/string-builder-length-stale.idio
+	 *
+	 * sb := make-string-builder "abc"
+	 * sb.parts = #[ "x" ]
+	 * string-builder-length sb
+	 */
+	idio_error_param_value_msg_only (func, "sb", "length does not match the parts", IDIO_C_FUNC_LOCATION ());
+
+	/* notreached */
+    }
+}
+
+static void idio_string_builder_push (IDIO sb, IDIO s)
+{
+    IDIO_ASSERT (sb);
+    IDIO_ASSERT (s);
+
+    idio_string_builder_verify (sb);
+
+    size_t len = idio_string_len (s);
+    if (0 == len) {
+	return;
+    }
+
+    idio_array_push (IDIO_STRING_BUILDER_PARTS (sb), s);
+    IDIO_STRING_BUILDER_LENGTH (sb) = idio_fixnum (IDIO_FIXNUM_VAL (IDIO_STRING_BUILDER_LENGTH (sb)) + len);
+}
+
+void idio_string_builder_append (IDIO sb, IDIO o)
+{
+    IDIO_ASSERT (sb);
+    IDIO_ASSERT (o);
+
+    if (idio_isa_string (o)) {
+	idio_string_builder_push (sb, idio_copy_string (o));
+    } else if (idio_isa_unicode (o)) {
+	size_t size = 0;
+	char *s = idio_display_string (o, &size);
+	IDIO str = idio_string_C_len (s, size);
+	IDIO_GC_FREE (s, size);
+
+	idio_string_builder_push (sb, str);
+    } else if (idio_isa_string_builder (o)) {
+	/*
+	 * The parts are private (and therefore unchanging) so we can
+	 * share them.  Note the number of parts up front in case o is
+	 * sb.
+	 */
+	idio_string_builder_verify (o);
+
+	IDIO parts = IDIO_STRING_BUILDER_PARTS (o);
+	idio_as_t np = IDIO_ARRAY_USIZE (parts);
+	for (idio_as_t i = 0; i < np; i++) {
+	    IDIO part = IDIO_ARRAY_AE (parts, i);
+
+	    /*
+	     * Test Case: string-builder-errors/string-builder-append-bad-part.idio
+	     *
+	     * sb := make-string-builder "abc"
+	     * sb.parts = #[ #t ]
+	     * string-builder-append! (make-string-builder) sb
+	     */
+	    IDIO_USER_TYPE_ASSERT (string, part);
+
+	    idio_string_builder_push (sb, part);
+	}
+    } else {
+	/*
+	 * Test Case: string-builder-errors/string-builder-append-bad-type.idio
+	 *
+	 * string-builder-append! (make-string-builder) #t
+	 */
+	idio_error_param_type ("string|unicode|string-builder", o, IDIO_C_FUNC_LOCATION ());
+
+	/* notreached */
+    }
+}
+
+/*
+ * idio_string_builder_string() flattens the parts of sb into a single
+ * string which then replaces the parts so that flattening again is
+ * cheap.
+ *
+ * Any run of parts is appended IDIO_STRING_BUILDER_FANOUT at a time
+ * so a builder of very many parts takes a few passes.
+ */
+IDIO idio_string_builder_string (IDIO sb)
+{
+    IDIO_ASSERT (sb);
+
+    idio_string_builder_verify (sb);
+
+    IDIO parts = IDIO_STRING_BUILDER_PARTS (sb);
+    idio_as_t np = IDIO_ARRAY_USIZE (parts);
+
+    if (0 == np) {
+	return idio_string_C_len ("", 0);
+    }
+
+    while (np > 1) {
+	idio_as_t nnp = (np + IDIO_STRING_BUILDER_FANOUT - 1) / IDIO_STRING_BUILDER_FANOUT;
+	IDIO nparts = idio_array (nnp);
+
+	for (idio_as_t i = 0; i < np; i += IDIO_STRING_BUILDER_FANOUT) {
+	    idio_as_t j = i + IDIO_STRING_BUILDER_FANOUT;
+	    if (j > np) {
+		j = np;
+	    }
+
+	    IDIO strs = idio_S_nil;
+	    while (j > i) {
+		j--;
+		strs = idio_pair (IDIO_ARRAY_AE (parts, j), strs);
+	    }
+
+	    idio_array_push (nparts, idio_append_string (strs));
+	}
+
+	parts = nparts;
+	np = nnp;
+    }
+
+    IDIO_STRING_BUILDER_PARTS (sb) = parts;
+
+    IDIO s = IDIO_ARRAY_AE (parts, 0);
+
+    /*
+     * Test Case: string-builder-errors/string-builder-2string-bad-part.idio
+     *
+     * sb := make-string-builder "abc"
+     * sb.parts = #[ #t ]
+     * string-builder->string sb
+     */
+    IDIO_USER_TYPE_ASSERT (string, s);
+
+    idio_string_builder_check_length (sb, idio_string_len (s), "string-builder->string");
+
+    /*
+     * Our part is private, the caller gets a copy
+     */
+    return idio_copy_string (s);
+}
+
+void idio_string_builder_write (IDIO sb, IDIO h)
+{
+    IDIO_ASSERT (sb);
+    IDIO_ASSERT (h);
+
+    idio_string_builder_verify (sb);
+
+    IDIO parts = IDIO_STRING_BUILDER_PARTS (sb);
+    idio_as_t np = IDIO_ARRAY_USIZE (parts);
+
+    for (idio_as_t i = 0; i < np; i++) {
+	IDIO part = IDIO_ARRAY_AE (parts, i);
+
+	/*
+	 * Test Case: string-builder-errors/write-string-builder-bad-part.idio
+	 *
+	 * sb := make-string-builder "abc"
+	 * sb.parts = #[ #t ]
+	 * write-string-builder sb (open-output-string)
+	 */
+	IDIO_USER_TYPE_ASSERT (string, part);
+
+	idio_display (part, h);
+    }
+}
+
+IDIO_DEFINE_PRIMITIVE0V_DS ("make-string-builder", make_string_builder, (IDIO args), "[x ...]", "\
+create a string-builder with the optional initial	\n\
+contents `x ...`					\n\
+							\n\
+:param x: string, unicode or string-builder		\n\
+:type x: any, optional					\n\
+:return: the new string-builder				\n\
+:rtype: string-builder					\n\
+")
+{
+    IDIO_ASSERT (args);
+
+    /*
+     * Test Case: n/a
+     *
+     * args is the varargs parameter -- should always be a list
+     */
+    IDIO_USER_TYPE_ASSERT (list, args);
+
+    IDIO sb = idio_string_builder ();
+
+    while (idio_S_nil != args) {
+	idio_string_builder_append (sb, IDIO_PAIR_H (args));
+	args = IDIO_PAIR_T (args);
+    }
+
+    return sb;
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("string-builder?", string_builderp, (IDIO o), "o", "\
+test if `o` is a string-builder			\n\
+						\n\
+:param o: object to test			\n\
+:return: ``#t`` if `o` is a string-builder, ``#f`` otherwise	\n\
+")
+{
+    IDIO_ASSERT (o);
+
+    IDIO r = idio_S_false;
+
+    if (idio_isa_string_builder (o)) {
+	r = idio_S_true;
+    }
+
+    return r;
+}
+
+IDIO_DEFINE_PRIMITIVE1V_DS ("string-builder-append!", string_builder_append, (IDIO sb, IDIO args), "sb [x ...]", "\
+append `x ...` to string-builder `sb`			\n\
+							\n\
+:param sb: the string-builder				\n\
+:type sb: string-builder				\n\
+:param x: string, unicode or string-builder		\n\
+:type x: any, optional					\n\
+:return: `sb`						\n\
+:rtype: string-builder					\n\
+							\n\
+A string is copied when it is appended.			\n\
+")
+{
+    IDIO_ASSERT (sb);
+    IDIO_ASSERT (args);
+
+    /*
+     * Test Case: string-builder-errors/string-builder-append-bad-sb-type.idio
+     *
+     * string-builder-append! #t "a"
+     */
+    IDIO_USER_TYPE_ASSERT (string_builder, sb);
+    /*
+     * Test Case: n/a
+     *
+     * args is the varargs parameter -- should always be a list
+     */
+    IDIO_USER_TYPE_ASSERT (list, args);
+
+    while (idio_S_nil != args) {
+	idio_string_builder_append (sb, IDIO_PAIR_H (args));
+	args = IDIO_PAIR_T (args);
+    }
+
+    return sb;
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("string-builder-length", string_builder_length, (IDIO sb), "sb", "\
+return the number of code points in `sb`	\n\
+						\n\
+:param sb: the string-builder			\n\
+:type sb: string-builder			\n\
+:return: number of code points			\n\
+:rtype: integer					\n\
+")
+{
+    IDIO_ASSERT (sb);
+
+    /*
+     * Test Case: string-builder-errors/string-builder-length-bad-type.idio
+     *
+     * string-builder-length #t
+     */
+    IDIO_USER_TYPE_ASSERT (string_builder, sb);
+
+    idio_string_builder_verify (sb);
+
+    IDIO parts = IDIO_STRING_BUILDER_PARTS (sb);
+    idio_as_t np = IDIO_ARRAY_USIZE (parts);
+    size_t len = 0;
+
+    for (idio_as_t i = 0; i < np; i++) {
+	IDIO part = IDIO_ARRAY_AE (parts, i);
+
+	/*
+	 * Test Case: string-builder-errors/string-builder-length-bad-part.idio
+	 *
+	 * sb := make-string-builder "abc"
+	 * sb.parts = #[ #t ]
+	 * string-builder-length sb
+	 */
+	IDIO_USER_TYPE_ASSERT (string, part);
+
+	len += idio_string_len (part);
+    }
+
+    idio_string_builder_check_length (sb, len, "string-builder-length");
+
+    return IDIO_STRING_BUILDER_LENGTH (sb);
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("string-builder-clear!", string_builder_clear, (IDIO sb), "sb", "\
+discard the contents of `sb`			\n\
+						\n\
+:param sb: the string-builder			\n\
+:type sb: string-builder			\n\
+:return: `sb`					\n\
+:rtype: string-builder				\n\
+")
+{
+    IDIO_ASSERT (sb);
+
+    /*
+     * Test Case: string-builder-errors/string-builder-clear-bad-type.idio
+     *
+     * string-builder-clear! #t
+     */
+    IDIO_USER_TYPE_ASSERT (string_builder, sb);
+
+    IDIO_STRING_BUILDER_PARTS (sb) = idio_array (0);
+    IDIO_STRING_BUILDER_LENGTH (sb) = idio_fixnum (0);
+
+    return sb;
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("string-builder->string", string_builder2string, (IDIO sb), "sb", "\
+return the contents of `sb` as a string		\n\
+						\n\
+:param sb: the string-builder			\n\
+:type sb: string-builder			\n\
+:return: string					\n\
+:rtype: string					\n\
+						\n\
+The string variant is degraded as for		\n\
+:ref:`append-string <append-string>`.		\n\
+")
+{
+    IDIO_ASSERT (sb);
+
+    /*
+     * Test Case: string-builder-errors/string-builder-2string-bad-type.idio
+     *
+     * string-builder->string #t
+     */
+    IDIO_USER_TYPE_ASSERT (string_builder, sb);
+
+    return idio_string_builder_string (sb);
+}
+
+IDIO_DEFINE_PRIMITIVE1V_DS ("write-string-builder", write_string_builder, (IDIO sb, IDIO args), "sb [handle]", "\
+write the contents of `sb` to `handle`		\n\
+						\n\
+:param sb: the string-builder			\n\
+:type sb: string-builder			\n\
+:param handle: handle to write to, defaults to the current output handle	\n\
+:type handle: handle, optional			\n\
+:return: ``#<unspec>``				\n\
+						\n\
+The contents are written a part at a time	\n\
+and are not flattened into a single string.	\n\
+")
+{
+    IDIO_ASSERT (sb);
+    IDIO_ASSERT (args);
+
+    /*
+     * Test Case: string-builder-errors/write-string-builder-bad-type.idio
+     *
+     * write-string-builder #t
+     */
+    IDIO_USER_TYPE_ASSERT (string_builder, sb);
+
+    IDIO h = idio_handle_or_current (idio_list_head (args), IDIO_HANDLE_FLAG_WRITE);
+
+    idio_string_builder_write (sb, h);
+
+    return idio_S_unspec;
+}
+
+IDIO idio_string_builder_method_2string (idio_vtable_method_t *m, IDIO v, ...)
+{
+    IDIO_C_ASSERT (m);
+    IDIO_ASSERT (v);
+
+    va_list ap;
+    va_start (ap, v);
+    size_t *sizep = va_arg (ap, size_t *);
+    va_end (ap);
+
+    char *C_r;
+
+    /*
+     * No idio_string_builder_verify() here as we don't want to raise
+     * a condition while printing, possibly, a condition
+     */
+    if (idio_isa_fixnum (IDIO_STRING_BUILDER_LENGTH (v)) &&
+	idio_isa_array (IDIO_STRING_BUILDER_PARTS (v))) {
+	*sizep = idio_asprintf (&C_r, "#<string-builder %" PRIdPTR " parts=%zu>",
+				IDIO_FIXNUM_VAL (IDIO_STRING_BUILDER_LENGTH (v)),
+				IDIO_ARRAY_USIZE (IDIO_STRING_BUILDER_PARTS (v)));
+    } else {
+	*sizep = idio_asprintf (&C_r, "#<string-builder invalid>");
+    }
+
+    IDIO r = idio_string_C_len (C_r, *sizep);
+
+    IDIO_GC_FREE (C_r, *sizep);
+
+    return r;
+}
+
+void idio_string_builder_add_primitives ()
+{
+    IDIO_ADD_PRIMITIVE (make_string_builder);
+    IDIO_ADD_PRIMITIVE (string_builderp);
+    IDIO_ADD_PRIMITIVE (string_builder_append);
+    IDIO_ADD_PRIMITIVE (string_builder_length);
+    IDIO_ADD_PRIMITIVE (string_builder_clear);
+    IDIO_ADD_PRIMITIVE (string_builder2string);
+    IDIO_ADD_PRIMITIVE (write_string_builder);
+}
+
+void idio_init_string_builder ()
+{
+    idio_module_table_register (idio_string_builder_add_primitives, NULL, NULL);
+
+    idio_string_builder_type = idio_struct_type (IDIO_SYMBOL ("string-builder"),
+						 idio_S_nil,
+						 IDIO_LIST2 (IDIO_SYMBOL ("parts"),
+							     IDIO_SYMBOL ("length")));
+    idio_gc_protect_auto (idio_string_builder_type);
+
+    idio_vtable_add_method (IDIO_STRUCT_TYPE_VTABLE (idio_string_builder_type),
+			    idio_S_struct_instance_2string,
+			    idio_vtable_create_method_simple (idio_string_builder_method_2string));
+}
+
+/* Local Variables: */
+/* mode: C */
+/* coding: utf-8-unix */
+/* End: */
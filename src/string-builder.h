@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) 2020-2022 Ian Fitchet <idf(at)idio-lang.org>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License.  You
+ * may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/*
+ * string-builder.h
+ *
+ */
+
+#ifndef STRING_BUILDER_H
+#define STRING_BUILDER_H
+
+IDIO idio_string_builder ();
+int idio_isa_string_builder (IDIO o);
+void idio_string_builder_append (IDIO sb, IDIO o);
+IDIO idio_string_builder_string (IDIO sb);
+void idio_string_builder_write (IDIO sb, IDIO h);
+
+void idio_init_string_builder ();
+
+#endif
+
+/* Local Variables: */
+/* mode: C */
+/* coding: utf-8-unix */
+/* End: */
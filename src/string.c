@@ -148,6 +148,38 @@ void idio_string_size_error (char const *msg, ssize_t size, IDIO c_location)
     /* notreached */
 }
 
+/*
+ * idio_string_check_blen() - string lengths are 32-bit, see
+ * IDIO_STRING_BLEN_MAX
+ */
+void idio_string_check_blen (size_t const blen)
+{
+    if (blen > IDIO_STRING_BLEN_MAX) {
+	/*
+	 * Test Case: n/a
+	 *
+	 * A 4GB string...
+	 */
+	idio_string_size_error ("too long", blen, IDIO_C_FUNC_LOCATION ());
+
+	/* notreached */
+    }
+}
+
+/*
+ * idio_string_alloc_s() - set the byte length of the freshly
+ * allocated string @so and, if it is too long to be stored inline,
+ * allocate storage for @blen bytes plus a NUL
+ */
+void idio_string_alloc_s (IDIO so, size_t const blen)
+{
+    IDIO_STRING_BLEN (so) = blen;
+
+    if (! IDIO_STRING_INLINE_P (so)) {
+	IDIO_GC_ALLOC (so->u.string.s, blen + 1);
+    }
+}
+
 void idio_string_length_error (char const *msg, IDIO str, ssize_t index, IDIO c_location)
 {
     IDIO_C_ASSERT (msg);
@@ -330,9 +362,6 @@ IDIO idio_string_C_len (char const *s_C, size_t const blen)
 {
     IDIO_C_ASSERT (s_C);
 
-    IDIO so = idio_gc_get (IDIO_TYPE_STRING);
-    so->vtable = idio_vtable (IDIO_TYPE_STRING);
-
     IDIO_FLAGS_T flags = IDIO_STRING_FLAG_1BYTE;
 
     idio_unicode_t codepoint;
@@ -397,8 +426,11 @@ IDIO idio_string_C_len (char const *s_C, size_t const blen)
 	}
     }
 
-    IDIO_GC_ALLOC (IDIO_STRING_S (so), reqd_bytes + 1);
-    IDIO_STRING_BLEN (so) = reqd_bytes;
+    idio_string_check_blen (reqd_bytes);
+
+    IDIO so = idio_gc_get (IDIO_TYPE_STRING);
+
+    idio_string_alloc_s (so, reqd_bytes);
 
     uint8_t *us8 = (uint8_t *) IDIO_STRING_S (so);
     uint16_t *us16 = (uint16_t *) IDIO_STRING_S (so);
@@ -468,11 +500,11 @@ IDIO idio_octet_string_C_len (char const *s_C, size_t const blen)
 {
     IDIO_C_ASSERT (s_C);
 
+    idio_string_check_blen (blen);
+
     IDIO so = idio_gc_get (IDIO_TYPE_STRING);
-    so->vtable = idio_vtable (IDIO_TYPE_STRING);
 
-    IDIO_GC_ALLOC (IDIO_STRING_S (so), blen + 1);
-    IDIO_STRING_BLEN (so) = blen;
+    idio_string_alloc_s (so, blen);
 
     uint8_t *us8 = (uint8_t *) IDIO_STRING_S (so);
 
@@ -521,9 +553,6 @@ IDIO idio_string_C_array_lens (size_t const ns, char const *a_C[], size_t const
     IDIO_C_ASSERT (a_C);
     IDIO_C_ASSERT (lens);
 
-    IDIO so = idio_gc_get (IDIO_TYPE_STRING);
-    so->vtable = idio_vtable (IDIO_TYPE_STRING);
-
     size_t ai;
 
     IDIO_FLAGS_T flags = IDIO_STRING_FLAG_1BYTE;
@@ -606,8 +635,11 @@ IDIO idio_string_C_array_lens (size_t const ns, char const *a_C[], size_t const
 	}
     }
 
-    IDIO_GC_ALLOC (IDIO_STRING_S (so), reqd_bytes + 1);
-    IDIO_STRING_BLEN (so) = reqd_bytes;
+    idio_string_check_blen (reqd_bytes);
+
+    IDIO so = idio_gc_get (IDIO_TYPE_STRING);
+
+    idio_string_alloc_s (so, reqd_bytes);
 
     uint8_t *us8 = (uint8_t *) IDIO_STRING_S (so);
     uint16_t *us16 = (uint16_t *) IDIO_STRING_S (so);
@@ -699,11 +731,9 @@ IDIO idio_copy_string (IDIO string)
     case IDIO_TYPE_STRING:
 	{
 	    copy = idio_gc_get (IDIO_TYPE_STRING);
-	    copy->vtable = idio_vtable (IDIO_TYPE_STRING);
 
 	    size_t blen = IDIO_STRING_BLEN (string);
-	    IDIO_GC_ALLOC (IDIO_STRING_S (copy), blen + 1);
-	    IDIO_STRING_BLEN (copy) = blen;
+	    idio_string_alloc_s (copy, blen);
 
 	    memcpy (IDIO_STRING_S (copy), IDIO_STRING_S (string), blen);
 	    IDIO_STRING_S (copy)[blen] = '\0';
@@ -787,7 +817,9 @@ void idio_free_string (IDIO so)
 
     IDIO_TYPE_ASSERT (string, so);
 
-    IDIO_GC_FREE (IDIO_STRING_S (so), IDIO_STRING_BLEN (so) + 1);
+    if (! IDIO_STRING_INLINE_P (so)) {
+	IDIO_GC_FREE (IDIO_STRING_S (so), IDIO_STRING_BLEN (so) + 1);
+    }
 }
 
 /*
@@ -858,14 +890,13 @@ IDIO idio_substring_offset_len (IDIO str, size_t const offset, size_t const len)
     }
 
     IDIO so = idio_gc_get (IDIO_TYPE_SUBSTRING);
-    so->vtable = idio_vtable (IDIO_TYPE_SUBSTRING);
     IDIO_SUBSTRING_LEN (so) = len;
 
     if (idio_isa (str, IDIO_TYPE_SUBSTRING)) {
-	IDIO_SUBSTRING_S (so) = IDIO_SUBSTRING_S (str) + offset * width;
+	IDIO_SUBSTRING_OFFSET (so) = IDIO_SUBSTRING_OFFSET (str) + offset * width;
 	IDIO_SUBSTRING_PARENT (so) = IDIO_SUBSTRING_PARENT (str);
     } else {
-	IDIO_SUBSTRING_S (so) = IDIO_STRING_S (str) + offset * width;
+	IDIO_SUBSTRING_OFFSET (so) = offset * width;
 	IDIO_SUBSTRING_PARENT (so) = str;
     }
 
@@ -1055,11 +1086,11 @@ create a string with an initial length of `size`\n\
 	}
     }
 
+    idio_string_check_blen (reqd_bytes);
+
     IDIO so = idio_gc_get (IDIO_TYPE_STRING);
-    so->vtable = idio_vtable (IDIO_TYPE_STRING);
 
-    IDIO_GC_ALLOC (IDIO_STRING_S (so), reqd_bytes + 1);
-    IDIO_STRING_BLEN (so) = reqd_bytes;
+    idio_string_alloc_s (so, reqd_bytes);
 
     uint8_t *us8 = (uint8_t *) IDIO_STRING_S (so);
     uint16_t *us16 = (uint16_t *) IDIO_STRING_S (so);
@@ -1350,11 +1381,11 @@ IDIO idio_list_list2string (IDIO l)
 	}
     }
 
+    idio_string_check_blen (reqd_bytes);
+
     IDIO so = idio_gc_get (IDIO_TYPE_STRING);
-    so->vtable = idio_vtable (IDIO_TYPE_STRING);
 
-    IDIO_GC_ALLOC (IDIO_STRING_S (so), reqd_bytes + 1);
-    IDIO_STRING_BLEN (so) = reqd_bytes;
+    idio_string_alloc_s (so, reqd_bytes);
 
     uint8_t *us8 = (uint8_t *) IDIO_STRING_S (so);
     uint16_t *us16 = (uint16_t *) IDIO_STRING_S (so);
@@ -1474,32 +1505,14 @@ return a symbol derived from `s`		\n\
     return r;
 }
 
-IDIO_DEFINE_PRIMITIVE0V_DS ("append-string", append_string, (IDIO args), "[args]", "\
-append strings								\n\
-									\n\
-:param args: strings to append together					\n\
-:type args: list, optional						\n\
-:return: string	(\"\" if no `args` supplied)				\n\
-									\n\
-``append-string`` will gracefully degrade the string variant based on	\n\
-the arguments: `unicode` > `pathname` > `octet-string`			\n\
-									\n\
-``append-string`` takes multiple arguments each of which is		\n\
-a string.								\n\
-									\n\
-.. seealso:: :ref:`concatenate-string <concatenate-string>` which takes	\n\
-	a single argument which is a list of strings.			\n\
-")
+/*
+ * idio_append_string() is the body of append-string, args is the list
+ * of strings to be appended
+ */
+IDIO idio_append_string (IDIO args)
 {
     IDIO_ASSERT (args);
 
-    /*
-     * Test Case: n/a
-     *
-     * args is the varargs parameter -- should always be a list
-     */
-    IDIO_USER_TYPE_ASSERT (list, args);
-
     IDIO r = idio_S_nil;
 
     ssize_t ns = idio_list_length (args);
@@ -1658,11 +1671,11 @@ a string.								\n\
 	    }
 	}
 
+	idio_string_check_blen (reqd_bytes);
+
 	IDIO so = idio_gc_get (IDIO_TYPE_STRING);
-	so->vtable = idio_vtable (IDIO_TYPE_STRING);
 
-	IDIO_GC_ALLOC (IDIO_STRING_S (so), reqd_bytes + 1);
-	IDIO_STRING_BLEN (so) = reqd_bytes;
+	idio_string_alloc_s (so, reqd_bytes);
 
 	uint8_t *so8 = (uint8_t *) IDIO_STRING_S (so);
 	uint16_t *so16 = (uint16_t *) IDIO_STRING_S (so);
@@ -1841,6 +1854,35 @@ a string.								\n\
     return r;
 }
 
+IDIO_DEFINE_PRIMITIVE0V_DS ("append-string", append_string, (IDIO args), "[args]", "\
+append strings								\n\
+									\n\
+:param args: strings to append together					\n\
+:type args: list, optional						\n\
+:return: string	(\"\" if no `args` supplied)				\n\
+									\n\
+``append-string`` will gracefully degrade the string variant based on	\n\
+the arguments: `unicode` > `pathname` > `octet-string`			\n\
+									\n\
+``append-string`` takes multiple arguments each of which is		\n\
+a string.								\n\
+									\n\
+.. seealso:: :ref:`concatenate-string <concatenate-string>` which takes	\n\
+	a single argument which is a list of strings.			\n\
+")
+{
+    IDIO_ASSERT (args);
+
+    /*
+     * Test Case: n/a
+     *
+     * args is the varargs parameter -- should always be a list
+     */
+    IDIO_USER_TYPE_ASSERT (list, args);
+
+    return idio_append_string (args);
+}
+
 IDIO_DEFINE_PRIMITIVE1_DS ("copy-string", copy_string, (IDIO s), "s", "\
 return a copy of `s` which is not ``eq?`` to `s`	\n\
 						\n\
@@ -2680,6 +2722,102 @@ int idio_string_equal (IDIO s1, IDIO s2)
     return 1;
 }
 
+static idio_unicode_t idio_string_cp (char const *s, size_t w, size_t i)
+{
+    switch (w) {
+    case 1:
+	return ((uint8_t *) s)[i];
+    case 2:
+	return ((uint16_t *) s)[i];
+    default:
+	return ((uint32_t *) s)[i];
+    }
+}
+
+static char const *idio_string_cps (IDIO s, size_t *lenp)
+{
+    if (idio_isa_substring (s)) {
+	*lenp = IDIO_SUBSTRING_LEN (s);
+	return IDIO_SUBSTRING_S (s);
+    } else {
+	*lenp = IDIO_STRING_LEN (s);
+	return IDIO_STRING_S (s);
+    }
+}
+
+/*
+ * idio_string_ncmp() compares up to n code points of s1 and s2 and
+ * returns less than, equal to or greater than zero like strncmp(3).
+ *
+ * A string that is a prefix of another is less than it.
+ */
+static int idio_string_ncmp (IDIO s1, IDIO s2, size_t n)
+{
+    size_t s1len;
+    char const *s1s = idio_string_cps (s1, &s1len);
+    size_t s1w = idio_string_storage_size (s1);
+
+    size_t s2len;
+    char const *s2s = idio_string_cps (s2, &s2len);
+    size_t s2w = idio_string_storage_size (s2);
+
+    if (s1len > n) {
+	s1len = n;
+    }
+    if (s2len > n) {
+	s2len = n;
+    }
+
+    size_t len = s1len < s2len ? s1len : s2len;
+
+    size_t i;
+    for (i = 0; i < len; i++) {
+	idio_unicode_t s1_cp = idio_string_cp (s1s, s1w, i);
+	idio_unicode_t s2_cp = idio_string_cp (s2s, s2w, i);
+
+	if (s1_cp != s2_cp) {
+	    return (s1_cp < s2_cp) ? -1 : 1;
+	}
+    }
+
+    if (s1len == s2len) {
+	return 0;
+    }
+
+    return (s1len < s2len) ? -1 : 1;
+}
+
+int idio_string_cmp (IDIO s1, IDIO s2)
+{
+    IDIO_ASSERT (s1);
+    IDIO_ASSERT (s2);
+
+    IDIO_TYPE_ASSERT (string, s1);
+    IDIO_TYPE_ASSERT (string, s2);
+
+    return idio_string_ncmp (s1, s2, SIZE_MAX);
+}
+
+/*
+ * idio_string_prefixp() tests whether s starts with prefix
+ */
+int idio_string_prefixp (IDIO s, IDIO prefix)
+{
+    IDIO_ASSERT (s);
+    IDIO_ASSERT (prefix);
+
+    IDIO_TYPE_ASSERT (string, s);
+    IDIO_TYPE_ASSERT (string, prefix);
+
+    size_t plen = idio_string_len (prefix);
+
+    if (idio_string_len (s) < plen) {
+	return 0;
+    }
+
+    return (0 == idio_string_ncmp (s, prefix, plen));
+}
+
 /*
  * All the string-*? are essentially identical.
  *
@@ -173,11 +173,10 @@ IDIO idio_struct_type (IDIO name, IDIO parent, IDIO fields)
      * * a per-type vtable for a start
      */
     idio_vtable_t *vt = idio_vtable (0);
-    st->vtable = vt;
     if (idio_S_nil == parent) {
 	IDIO_VTABLE_PARENT (vt) = idio_vtable (IDIO_TYPE_STRUCT_TYPE);
     } else {
-	IDIO_VTABLE_PARENT (vt) = parent->vtable;
+	IDIO_VTABLE_PARENT (vt) = IDIO_STRUCT_TYPE_VTABLE (parent);
     }
 
     idio_vtable_add_method (vt,
@@ -190,6 +189,7 @@ IDIO idio_struct_type (IDIO name, IDIO parent, IDIO fields)
     IDIO_STRUCT_TYPE_GREY (st) = NULL;
     IDIO_STRUCT_TYPE_NAME (st) = name;
     IDIO_STRUCT_TYPE_PARENT (st) = parent;
+    IDIO_STRUCT_TYPE_VTABLE (st) = vt;
 
     IDIO_STRUCT_TYPE_SIZE (st) = size;
     IDIO_GC_ALLOC (st->u.struct_type->fields, size * sizeof (IDIO));
@@ -434,7 +434,6 @@ IDIO idio_allocate_struct_instance_size (IDIO st, size_t size, int fill)
     IDIO_TYPE_ASSERT (struct_type, st);
 
     IDIO si = idio_gc_get (IDIO_TYPE_STRUCT_INSTANCE);
-    si->vtable = st->vtable;
 
     IDIO_GC_ALLOC (si->u.struct_instance, sizeof (idio_struct_instance_t));
 
@@ -442,7 +441,7 @@ IDIO idio_allocate_struct_instance_size (IDIO st, size_t size, int fill)
     IDIO_STRUCT_INSTANCE_TYPE (si) = st;
     IDIO_STRUCT_INSTANCE_SIZE (si) = size;
 
-    IDIO_GC_ALLOC (si->u.struct_instance->fields, size * sizeof (struct idio_s));
+    IDIO_GC_ALLOC (si->u.struct_instance->fields, size * sizeof (IDIO));
 
     if (fill) {
 	size_t i = 0;
@@ -77,6 +77,7 @@
 IDIO idio_struct_type (IDIO name, IDIO parent, IDIO fields);
 int idio_isa_struct_type (IDIO p);
 int idio_struct_type_isa (IDIO st, IDIO type);
+ssize_t idio_struct_type_find_eqp (IDIO st, IDIO e, size_t index);
 void idio_free_struct_type (IDIO p);
 IDIO idio_allocate_struct_instance_size (IDIO st, size_t size, int fill);
 IDIO idio_allocate_struct_instance (IDIO st, int fill);
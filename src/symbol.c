@@ -84,6 +84,10 @@ IDIO_SYMBOL_DECL (struct_instance);
 IDIO_SYMBOL_DECL (thread);
 IDIO_SYMBOL_DECL (continuation);
 IDIO_SYMBOL_DECL (bitset);
+IDIO_SYMBOL_DECL (pmap);
+IDIO_SYMBOL_DECL (omap);
+IDIO_SYMBOL_DECL (tvector);
+IDIO_SYMBOL_DECL (bytevector);
 IDIO_SYMBOL_DECL (c_char);
 IDIO_SYMBOL_DECL (c_schar);
 IDIO_SYMBOL_DECL (c_uchar);
@@ -227,6 +231,15 @@ IDIO_SYMBOL_DECL (float);
 IDIO_SYMBOL_DECL (double);
 IDIO_SYMBOL_DECL (longdouble);
 
+IDIO_SYMBOL_DECL (u8);
+IDIO_SYMBOL_DECL (s32);
+IDIO_SYMBOL_DECL (s64);
+IDIO_SYMBOL_DECL (f32);
+IDIO_SYMBOL_DECL (f64);
+
+IDIO_SYMBOL_DECL (big);
+IDIO_SYMBOL_DECL (little);
+
 static void idio_symbol_error (char const *msg, IDIO c_location)
 {
     IDIO_C_ASSERT (msg);
@@ -348,10 +361,10 @@ idio_hi_t idio_symbol_C_hash (IDIO h, const void *s)
     idio_hi_t hvalue = (uintptr_t) s;
 
     if (idio_S_nil != s) {
-	hvalue = idio_hash_default_hash_C_string_C_MurmurOAAT_32 (s);
+	hvalue = idio_hash_default_hash_C_string_C (strlen (s), s);
     }
 
-    return (hvalue & IDIO_HASH_MASK (h));
+    return hvalue;
 }
 
 /*
@@ -373,7 +386,6 @@ static IDIO idio_symbol_C (char const *s_C, size_t const blen)
     IDIO_C_ASSERT (s_C);
 
     IDIO o = idio_gc_get (IDIO_TYPE_SYMBOL);
-    o->vtable = idio_vtable (IDIO_TYPE_SYMBOL);
 
     IDIO_GC_ALLOC (IDIO_SYMBOL_S (o), blen + 1);
     memcpy (IDIO_SYMBOL_S (o), s_C, blen);
@@ -1085,6 +1097,10 @@ void idio_init_symbol ()
     IDIO_SYMBOL_DEF ("thread", thread);
     IDIO_SYMBOL_DEF ("continuation", continuation);
     IDIO_SYMBOL_DEF ("bitset", bitset);
+    IDIO_SYMBOL_DEF ("pmap", pmap);
+    IDIO_SYMBOL_DEF ("omap", omap);
+    IDIO_SYMBOL_DEF ("tvector", tvector);
+    IDIO_SYMBOL_DEF ("bytevector", bytevector);
     IDIO_SYMBOL_DEF ("C/char", c_char);
     IDIO_SYMBOL_DEF ("C/schar", c_schar);
     IDIO_SYMBOL_DEF ("C/uchar", c_uchar);
@@ -1232,6 +1248,15 @@ void idio_init_symbol ()
     IDIO_SYMBOL_DEF ("double", double);
     IDIO_SYMBOL_DEF ("longdouble", longdouble);
 
+    IDIO_SYMBOL_DEF ("u8", u8);
+    IDIO_SYMBOL_DEF ("s32", s32);
+    IDIO_SYMBOL_DEF ("s64", s64);
+    IDIO_SYMBOL_DEF ("f32", f32);
+    IDIO_SYMBOL_DEF ("f64", f64);
+
+    IDIO_SYMBOL_DEF ("big", big);
+    IDIO_SYMBOL_DEF ("little", little);
+
     /*
      * idio_properties_hash doesn't really live in symbol.c but we
      * need it up and running before primitives and closures get a
@@ -50,6 +50,10 @@ extern IDIO_SYMBOL_DECL (struct_instance);
 extern IDIO_SYMBOL_DECL (thread);
 extern IDIO_SYMBOL_DECL (continuation);
 extern IDIO_SYMBOL_DECL (bitset);
+extern IDIO_SYMBOL_DECL (pmap);
+extern IDIO_SYMBOL_DECL (omap);
+extern IDIO_SYMBOL_DECL (tvector);
+extern IDIO_SYMBOL_DECL (bytevector);
 extern IDIO_SYMBOL_DECL (c_char);
 extern IDIO_SYMBOL_DECL (c_schar);
 extern IDIO_SYMBOL_DECL (c_uchar);
@@ -193,6 +197,15 @@ extern IDIO_SYMBOL_DECL (float);
 extern IDIO_SYMBOL_DECL (double);
 extern IDIO_SYMBOL_DECL (longdouble);
 
+extern IDIO_SYMBOL_DECL (u8);
+extern IDIO_SYMBOL_DECL (s32);
+extern IDIO_SYMBOL_DECL (s64);
+extern IDIO_SYMBOL_DECL (f32);
+extern IDIO_SYMBOL_DECL (f64);
+
+extern IDIO_SYMBOL_DECL (big);
+extern IDIO_SYMBOL_DECL (little);
+
 extern IDIO idio_properties_hash;
 
 void idio_property_nil_object_error (char const *msg, IDIO c_location);
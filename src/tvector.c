@@ -0,0 +1,2187 @@
+/*
+ * Copyright (c) 2020-2022 Ian Fitchet <idf(at)idio-lang.org>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License.  You
+ * may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/*
+ * tvector.c
+ *
+ * Typed vectors: contiguous C arrays of u8, s32, s64, f32 or f64
+ * elements.
+ *
+ * Numbers in an array are each a (boxed) Idio value.  A tvector
+ * holds the C values themselves which is eight times smaller for a
+ * u8 and gives the garbage collector nothing to look at.
+ *
+ * Elements are boxed on the way out: integer kinds as fixnums (or
+ * bignums for large s64 values), f32 as C/float and f64 as C/double.
+ * On the way in integer kinds take integers and the floating point
+ * kinds take any Idio number or a C/float or C/double.
+ */
+
+#define _GNU_SOURCE
+
+#include <sys/types.h>
+
+#include <assert.h>
+#include <inttypes.h>
+#include <limits.h>
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "idio-config.h"
+
+#include "gc.h"
+#include "idio.h"
+
+#include "array.h"
+#include "bignum.h"
+#include "bitset.h"
+#include "c-type.h"
+#include "error.h"
+#include "evaluate.h"
+#include "fixnum.h"
+#include "hash.h"
+#include "idio-string.h"
+#include "pair.h"
+#include "symbol.h"
+#include "tvector.h"
+#include "util.h"
+#include "vm.h"
+#include "vtable.h"
+
+typedef union idio_tvector_elem_u {
+    uint8_t u8;
+    int32_t s32;
+    int64_t s64;
+    float f32;
+    double f64;
+} idio_tvector_elem_t;
+
+static size_t const idio_tvector_widths[] = {
+    sizeof (uint8_t),
+    sizeof (int32_t),
+    sizeof (int64_t),
+    sizeof (float),
+    sizeof (double),
+};
+
+static char const *idio_tvector_kind_names[] = {
+    "u8",
+    "s32",
+    "s64",
+    "f32",
+    "f64",
+};
+
+size_t idio_tvector_kind_width (int const kind)
+{
+    return idio_tvector_widths[kind];
+}
+
+IDIO idio_tvector_kind_symbol (int const kind)
+{
+    switch (kind) {
+    case IDIO_TVECTOR_KIND_U8:	return idio_S_u8;
+    case IDIO_TVECTOR_KIND_S32:	return idio_S_s32;
+    case IDIO_TVECTOR_KIND_S64:	return idio_S_s64;
+    case IDIO_TVECTOR_KIND_F32:	return idio_S_f32;
+    case IDIO_TVECTOR_KIND_F64:	return idio_S_f64;
+    }
+
+    return idio_S_unspec;
+}
+
+static int idio_tvector_kind (IDIO type, char const *func)
+{
+    IDIO_ASSERT (type);
+    IDIO_C_ASSERT (func);
+
+    if (idio_S_u8 == type) {
+	return IDIO_TVECTOR_KIND_U8;
+    } else if (idio_S_s32 == type) {
+	return IDIO_TVECTOR_KIND_S32;
+    } else if (idio_S_s64 == type) {
+	return IDIO_TVECTOR_KIND_S64;
+    } else if (idio_S_f32 == type) {
+	return IDIO_TVECTOR_KIND_F32;
+    } else if (idio_S_f64 == type) {
+	return IDIO_TVECTOR_KIND_F64;
+    }
+
+    /*
+     * Test Case: tvector-errors/make-tvector-bad-type.idio
+     *
+     * make-tvector 'u16 3
+     */
+    idio_error_param_value_msg (func, "type", type, "should be one of u8, s32, s64, f32, f64", IDIO_C_FUNC_LOCATION ());
+
+    return -1;
+}
+
+/*
+ * idio_tvector_len_overflows() is true if len elements of kind would
+ * overflow a size_t number of bytes.
+ */
+static int idio_tvector_len_overflows (int const kind, size_t const len)
+{
+    return (len > SIZE_MAX / idio_tvector_widths[kind]);
+}
+
+IDIO idio_tvector (int const kind, size_t const len)
+{
+    if (idio_tvector_len_overflows (kind, len)) {
+	/*
+	 * Test Case: n/a
+	 *
+	 * make-tvector and tvector-histogram check their sizes first
+	 */
+	idio_error_param_value_msg ("tvector", "size", idio_uinteger (len), "too large for the element type", IDIO_C_FUNC_LOCATION ());
+
+	return idio_S_notreached;
+    }
+
+    IDIO tv = idio_gc_get (IDIO_TYPE_TVECTOR);
+
+    IDIO_TVECTOR_KIND (tv) = kind;
+    IDIO_TVECTOR_LEN (tv) = len;
+    IDIO_TVECTOR_DATA (tv) = NULL;
+
+    if (len) {
+	size_t size = len * idio_tvector_widths[kind];
+	IDIO_GC_ALLOC (IDIO_TVECTOR_DATA (tv), size);
+	memset (IDIO_TVECTOR_DATA (tv), 0, size);
+    }
+
+    return tv;
+}
+
+int idio_isa_tvector (IDIO o)
+{
+    IDIO_ASSERT (o);
+
+    return idio_isa (o, IDIO_TYPE_TVECTOR);
+}
+
+void idio_free_tvector (IDIO tv)
+{
+    IDIO_ASSERT (tv);
+    IDIO_TYPE_ASSERT (tvector, tv);
+
+    IDIO_GC_FREE (IDIO_TVECTOR_DATA (tv), IDIO_TVECTOR_LEN (tv) * idio_tvector_widths[IDIO_TVECTOR_KIND (tv)]);
+}
+
+IDIO idio_copy_tvector (IDIO tv)
+{
+    IDIO_ASSERT (tv);
+    IDIO_TYPE_ASSERT (tvector, tv);
+
+    size_t len = IDIO_TVECTOR_LEN (tv);
+    IDIO r = idio_tvector (IDIO_TVECTOR_KIND (tv), len);
+
+    if (len) {
+	memcpy (IDIO_TVECTOR_DATA (r), IDIO_TVECTOR_DATA (tv), len * idio_tvector_widths[IDIO_TVECTOR_KIND (tv)]);
+    }
+
+    return r;
+}
+
+/*
+ * idio_tvector_C_index() converts an Idio integer (or an integral
+ * bignum) into a C index.  The caller checks the bounds.
+ */
+static ptrdiff_t idio_tvector_C_index (IDIO index)
+{
+    IDIO_ASSERT (index);
+
+    if (idio_isa_fixnum (index)) {
+	return IDIO_FIXNUM_VAL (index);
+    } else if (idio_isa_bignum (index)) {
+	if (IDIO_BIGNUM_INTEGER_P (index)) {
+	    /*
+	     * Code coverage: requires a large tvector
+	     */
+	    return idio_bignum_ptrdiff_t_value (index);
+	} else {
+	    IDIO index_i = idio_bignum_real_to_integer (index);
+	    if (idio_S_nil == index_i) {
+		/*
+		 * Test Case: tvector-errors/tvector-ref-float.idio
+		 *
+		 * tvector-ref (make-tvector 'u8 3) 1.1
+		 */
+		idio_error_param_type ("integer", index, IDIO_C_FUNC_LOCATION ());
+
+		return -1;
+	    } else {
+		return idio_bignum_ptrdiff_t_value (index_i);
+	    }
+	}
+    }
+
+    /*
+     * Test Case: tvector-errors/tvector-ref-not-integer.idio
+     *
+     * tvector-ref (make-tvector 'u8 3) #t
+     */
+    idio_error_param_type ("integer", index, IDIO_C_FUNC_LOCATION ());
+
+    return -1;
+}
+
+/*
+ * idio_tvector_range() sets *startp and *endp from the optional
+ * [start [end]] in args, defaulting to the whole of tv.
+ */
+static void idio_tvector_range (IDIO tv, IDIO args, size_t *startp, size_t *endp, char const *func)
+{
+    IDIO_ASSERT (tv);
+    IDIO_ASSERT (args);
+    IDIO_C_ASSERT (startp);
+    IDIO_C_ASSERT (endp);
+    IDIO_C_ASSERT (func);
+
+    size_t len = IDIO_TVECTOR_LEN (tv);
+    ptrdiff_t start = 0;
+    ptrdiff_t end = len;
+
+    if (idio_isa_pair (args)) {
+	start = idio_tvector_C_index (IDIO_PAIR_H (args));
+	args = IDIO_PAIR_T (args);
+	if (idio_isa_pair (args)) {
+	    end = idio_tvector_C_index (IDIO_PAIR_H (args));
+	}
+    }
+
+    if (start < 0 ||
+	start > end ||
+	(size_t) end > len) {
+	/*
+	 * Test Case: tvector-errors/tvector-slice-bad-range.idio
+	 *
+	 * tvector-slice (make-tvector 'u8 3) 2 1
+	 */
+	char em[BUFSIZ];
+	idio_snprintf (em, BUFSIZ, "range %td-%td is not within 0-%zu", start, end, len);
+	idio_error_param_value_msg_only (func, "start/end", em, IDIO_C_FUNC_LOCATION ());
+
+	return;
+    }
+
+    *startp = start;
+    *endp = end;
+}
+
+static size_t idio_tvector_ref_index (IDIO tv, IDIO index, char const *func)
+{
+    IDIO_ASSERT (tv);
+    IDIO_ASSERT (index);
+    IDIO_C_ASSERT (func);
+
+    ptrdiff_t i = idio_tvector_C_index (index);
+    ptrdiff_t len = IDIO_TVECTOR_LEN (tv);
+
+    /*
+     * As with arrays, negative indexes count back from the end
+     */
+    if (i < 0) {
+	i += len;
+    }
+
+    if (i < 0 ||
+	i >= len) {
+	/*
+	 * Test Case: tvector-errors/tvector-ref-bounds.idio
+	 *
+	 * tvector-ref (make-tvector 'u8 3) 3
+	 */
+	char em[BUFSIZ];
+	idio_snprintf (em, BUFSIZ, "out of bounds for length %td", len);
+	idio_error_param_value_msg (func, "index", index, em, IDIO_C_FUNC_LOCATION ());
+
+	return 0;
+    }
+
+    return i;
+}
+
+static intmax_t idio_tvector_integer_value (IDIO v, char const *func, char const *param)
+{
+    IDIO_ASSERT (v);
+    IDIO_C_ASSERT (func);
+    IDIO_C_ASSERT (param);
+
+    if (idio_isa_fixnum (v)) {
+	return IDIO_FIXNUM_VAL (v);
+    } else if (idio_isa_bignum (v)) {
+	if (IDIO_BIGNUM_INTEGER_P (v)) {
+	    return idio_bignum_intmax_t_value (v);
+	} else {
+	    IDIO v_i = idio_bignum_real_to_integer (v);
+	    if (idio_S_nil != v_i) {
+		return idio_bignum_intmax_t_value (v_i);
+	    }
+	}
+    }
+
+    /*
+     * Test Case: tvector-errors/tvector-set-u8-not-integer.idio
+     *
+     * tvector-set! (make-tvector 'u8 3) 0 1.5
+     */
+    idio_error_param_type ("integer", v, IDIO_C_FUNC_LOCATION ());
+
+    return 0;
+}
+
+static double idio_tvector_double_value (IDIO v, char const *func, char const *param)
+{
+    IDIO_ASSERT (v);
+    IDIO_C_ASSERT (func);
+    IDIO_C_ASSERT (param);
+
+    if (idio_isa_fixnum (v)) {
+	return IDIO_FIXNUM_VAL (v);
+    } else if (idio_isa_bignum (v)) {
+	return idio_bignum_double_value (v);
+    } else if (idio_isa_C_double (v)) {
+	return IDIO_C_TYPE_double (v);
+    } else if (idio_isa_C_float (v)) {
+	return IDIO_C_TYPE_float (v);
+    }
+
+    /*
+     * Test Case: tvector-errors/tvector-set-f64-not-number.idio
+     *
+     * tvector-set! (make-tvector 'f64 3) 0 #t
+     */
+    idio_error_param_type ("number", v, IDIO_C_FUNC_LOCATION ());
+
+    return 0;
+}
+
+/*
+ * idio_tvector_elem() converts v to the C type of kind in *ep
+ * raising an error if it won't go.
+ */
+static void idio_tvector_elem (int const kind, IDIO v, idio_tvector_elem_t *ep, char const *func, char const *param)
+{
+    IDIO_ASSERT (v);
+    IDIO_C_ASSERT (ep);
+    IDIO_C_ASSERT (func);
+    IDIO_C_ASSERT (param);
+
+    intmax_t i;
+    intmax_t min = 0;
+    intmax_t max = 0;
+
+    switch (kind) {
+    case IDIO_TVECTOR_KIND_F32:
+	ep->f32 = idio_tvector_double_value (v, func, param);
+	return;
+    case IDIO_TVECTOR_KIND_F64:
+	ep->f64 = idio_tvector_double_value (v, func, param);
+	return;
+    case IDIO_TVECTOR_KIND_U8:
+	min = 0;
+	max = UINT8_MAX;
+	break;
+    case IDIO_TVECTOR_KIND_S32:
+	min = INT32_MIN;
+	max = INT32_MAX;
+	break;
+    case IDIO_TVECTOR_KIND_S64:
+	min = INT64_MIN;
+	max = INT64_MAX;
+	break;
+    }
+
+    i = idio_tvector_integer_value (v, func, param);
+
+    if (i < min ||
+	i > max) {
+	/*
+	 * Test Case: tvector-errors/tvector-set-u8-range.idio
+	 *
+	 * tvector-set! (make-tvector 'u8 3) 0 256
+	 */
+	char em[BUFSIZ];
+	idio_snprintf (em, BUFSIZ, "out of range for %s", idio_tvector_kind_names[kind]);
+	idio_error_param_value_msg (func, param, v, em, IDIO_C_FUNC_LOCATION ());
+
+	return;
+    }
+
+    switch (kind) {
+    case IDIO_TVECTOR_KIND_U8:	ep->u8 = i;	break;
+    case IDIO_TVECTOR_KIND_S32:	ep->s32 = i;	break;
+    case IDIO_TVECTOR_KIND_S64:	ep->s64 = i;	break;
+    }
+}
+
+static void idio_tvector_store (IDIO tv, size_t const i, idio_tvector_elem_t *ep)
+{
+    switch (IDIO_TVECTOR_KIND (tv)) {
+    case IDIO_TVECTOR_KIND_U8:	IDIO_TVECTOR_U8 (tv)[i] = ep->u8;	break;
+    case IDIO_TVECTOR_KIND_S32:	IDIO_TVECTOR_S32 (tv)[i] = ep->s32;	break;
+    case IDIO_TVECTOR_KIND_S64:	IDIO_TVECTOR_S64 (tv)[i] = ep->s64;	break;
+    case IDIO_TVECTOR_KIND_F32:	IDIO_TVECTOR_F32 (tv)[i] = ep->f32;	break;
+    case IDIO_TVECTOR_KIND_F64:	IDIO_TVECTOR_F64 (tv)[i] = ep->f64;	break;
+    }
+}
+
+IDIO idio_tvector_ref_C (IDIO tv, size_t const i)
+{
+    IDIO_ASSERT (tv);
+    IDIO_TYPE_ASSERT (tvector, tv);
+
+    switch (IDIO_TVECTOR_KIND (tv)) {
+    case IDIO_TVECTOR_KIND_U8:	return idio_fixnum (IDIO_TVECTOR_U8 (tv)[i]);
+    case IDIO_TVECTOR_KIND_S32:	return idio_fixnum (IDIO_TVECTOR_S32 (tv)[i]);
+    case IDIO_TVECTOR_KIND_S64:	return idio_integer (IDIO_TVECTOR_S64 (tv)[i]);
+    case IDIO_TVECTOR_KIND_F32:	return idio_C_float (IDIO_TVECTOR_F32 (tv)[i]);
+    case IDIO_TVECTOR_KIND_F64:	return idio_C_double (IDIO_TVECTOR_F64 (tv)[i]);
+    }
+
+    return idio_S_notreached;
+}
+
+void idio_tvector_set_C (IDIO tv, size_t const i, IDIO v, char const *func)
+{
+    IDIO_ASSERT (tv);
+    IDIO_ASSERT (v);
+    IDIO_TYPE_ASSERT (tvector, tv);
+
+    idio_tvector_elem_t e;
+    idio_tvector_elem (IDIO_TVECTOR_KIND (tv), v, &e, func, "v");
+    idio_tvector_store (tv, i, &e);
+}
+
+int idio_tvector_equal (IDIO tv1, IDIO tv2)
+{
+    IDIO_ASSERT (tv1);
+    IDIO_ASSERT (tv2);
+    IDIO_TYPE_ASSERT (tvector, tv1);
+    IDIO_TYPE_ASSERT (tvector, tv2);
+
+    if (IDIO_TVECTOR_KIND (tv1) != IDIO_TVECTOR_KIND (tv2) ||
+	IDIO_TVECTOR_LEN (tv1) != IDIO_TVECTOR_LEN (tv2)) {
+	return 0;
+    }
+
+    size_t len = IDIO_TVECTOR_LEN (tv1);
+    size_t i;
+
+    /*
+     * The floating point kinds compare by value, not by bit pattern,
+     * so that 0.0 and -0.0 are equal
+     */
+    switch (IDIO_TVECTOR_KIND (tv1)) {
+    case IDIO_TVECTOR_KIND_F32:
+	for (i = 0; i < len; i++) {
+	    if (IDIO_TVECTOR_F32 (tv1)[i] != IDIO_TVECTOR_F32 (tv2)[i]) {
+		return 0;
+	    }
+	}
+	return 1;
+    case IDIO_TVECTOR_KIND_F64:
+	for (i = 0; i < len; i++) {
+	    if (IDIO_TVECTOR_F64 (tv1)[i] != IDIO_TVECTOR_F64 (tv2)[i]) {
+		return 0;
+	    }
+	}
+	return 1;
+    }
+
+    if (0 == len) {
+	return 1;
+    }
+
+    return (0 == memcmp (IDIO_TVECTOR_DATA (tv1), IDIO_TVECTOR_DATA (tv2), len * idio_tvector_widths[IDIO_TVECTOR_KIND (tv1)]));
+}
+
+/*
+ * idio_tvector_hash_C() hashes the kind, length and element values of
+ * tv for an equal? hash table and so must agree with
+ * idio_tvector_equal(): in particular, -0.0 hashes as 0.0.
+ */
+idio_hi_t idio_tvector_hash_C (IDIO tv)
+{
+    IDIO_ASSERT (tv);
+    IDIO_TYPE_ASSERT (tvector, tv);
+
+    int kind = IDIO_TVECTOR_KIND (tv);
+    size_t len = IDIO_TVECTOR_LEN (tv);
+    uint64_t hv = ((uint64_t) kind << 56) ^ len;
+    size_t i;
+
+    switch (kind) {
+    case IDIO_TVECTOR_KIND_F32:
+	for (i = 0; i < len; i++) {
+	    float f = IDIO_TVECTOR_F32 (tv)[i];
+	    if (0.0f == f) {
+		f = 0.0f;
+	    }
+	    uint32_t bits;
+	    memcpy (&bits, &f, sizeof (bits));
+	    hv = (hv ^ bits) * 0x100000001b3ULL;
+	}
+	break;
+    case IDIO_TVECTOR_KIND_F64:
+	for (i = 0; i < len; i++) {
+	    double d = IDIO_TVECTOR_F64 (tv)[i];
+	    if (0.0 == d) {
+		d = 0.0;
+	    }
+	    uint64_t bits;
+	    memcpy (&bits, &d, sizeof (bits));
+	    hv = (hv ^ bits) * 0x100000001b3ULL;
+	}
+	break;
+    default:
+	if (len) {
+	    hv ^= idio_hash_default_hash_C_string_C (len * idio_tvector_widths[kind], (char const *) IDIO_TVECTOR_DATA (tv));
+	}
+	break;
+    }
+
+    return idio_hash_default_hash_C_uintmax_t (hv);
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("tvector?", tvector_p, (IDIO o), "o", "\
+test if `o` is a tvector			\n\
+						\n\
+:param o: object to test			\n\
+:return: ``#t`` if `o` is a tvector, ``#f`` otherwise	\n\
+")
+{
+    IDIO_ASSERT (o);
+
+    IDIO r = idio_S_false;
+
+    if (idio_isa_tvector (o)) {
+	r = idio_S_true;
+    }
+
+    return r;
+}
+
+IDIO_DEFINE_PRIMITIVE2V_DS ("make-tvector", make_tvector, (IDIO type, IDIO size, IDIO args), "type size [fill]", "\
+create a tvector of `size` elements of `type`	\n\
+						\n\
+:param type: element type			\n\
+:type type: symbol, one of ``u8``, ``s32``, ``s64``, ``f32`` or ``f64``	\n\
+:param size: number of elements			\n\
+:type size: integer				\n\
+:param fill: initial value, defaults to zero	\n\
+:type fill: number, optional			\n\
+:rtype: tvector					\n\
+")
+{
+    IDIO_ASSERT (type);
+    IDIO_ASSERT (size);
+    IDIO_ASSERT (args);
+
+    /*
+     * Test Case: tvector-errors/make-tvector-bad-type-type.idio
+     *
+     * make-tvector #t 3
+     */
+    IDIO_USER_TYPE_ASSERT (symbol, type);
+    /*
+     * Test Case: n/a
+     *
+     * args is the varargs parameter -- should always be a list
+     */
+    IDIO_USER_TYPE_ASSERT (list, args);
+
+    int kind = idio_tvector_kind (type, "make-tvector");
+
+    ptrdiff_t len = idio_tvector_C_index (size);
+    if (len < 0) {
+	/*
+	 * Test Case: tvector-errors/make-tvector-negative-size.idio
+	 *
+	 * make-tvector 'u8 -1
+	 */
+	idio_error_param_value_msg ("make-tvector", "size", size, "should be a non-negative integer", IDIO_C_FUNC_LOCATION ());
+
+	return idio_S_notreached;
+    }
+
+    if (idio_tvector_len_overflows (kind, len)) {
+	/*
+	 * Test Case: tvector-errors/make-tvector-too-large.idio
+	 *
+	 * make-tvector 's64 4611686018427387904
+	 */
+	idio_error_param_value_msg ("make-tvector", "size", size, "too large for the element type", IDIO_C_FUNC_LOCATION ());
+
+	return idio_S_notreached;
+    }
+
+    idio_tvector_elem_t e;
+    int fill = 0;
+    if (idio_isa_pair (args)) {
+	idio_tvector_elem (kind, IDIO_PAIR_H (args), &e, "make-tvector", "fill");
+	fill = 1;
+    }
+
+    IDIO tv = idio_tvector (kind, len);
+
+    if (fill) {
+	ptrdiff_t i;
+	for (i = 0; i < len; i++) {
+	    idio_tvector_store (tv, i, &e);
+	}
+    }
+
+    return tv;
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("tvector-type", tvector_type, (IDIO tv), "tv", "\
+return the element type of tvector `tv`		\n\
+						\n\
+:param tv: tvector				\n\
+:type tv: tvector				\n\
+:rtype: symbol					\n\
+")
+{
+    IDIO_ASSERT (tv);
+
+    /*
+     * Test Case: tvector-errors/tvector-type-bad-type.idio
+     *
+     * tvector-type #t
+     */
+    IDIO_USER_TYPE_ASSERT (tvector, tv);
+
+    return idio_tvector_kind_symbol (IDIO_TVECTOR_KIND (tv));
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("tvector-length", tvector_length, (IDIO tv), "tv", "\
+return the number of elements in tvector `tv`	\n\
+						\n\
+:param tv: tvector				\n\
+:type tv: tvector				\n\
+:rtype: integer					\n\
+")
+{
+    IDIO_ASSERT (tv);
+
+    /*
+     * Test Case: tvector-errors/tvector-length-bad-type.idio
+     *
+     * tvector-length #t
+     */
+    IDIO_USER_TYPE_ASSERT (tvector, tv);
+
+    return idio_integer (IDIO_TVECTOR_LEN (tv));
+}
+
+IDIO_DEFINE_PRIMITIVE2_DS ("tvector-ref", tvector_ref, (IDIO tv, IDIO index), "tv index", "\
+return the element at `index` of tvector `tv`	\n\
+						\n\
+:param tv: tvector				\n\
+:type tv: tvector				\n\
+:param index: index, negative indexes count back from the end	\n\
+:type index: integer				\n\
+:return: the element as an integer, ``C/float`` or ``C/double``	\n\
+")
+{
+    IDIO_ASSERT (tv);
+    IDIO_ASSERT (index);
+
+    /*
+     * Test Case: tvector-errors/tvector-ref-bad-type.idio
+     *
+     * tvector-ref #t 0
+     */
+    IDIO_USER_TYPE_ASSERT (tvector, tv);
+
+    size_t i = idio_tvector_ref_index (tv, index, "tvector-ref");
+
+    return idio_tvector_ref_C (tv, i);
+}
+
+IDIO_DEFINE_PRIMITIVE3_DS ("tvector-set!", tvector_set, (IDIO tv, IDIO index, IDIO v), "tv index v", "\
+set the element at `index` of tvector `tv` to `v`	\n\
+						\n\
+:param tv: tvector				\n\
+:type tv: tvector				\n\
+:param index: index, negative indexes count back from the end	\n\
+:type index: integer				\n\
+:param v: value					\n\
+:type v: integer for integer tvectors or a number, ``C/float`` or ``C/double``	\n\
+:return: ``#<unspec>``				\n\
+")
+{
+    IDIO_ASSERT (tv);
+    IDIO_ASSERT (index);
+    IDIO_ASSERT (v);
+
+    /*
+     * Test Case: tvector-errors/tvector-set-bad-type.idio
+     *
+     * tvector-set! #t 0 0
+     */
+    IDIO_USER_TYPE_ASSERT (tvector, tv);
+
+    size_t i = idio_tvector_ref_index (tv, index, "tvector-set!");
+
+    idio_tvector_set_C (tv, i, v, "tvector-set!");
+
+    return idio_S_unspec;
+}
+
+IDIO_DEFINE_PRIMITIVE2V_DS ("tvector-fill!", tvector_fill, (IDIO tv, IDIO v, IDIO args), "tv v [start [end]]", "\
+set the elements of tvector `tv` from `start`	\n\
+up to `end` to `v`				\n\
+						\n\
+:param tv: tvector				\n\
+:type tv: tvector				\n\
+:param v: value					\n\
+:type v: integer for integer tvectors or a number, ``C/float`` or ``C/double``	\n\
+:param start: first index, defaults to 0	\n\
+:type start: integer, optional			\n\
+:param end: index after the last, defaults to the length of `tv`	\n\
+:type end: integer, optional			\n\
+:return: ``#<unspec>``				\n\
+")
+{
+    IDIO_ASSERT (tv);
+    IDIO_ASSERT (v);
+    IDIO_ASSERT (args);
+
+    /*
+     * Test Case: tvector-errors/tvector-fill-bad-type.idio
+     *
+     * tvector-fill! #t 0
+     */
+    IDIO_USER_TYPE_ASSERT (tvector, tv);
+    /*
+     * Test Case: n/a
+     *
+     * args is the varargs parameter -- should always be a list
+     */
+    IDIO_USER_TYPE_ASSERT (list, args);
+
+    size_t start;
+    size_t end;
+    idio_tvector_range (tv, args, &start, &end, "tvector-fill!");
+
+    idio_tvector_elem_t e;
+    idio_tvector_elem (IDIO_TVECTOR_KIND (tv), v, &e, "tvector-fill!", "v");
+
+    if (IDIO_TVECTOR_KIND_U8 == IDIO_TVECTOR_KIND (tv)) {
+	memset (IDIO_TVECTOR_U8 (tv) + start, e.u8, end - start);
+    } else {
+	size_t i;
+	for (i = start; i < end; i++) {
+	    idio_tvector_store (tv, i, &e);
+	}
+    }
+
+    return idio_S_unspec;
+}
+
+IDIO_DEFINE_PRIMITIVE1V_DS ("tvector-slice", tvector_slice, (IDIO tv, IDIO args), "tv [start [end]]", "\
+return a new tvector of the elements of tvector	\n\
+`tv` from `start` up to `end`			\n\
+						\n\
+:param tv: tvector				\n\
+:type tv: tvector				\n\
+:param start: first index, defaults to 0	\n\
+:type start: integer, optional			\n\
+:param end: index after the last, defaults to the length of `tv`	\n\
+:type end: integer, optional			\n\
+:rtype: tvector					\n\
+")
+{
+    IDIO_ASSERT (tv);
+    IDIO_ASSERT (args);
+
+    /*
+     * Test Case: tvector-errors/tvector-slice-bad-type.idio
+     *
+     * tvector-slice #t
+     */
+    IDIO_USER_TYPE_ASSERT (tvector, tv);
+    /*
+     * Test Case: n/a
+     *
+     * args is the varargs parameter -- should always be a list
+     */
+    IDIO_USER_TYPE_ASSERT (list, args);
+
+    size_t start;
+    size_t end;
+    idio_tvector_range (tv, args, &start, &end, "tvector-slice");
+
+    int kind = IDIO_TVECTOR_KIND (tv);
+    size_t width = idio_tvector_widths[kind];
+
+    IDIO r = idio_tvector (kind, end - start);
+
+    if (end > start) {
+	memcpy (IDIO_TVECTOR_DATA (r), (char *) IDIO_TVECTOR_DATA (tv) + start * width, (end - start) * width);
+    }
+
+    return r;
+}
+
+IDIO_DEFINE_PRIMITIVE3V_DS ("tvector-copy!", tvector_copy, (IDIO dst, IDIO at, IDIO src, IDIO args), "dst at src [start [end]]", "\
+copy the elements of tvector `src` from `start`	\n\
+up to `end` into tvector `dst` at index `at`	\n\
+						\n\
+:param dst: tvector				\n\
+:type dst: tvector				\n\
+:param at: index into `dst`			\n\
+:type at: integer				\n\
+:param src: tvector of the same type as `dst`	\n\
+:type src: tvector				\n\
+:param start: first index, defaults to 0	\n\
+:type start: integer, optional			\n\
+:param end: index after the last, defaults to the length of `src`	\n\
+:type end: integer, optional			\n\
+:return: ``#<unspec>``				\n\
+						\n\
+`src` and `dst` may be the same tvector and	\n\
+the ranges may overlap.				\n\
+")
+{
+    IDIO_ASSERT (dst);
+    IDIO_ASSERT (at);
+    IDIO_ASSERT (src);
+    IDIO_ASSERT (args);
+
+    /*
+     * Test Case: tvector-errors/tvector-copy-bad-dst-type.idio
+     *
+     * tvector-copy! #t 0 (make-tvector 'u8 3)
+     */
+    IDIO_USER_TYPE_ASSERT (tvector, dst);
+    /*
+     * Test Case: tvector-errors/tvector-copy-bad-src-type.idio
+     *
+     * tvector-copy! (make-tvector 'u8 3) 0 #t
+     */
+    IDIO_USER_TYPE_ASSERT (tvector, src);
+    /*
+     * Test Case: n/a
+     *
+     * args is the varargs parameter -- should always be a list
+     */
+    IDIO_USER_TYPE_ASSERT (list, args);
+
+    if (IDIO_TVECTOR_KIND (dst) != IDIO_TVECTOR_KIND (src)) {
+	/*
+	 * Test Case: tvector-errors/tvector-copy-mismatched-types.idio
+	 *
+	 * tvector-copy! (make-tvector 'u8 3) 0 (make-tvector 's32 3)
+	 */
+	idio_error_param_value_msg_only ("tvector-copy!", "src", "element type differs from dst", IDIO_C_FUNC_LOCATION ());
+
+	return idio_S_notreached;
+    }
+
+    size_t start;
+    size_t end;
+    idio_tvector_range (src, args, &start, &end, "tvector-copy!");
+
+    ptrdiff_t C_at = idio_tvector_C_index (at);
+    if (C_at < 0 ||
+	(size_t) C_at + (end - start) > IDIO_TVECTOR_LEN (dst)) {
+	/*
+	 * Test Case: tvector-errors/tvector-copy-overflow.idio
+	 *
+	 * tvector-copy! (make-tvector 'u8 3) 2 (make-tvector 'u8 3)
+	 */
+	idio_error_param_value_msg ("tvector-copy!", "at", at, "the elements do not fit in dst", IDIO_C_FUNC_LOCATION ());
+
+	return idio_S_notreached;
+    }
+
+    size_t width = idio_tvector_widths[IDIO_TVECTOR_KIND (dst)];
+
+    if (end > start) {
+	memmove ((char *) IDIO_TVECTOR_DATA (dst) + C_at * width,
+		 (char *) IDIO_TVECTOR_DATA (src) + start * width,
+		 (end - start) * width);
+    }
+
+    return idio_S_unspec;
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("tvector->array", tvector2array, (IDIO tv), "tv", "\
+return an array of the elements of tvector `tv`	\n\
+						\n\
+:param tv: tvector				\n\
+:type tv: tvector				\n\
+:rtype: array					\n\
+")
+{
+    IDIO_ASSERT (tv);
+
+    /*
+     * Test Case: tvector-errors/tvector2array-bad-type.idio
+     *
+     * tvector->array #t
+     */
+    IDIO_USER_TYPE_ASSERT (tvector, tv);
+
+    size_t len = IDIO_TVECTOR_LEN (tv);
+    IDIO a = idio_array (len);
+
+    size_t i;
+    for (i = 0; i < len; i++) {
+	idio_array_push (a, idio_tvector_ref_C (tv, i));
+    }
+
+    return a;
+}
+
+IDIO_DEFINE_PRIMITIVE2_DS ("array->tvector", array2tvector, (IDIO type, IDIO a), "type a", "\
+return a tvector of `type` with the elements of	\n\
+array `a`					\n\
+						\n\
+:param type: element type			\n\
+:type type: symbol, one of ``u8``, ``s32``, ``s64``, ``f32`` or ``f64``	\n\
+:param a: array of numbers			\n\
+:type a: array					\n\
+:rtype: tvector					\n\
+")
+{
+    IDIO_ASSERT (type);
+    IDIO_ASSERT (a);
+
+    /*
+     * Test Case: tvector-errors/array2tvector-bad-type-type.idio
+     *
+     * array->tvector #t #[]
+     */
+    IDIO_USER_TYPE_ASSERT (symbol, type);
+    /*
+     * Test Case: tvector-errors/array2tvector-bad-array-type.idio
+     *
+     * array->tvector 'u8 #t
+     */
+    IDIO_USER_TYPE_ASSERT (array, a);
+
+    int kind = idio_tvector_kind (type, "array->tvector");
+
+    size_t len = IDIO_ARRAY_USIZE (a);
+    IDIO tv = idio_tvector (kind, len);
+
+    size_t i;
+    for (i = 0; i < len; i++) {
+	idio_tvector_set_C (tv, i, IDIO_ARRAY_AE (a, i), "array->tvector");
+    }
+
+    return tv;
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("tvector->octet-string", tvector2octet_string, (IDIO tv), "tv", "\
+return an octet string of the bytes of tvector	\n\
+`tv` in the machine's byte order		\n\
+						\n\
+:param tv: tvector				\n\
+:type tv: tvector				\n\
+:rtype: octet string				\n\
+")
+{
+    IDIO_ASSERT (tv);
+
+    /*
+     * Test Case: tvector-errors/tvector2octet-string-bad-type.idio
+     *
+     * tvector->octet-string #t
+     */
+    IDIO_USER_TYPE_ASSERT (tvector, tv);
+
+    return idio_octet_string_C_len (IDIO_TVECTOR_DATA (tv), IDIO_TVECTOR_LEN (tv) * idio_tvector_widths[IDIO_TVECTOR_KIND (tv)]);
+}
+
+IDIO_DEFINE_PRIMITIVE2_DS ("octet-string->tvector", octet_string2tvector, (IDIO type, IDIO os), "type os", "\
+return a tvector of `type` from the bytes of	\n\
+octet string `os` in the machine's byte order	\n\
+						\n\
+:param type: element type			\n\
+:type type: symbol, one of ``u8``, ``s32``, ``s64``, ``f32`` or ``f64``	\n\
+:param os: octet string				\n\
+:type os: octet string				\n\
+:rtype: tvector					\n\
+")
+{
+    IDIO_ASSERT (type);
+    IDIO_ASSERT (os);
+
+    /*
+     * Test Case: tvector-errors/octet-string2tvector-bad-type-type.idio
+     *
+     * octet-string->tvector #t ""
+     */
+    IDIO_USER_TYPE_ASSERT (symbol, type);
+    /*
+     * Test Case: tvector-errors/octet-string2tvector-bad-os-type.idio
+     *
+     * octet-string->tvector 'u8 #t
+     */
+    IDIO_USER_TYPE_ASSERT (octet_string, os);
+
+    int kind = idio_tvector_kind (type, "octet-string->tvector");
+    size_t width = idio_tvector_widths[kind];
+
+    char *s;
+    size_t blen;
+    if (idio_isa_substring (os)) {
+	s = IDIO_SUBSTRING_S (os);
+	blen = IDIO_SUBSTRING_LEN (os);
+    } else {
+	s = IDIO_STRING_S (os);
+	blen = IDIO_STRING_LEN (os);
+    }
+
+    if (blen % width) {
+	/*
+	 * Test Case: tvector-errors/octet-string2tvector-bad-length.idio
+	 *
+	 * octet-string->tvector 's32 (tvector->octet-string (make-tvector 'u8 3))
+	 */
+	char em[BUFSIZ];
+	idio_snprintf (em, BUFSIZ, "length %zu is not a multiple of %zu", blen, width);
+	idio_error_param_value_msg_only ("octet-string->tvector", "os", em, IDIO_C_FUNC_LOCATION ());
+
+	return idio_S_notreached;
+    }
+
+    IDIO tv = idio_tvector (kind, blen / width);
+
+    if (blen) {
+	memcpy (IDIO_TVECTOR_DATA (tv), s, blen);
+    }
+
+    return tv;
+}
+
+/*
+ * The numeric kernels below are written as simple loops over the C
+ * arrays, with restrict-qualified pointers and, for the floating
+ * point reductions, several independent accumulators, so that the
+ * compiler can vectorise them.
+ */
+
+/*
+ * Integer sums are exact.  They are accumulated in an int64_t and
+ * only if that would overflow is the running total moved into a
+ * bignum.
+ */
+typedef struct idio_tvector_isum_s {
+    int64_t acc;
+    IDIO big;
+} idio_tvector_isum_t;
+
+static void idio_tvector_isum_flush (idio_tvector_isum_t *sp, IDIO bn)
+{
+    if (idio_S_nil == sp->big) {
+	sp->big = bn;
+    } else {
+	sp->big = idio_bignum_add (sp->big, bn);
+    }
+}
+
+static void idio_tvector_isum_add (idio_tvector_isum_t *sp, int64_t const x)
+{
+    if ((x > 0 && sp->acc > INT64_MAX - x) ||
+	(x < 0 && sp->acc < INT64_MIN - x)) {
+	idio_tvector_isum_flush (sp, idio_bignum_integer_intmax_t (sp->acc));
+	sp->acc = 0;
+    }
+
+    sp->acc += x;
+}
+
+static IDIO idio_tvector_isum_value (idio_tvector_isum_t *sp)
+{
+    if (idio_S_nil == sp->big) {
+	return idio_integer (sp->acc);
+    }
+
+    idio_tvector_isum_flush (sp, idio_bignum_integer_intmax_t (sp->acc));
+
+    return idio_bignum_to_fixnum (sp->big);
+}
+
+/*
+ * A block of s32 elements small enough that its sum cannot overflow
+ * an int64_t
+ */
+#define IDIO_TVECTOR_S32_BLOCK	(1UL << 31)
+
+static double idio_tvector_sum_f64 (double const * restrict a, size_t const len)
+{
+    double s0 = 0;
+    double s1 = 0;
+    double s2 = 0;
+    double s3 = 0;
+
+    size_t i;
+    for (i = 0; i + 4 <= len; i += 4) {
+	s0 += a[i];
+	s1 += a[i + 1];
+	s2 += a[i + 2];
+	s3 += a[i + 3];
+    }
+    for (; i < len; i++) {
+	s0 += a[i];
+    }
+
+    return (s0 + s1) + (s2 + s3);
+}
+
+static double idio_tvector_sum_f32 (float const * restrict a, size_t const len)
+{
+    double s0 = 0;
+    double s1 = 0;
+    double s2 = 0;
+    double s3 = 0;
+
+    size_t i;
+    for (i = 0; i + 4 <= len; i += 4) {
+	s0 += a[i];
+	s1 += a[i + 1];
+	s2 += a[i + 2];
+	s3 += a[i + 3];
+    }
+    for (; i < len; i++) {
+	s0 += a[i];
+    }
+
+    return (s0 + s1) + (s2 + s3);
+}
+
+/*
+ * idio_tvector_sum() returns the sum of the elements of tv: an
+ * integer for the integer kinds and a C double otherwise.  *dp is set
+ * for the floating point kinds.
+ */
+static IDIO idio_tvector_sum (IDIO tv, double *dp)
+{
+    IDIO_ASSERT (tv);
+    IDIO_TYPE_ASSERT (tvector, tv);
+
+    size_t len = IDIO_TVECTOR_LEN (tv);
+    size_t i;
+
+    switch (IDIO_TVECTOR_KIND (tv)) {
+    case IDIO_TVECTOR_KIND_U8:
+	{
+	    uint8_t const * restrict a = IDIO_TVECTOR_U8 (tv);
+	    uint64_t s = 0;
+	    for (i = 0; i < len; i++) {
+		s += a[i];
+	    }
+	    return idio_uinteger (s);
+	}
+    case IDIO_TVECTOR_KIND_S32:
+	{
+	    int32_t const * restrict a = IDIO_TVECTOR_S32 (tv);
+	    idio_tvector_isum_t is = { 0, idio_S_nil };
+	    size_t b;
+	    for (b = 0; b < len; b += IDIO_TVECTOR_S32_BLOCK) {
+		size_t e = len - b < IDIO_TVECTOR_S32_BLOCK ? len : b + IDIO_TVECTOR_S32_BLOCK;
+		int64_t s = 0;
+		for (i = b; i < e; i++) {
+		    s += a[i];
+		}
+		idio_tvector_isum_add (&is, s);
+	    }
+	    return idio_tvector_isum_value (&is);
+	}
+    case IDIO_TVECTOR_KIND_S64:
+	{
+	    int64_t const * restrict a = IDIO_TVECTOR_S64 (tv);
+	    idio_tvector_isum_t is = { 0, idio_S_nil };
+	    for (i = 0; i < len; i++) {
+		idio_tvector_isum_add (&is, a[i]);
+	    }
+	    return idio_tvector_isum_value (&is);
+	}
+    case IDIO_TVECTOR_KIND_F32:
+	*dp = idio_tvector_sum_f32 (IDIO_TVECTOR_F32 (tv), len);
+	return idio_C_double (*dp);
+    case IDIO_TVECTOR_KIND_F64:
+	*dp = idio_tvector_sum_f64 (IDIO_TVECTOR_F64 (tv), len);
+	return idio_C_double (*dp);
+    }
+
+    return idio_S_notreached;
+}
+
+static void idio_tvector_empty_error (char const *func, IDIO c_location)
+{
+    IDIO_C_ASSERT (func);
+    IDIO_ASSERT (c_location);
+
+    idio_error_param_value_msg_only (func, "tv", "is empty", c_location);
+}
+
+static void idio_tvector_match_error (char const *func, IDIO c_location)
+{
+    IDIO_C_ASSERT (func);
+    IDIO_ASSERT (c_location);
+
+    idio_error_param_value_msg_only (func, "tv2", "element type or length differs from tv1", c_location);
+}
+
+static IDIO idio_tvector_box (int const kind, idio_tvector_elem_t *ep)
+{
+    switch (kind) {
+    case IDIO_TVECTOR_KIND_U8:	return idio_fixnum (ep->u8);
+    case IDIO_TVECTOR_KIND_S32:	return idio_fixnum (ep->s32);
+    case IDIO_TVECTOR_KIND_S64:	return idio_integer (ep->s64);
+    case IDIO_TVECTOR_KIND_F32:	return idio_C_float (ep->f32);
+    case IDIO_TVECTOR_KIND_F64:	return idio_C_double (ep->f64);
+    }
+
+    return idio_S_notreached;
+}
+
+#define IDIO_TVECTOR_MINMAX(T,M,OP)				\
+    {								\
+	T const * restrict a = (T const *) IDIO_TVECTOR_DATA (tv);	\
+	T m = a[0];						\
+	for (i = 1; i < len; i++) {				\
+	    m = a[i] OP m ? a[i] : m;				\
+	}							\
+	e.M = m;						\
+    }
+
+static IDIO idio_tvector_minmax (IDIO tv, int const max, char const *func)
+{
+    IDIO_ASSERT (tv);
+    IDIO_TYPE_ASSERT (tvector, tv);
+
+    size_t len = IDIO_TVECTOR_LEN (tv);
+
+    if (0 == len) {
+	/*
+	 * Test Case: tvector-errors/tvector-min-empty.idio
+	 *
+	 * tvector-min (make-tvector 'u8 0)
+	 */
+	idio_tvector_empty_error (func, IDIO_C_FUNC_LOCATION ());
+
+	return idio_S_notreached;
+    }
+
+    idio_tvector_elem_t e;
+    size_t i;
+
+    if (max) {
+	switch (IDIO_TVECTOR_KIND (tv)) {
+	case IDIO_TVECTOR_KIND_U8:	IDIO_TVECTOR_MINMAX (uint8_t, u8, >);	break;
+	case IDIO_TVECTOR_KIND_S32:	IDIO_TVECTOR_MINMAX (int32_t, s32, >);	break;
+	case IDIO_TVECTOR_KIND_S64:	IDIO_TVECTOR_MINMAX (int64_t, s64, >);	break;
+	case IDIO_TVECTOR_KIND_F32:	IDIO_TVECTOR_MINMAX (float, f32, >);	break;
+	case IDIO_TVECTOR_KIND_F64:	IDIO_TVECTOR_MINMAX (double, f64, >);	break;
+	}
+    } else {
+	switch (IDIO_TVECTOR_KIND (tv)) {
+	case IDIO_TVECTOR_KIND_U8:	IDIO_TVECTOR_MINMAX (uint8_t, u8, <);	break;
+	case IDIO_TVECTOR_KIND_S32:	IDIO_TVECTOR_MINMAX (int32_t, s32, <);	break;
+	case IDIO_TVECTOR_KIND_S64:	IDIO_TVECTOR_MINMAX (int64_t, s64, <);	break;
+	case IDIO_TVECTOR_KIND_F32:	IDIO_TVECTOR_MINMAX (float, f32, <);	break;
+	case IDIO_TVECTOR_KIND_F64:	IDIO_TVECTOR_MINMAX (double, f64, <);	break;
+	}
+    }
+
+    return idio_tvector_box (IDIO_TVECTOR_KIND (tv), &e);
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("tvector-sum", tvector_sum, (IDIO tv), "tv", "\
+return the sum of the elements of tvector `tv`	\n\
+						\n\
+:param tv: tvector				\n\
+:type tv: tvector				\n\
+:return: the sum				\n\
+:rtype: integer for integer tvectors, ``C/double`` otherwise	\n\
+						\n\
+The sum of an integer tvector is exact.		\n\
+")
+{
+    IDIO_ASSERT (tv);
+
+    /*
+     * Test Case: tvector-errors/tvector-sum-bad-type.idio
+     *
+     * tvector-sum #t
+     */
+    IDIO_USER_TYPE_ASSERT (tvector, tv);
+
+    double d;
+
+    return idio_tvector_sum (tv, &d);
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("tvector-mean", tvector_mean, (IDIO tv), "tv", "\
+return the mean of the elements of tvector `tv`	\n\
+						\n\
+:param tv: tvector				\n\
+:type tv: tvector				\n\
+:rtype: ``C/double``				\n\
+")
+{
+    IDIO_ASSERT (tv);
+
+    /*
+     * Test Case: tvector-errors/tvector-mean-bad-type.idio
+     *
+     * tvector-mean #t
+     */
+    IDIO_USER_TYPE_ASSERT (tvector, tv);
+
+    size_t len = IDIO_TVECTOR_LEN (tv);
+
+    if (0 == len) {
+	/*
+	 * Test Case: tvector-errors/tvector-mean-empty.idio
+	 *
+	 * tvector-mean (make-tvector 'f64 0)
+	 */
+	idio_tvector_empty_error ("tvector-mean", IDIO_C_FUNC_LOCATION ());
+
+	return idio_S_notreached;
+    }
+
+    double d = 0;
+    IDIO s = idio_tvector_sum (tv, &d);
+
+    switch (IDIO_TVECTOR_KIND (tv)) {
+    case IDIO_TVECTOR_KIND_U8:
+    case IDIO_TVECTOR_KIND_S32:
+    case IDIO_TVECTOR_KIND_S64:
+	if (idio_isa_fixnum (s)) {
+	    d = IDIO_FIXNUM_VAL (s);
+	} else {
+	    d = idio_bignum_double_value (s);
+	}
+	break;
+    }
+
+    return idio_C_double (d / len);
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("tvector-min", tvector_min, (IDIO tv), "tv", "\
+return the smallest element of tvector `tv`	\n\
+						\n\
+:param tv: tvector				\n\
+:type tv: tvector				\n\
+:return: the element as an integer, ``C/float`` or ``C/double``	\n\
+")
+{
+    IDIO_ASSERT (tv);
+
+    /*
+     * Test Case: tvector-errors/tvector-min-bad-type.idio
+     *
+     * tvector-min #t
+     */
+    IDIO_USER_TYPE_ASSERT (tvector, tv);
+
+    return idio_tvector_minmax (tv, 0, "tvector-min");
+}
+
+IDIO_DEFINE_PRIMITIVE1_DS ("tvector-max", tvector_max, (IDIO tv), "tv", "\
+return the largest element of tvector `tv`	\n\
+						\n\
+:param tv: tvector				\n\
+:type tv: tvector				\n\
+:return: the element as an integer, ``C/float`` or ``C/double``	\n\
+")
+{
+    IDIO_ASSERT (tv);
+
+    /*
+     * Test Case: tvector-errors/tvector-max-bad-type.idio
+     *
+     * tvector-max #t
+     */
+    IDIO_USER_TYPE_ASSERT (tvector, tv);
+
+    return idio_tvector_minmax (tv, 1, "tvector-max");
+}
+
+IDIO_DEFINE_PRIMITIVE2_DS ("tvector-dot", tvector_dot, (IDIO tv1, IDIO tv2), "tv1 tv2", "\
+return the dot product of tvectors `tv1` and `tv2`	\n\
+						\n\
+:param tv1: tvector				\n\
+:type tv1: tvector				\n\
+:param tv2: tvector of the same type and length as `tv1`	\n\
+:type tv2: tvector				\n\
+:return: the dot product			\n\
+:rtype: integer for integer tvectors, ``C/double`` otherwise	\n\
+						\n\
+The dot product of integer tvectors is exact.	\n\
+")
+{
+    IDIO_ASSERT (tv1);
+    IDIO_ASSERT (tv2);
+
+    /*
+     * Test Case: tvector-errors/tvector-dot-bad-tv1-type.idio
+     *
+     * tvector-dot #t (make-tvector 'u8 1)
+     */
+    IDIO_USER_TYPE_ASSERT (tvector, tv1);
+    /*
+     * Test Case: tvector-errors/tvector-dot-bad-tv2-type.idio
+     *
+     * tvector-dot (make-tvector 'u8 1) #t
+     */
+    IDIO_USER_TYPE_ASSERT (tvector, tv2);
+
+    if (IDIO_TVECTOR_KIND (tv1) != IDIO_TVECTOR_KIND (tv2) ||
+	IDIO_TVECTOR_LEN (tv1) != IDIO_TVECTOR_LEN (tv2)) {
+	/*
+	 * Test Case: tvector-errors/tvector-dot-mismatched.idio
+	 *
+	 * tvector-dot (make-tvector 'u8 1) (make-tvector 'u8 2)
+	 */
+	idio_tvector_match_error ("tvector-dot", IDIO_C_FUNC_LOCATION ());
+
+	return idio_S_notreached;
+    }
+
+    size_t len = IDIO_TVECTOR_LEN (tv1);
+    size_t i;
+
+    switch (IDIO_TVECTOR_KIND (tv1)) {
+    case IDIO_TVECTOR_KIND_U8:
+	{
+	    uint8_t const * restrict a = IDIO_TVECTOR_U8 (tv1);
+	    uint8_t const * restrict b = IDIO_TVECTOR_U8 (tv2);
+	    uint64_t s = 0;
+	    for (i = 0; i < len; i++) {
+		s += (uint32_t) a[i] * b[i];
+	    }
+	    return idio_uinteger (s);
+	}
+    case IDIO_TVECTOR_KIND_S32:
+	{
+	    int32_t const * restrict a = IDIO_TVECTOR_S32 (tv1);
+	    int32_t const * restrict b = IDIO_TVECTOR_S32 (tv2);
+	    idio_tvector_isum_t is = { 0, idio_S_nil };
+	    for (i = 0; i < len; i++) {
+		idio_tvector_isum_add (&is, (int64_t) a[i] * b[i]);
+	    }
+	    return idio_tvector_isum_value (&is);
+	}
+    case IDIO_TVECTOR_KIND_S64:
+	{
+	    int64_t const * restrict a = IDIO_TVECTOR_S64 (tv1);
+	    int64_t const * restrict b = IDIO_TVECTOR_S64 (tv2);
+	    idio_tvector_isum_t is = { 0, idio_S_nil };
+	    for (i = 0; i < len; i++) {
+		if (a[i] < INT32_MIN || a[i] > INT32_MAX ||
+		    b[i] < INT32_MIN || b[i] > INT32_MAX) {
+		    /*
+		     * The product might not fit in an int64_t
+		     */
+		    idio_tvector_isum_flush (&is, idio_bignum_multiply (idio_bignum_integer_intmax_t (a[i]),
+									idio_bignum_integer_intmax_t (b[i])));
+		} else {
+		    idio_tvector_isum_add (&is, a[i] * b[i]);
+		}
+	    }
+	    return idio_tvector_isum_value (&is);
+	}
+    case IDIO_TVECTOR_KIND_F32:
+	{
+	    float const * restrict a = IDIO_TVECTOR_F32 (tv1);
+	    float const * restrict b = IDIO_TVECTOR_F32 (tv2);
+	    double s0 = 0;
+	    double s1 = 0;
+	    for (i = 0; i + 2 <= len; i += 2) {
+		s0 += (double) a[i] * b[i];
+		s1 += (double) a[i + 1] * b[i + 1];
+	    }
+	    for (; i < len; i++) {
+		s0 += (double) a[i] * b[i];
+	    }
+	    return idio_C_double (s0 + s1);
+	}
+    case IDIO_TVECTOR_KIND_F64:
+	{
+	    double const * restrict a = IDIO_TVECTOR_F64 (tv1);
+	    double const * restrict b = IDIO_TVECTOR_F64 (tv2);
+	    double s0 = 0;
+	    double s1 = 0;
+	    double s2 = 0;
+	    double s3 = 0;
+	    for (i = 0; i + 4 <= len; i += 4) {
+		s0 += a[i] * b[i];
+		s1 += a[i + 1] * b[i + 1];
+		s2 += a[i + 2] * b[i + 2];
+		s3 += a[i + 3] * b[i + 3];
+	    }
+	    for (; i < len; i++) {
+		s0 += a[i] * b[i];
+	    }
+	    return idio_C_double ((s0 + s1) + (s2 + s3));
+	}
+    }
+
+    return idio_S_notreached;
+}
+
+/*
+ * Element-wise integer arithmetic wraps around, as C unsigned
+ * arithmetic does, so it is performed on the unsigned type, UT.
+ */
+#define IDIO_TVECTOR_ELEMENTWISE(T,UT,OP)				\
+    {									\
+	T const * restrict a = (T const *) IDIO_TVECTOR_DATA (tv1);	\
+	T const * restrict b = (T const *) IDIO_TVECTOR_DATA (tv2);	\
+	T * restrict c = (T *) IDIO_TVECTOR_DATA (r);			\
+	for (i = 0; i < len; i++) {					\
+	    c[i] = (T) ((UT) a[i] OP (UT) b[i]);			\
+	}								\
+    }
+
+static IDIO idio_tvector_elementwise (IDIO tv1, IDIO tv2, int const multiply, char const *func)
+{
+    IDIO_ASSERT (tv1);
+    IDIO_ASSERT (tv2);
+    IDIO_TYPE_ASSERT (tvector, tv1);
+    IDIO_TYPE_ASSERT (tvector, tv2);
+
+    if (IDIO_TVECTOR_KIND (tv1) != IDIO_TVECTOR_KIND (tv2) ||
+	IDIO_TVECTOR_LEN (tv1) != IDIO_TVECTOR_LEN (tv2)) {
+	/*
+	 * Test Case: tvector-errors/tvector-add-mismatched.idio
+	 *
+	 * tvector-add (make-tvector 'u8 1) (make-tvector 's32 1)
+	 */
+	idio_tvector_match_error (func, IDIO_C_FUNC_LOCATION ());
+
+	return idio_S_notreached;
+    }
+
+    size_t len = IDIO_TVECTOR_LEN (tv1);
+    IDIO r = idio_tvector (IDIO_TVECTOR_KIND (tv1), len);
+    size_t i;
+
+    if (multiply) {
+	switch (IDIO_TVECTOR_KIND (tv1)) {
+	case IDIO_TVECTOR_KIND_U8:	IDIO_TVECTOR_ELEMENTWISE (uint8_t, uint32_t, *);	break;
+	case IDIO_TVECTOR_KIND_S32:	IDIO_TVECTOR_ELEMENTWISE (int32_t, uint32_t, *);	break;
+	case IDIO_TVECTOR_KIND_S64:	IDIO_TVECTOR_ELEMENTWISE (int64_t, uint64_t, *);	break;
+	case IDIO_TVECTOR_KIND_F32:	IDIO_TVECTOR_ELEMENTWISE (float, float, *);		break;
+	case IDIO_TVECTOR_KIND_F64:	IDIO_TVECTOR_ELEMENTWISE (double, double, *);		break;
+	}
+    } else {
+	switch (IDIO_TVECTOR_KIND (tv1)) {
+	case IDIO_TVECTOR_KIND_U8:	IDIO_TVECTOR_ELEMENTWISE (uint8_t, uint32_t, +);	break;
+	case IDIO_TVECTOR_KIND_S32:	IDIO_TVECTOR_ELEMENTWISE (int32_t, uint32_t, +);	break;
+	case IDIO_TVECTOR_KIND_S64:	IDIO_TVECTOR_ELEMENTWISE (int64_t, uint64_t, +);	break;
+	case IDIO_TVECTOR_KIND_F32:	IDIO_TVECTOR_ELEMENTWISE (float, float, +);		break;
+	case IDIO_TVECTOR_KIND_F64:	IDIO_TVECTOR_ELEMENTWISE (double, double, +);		break;
+	}
+    }
+
+    return r;
+}
+
+IDIO_DEFINE_PRIMITIVE2_DS ("tvector-add", tvector_add, (IDIO tv1, IDIO tv2), "tv1 tv2", "\
+return a tvector of the element-wise sum of	\n\
+tvectors `tv1` and `tv2`			\n\
+						\n\
+:param tv1: tvector				\n\
+:type tv1: tvector				\n\
+:param tv2: tvector of the same type and length as `tv1`	\n\
+:type tv2: tvector				\n\
+:rtype: tvector					\n\
+						\n\
+Integer elements wrap around on overflow.	\n\
+")
+{
+    IDIO_ASSERT (tv1);
+    IDIO_ASSERT (tv2);
+
+    /*
+     * Test Case: tvector-errors/tvector-add-bad-tv1-type.idio
+     *
+     * tvector-add #t (make-tvector 'u8 1)
+     */
+    IDIO_USER_TYPE_ASSERT (tvector, tv1);
+    /*
+     * Test Case: tvector-errors/tvector-add-bad-tv2-type.idio
+     *
+     * tvector-add (make-tvector 'u8 1) #t
+     */
+    IDIO_USER_TYPE_ASSERT (tvector, tv2);
+
+    return idio_tvector_elementwise (tv1, tv2, 0, "tvector-add");
+}
+
+IDIO_DEFINE_PRIMITIVE2_DS ("tvector-multiply", tvector_multiply, (IDIO tv1, IDIO tv2), "tv1 tv2", "\
+return a tvector of the element-wise product of	\n\
+tvectors `tv1` and `tv2`			\n\
+						\n\
+:param tv1: tvector				\n\
+:type tv1: tvector				\n\
+:param tv2: tvector of the same type and length as `tv1`	\n\
+:type tv2: tvector				\n\
+:rtype: tvector					\n\
+						\n\
+Integer elements wrap around on overflow.	\n\
+")
+{
+    IDIO_ASSERT (tv1);
+    IDIO_ASSERT (tv2);
+
+    /*
+     * Test Case: tvector-errors/tvector-multiply-bad-tv1-type.idio
+     *
+     * tvector-multiply #t (make-tvector 'u8 1)
+     */
+    IDIO_USER_TYPE_ASSERT (tvector, tv1);
+    /*
+     * Test Case: tvector-errors/tvector-multiply-bad-tv2-type.idio
+     *
+     * tvector-multiply (make-tvector 'u8 1) #t
+     */
+    IDIO_USER_TYPE_ASSERT (tvector, tv2);
+
+    return idio_tvector_elementwise (tv1, tv2, 1, "tvector-multiply");
+}
+
+#define IDIO_TVECTOR_SCALE(T,UT,K)					\
+    {									\
+	T const * restrict a = (T const *) IDIO_TVECTOR_DATA (tv);	\
+	T * restrict c = (T *) IDIO_TVECTOR_DATA (r);			\
+	UT k = (UT) (K);						\
+	for (i = 0; i < len; i++) {					\
+	    c[i] = (T) ((UT) a[i] * k);					\
+	}								\
+    }
+
+IDIO_DEFINE_PRIMITIVE2_DS ("tvector-scale", tvector_scale, (IDIO tv, IDIO k), "tv k", "\
+return a tvector of the elements of tvector `tv`	\n\
+multiplied by `k`				\n\
+						\n\
+:param tv: tvector				\n\
+:type tv: tvector				\n\
+:param k: factor				\n\
+:type k: integer for integer tvectors or a number, ``C/float`` or ``C/double``	\n\
+:rtype: tvector					\n\
+						\n\
+Integer elements wrap around on overflow.	\n\
+")
+{
+    IDIO_ASSERT (tv);
+    IDIO_ASSERT (k);
+
+    /*
+     * Test Case: tvector-errors/tvector-scale-bad-type.idio
+     *
+     * tvector-scale #t 1
+     */
+    IDIO_USER_TYPE_ASSERT (tvector, tv);
+
+    size_t len = IDIO_TVECTOR_LEN (tv);
+    IDIO r;
+    size_t i;
+
+    switch (IDIO_TVECTOR_KIND (tv)) {
+    case IDIO_TVECTOR_KIND_F32:
+	{
+	    double d = idio_tvector_double_value (k, "tvector-scale", "k");
+	    r = idio_tvector (IDIO_TVECTOR_KIND (tv), len);
+	    IDIO_TVECTOR_SCALE (float, float, d);
+	}
+	break;
+    case IDIO_TVECTOR_KIND_F64:
+	{
+	    double d = idio_tvector_double_value (k, "tvector-scale", "k");
+	    r = idio_tvector (IDIO_TVECTOR_KIND (tv), len);
+	    IDIO_TVECTOR_SCALE (double, double, d);
+	}
+	break;
+    default:
+	{
+	    /*
+	     * Test Case: tvector-errors/tvector-scale-float.idio
+	     *
+	     * tvector-scale (make-tvector 'u8 1) 1.5
+	     */
+	    intmax_t ik = idio_tvector_integer_value (k, "tvector-scale", "k");
+	    r = idio_tvector (IDIO_TVECTOR_KIND (tv), len);
+	    switch (IDIO_TVECTOR_KIND (tv)) {
+	    case IDIO_TVECTOR_KIND_U8:	IDIO_TVECTOR_SCALE (uint8_t, uint32_t, ik);	break;
+	    case IDIO_TVECTOR_KIND_S32:	IDIO_TVECTOR_SCALE (int32_t, uint32_t, ik);	break;
+	    case IDIO_TVECTOR_KIND_S64:	IDIO_TVECTOR_SCALE (int64_t, uint64_t, ik);	break;
+	    }
+	}
+	break;
+    }
+
+    return r;
+}
+
+#define IDIO_TVECTOR_COMPARE_LT	0
+#define IDIO_TVECTOR_COMPARE_LE	1
+#define IDIO_TVECTOR_COMPARE_EQ	2
+#define IDIO_TVECTOR_COMPARE_GE	3
+#define IDIO_TVECTOR_COMPARE_GT	4
+
+#define IDIO_TVECTOR_COMPARE_LOOP(T,X,OP)				\
+    {									\
+	T const * restrict a = (T const *) IDIO_TVECTOR_DATA (tv);	\
+	for (i = 0; i < len; i++) {					\
+	    w[i / IDIO_BITSET_BITS_PER_WORD] |= (idio_bitset_word_t) (a[i] OP X) << (i % IDIO_BITSET_BITS_PER_WORD); \
+	}								\
+    }
+
+#define IDIO_TVECTOR_COMPARE(OP)					\
+    switch (IDIO_TVECTOR_KIND (tv)) {					\
+    case IDIO_TVECTOR_KIND_U8:	IDIO_TVECTOR_COMPARE_LOOP (uint8_t, ix, OP);	break; \
+    case IDIO_TVECTOR_KIND_S32:	IDIO_TVECTOR_COMPARE_LOOP (int32_t, ix, OP);	break; \
+    case IDIO_TVECTOR_KIND_S64:	IDIO_TVECTOR_COMPARE_LOOP (int64_t, ix, OP);	break; \
+    case IDIO_TVECTOR_KIND_F32:	IDIO_TVECTOR_COMPARE_LOOP (float, dx, OP);	break; \
+    case IDIO_TVECTOR_KIND_F64:	IDIO_TVECTOR_COMPARE_LOOP (double, dx, OP);	break; \
+    }
+
+/*
+ * idio_tvector_compare() returns a bitset with bit i set if element
+ * i of tv compares to x according to op.  Integer tvectors compare
+ * with an integer x.
+ */
+static IDIO idio_tvector_compare (IDIO tv, IDIO x, int const op, char const *func)
+{
+    IDIO_ASSERT (tv);
+    IDIO_ASSERT (x);
+    IDIO_C_ASSERT (func);
+    IDIO_TYPE_ASSERT (tvector, tv);
+
+    int64_t ix = 0;
+    double dx = 0;
+
+    switch (IDIO_TVECTOR_KIND (tv)) {
+    case IDIO_TVECTOR_KIND_F32:
+    case IDIO_TVECTOR_KIND_F64:
+	dx = idio_tvector_double_value (x, func, "x");
+	break;
+    default:
+	/*
+	 * Test Case: tvector-errors/tvector-lt-float.idio
+	 *
+	 * tvector-lt (make-tvector 'u8 1) 1.5
+	 */
+	ix = idio_tvector_integer_value (x, func, "x");
+	break;
+    }
+
+    size_t len = IDIO_TVECTOR_LEN (tv);
+    IDIO bs = idio_bitset (len);
+
+    if (0 == len) {
+	return bs;
+    }
+
+    idio_bitset_word_t * restrict w = &IDIO_BITSET_WORDS (bs, 0);
+    size_t i;
+
+    switch (op) {
+    case IDIO_TVECTOR_COMPARE_LT:	IDIO_TVECTOR_COMPARE (<);	break;
+    case IDIO_TVECTOR_COMPARE_LE:	IDIO_TVECTOR_COMPARE (<=);	break;
+    case IDIO_TVECTOR_COMPARE_EQ:	IDIO_TVECTOR_COMPARE (==);	break;
+    case IDIO_TVECTOR_COMPARE_GE:	IDIO_TVECTOR_COMPARE (>=);	break;
+    case IDIO_TVECTOR_COMPARE_GT:	IDIO_TVECTOR_COMPARE (>);	break;
+    }
+
+    return bs;
+}
+
+IDIO_DEFINE_PRIMITIVE2_DS ("tvector-lt", tvector_lt, (IDIO tv, IDIO x), "tv x", "\
+return a bitset of the elements of tvector `tv`	\n\
+less than `x`					\n\
+						\n\
+:param tv: tvector				\n\
+:type tv: tvector				\n\
+:param x: value					\n\
+:type x: integer for integer tvectors or a number, ``C/float`` or ``C/double``	\n\
+:rtype: bitset					\n\
+")
+{
+    IDIO_ASSERT (tv);
+    IDIO_ASSERT (x);
+
+    /*
+     * Test Case: tvector-errors/tvector-lt-bad-type.idio
+     *
+     * tvector-lt #t 1
+     */
+    IDIO_USER_TYPE_ASSERT (tvector, tv);
+
+    return idio_tvector_compare (tv, x, IDIO_TVECTOR_COMPARE_LT, "tvector-lt");
+}
+
+IDIO_DEFINE_PRIMITIVE2_DS ("tvector-le", tvector_le, (IDIO tv, IDIO x), "tv x", "\
+return a bitset of the elements of tvector `tv`	\n\
+less than or equal to `x`			\n\
+						\n\
+:param tv: tvector				\n\
+:type tv: tvector				\n\
+:param x: value					\n\
+:type x: integer for integer tvectors or a number, ``C/float`` or ``C/double``	\n\
+:rtype: bitset					\n\
+")
+{
+    IDIO_ASSERT (tv);
+    IDIO_ASSERT (x);
+
+    /*
+     * Test Case: tvector-errors/tvector-le-bad-type.idio
+     *
+     * tvector-le #t 1
+     */
+    IDIO_USER_TYPE_ASSERT (tvector, tv);
+
+    return idio_tvector_compare (tv, x, IDIO_TVECTOR_COMPARE_LE, "tvector-le");
+}
+
+IDIO_DEFINE_PRIMITIVE2_DS ("tvector-eq", tvector_eq, (IDIO tv, IDIO x), "tv x", "\
+return a bitset of the elements of tvector `tv`	\n\
+equal to `x`					\n\
+						\n\
+:param tv: tvector				\n\
+:type tv: tvector				\n\
+:param x: value					\n\
+:type x: integer for integer tvectors or a number, ``C/float`` or ``C/double``	\n\
+:rtype: bitset					\n\
+")
+{
+    IDIO_ASSERT (tv);
+    IDIO_ASSERT (x);
+
+    /*
+     * Test Case: tvector-errors/tvector-eq-bad-type.idio
+     *
+     * tvector-eq #t 1
+     */
+    IDIO_USER_TYPE_ASSERT (tvector, tv);
+
+    return idio_tvector_compare (tv, x, IDIO_TVECTOR_COMPARE_EQ, "tvector-eq");
+}
+
+IDIO_DEFINE_PRIMITIVE2_DS ("tvector-ge", tvector_ge, (IDIO tv, IDIO x), "tv x", "\
+return a bitset of the elements of tvector `tv`	\n\
+greater than or equal to `x`			\n\
+						\n\
+:param tv: tvector				\n\
+:type tv: tvector				\n\
+:param x: value					\n\
+:type x: integer for integer tvectors or a number, ``C/float`` or ``C/double``	\n\
+:rtype: bitset					\n\
+")
+{
+    IDIO_ASSERT (tv);
+    IDIO_ASSERT (x);
+
+    /*
+     * Test Case: tvector-errors/tvector-ge-bad-type.idio
+     *
+     * tvector-ge #t 1
+     */
+    IDIO_USER_TYPE_ASSERT (tvector, tv);
+
+    return idio_tvector_compare (tv, x, IDIO_TVECTOR_COMPARE_GE, "tvector-ge");
+}
+
+IDIO_DEFINE_PRIMITIVE2_DS ("tvector-gt", tvector_gt, (IDIO tv, IDIO x), "tv x", "\
+return a bitset of the elements of tvector `tv`	\n\
+greater than `x`				\n\
+						\n\
+:param tv: tvector				\n\
+:type tv: tvector				\n\
+:param x: value					\n\
+:type x: integer for integer tvectors or a number, ``C/float`` or ``C/double``	\n\
+:rtype: bitset					\n\
+")
+{
+    IDIO_ASSERT (tv);
+    IDIO_ASSERT (x);
+
+    /*
+     * Test Case: tvector-errors/tvector-gt-bad-type.idio
+     *
+     * tvector-gt #t 1
+     */
+    IDIO_USER_TYPE_ASSERT (tvector, tv);
+
+    return idio_tvector_compare (tv, x, IDIO_TVECTOR_COMPARE_GT, "tvector-gt");
+}
+
+#define IDIO_TVECTOR_HISTOGRAM(T)					\
+    {									\
+	T const * restrict a = (T const *) IDIO_TVECTOR_DATA (tv);	\
+	for (i = 0; i < len; i++) {					\
+	    double x = a[i];						\
+	    if (x >= C_lo && x < C_hi) {				\
+		size_t bin = (x - C_lo) * scale;			\
+		if (bin >= nbins) {					\
+		    bin = nbins - 1;					\
+		}							\
+		counts[bin]++;						\
+	    } else if (x == C_hi) {					\
+		counts[nbins - 1]++;					\
+	    }								\
+	}								\
+    }
+
+IDIO_DEFINE_PRIMITIVE4_DS ("tvector-histogram", tvector_histogram, (IDIO tv, IDIO lo, IDIO hi, IDIO n), "tv lo hi n", "\
+return an s64 tvector of the counts of the	\n\
+elements of tvector `tv` in each of `n` equal	\n\
+width bins from `lo` to `hi`			\n\
+						\n\
+:param tv: tvector				\n\
+:type tv: tvector				\n\
+:param lo: lower bound of the first bin		\n\
+:type lo: number				\n\
+:param hi: upper bound of the last bin		\n\
+:type hi: number				\n\
+:param n: number of bins			\n\
+:type n: positive integer			\n\
+:rtype: tvector					\n\
+						\n\
+Each bin includes its lower bound.  The last bin	\n\
+also includes `hi`.  Elements outside of `lo` to	\n\
+`hi` are not counted.				\n\
+")
+{
+    IDIO_ASSERT (tv);
+    IDIO_ASSERT (lo);
+    IDIO_ASSERT (hi);
+    IDIO_ASSERT (n);
+
+    /*
+     * Test Case: tvector-errors/tvector-histogram-bad-type.idio
+     *
+     * tvector-histogram #t 0 1 1
+     */
+    IDIO_USER_TYPE_ASSERT (tvector, tv);
+
+    double C_lo = idio_tvector_double_value (lo, "tvector-histogram", "lo");
+    double C_hi = idio_tvector_double_value (hi, "tvector-histogram", "hi");
+
+    if (! (C_lo < C_hi)) {
+	/*
+	 * Test Case: tvector-errors/tvector-histogram-bad-range.idio
+	 *
+	 * tvector-histogram (make-tvector 'u8 1) 1 0 1
+	 */
+	idio_error_param_value_msg ("tvector-histogram", "hi", hi, "should be greater than lo", IDIO_C_FUNC_LOCATION ());
+
+	return idio_S_notreached;
+    }
+
+    ptrdiff_t C_n = idio_tvector_C_index (n);
+    if (C_n < 1) {
+	/*
+	 * Test Case: tvector-errors/tvector-histogram-bad-n.idio
+	 *
+	 * tvector-histogram (make-tvector 'u8 1) 0 1 0
+	 */
+	idio_error_param_value_msg ("tvector-histogram", "n", n, "should be a positive integer", IDIO_C_FUNC_LOCATION ());
+
+	return idio_S_notreached;
+    }
+
+    if (idio_tvector_len_overflows (IDIO_TVECTOR_KIND_S64, C_n)) {
+	/*
+	 * Test Case: tvector-errors/tvector-histogram-too-large.idio
+	 *
+	 * tvector-histogram (make-tvector 'u8 1) 0 1 4611686018427387904
+	 */
+	idio_error_param_value_msg ("tvector-histogram", "n", n, "too large for the element type", IDIO_C_FUNC_LOCATION ());
+
+	return idio_S_notreached;
+    }
+
+    size_t nbins = C_n;
+    IDIO r = idio_tvector (IDIO_TVECTOR_KIND_S64, nbins);
+    int64_t * restrict counts = IDIO_TVECTOR_S64 (r);
+
+    double const scale = nbins / (C_hi - C_lo);
+    size_t len = IDIO_TVECTOR_LEN (tv);
+    size_t i;
+
+    switch (IDIO_TVECTOR_KIND (tv)) {
+    case IDIO_TVECTOR_KIND_U8:	IDIO_TVECTOR_HISTOGRAM (uint8_t);	break;
+    case IDIO_TVECTOR_KIND_S32:	IDIO_TVECTOR_HISTOGRAM (int32_t);	break;
+    case IDIO_TVECTOR_KIND_S64:	IDIO_TVECTOR_HISTOGRAM (int64_t);	break;
+    case IDIO_TVECTOR_KIND_F32:	IDIO_TVECTOR_HISTOGRAM (float);		break;
+    case IDIO_TVECTOR_KIND_F64:	IDIO_TVECTOR_HISTOGRAM (double);	break;
+    }
+
+    return r;
+}
+
+char *idio_tvector_report_string (IDIO v, size_t *sizep, idio_unicode_t format, IDIO seen, int depth)
+{
+    IDIO_ASSERT (v);
+    IDIO_ASSERT (seen);
+
+    IDIO_TYPE_ASSERT (tvector, v);
+
+    char *r = NULL;
+
+    *sizep = idio_asprintf (&r, "#<TVECTOR %s /%zu>", idio_tvector_kind_names[IDIO_TVECTOR_KIND (v)], IDIO_TVECTOR_LEN (v));
+
+    return r;
+}
+
+char *idio_tvector_as_C_string (IDIO v, size_t *sizep, idio_unicode_t format, IDIO seen, int depth)
+{
+    IDIO_ASSERT (v);
+    IDIO_ASSERT (seen);
+
+    IDIO_TYPE_ASSERT (tvector, v);
+
+    char *r = NULL;
+
+    *sizep = idio_asprintf (&r, "#<TVECTOR %s", idio_tvector_kind_names[IDIO_TVECTOR_KIND (v)]);
+
+    size_t len = IDIO_TVECTOR_LEN (v);
+    size_t i;
+    for (i = 0; i < len; i++) {
+	char *es;
+	size_t es_size = 0;
+
+	switch (IDIO_TVECTOR_KIND (v)) {
+	case IDIO_TVECTOR_KIND_U8:
+	    es_size = idio_asprintf (&es, " %" PRIu8, IDIO_TVECTOR_U8 (v)[i]);
+	    break;
+	case IDIO_TVECTOR_KIND_S32:
+	    es_size = idio_asprintf (&es, " %" PRId32, IDIO_TVECTOR_S32 (v)[i]);
+	    break;
+	case IDIO_TVECTOR_KIND_S64:
+	    es_size = idio_asprintf (&es, " %" PRId64, IDIO_TVECTOR_S64 (v)[i]);
+	    break;
+	case IDIO_TVECTOR_KIND_F32:
+	    es_size = idio_asprintf (&es, " %g", IDIO_TVECTOR_F32 (v)[i]);
+	    break;
+	case IDIO_TVECTOR_KIND_F64:
+	    es_size = idio_asprintf (&es, " %g", IDIO_TVECTOR_F64 (v)[i]);
+	    break;
+	}
+
+	IDIO_STRCAT_FREE (r, sizep, es, es_size);
+    }
+    IDIO_STRCAT (r, sizep, ">");
+
+    return r;
+}
+
+IDIO idio_tvector_method_2string (idio_vtable_method_t *m, IDIO v, ...)
+{
+    IDIO_C_ASSERT (m);
+    IDIO_ASSERT (v);
+
+    va_list ap;
+    va_start (ap, v);
+    size_t *sizep = va_arg (ap, size_t *);
+    va_end (ap);
+
+    char *C_r = idio_tvector_as_C_string (v, sizep, 0, idio_S_nil, 0);
+
+    IDIO r = idio_string_C_len (C_r, *sizep);
+
+    IDIO_GC_FREE (C_r, *sizep);
+
+    return r;
+}
+
+void idio_tvector_add_primitives ()
+{
+    IDIO_ADD_PRIMITIVE (tvector_p);
+    IDIO_ADD_PRIMITIVE (make_tvector);
+    IDIO_ADD_PRIMITIVE (tvector_type);
+    IDIO_ADD_PRIMITIVE (tvector_length);
+
+    idio_vtable_t *tv_vt = idio_vtable (IDIO_TYPE_TVECTOR);
+
+    IDIO ref = IDIO_ADD_PRIMITIVE (tvector_ref);
+    idio_vtable_add_method (tv_vt,
+			    idio_S_value_index,
+			    idio_vtable_create_method_value (idio_util_method_value_index,
+							     idio_vm_default_values_ref (IDIO_FIXNUM_VAL (ref))));
+
+    IDIO set = IDIO_ADD_PRIMITIVE (tvector_set);
+    idio_vtable_add_method (tv_vt,
+			    idio_S_set_value_index,
+			    idio_vtable_create_method_value (idio_util_method_set_value_index,
+							     idio_vm_default_values_ref (IDIO_FIXNUM_VAL (set))));
+
+    IDIO_ADD_PRIMITIVE (tvector_fill);
+    IDIO_ADD_PRIMITIVE (tvector_slice);
+    IDIO_ADD_PRIMITIVE (tvector_copy);
+    IDIO_ADD_PRIMITIVE (tvector2array);
+    IDIO_ADD_PRIMITIVE (array2tvector);
+    IDIO_ADD_PRIMITIVE (tvector2octet_string);
+    IDIO_ADD_PRIMITIVE (octet_string2tvector);
+    IDIO_ADD_PRIMITIVE (tvector_sum);
+    IDIO_ADD_PRIMITIVE (tvector_mean);
+    IDIO_ADD_PRIMITIVE (tvector_min);
+    IDIO_ADD_PRIMITIVE (tvector_max);
+    IDIO_ADD_PRIMITIVE (tvector_dot);
+    IDIO_ADD_PRIMITIVE (tvector_add);
+    IDIO_ADD_PRIMITIVE (tvector_multiply);
+    IDIO_ADD_PRIMITIVE (tvector_scale);
+    IDIO_ADD_PRIMITIVE (tvector_lt);
+    IDIO_ADD_PRIMITIVE (tvector_le);
+    IDIO_ADD_PRIMITIVE (tvector_eq);
+    IDIO_ADD_PRIMITIVE (tvector_ge);
+    IDIO_ADD_PRIMITIVE (tvector_gt);
+    IDIO_ADD_PRIMITIVE (tvector_histogram);
+}
+
+void idio_init_tvector ()
+{
+    idio_module_table_register (idio_tvector_add_primitives, NULL, NULL);
+
+    idio_vtable_t *tv_vt = idio_vtable (IDIO_TYPE_TVECTOR);
+
+    idio_vtable_add_method (tv_vt,
+			    idio_S_typename,
+			    idio_vtable_create_method_value (idio_util_method_typename,
+							     idio_S_tvector));
+
+    idio_vtable_add_method (tv_vt,
+			    idio_S_2string,
+			    idio_vtable_create_method_simple (idio_tvector_method_2string));
+}
+
+/* Local Variables: */
+/* mode: C */
+/* coding: utf-8-unix */
+/* End: */
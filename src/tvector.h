@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2020-2022 Ian Fitchet <idf(at)idio-lang.org>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License.  You
+ * may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/*
+ * tvector.h
+ *
+ */
+
+#ifndef TVECTOR_H
+#define TVECTOR_H
+
+IDIO idio_tvector (int kind, size_t len);
+int idio_isa_tvector (IDIO o);
+void idio_free_tvector (IDIO tv);
+IDIO idio_copy_tvector (IDIO tv);
+
+size_t idio_tvector_kind_width (int kind);
+IDIO idio_tvector_kind_symbol (int kind);
+IDIO idio_tvector_ref_C (IDIO tv, size_t i);
+void idio_tvector_set_C (IDIO tv, size_t i, IDIO v, char const *func);
+int idio_tvector_equal (IDIO tv1, IDIO tv2);
+idio_hi_t idio_tvector_hash_C (IDIO tv);
+
+char *idio_tvector_report_string (IDIO v, size_t *sizep, idio_unicode_t format, IDIO seen, int depth);
+char *idio_tvector_as_C_string (IDIO v, size_t *sizep, idio_unicode_t format, IDIO seen, int depth);
+
+void idio_init_tvector ();
+
+#endif
+
+/* Local Variables: */
+/* mode: C */
+/* coding: utf-8-unix */
+/* End: */
@@ -620,10 +620,10 @@ idio_hi_t idio_unicode_C_hash (IDIO h, const void *s)
     size_t hvalue = (uintptr_t) s;
 
     if (idio_S_nil != s) {
-	hvalue = idio_hash_default_hash_C_string_C_MurmurOAAT_32 (s);
+	hvalue = idio_hash_default_hash_C_string_C (strlen (s), s);
     }
 
-    return (hvalue & IDIO_HASH_MASK (h));
+    return hvalue;
 }
 
 IDIO idio_unicode_C_intern (char const *s, size_t const blen, IDIO v)
@@ -47,6 +47,7 @@
 #include "array.h"
 #include "bignum.h"
 #include "bitset.h"
+#include "bytevector.h"
 #include "c-type.h"
 #include "closure.h"
 #include "codegen.h"
@@ -62,13 +63,16 @@
 #include "keyword.h"
 #include "module.h"
 #include "object.h"
+#include "omap.h"
 #include "pair.h"
 #include "path.h"
+#include "pmap.h"
 #include "primitive.h"
 #include "read.h"
 #include "struct.h"
 #include "symbol.h"
 #include "thread.h"
+#include "tvector.h"
 #include "unicode.h"
 #include "util.h"
 #include "vm.h"
@@ -197,6 +201,10 @@ char const *idio_type_enum2string (idio_type_e type)
     case IDIO_TYPE_THREAD:		return "THREAD";
     case IDIO_TYPE_CONTINUATION:	return "CONTINUATION";
     case IDIO_TYPE_BITSET:		return "bitset";
+    case IDIO_TYPE_PMAP:		return "pmap";
+    case IDIO_TYPE_OMAP:		return "omap";
+    case IDIO_TYPE_TVECTOR:		return "tvector";
+    case IDIO_TYPE_BYTEVECTOR:		return "bytevector";
 
     case IDIO_TYPE_C_CHAR:		return "C/char";
     case IDIO_TYPE_C_SCHAR:		return "C/schar";
@@ -1164,6 +1172,34 @@ int idio_equal (IDIO o1, IDIO o2, idio_equal_enum eqp)
 #endif
 		return idio_equal_bitsetp (IDIO_LIST2 (o1, o2));
 		break;
+	    case IDIO_TYPE_PMAP:
+		if (IDIO_EQUAL_EQP == eqp ||
+		    IDIO_EQUAL_EQVP == eqp) {
+		    return (o1 == o2);
+		}
+
+		return idio_pmap_equal (o1, o2, eqp);
+	    case IDIO_TYPE_OMAP:
+		if (IDIO_EQUAL_EQP == eqp ||
+		    IDIO_EQUAL_EQVP == eqp) {
+		    return (o1 == o2);
+		}
+
+		return idio_omap_equal (o1, o2, eqp);
+	    case IDIO_TYPE_TVECTOR:
+		if (IDIO_EQUAL_EQP == eqp ||
+		    IDIO_EQUAL_EQVP == eqp) {
+		    return (o1 == o2);
+		}
+
+		return idio_tvector_equal (o1, o2);
+	    case IDIO_TYPE_BYTEVECTOR:
+		if (IDIO_EQUAL_EQP == eqp ||
+		    IDIO_EQUAL_EQVP == eqp) {
+		    return (o1 == o2);
+		}
+
+		return idio_bytevector_equal (o1, o2);
 	    default:
 		/*
 		 * Test Case: ??
@@ -1460,6 +1496,18 @@ char *idio_as_string (IDIO o, size_t *sizep, int depth, IDIO seen, int first)
 	    case IDIO_TYPE_BITSET:
 		r = idio_bitset_as_C_string (o, sizep, format, seen, depth);
 		break;
+	    case IDIO_TYPE_PMAP:
+		r = idio_pmap_as_C_string (o, sizep, format, seen, depth);
+		break;
+	    case IDIO_TYPE_OMAP:
+		r = idio_omap_as_C_string (o, sizep, format, seen, depth);
+		break;
+	    case IDIO_TYPE_TVECTOR:
+		r = idio_tvector_as_C_string (o, sizep, format, seen, depth);
+		break;
+	    case IDIO_TYPE_BYTEVECTOR:
+		r = idio_bytevector_as_C_string (o, sizep, format, seen, depth);
+		break;
 	    default:
 		{
 		    fprintf (stderr, "idio_as_string: unexpected type %d\n", type);
@@ -1779,6 +1827,18 @@ char *idio_report_string (IDIO o, size_t *sizep, int depth, IDIO seen, int first
 	    case IDIO_TYPE_BITSET:
 		r = idio_bitset_report_string (o, sizep, format, seen, depth);
 		break;
+	    case IDIO_TYPE_PMAP:
+		r = idio_pmap_report_string (o, sizep, format, seen, depth);
+		break;
+	    case IDIO_TYPE_OMAP:
+		r = idio_omap_report_string (o, sizep, format, seen, depth);
+		break;
+	    case IDIO_TYPE_TVECTOR:
+		r = idio_tvector_report_string (o, sizep, format, seen, depth);
+		break;
+	    case IDIO_TYPE_BYTEVECTOR:
+		r = idio_bytevector_report_string (o, sizep, format, seen, depth);
+		break;
 	    default:
 		{
 		    fprintf (stderr, "idio_as_string: unexpected type %d\n", type);
@@ -2249,6 +2309,17 @@ IDIO idio_copy (IDIO o, int depth)
 		return idio_bignum_copy (o);
 	    case IDIO_TYPE_BITSET:
 		return idio_copy_bitset (o);
+	    case IDIO_TYPE_PMAP:
+		/*
+		 * pmaps are immutable
+		 */
+		return o;
+	    case IDIO_TYPE_OMAP:
+		return idio_copy_omap (o, depth);
+	    case IDIO_TYPE_TVECTOR:
+		return idio_copy_tvector (o);
+	    case IDIO_TYPE_BYTEVECTOR:
+		return idio_copy_bytevector (o);
 
 	    case IDIO_TYPE_STRUCT_INSTANCE:
 		if (idio_isa_instance (o)) {
@@ -2417,12 +2488,12 @@ void idio_dump (IDIO o, int detail)
 	    switch (o->type) {
 	    case IDIO_TYPE_STRING:
 		if (detail) {
-		    fprintf (stderr, "len=%4zu blen=%4zu fl=%x s=", IDIO_STRING_LEN (o), IDIO_STRING_BLEN (o), IDIO_STRING_FLAGS (o));
+		    fprintf (stderr, "len=%4" PRIu32 " blen=%4" PRIu32 " fl=%x s=", IDIO_STRING_LEN (o), IDIO_STRING_BLEN (o), IDIO_STRING_FLAGS (o));
 		}
 		break;
 	    case IDIO_TYPE_SUBSTRING:
 		if (detail) {
-		    fprintf (stderr, "len=%4zu parent=%10p subs=", IDIO_SUBSTRING_LEN (o), IDIO_SUBSTRING_PARENT (o));
+		    fprintf (stderr, "len=%4" PRIu32 " parent=%10p subs=", IDIO_SUBSTRING_LEN (o), IDIO_SUBSTRING_PARENT (o));
 		}
 		break;
 	    case IDIO_TYPE_SYMBOL:
@@ -2477,42 +2548,40 @@ void idio_dump (IDIO o, int detail)
 		    }
 		    fprintf (stderr, "\n");
 		    if (detail > 1) {
+			idio_hash_migrate_all (o);
+
 			size_t i;
 			for (i = 0; i < IDIO_HASH_SIZE (o); i++) {
-			    idio_hash_entry_t *he = IDIO_HASH_HA (o, i);
-			    for (; NULL != he; he = IDIO_HASH_HE_NEXT (he)) {
-				if (idio_S_nil == IDIO_HASH_HE_KEY (he)) {
-				    continue;
+			    idio_hash_entry_t *he = IDIO_HASH_HE (o, i);
+			    if (IDIO_HASH_HE_LIVE_P (he)) {
+				size_t size = 0;
+				char *s;
+				if (IDIO_HASH_FLAGS (o) & IDIO_HASH_FLAG_STRING_KEYS) {
+				    s = (char *) IDIO_HASH_HE_KEY (he);
 				} else {
-				    size_t size = 0;
-				    char *s;
-				    if (IDIO_HASH_FLAGS (o) & IDIO_HASH_FLAG_STRING_KEYS) {
-					s = (char *) IDIO_HASH_HE_KEY (he);
-				    } else {
-					s = idio_as_string_safe (IDIO_HASH_HE_KEY (he), &size, 4, 1);
-				    }
-				    if (detail & 0x4) {
-					fprintf (stderr, "\t%30s : ", s);
-				    } else {
-					fprintf (stderr, "\t%3zu: k=%10p v=%10p %10s : ",
-						 i,
-						 IDIO_HASH_HE_KEY (he),
-						 IDIO_HASH_HE_VALUE (he),
-						 s);
-				    }
-				    if (! (IDIO_HASH_FLAGS (o) & IDIO_HASH_FLAG_STRING_KEYS)) {
-					idio_gc_free (s, size);
-				    }
-				    if (IDIO_HASH_HE_VALUE (he)) {
-					size = 0;
-					s = idio_as_string_safe (IDIO_HASH_HE_VALUE (he), &size, 4, 1);
-				    } else {
-					size = idio_asprintf (&s, "-");
-				    }
-				    fprintf (stderr, "%-10s\n", s);
-
+				    s = idio_as_string_safe (IDIO_HASH_HE_KEY (he), &size, 4, 1);
+				}
+				if (detail & 0x4) {
+				    fprintf (stderr, "\t%30s : ", s);
+				} else {
+				    fprintf (stderr, "\t%3zu: k=%10p v=%10p %10s : ",
+					     i,
+					     IDIO_HASH_HE_KEY (he),
+					     IDIO_HASH_HE_VALUE (he),
+					     s);
+				}
+				if (! (IDIO_HASH_FLAGS (o) & IDIO_HASH_FLAG_STRING_KEYS)) {
 				    idio_gc_free (s, size);
 				}
+				if (IDIO_HASH_HE_VALUE (he)) {
+				    size = 0;
+				    s = idio_as_string_safe (IDIO_HASH_HE_VALUE (he), &size, 4, 1);
+				} else {
+				    size = idio_asprintf (&s, "-");
+				}
+				fprintf (stderr, "%-10s\n", s);
+
+				idio_gc_free (s, size);
 			    }
 			}
 		    }
@@ -2529,6 +2598,10 @@ void idio_dump (IDIO o, int detail)
 	    case IDIO_TYPE_THREAD:
 	    case IDIO_TYPE_CONTINUATION:
 	    case IDIO_TYPE_BITSET:
+	    case IDIO_TYPE_PMAP:
+	    case IDIO_TYPE_OMAP:
+	    case IDIO_TYPE_TVECTOR:
+	    case IDIO_TYPE_BYTEVECTOR:
 	    case IDIO_TYPE_C_CHAR:
 	    case IDIO_TYPE_C_SCHAR:
 	    case IDIO_TYPE_C_UCHAR:
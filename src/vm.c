@@ -1793,6 +1793,69 @@ static void idio_vm_invoke (IDIO thr, IDIO func, idio_vm_invoke_enum tailp)
     }
 }
 
+/*
+ * idio_vm_invoke_C_enter() and idio_vm_invoke_C_leave() bracket a
+ * call from C into Idio by stashing the current XI/PC and preserving
+ * *everything* else.
+ */
+static void idio_vm_invoke_C_enter (IDIO thr)
+{
+    IDIO_ASSERT (thr);
+
+    idio_xi_t xi0 = IDIO_THREAD_XI (thr);
+    idio_pc_t pc0 = IDIO_THREAD_PC (thr);
+    IDIO_THREAD_STACK_PUSH (idio_fixnum (pc0));
+    IDIO_THREAD_STACK_PUSH (idio_fixnum (xi0));
+    IDIO_THREAD_STACK_PUSH (idio_SM_return);
+    idio_vm_preserve_all_state (thr);
+}
+
+static IDIO idio_vm_invoke_C_leave (IDIO thr)
+{
+    IDIO_ASSERT (thr);
+
+    IDIO r = IDIO_THREAD_VAL (thr);
+
+    idio_vm_restore_all_state (thr);
+    IDIO marker = IDIO_THREAD_STACK_POP ();
+    if (idio_SM_return != marker) {
+	idio_debug ("iviCt: marker: expected idio_SM_return not %s\n", marker);
+	IDIO_THREAD_STACK_PUSH (marker);
+	idio_vm_panic (thr, "iviCt: unexpected stack marker");
+    }
+    IDIO_THREAD_XI (thr) = IDIO_FIXNUM_VAL (IDIO_THREAD_STACK_POP ());
+    IDIO_THREAD_PC (thr) = IDIO_FIXNUM_VAL (IDIO_THREAD_STACK_POP ());
+
+    return r;
+}
+
+/*
+ * idio_vm_invoke_C_frame() calls func with the argument frame fr
+ */
+static void idio_vm_invoke_C_frame (IDIO thr, IDIO func, IDIO fr)
+{
+    IDIO_ASSERT (thr);
+    IDIO_ASSERT (func);
+    IDIO_ASSERT (fr);
+
+    IDIO_THREAD_VAL (thr) = fr;
+
+    idio_vm_invoke (thr, func, IDIO_VM_INVOKE_TAIL_CALL);
+
+    /*
+     * XXX
+     *
+     * If the command was a primitive then we called
+     * idio_vm_run() we'd be continuing our parent's loop.
+     *
+     * Need to figure out the whole invoke-from-C thing
+     * properly (or at least consistently).
+     */
+    if (! idio_isa_primitive (func)) {
+	idio_vm_run_C (thr, IDIO_THREAD_XI (thr), IDIO_THREAD_PC (thr));
+    }
+}
+
 /*
  * Given a command as a list, (foo bar baz), run the code
  *
@@ -1835,12 +1898,7 @@ IDIO idio_vm_invoke_C_thread (IDIO thr, IDIO command)
 	break;
     }
 
-    idio_xi_t xi0 = IDIO_THREAD_XI (thr);
-    idio_pc_t pc0 = IDIO_THREAD_PC (thr);
-    IDIO_THREAD_STACK_PUSH (idio_fixnum (pc0));
-    IDIO_THREAD_STACK_PUSH (idio_fixnum (xi0));
-    IDIO_THREAD_STACK_PUSH (idio_SM_return);
-    idio_vm_preserve_all_state (thr);
+    idio_vm_invoke_C_enter (thr);
 
     switch (command->type) {
     case IDIO_TYPE_PAIR:
@@ -1857,22 +1915,8 @@ IDIO idio_vm_invoke_C_thread (IDIO thr, IDIO command)
 		idio_frame_update (fr, 0, fai, IDIO_PAIR_H (args));
 		args = IDIO_PAIR_T (args);
 	    }
-	    IDIO_THREAD_VAL (thr) = fr;
-
-	    idio_vm_invoke (thr, IDIO_PAIR_H (command), IDIO_VM_INVOKE_TAIL_CALL);
 
-	    /*
-	     * XXX
-	     *
-	     * If the command was a primitive then we called
-	     * idio_vm_run() we'd be continuing our parent's loop.
-	     *
-	     * Need to figure out the whole invoke-from-C thing
-	     * properly (or at least consistently).
-	     */
-	    if (! idio_isa_primitive (IDIO_PAIR_H (command))) {
-		idio_vm_run_C (thr, IDIO_THREAD_XI (thr), IDIO_THREAD_PC (thr));
-	    }
+	    idio_vm_invoke_C_frame (thr, IDIO_PAIR_H (command), fr);
 	}
 	break;
     case IDIO_TYPE_CLOSURE:
@@ -1902,19 +1946,7 @@ IDIO idio_vm_invoke_C_thread (IDIO thr, IDIO command)
 	break;
     }
 
-    IDIO r = IDIO_THREAD_VAL (thr);
-
-    idio_vm_restore_all_state (thr);
-    IDIO marker = IDIO_THREAD_STACK_POP ();
-    if (idio_SM_return != marker) {
-	idio_debug ("iviCt: marker: expected idio_SM_return not %s\n", marker);
-	IDIO_THREAD_STACK_PUSH (marker);
-	idio_vm_panic (thr, "iviCt: unexpected stack marker");
-    }
-    IDIO_THREAD_XI (thr) = IDIO_FIXNUM_VAL (IDIO_THREAD_STACK_POP ());
-    IDIO_THREAD_PC (thr) = IDIO_FIXNUM_VAL (IDIO_THREAD_STACK_POP ());
-
-    return r;
+    return idio_vm_invoke_C_leave (thr);
 }
 
 IDIO idio_vm_invoke_C (IDIO command)
@@ -1924,6 +1956,35 @@ IDIO idio_vm_invoke_C (IDIO command)
     return idio_vm_invoke_C_thread (idio_thread_current_thread (), command);
 }
 
+/*
+ * idio_vm_invoke_C_argv() is idio_vm_invoke_C() for C loops that
+ * call the same func once per element, array-map etc., and fills the
+ * frame directly from argv[] rather than consing up (and walking) a
+ * command list for every call.
+ *
+ * The same GC protection WARNING applies.
+ */
+IDIO idio_vm_invoke_C_argv (IDIO func, idio_fi_t argc, IDIO *argv)
+{
+    IDIO_ASSERT (func);
+    IDIO_C_ASSERT (argc >= 0);
+
+    IDIO thr = idio_thread_current_thread ();
+
+    /*
+     * The +1 is for the varargs element as with the list form
+     */
+    IDIO fr = idio_frame_allocate (argc + 1);
+    for (idio_fi_t fai = 0; fai < argc; fai++) {
+	idio_frame_update (fr, 0, fai, argv[fai]);
+    }
+
+    idio_vm_invoke_C_enter (thr);
+    idio_vm_invoke_C_frame (thr, func, fr);
+
+    return idio_vm_invoke_C_leave (thr);
+}
+
 static idio_sp_t idio_vm_find_stack_marker (IDIO stack, IDIO mark, idio_sp_t from, idio_sp_t max)
 {
     IDIO_ASSERT (stack);
@@ -4630,6 +4691,10 @@ int idio_vm_run1 (IDIO thr)
 		    case IDIO_TYPE_HASH:
 		    case IDIO_TYPE_BIGNUM:
 		    case IDIO_TYPE_BITSET:
+		    case IDIO_TYPE_PMAP:
+		    case IDIO_TYPE_OMAP:
+		    case IDIO_TYPE_TVECTOR:
+		    case IDIO_TYPE_BYTEVECTOR:
 			IDIO_THREAD_VAL (thr) = idio_copy (c, IDIO_COPY_DEEP);
 			break;
 		    case IDIO_TYPE_STRUCT_INSTANCE:
@@ -6403,6 +6468,7 @@ IDIO idio_vm_run (IDIO thr, idio_xi_t xi, idio_pc_t pc, idio_vm_run_enum caller)
 #endif
 
     volatile int v_gc_pause = idio_gc_get_pause ("idio_vm_run");
+    idio_root_frame_t * volatile v_root_frame = idio_gc_root_frame_top ();
 
     /*
      * As sigjmp_buf is storing the registers I'm guessing it is too
@@ -6451,6 +6517,12 @@ IDIO idio_vm_run (IDIO thr, idio_xi_t xi, idio_pc_t pc, idio_vm_run_enum caller)
 	break;
     }
 
+    /*
+     * Any root frames pushed by C functions we have just siglongjmp'd
+     * out of are no longer valid
+     */
+    idio_gc_root_frame_reset (v_root_frame);
+
     /*
      * This is where the problems arise post-siglongjmp().
      */
@@ -6642,6 +6714,18 @@ IDIO idio_vm_run (IDIO thr, idio_xi_t xi, idio_pc_t pc, idio_vm_run_enum caller)
 
 	    if ((++idio_vm_run_loops & 0x3fff) == 0) {
 		idio_gc_possibly_collect ();
+
+		/*
+		 * Like a signal, the heap limit condition arrives
+		 * between instructions so we want the handler to
+		 * restore all state
+		 */
+		IDIO hlc = idio_gc_heap_limit_condition ();
+		if (idio_S_nil != hlc) {
+		    idio_vm_raise_condition (idio_S_true, hlc, 1, 0);
+
+		    return idio_S_notreached;
+		}
 	    }
 	} else {
 	    break;
@@ -8534,10 +8618,21 @@ void idio_vm_save_xenvs (idio_xi_t from)
  */
 IDIO idio_vm_source_location ()
 {
-    IDIO lsh = idio_open_output_string_handle_C ();
     IDIO cthr = idio_thread_current_thread ();
-    IDIO fsei = IDIO_THREAD_EXPR (cthr);
-    idio_xi_t xi = IDIO_THREAD_XI (cthr);
+
+    return idio_vm_src_location (IDIO_THREAD_XI (cthr), IDIO_THREAD_EXPR (cthr));
+}
+
+/*
+ * idio_vm_src_location() is the guts of idio_vm_source_location()
+ * for a source expression index recorded earlier, eg. by the
+ * allocation profiler
+ */
+IDIO idio_vm_src_location (idio_xi_t xi, IDIO fsei)
+{
+    IDIO_ASSERT (fsei);
+
+    IDIO lsh = idio_open_output_string_handle_C ();
     if (idio_isa_fixnum (fsei)) {
 	IDIO sp = idio_vm_src_props_ref (xi, IDIO_FIXNUM_VAL (fsei));
 
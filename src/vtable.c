@@ -220,8 +220,9 @@ void idio_free_vtable (idio_vtable_t *vt)
 }
 
 /*
- * idio_value_vtable() exists as the simpler types do not encapsulate
- * a vtable pointer directly.
+ * idio_value_vtable() exists as values do not encapsulate a vtable
+ * pointer directly.  Most types share the per-type vtable, struct
+ * types and C/pointers have their own.
  */
 idio_vtable_t *idio_value_vtable (IDIO o)
 {
@@ -260,7 +261,20 @@ idio_vtable_t *idio_value_vtable (IDIO o)
 	vt = idio_vtable (IDIO_TYPE_PLACEHOLDER);
 	break;
     case IDIO_TYPE_POINTER_MARK:
-	vt = o->vtable;
+	switch (o->type) {
+	case IDIO_TYPE_STRUCT_TYPE:
+	    vt = IDIO_STRUCT_TYPE_VTABLE (o);
+	    break;
+	case IDIO_TYPE_STRUCT_INSTANCE:
+	    vt = IDIO_STRUCT_TYPE_VTABLE (IDIO_STRUCT_INSTANCE_TYPE (o));
+	    break;
+	case IDIO_TYPE_C_POINTER:
+	    vt = IDIO_C_TYPE_POINTER_VTABLE (o);
+	    break;
+	default:
+	    vt = idio_vtable (o->type);
+	    break;
+	}
 	break;
     default:
 	/* inconceivable! */